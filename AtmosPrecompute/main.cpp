@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		main.cpp
+/// @brief		Galaxy-Music Engine - AtmosPrecompute
+///				ɴұйߣֻOSGͱ׼
+///				WindowsAtmosPrecompute.vcxproj룬LinuxøĿ¼CMakeLists.txt
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAtmosPrecompute.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+
+using namespace GM;
+
+/** @brief ӡ÷ */
+static void _PrintUsage()
+{
+	printf("Usage: AtmosPrecompute [-core <corePath>] [-threads <num>] [-table <all|transmittance|irradiance|inscattering>]\n");
+	printf("  -core      core resource path, default: ../../Data/Core/\n");
+	printf("  -threads   thread number, 0 = hardware threads, default: 0\n");
+	printf("  -table     table to make, default: all\n");
+}
+
+int main(int argc, char **argv)
+{
+	std::string strCorePath = "../../Data/Core/";
+	std::string strTable = "all";
+	unsigned int iThreadNum = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == strcmp(argv[i], "-core") && i + 1 < argc)
+		{
+			strCorePath = argv[++i];
+			if (!strCorePath.empty() && '/' != strCorePath.back() && '\\' != strCorePath.back())
+				strCorePath += "/";
+		}
+		else if (0 == strcmp(argv[i], "-threads") && i + 1 < argc)
+		{
+			iThreadNum = (unsigned int)(atoi(argv[++i]));
+		}
+		else if (0 == strcmp(argv[i], "-table") && i + 1 < argc)
+		{
+			strTable = argv[++i];
+		}
+		else
+		{
+			_PrintUsage();
+			return 1;
+		}
+	}
+
+	CGMAtmosPrecompute atmosPrecompute(strCorePath, iThreadNum);
+	printf("core path: %s, threads: %u\n", strCorePath.c_str(), atmosPrecompute.GetThreadNum());
+
+	// ȻصѾֱӴӡÿһűʱ
+	atmosPrecompute.SetProgress([](const std::string& strName, const int iDone, const int iTotal)
+	{
+		printf("\r%-14s %5d / %d", strName.c_str(), iDone, iTotal);
+		if (iDone == iTotal) printf("\n");
+		fflush(stdout);
+	});
+
+	const auto tStart = std::chrono::steady_clock::now();
+	bool bOK = false;
+	if ("all" == strTable)					bOK = atmosPrecompute.MakeAll();
+	else if ("transmittance" == strTable)	bOK = atmosPrecompute.MakeTransmittance();
+	else if ("irradiance" == strTable)		bOK = atmosPrecompute.MakeIrradiance();
+	else if ("inscattering" == strTable)	bOK = atmosPrecompute.MakeInscattering();
+	else
+	{
+		_PrintUsage();
+		return 1;
+	}
+	const double fSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	printf("%s, %.1f s\n", bOK ? "done" : "failed, missing input or unable to write", fSeconds);
+	return bOK ? 0 : 1;
+}
@@ -6,6 +6,8 @@ uniform mat4 osg_ViewMatrixInverse;
 uniform vec3 mouseWorldPos;
 uniform vec3 starWorldPos;
 uniform float level[128];
+uniform int levelHead;
+uniform float spectrum[32];
 
 out vec4 vertexColor;
 out float playingStar;
@@ -29,7 +31,11 @@ void main()
 #else
 	float dissipate = exp(-distanceStar*0.5);
 #endif // WELCOME or not
-	float starRipple = level[int(disRipple)]*dissipate;
+	// each star listens to one fixed band chosen by its position, so neighbouring stars pulse with different parts of the spectrum
+	int band = int(fract(sin(dot(gl_Vertex.xy, vec2(12.9898, 78.233)))*43758.5453)*32.0) & 31;
+	float bandPulse = spectrum[band];
+	bandPulse *= bandPulse*dissipate*0.5;
+	float starRipple = max(level[(levelHead + int(disRipple)) & 127]*dissipate, bandPulse);
 	playingStar = step(-0.001,-distanceStar);
 	float mouseSelect = 1 - step(1, distanceMouse*mix(2,6,exp2(-abs(WCP.z))));	
 	float ripple = min(1.0,max(mouseSelect, starRipple));
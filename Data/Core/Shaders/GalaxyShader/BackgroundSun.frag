@@ -1,6 +1,7 @@
 #version 400 compatibility
 
 uniform float level[128];
+uniform int levelHead;
 uniform float times;
 uniform float backgroundSunAlpha;
 uniform sampler2D sunNoiseTex;
@@ -12,6 +13,6 @@ void main()
 	float noise = texture2D(sunNoiseTex, vec2(atan(tanDir.y/tanDir.x)*0.1, times*0.02)).r;
 	vec2 fall = abs(gl_TexCoord[0].xy);
 	float radius = length(fall);
-	float shininess = exp2(-sqrt(max(0, radius - 0.015))*(8 - pow(noise, 1 + 9*radius) - level[0]));
+	float shininess = exp2(-sqrt(max(0, radius - 0.015))*(8 - pow(noise, 1 + 9*radius) - level[levelHead]));
 	gl_FragColor = vec4(playingStarColor.rgb*smoothstep(0.0, 0.02, shininess), backgroundSunAlpha*shininess);
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 uniform sampler2D galaxyTex;
 uniform vec3 mouseWorldPos;
 uniform float level[128];
+uniform int levelHead;
 
 in vec3 worldPos;
 in vec4 viewPos;
@@ -25,7 +26,7 @@ void main()
 	float disRipple = mod(distancStar*10.0, 128.0);
 	float starRipple = 0.05*exp(-distancStar*5.0);
 #ifdef CAPTURE	
-	starRipple = 0.02*sqrt(level[int(disRipple)])*exp(-distancStar);
+	starRipple = 0.02*sqrt(level[(levelHead + int(disRipple)) & 127])*exp(-distancStar);
 #endif // CAPTURE
 	texCoord -= starRipple*starDir;
 #endif // EDIT
@@ -4,6 +4,7 @@
 uniform vec3 starWorldPos;
 uniform vec4 playingStarColor;
 uniform float level[128];
+uniform int levelHead;
 
 out float lengthV;
 out vec4 vertexColor;
@@ -19,7 +20,7 @@ void main()
 	float distancStar = distance(gl_Vertex.xyz, starWorldPos);
 	float disRipple = mod(distancStar*10.0, 128.0);
 
-	float starRipple = level[int(disRipple)];
+	float starRipple = level[(levelHead + int(disRipple)) & 127];
 #ifdef WELCOME
 	starRipple *= exp(-distancStar*0.1);
 	vertexColor.rgb *= (1+starRipple);
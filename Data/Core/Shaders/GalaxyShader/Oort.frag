@@ -38,6 +38,7 @@ const float M_PI = 3.141592657;
 const float ALPHA_MAX = 0.99;
 
 uniform float level[128];
+uniform int levelHead;
 uniform float times;
 uniform float unit;
 uniform float pixelLength;
@@ -121,7 +122,7 @@ void Oort(commonParam cP, inout vec4 oortColor, inout float lenOort)
 			vec3 stepPolarOutDir = normalize(stepPolarPos);
 			float radiusRatio = max(1e-10, length(stepPolarPos) / OortRadius);
 			float disRipple = mod(128.0 * radiusRatio, 128.0);
-			float audioLevel = level[int(disRipple)];
+			float audioLevel = level[(levelHead + int(disRipple)) & 127];
 
 			float theta = 0.02*times + (exp2(-radiusRatio*(8-3*abs(stepPolarOutDir.z)))-1)*3;
 			float cosTheta = cos(theta);
@@ -7,6 +7,7 @@ uniform vec4 playingStarColor;
 uniform vec3 starWorldPos;
 uniform vec3 screenSize;
 uniform float level[128];
+uniform int levelHead;
 uniform float times;
 uniform sampler3D shapeNoiseTex;
 uniform sampler2D blueNoiseSampler;
@@ -53,7 +54,7 @@ void main()
 		float raidusRatio = max(1e-10,length(stepPolarPos) / radius);
 		float shapeNoise = 1-texture3D(shapeNoiseTex, (0.9-0.3*raidusRatio)*stepPolarPos/radius+0.005*times).r;
 		float disRipple = mod(128.0 * raidusRatio * (0.8+0.2*shapeNoise), 128.0);
-		float audioLevel = level[int(disRipple)];
+		float audioLevel = level[(levelHead + int(disRipple)) & 127];
 
 		vec3 cloudC = playingStarColor.rgb*playingStarColor.rgb*max(0, 2-raidusRatio);
 		cloudC = mix(cloudC, playingStarColor.gbr, sqrt(clamp((raidusRatio-0.6+0.2*shapeNoise-0.1*audioLevel), 0, 1)));
@@ -3,6 +3,7 @@
 uniform mat4 osg_ViewMatrixInverse;
 uniform vec3 shapeUVW;
 uniform vec2 cubeInfo; // x = cubeMinSize, y = targetDistance
+uniform float cubeSize; // edge length of this cube level, gl_Vertex is in the unit cube
 uniform float galaxyHeight;
 uniform sampler3D shapeNoiseTex;
 
@@ -19,12 +20,11 @@ void main()
 {
 	float cubeMinSize = cubeInfo.x;
 	float targetDistance = cubeInfo.y;
-	float cubeSize = gl_Vertex.w;
 	vertexColor = gl_Color.rgb;
 	vec3 worldFrontDir = -osg_ViewMatrixInverse[2].xyz;
 	vec3 worldEyePos = osg_ViewMatrixInverse[3].xyz;
 	float notMinCube = step(1.5*cubeMinSize, cubeSize);
-	vec4 modelPos = vec4(gl_Vertex.xyz, 1.0);
+	vec4 modelPos = vec4(gl_Vertex.xyz*cubeSize, 1.0);
 	vec3 eye2Cube = worldFrontDir*0.5*cubeSize*notMinCube;
 	vec3 worldCubePos = worldEyePos + eye2Cube;
 	modelPos.xyz += cubeSize*0.11*notMinCube;// 0.11: avoid repetition
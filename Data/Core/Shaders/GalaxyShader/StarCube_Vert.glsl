@@ -4,16 +4,16 @@ uniform mat4 osg_ViewMatrixInverse;
 uniform vec3 centerOffset;
 uniform float starDistance;
 uniform float unit;
+uniform float cubeSize; // gl_Vertex is in the unit cube
 
 out float falloff;
 out vec3 vertexColor;
 
 void main()
 {
-	float cubeSize = gl_Vertex.w;
 	vertexColor = gl_Color.rgb;
 	vec3 WCP = osg_ViewMatrixInverse[3].xyz;
-	vec4 modelPos = vec4(gl_Vertex.xyz, 1.0);
+	vec4 modelPos = vec4(gl_Vertex.xyz*cubeSize, 1.0);
 
 	vec3 distanceXYZ = modelPos.xyz-WCP*unit/1e15;
 	vec3 offset = cubeSize*fract(distanceXYZ/cubeSize);
@@ -4,6 +4,7 @@ uniform mat4 osg_ViewMatrixInverse;
 uniform vec3 starWorldPos;
 uniform vec4 playingStarColor;
 uniform float level[128];
+uniform int levelHead;
 uniform float galaxyRadius;
 uniform sampler2D galaxyTex;
 
@@ -37,7 +38,7 @@ void main()
 	float dissipate = exp(-distancStar*10.0);
 	lengthV = length((gl_ModelViewMatrix * modelPos).xyz);
 	float lenFall = clamp(4-lengthV*2*scaleR/galaxyRadius, 0, 1);
-	float starRipple = level[int(disRipple)]*dissipate;
+	float starRipple = level[(levelHead + int(disRipple)) & 127]*dissipate;
 	vertexColor.rgb = mix(vertexColor.rgb, playingStarColor.rgb, starRipple);
 	vertexColor.a *= lenFall;
 	
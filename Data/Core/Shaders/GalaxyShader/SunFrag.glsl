@@ -2,6 +2,7 @@
 
 uniform vec4 playingStarColor;
 uniform float level[128];
+uniform int levelHead;
 uniform float times;
 uniform sampler3D shapeNoiseTex;
 uniform sampler2D starTex;
@@ -43,7 +44,7 @@ void main()
 	float dotVN = max(0,dot(-viewVertDir, viewNorm));
 
 	vec2 dirtNoise = texture3D(shapeNoiseTex, noiseCoord_1*25.0).xy;
-	vec2 shapeNoise = texture3D(shapeNoiseTex, noiseCoord_2*13.0*(1-0.1*dirtNoise.y-0.05*abs(fract(times*0.1)-0.5)-0.02*level[0])).xy;
+	vec2 shapeNoise = texture3D(shapeNoiseTex, noiseCoord_2*13.0*(1-0.1*dirtNoise.y-0.05*abs(fract(times*0.1)-0.5)-0.02*level[levelHead])).xy;
 	vec3 starBaseColor = texture(starTex, gl_TexCoord[0].xy+vec2(times*0.01,0)).rgb;
 	float brightness = starBaseColor.r;
 	starBaseColor *= playingStarColor.rgb/vec3(0.710, 0.4, 0.094);
@@ -54,7 +55,7 @@ void main()
 		mix(playingStarColor.rgb,
 			mix(starBaseColor, vec3(1), 0.8),
 			mix(1-dirtNoise.x, shapeNoise.y, 2*abs(shapeNoise.x-0.5))),
-		0.2+0.8*brightness*level[int(levelCoord)]);
+		0.2+0.8*brightness*level[(levelHead + int(levelCoord)) & 127]);
 	sunColor = mix(vec3(1), sunColor, dotVN*exp2(-length(viewPos)*5));
 	gl_FragColor = vec4(sunColor,1);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #version 400 compatibility
 
 uniform float level[128];
+uniform int levelHead;
 uniform float supernovaLight;
 
 out vec2 modelPosXY;
@@ -10,7 +11,7 @@ void main()
 	vec4 modelPos = gl_Vertex;
 	vec2 signPos = sign(modelPos.xy);
 	vec2 absScale = abs(modelPos.xy*gl_Normal.xy);
-	modelPos.xy = signPos*max(vec2(2,4), absScale*supernovaLight*(1+level[0]));
+	modelPos.xy = signPos*max(vec2(2,4), absScale*supernovaLight*(1+level[levelHead]));
 	modelPosXY = gl_Vertex.xy*vec2(0.01, 0.02);
 
 	float lenXY = length(modelPosXY); 
@@ -0,0 +1,483 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAsteroidKepler.cpp
+/// @brief		Galaxy-Music Engine - GMAsteroidKepler
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAsteroidKepler.h"
+#include "GMKit.h"
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+using namespace GM;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+// MSVCֱʹAVX2úGCC/ClangҪΪָĿָ
+#ifdef _MSC_VER
+#define GM_TARGET_AVX2
+#else
+#define GM_TARGET_AVX2				__attribute__((target("avx2")))
+#endif
+
+/*************************************************************************
+constexpr
+*************************************************************************/
+constexpr double KEPLER_2PI			= 6.283185307179586476925;			// 2*PI
+constexpr float KEPLER_2_PI_INV		= 0.63661977236758134f;				// 2/PI
+// PI/2Σǰεβ㹻̣ʱûCody-Waite
+constexpr float KEPLER_PI_2_A		= 1.5703125f;
+constexpr float KEPLER_PI_2_B		= 4.837512969970703125e-4f;
+constexpr float KEPLER_PI_2_C		= 7.54978995489188216e-8f;
+// [-PI/4, PI/4]sincosĶʽϵCephes sinf/cosf
+constexpr float KEPLER_SIN_1		= -1.6666654611e-1f;
+constexpr float KEPLER_SIN_2		= 8.3321608736e-3f;
+constexpr float KEPLER_SIN_3		= -1.9515295891e-4f;
+constexpr float KEPLER_COS_1		= 4.166664568298827e-2f;
+constexpr float KEPLER_COS_2		= -1.388731625493765e-3f;
+constexpr float KEPLER_COS_3		= 2.443315711809948e-5f;
+constexpr float KEPLER_DANBY		= 0.85f;							// ֵ E = M + 0.85*e*sign(M)
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+// ·ʹͬsin/cos˳ͬԽλһ
+// ȰPI/2޺öʽ㣬|x|ڼʮʱԼ1e-7
+
+/** @brief sin/cos_mm_cvtss_si32ȡSIMD·뷽ʽͬ */
+static inline void _SinCos(const float fX, float& fSin, float& fCos)
+{
+	const int iQuad = _mm_cvtss_si32(_mm_set_ss(fX * KEPLER_2_PI_INV));
+	const float fQuad = float(iQuad);
+	const float fR = ((fX - fQuad * KEPLER_PI_2_A) - fQuad * KEPLER_PI_2_B) - fQuad * KEPLER_PI_2_C;
+	const float fZ = fR * fR;
+	const float fS = fR + fR * fZ * (KEPLER_SIN_1 + fZ * (KEPLER_SIN_2 + fZ * KEPLER_SIN_3));
+	const float fC = 1.0f - 0.5f * fZ + fZ * fZ * (KEPLER_COS_1 + fZ * (KEPLER_COS_2 + fZ * KEPLER_COS_3));
+	const bool bSwap = (iQuad & 1) != 0;
+	fSin = bSwap ? fC : fS;
+	fCos = bSwap ? fS : fC;
+	if (iQuad & 2) fSin = -fSin;
+	if ((iQuad + 1) & 2) fCos = -fCos;
+}
+
+/** @brief SSE sin/cosÿ4 */
+static inline void _SinCosSSE(const __m128 vX, __m128& vSin, __m128& vCos)
+{
+	const __m128i vQuad = _mm_cvtps_epi32(_mm_mul_ps(vX, _mm_set1_ps(KEPLER_2_PI_INV)));
+	const __m128 vFQuad = _mm_cvtepi32_ps(vQuad);
+	const __m128 vR = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(vX,
+		_mm_mul_ps(vFQuad, _mm_set1_ps(KEPLER_PI_2_A))),
+		_mm_mul_ps(vFQuad, _mm_set1_ps(KEPLER_PI_2_B))),
+		_mm_mul_ps(vFQuad, _mm_set1_ps(KEPLER_PI_2_C)));
+	const __m128 vZ = _mm_mul_ps(vR, vR);
+	const __m128 vS = _mm_add_ps(vR, _mm_mul_ps(_mm_mul_ps(vR, vZ),
+		_mm_add_ps(_mm_set1_ps(KEPLER_SIN_1), _mm_mul_ps(vZ,
+		_mm_add_ps(_mm_set1_ps(KEPLER_SIN_2), _mm_mul_ps(vZ, _mm_set1_ps(KEPLER_SIN_3)))))));
+	const __m128 vC = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), vZ)),
+		_mm_mul_ps(_mm_mul_ps(vZ, vZ),
+		_mm_add_ps(_mm_set1_ps(KEPLER_COS_1), _mm_mul_ps(vZ,
+		_mm_add_ps(_mm_set1_ps(KEPLER_COS_2), _mm_mul_ps(vZ, _mm_set1_ps(KEPLER_COS_3)))))));
+	const __m128 vSwap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(vQuad, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	const __m128 vSinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(vQuad, _mm_set1_epi32(2)), 30));
+	const __m128 vCosSign = _mm_castsi128_ps(_mm_slli_epi32(
+		_mm_and_si128(_mm_add_epi32(vQuad, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	vSin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(vSwap, vC), _mm_andnot_ps(vSwap, vS)), vSinSign);
+	vCos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(vSwap, vS), _mm_andnot_ps(vSwap, vC)), vCosSign);
+}
+
+/** @brief AVX2 sin/cosÿ8 */
+GM_TARGET_AVX2
+static inline void _SinCosAVX2(const __m256 vX, __m256& vSin, __m256& vCos)
+{
+	const __m256i vQuad = _mm256_cvtps_epi32(_mm256_mul_ps(vX, _mm256_set1_ps(KEPLER_2_PI_INV)));
+	const __m256 vFQuad = _mm256_cvtepi32_ps(vQuad);
+	const __m256 vR = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(vX,
+		_mm256_mul_ps(vFQuad, _mm256_set1_ps(KEPLER_PI_2_A))),
+		_mm256_mul_ps(vFQuad, _mm256_set1_ps(KEPLER_PI_2_B))),
+		_mm256_mul_ps(vFQuad, _mm256_set1_ps(KEPLER_PI_2_C)));
+	const __m256 vZ = _mm256_mul_ps(vR, vR);
+	const __m256 vS = _mm256_add_ps(vR, _mm256_mul_ps(_mm256_mul_ps(vR, vZ),
+		_mm256_add_ps(_mm256_set1_ps(KEPLER_SIN_1), _mm256_mul_ps(vZ,
+		_mm256_add_ps(_mm256_set1_ps(KEPLER_SIN_2), _mm256_mul_ps(vZ, _mm256_set1_ps(KEPLER_SIN_3)))))));
+	const __m256 vC = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), vZ)),
+		_mm256_mul_ps(_mm256_mul_ps(vZ, vZ),
+		_mm256_add_ps(_mm256_set1_ps(KEPLER_COS_1), _mm256_mul_ps(vZ,
+		_mm256_add_ps(_mm256_set1_ps(KEPLER_COS_2), _mm256_mul_ps(vZ, _mm256_set1_ps(KEPLER_COS_3)))))));
+	const __m256 vSwap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(vQuad, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+	const __m256 vSinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(vQuad, _mm256_set1_epi32(2)), 30));
+	const __m256 vCosSign = _mm256_castsi256_ps(_mm256_slli_epi32(
+		_mm256_and_si256(_mm256_add_epi32(vQuad, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+	vSin = _mm256_xor_ps(_mm256_blendv_ps(vS, vC, vSwap), vSinSign);
+	vCos = _mm256_xor_ps(_mm256_blendv_ps(vC, vS, vSwap), vCosSign);
+}
+
+/*************************************************************************
+CGMAsteroidKepler Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAsteroidKepler::CGMAsteroidKepler(const unsigned int iThreadNum) : m_threadPool(iThreadNum), m_iSIMD(0), m_bSecular(true)
+{
+	SetSIMD(2);
+}
+
+/** @brief  */
+CGMAsteroidKepler::~CGMAsteroidKepler()
+{
+}
+
+bool CGMAsteroidKepler::SetOrbits(const float* pState, const size_t iNum, const SGMAsteroidParam& sParam)
+{
+	if (!pState || 0 == iNum) return false;
+
+	m_fMeanAnomalyVector.resize(iNum);
+	m_fMeanMotionVector.resize(iNum);
+	m_fPeriVector.resize(iNum);
+	m_fPeriRateVector.resize(iNum);
+	m_fSemiMajorVector.resize(iNum);
+	m_fEccVector.resize(iNum);
+	m_fSemiMinorVector.resize(iNum);
+	m_fAngularSpeedVector.resize(iNum);
+
+	const double fGMSun = sParam.vGravity.x();
+	const double fMassRatio = double(sParam.vGravity.y()) / fGMSun;
+	const double fJupiterR = sParam.vJupiter.x();
+	const int iBlockNum = int((iNum + GM_ASTEROID_BLOCK - 1) / GM_ASTEROID_BLOCK);
+	m_threadPool.ParallelFor(0, iBlockNum, [&](int b)
+	{
+		const size_t iEnd = (std::min)(iNum, size_t(b + 1) * GM_ASTEROID_BLOCK);
+		for (size_t i = size_t(b) * GM_ASTEROID_BLOCK; i < iEnd; i++)
+		{
+			double fX = pState[4 * i];
+			double fY = pState[4 * i + 1];
+			double fVX = pState[4 * i + 2];
+			double fVY = pState[4 * i + 3];
+			double fR = std::sqrt(fX * fX + fY * fY);
+			// ݣNaN̫ϣŵľǹ
+			if (!(fR > 0.0) || !std::isfinite(fR + fVX + fVY))
+			{
+				fX = fJupiterR;
+				fY = 0.0;
+				fR = fJupiterR;
+				fVX = 0.0;
+				fVY = std::sqrt(fGMSun / fJupiterR);
+			}
+
+			const double fV2 = fVX * fVX + fVY * fVY;
+			// Ƕķйڹƽڵyȡ
+			const double fSign = (fX * fVY - fY * fVX < 0.0) ? -1.0 : 1.0;
+			const double fEnergy = 0.5 * fV2 - fGMSun / fR;
+			double fA = (fEnergy < 0.0) ? (-0.5 * fGMSun / fEnergy) : 0.0;
+			// ƫʸָյ
+			const double fRV = fX * fVX + fY * fVY;
+			const double fEccX = ((fV2 - fGMSun / fR) * fX - fRV * fVX) / fGMSun;
+			const double fEccY = ((fV2 - fGMSun / fR) * fY - fRV * fVY) / fGMSun;
+			double fEcc = std::sqrt(fEccX * fEccX + fEccY * fEccY);
+			double fPeri = 0.0;
+			double fMean = 0.0;
+			if (fEnergy >= 0.0 || fEcc > GM_KEPLER_ECC_MAX)
+			{
+				// ݻ̫Ĺɵǰ뾶Բλò
+				fA = fR;
+				fEcc = 0.0;
+				fMean = std::atan2(fSign * fY, fX);
+			}
+			else
+			{
+				fPeri = std::atan2(fEccY, fEccX);
+				// תյϵx' = a*(cosE - e)y' = b*sinE
+				const double fCosPeri = std::cos(fPeri);
+				const double fSinPeri = std::sin(fPeri);
+				const double fPX = fCosPeri * fX + fSinPeri * fY;
+				const double fPY = -fSinPeri * fX + fCosPeri * fY;
+				const double fE = std::atan2(fPY / (fSign * std::sqrt(1.0 - fEcc * fEcc)), fPX + fA * fEcc);
+				fMean = fE - fEcc * std::sin(fE);
+			}
+			const double fMeanMotion = std::sqrt(fGMSun / (fA * fA * fA));
+
+			// 㶯ľǹΪԲʱûƫʣֻʣյƵA
+			// ڲࣺA = n/4 * (m'/M) * alpha^2 * b(alpha)alpha = a/a'
+			// ࣺA = n/4 * (m'/M) * alpha * b(alpha)alpha = a'/a
+			// йۣ
+			double fPeriRate = 0.0;
+			if (fSign > 0.0)
+			{
+				if (fA < fJupiterR)
+				{
+					const double fAlpha = (std::min)(fA / fJupiterR, GM_KEPLER_ALPHA_MAX);
+					fPeriRate = 0.25 * fMeanMotion * fMassRatio * fAlpha * fAlpha * _LaplaceCoefficient(fAlpha);
+				}
+				else
+				{
+					const double fAlpha = (std::min)(fJupiterR / fA, GM_KEPLER_ALPHA_MAX);
+					fPeriRate = 0.25 * fMeanMotion * fMassRatio * fAlpha * _LaplaceCoefficient(fAlpha);
+				}
+			}
+
+			m_fMeanAnomalyVector[i] = fMean;
+			m_fMeanMotionVector[i] = fMeanMotion;
+			m_fPeriVector[i] = fPeri;
+			m_fPeriRateVector[i] = fPeriRate;
+			m_fSemiMajorVector[i] = float(fA);
+			m_fEccVector[i] = float(fEcc);
+			m_fSemiMinorVector[i] = float(fSign * fA * std::sqrt(1.0 - fEcc * fEcc));
+			m_fAngularSpeedVector[i] = float(fMeanMotion);
+		}
+	});
+	return true;
+}
+
+bool CGMAsteroidKepler::SetOrbits(const osg::Image* pState, const SGMAsteroidParam& sParam)
+{
+	if (!pState || !pState->data()) return false;
+	if (GL_RGBA != pState->getPixelFormat() || GL_FLOAT != pState->getDataType()) return false;
+
+	return SetOrbits((const float*)(pState->data()), size_t(pState->s()) * pState->t() * pState->r(), sParam);
+}
+
+bool CGMAsteroidKepler::Evaluate(const double fTime, float* pTarget)
+{
+	const size_t iNum = GetNum();
+	if (!pTarget || 0 == iNum) return false;
+
+	const int iBlockNum = int((iNum + GM_ASTEROID_BLOCK - 1) / GM_ASTEROID_BLOCK);
+	m_threadPool.ParallelFor(0, iBlockNum, [&](int b)
+	{
+		const size_t iEnd = (std::min)(iNum, size_t(b + 1) * GM_ASTEROID_BLOCK);
+		for (size_t i = size_t(b) * GM_ASTEROID_BLOCK; i < iEnd; i += GM_ASTEROID_GROUP)
+		{
+			_EvaluateBlock(fTime, i, (std::min)(size_t(GM_ASTEROID_GROUP), iEnd - i), pTarget + 4 * i);
+		}
+	});
+	return true;
+}
+
+bool CGMAsteroidKepler::Evaluate(const double fTime, osg::Image* pTarget)
+{
+	if (!pTarget || !pTarget->data()) return false;
+	if (GL_RGBA != pTarget->getPixelFormat() || GL_FLOAT != pTarget->getDataType()) return false;
+	if (size_t(pTarget->s()) * pTarget->t() * pTarget->r() != GetNum()) return false;
+
+	return Evaluate(fTime, (float*)(pTarget->data()));
+}
+
+float CGMAsteroidKepler::SolveKepler(const float fMeanAnomaly, const float fEcc)
+{
+	// Danbyĳֵƫʽӽ1ʱҲ̶֮Halley
+	float fE = fMeanAnomaly + std::copysign(KEPLER_DANBY * fEcc, fMeanAnomaly);
+	for (int k = 0; k < GM_KEPLER_ITERATION; k++)
+	{
+		float fSinE, fCosE;
+		_SinCos(fE, fSinE, fCosE);
+		const float fF = (fE - fEcc * fSinE) - fMeanAnomaly;
+		const float fDF = 1.0f - fEcc * fCosE;
+		const float fDDF = fEcc * fSinE;
+		fE = fE - fF / (fDF - 0.5f * fF * fDDF / fDF);
+	}
+	return fE;
+}
+
+void CGMAsteroidKepler::SetSIMD(const int iLevel)
+{
+	m_iSIMD = (iLevel < 0) ? 0 : ((iLevel > 2) ? 2 : iLevel);
+	if (2 == m_iSIMD && !CGMKit::HasAVX2()) m_iSIMD = 1;
+}
+
+void CGMAsteroidKepler::_EvaluateBlock(const double fTime, const size_t iFirst, const size_t iNum, float* pTarget) const
+{
+	// Ƕʱdouble¼ʱһ[-PI, PI]ٽfloat
+	float fMean[GM_ASTEROID_GROUP];
+	float fPeri[GM_ASTEROID_GROUP];
+	for (size_t i = 0; i < iNum; i++)
+	{
+		double fM = m_fMeanAnomalyVector[iFirst + i] + m_fMeanMotionVector[iFirst + i] * fTime;
+		fM -= KEPLER_2PI * std::floor(fM / KEPLER_2PI + 0.5);
+		fMean[i] = float(fM);
+
+		double fW = m_fPeriVector[iFirst + i];
+		if (m_bSecular) fW += m_fPeriRateVector[iFirst + i] * fTime;
+		fW -= KEPLER_2PI * std::floor(fW / KEPLER_2PI + 0.5);
+		fPeri[i] = float(fW);
+	}
+
+	size_t iDone = 0;
+	if (2 == m_iSIMD)
+	{
+		iDone = _EvaluateAVX2(fMean, fPeri, iFirst, iNum, pTarget);
+	}
+	else if (1 == m_iSIMD)
+	{
+		iDone = _EvaluateSSE(fMean, fPeri, iFirst, iNum, pTarget);
+	}
+	_EvaluateScalar(fMean + iDone, fPeri + iDone, iFirst + iDone, iNum - iDone, pTarget + 4 * iDone);
+}
+
+void CGMAsteroidKepler::_EvaluateScalar(const float* pMean, const float* pPeri, const size_t iFirst, const size_t iNum, float* pTarget) const
+{
+	for (size_t i = 0; i < iNum; i++)
+	{
+		const float fA = m_fSemiMajorVector[iFirst + i];
+		const float fB = m_fSemiMinorVector[iFirst + i];
+		const float fEcc = m_fEccVector[iFirst + i];
+		const float fN = m_fAngularSpeedVector[iFirst + i];
+
+		float fSinE, fCosE;
+		_SinCos(SolveKepler(pMean[i], fEcc), fSinE, fCosE);
+		// յϵµλúٶȣٶ = n/(1 - e*cosE) * (-a*sinE, b*cosE)
+		const float fK = fN / (1.0f - fEcc * fCosE);
+		const float fPX = fA * (fCosE - fEcc);
+		const float fPY = fB * fSinE;
+		const float fPVX = -(fA * fSinE * fK);
+		const float fPVY = fB * fCosE * fK;
+
+		// ת̫ϵϵ
+		float fSinW, fCosW;
+		_SinCos(pPeri[i], fSinW, fCosW);
+		float* pPixel = pTarget + 4 * i;
+		pPixel[0] = fCosW * fPX - fSinW * fPY;
+		pPixel[1] = fSinW * fPX + fCosW * fPY;
+		pPixel[2] = fCosW * fPVX - fSinW * fPVY;
+		pPixel[3] = fSinW * fPVX + fCosW * fPVY;
+	}
+}
+
+size_t CGMAsteroidKepler::_EvaluateSSE(const float* pMean, const float* pPeri, const size_t iFirst, const size_t iNum, float* pTarget) const
+{
+	const __m128 vSignMask = _mm_set1_ps(-0.0f);
+	const __m128 vOne = _mm_set1_ps(1.0f);
+	const __m128 vHalf = _mm_set1_ps(0.5f);
+	const __m128 vDanby = _mm_set1_ps(KEPLER_DANBY);
+
+	size_t i = 0;
+	for (; i + 4 <= iNum; i += 4)
+	{
+		// ǰ洢ģֱӶȡ
+		const __m128 vA = _mm_loadu_ps(m_fSemiMajorVector.data() + iFirst + i);
+		const __m128 vB = _mm_loadu_ps(m_fSemiMinorVector.data() + iFirst + i);
+		const __m128 vEcc = _mm_loadu_ps(m_fEccVector.data() + iFirst + i);
+		const __m128 vN = _mm_loadu_ps(m_fAngularSpeedVector.data() + iFirst + i);
+		const __m128 vM = _mm_loadu_ps(pMean + i);
+
+		// SolveKepler˳ͬ
+		__m128 vE = _mm_add_ps(vM, _mm_or_ps(_mm_mul_ps(vDanby, vEcc), _mm_and_ps(vM, vSignMask)));
+		__m128 vSinE, vCosE;
+		for (int k = 0; k < GM_KEPLER_ITERATION; k++)
+		{
+			_SinCosSSE(vE, vSinE, vCosE);
+			const __m128 vF = _mm_sub_ps(_mm_sub_ps(vE, _mm_mul_ps(vEcc, vSinE)), vM);
+			const __m128 vDF = _mm_sub_ps(vOne, _mm_mul_ps(vEcc, vCosE));
+			const __m128 vDDF = _mm_mul_ps(vEcc, vSinE);
+			vE = _mm_sub_ps(vE, _mm_div_ps(vF,
+				_mm_sub_ps(vDF, _mm_div_ps(_mm_mul_ps(_mm_mul_ps(vHalf, vF), vDDF), vDF))));
+		}
+		_SinCosSSE(vE, vSinE, vCosE);
+
+		const __m128 vK = _mm_div_ps(vN, _mm_sub_ps(vOne, _mm_mul_ps(vEcc, vCosE)));
+		const __m128 vPX = _mm_mul_ps(vA, _mm_sub_ps(vCosE, vEcc));
+		const __m128 vPY = _mm_mul_ps(vB, vSinE);
+		const __m128 vPVX = _mm_xor_ps(_mm_mul_ps(_mm_mul_ps(vA, vSinE), vK), vSignMask);
+		const __m128 vPVY = _mm_mul_ps(_mm_mul_ps(vB, vCosE), vK);
+
+		__m128 vSinW, vCosW;
+		_SinCosSSE(_mm_loadu_ps(pPeri + i), vSinW, vCosW);
+		__m128 vX = _mm_sub_ps(_mm_mul_ps(vCosW, vPX), _mm_mul_ps(vSinW, vPY));
+		__m128 vY = _mm_add_ps(_mm_mul_ps(vSinW, vPX), _mm_mul_ps(vCosW, vPY));
+		__m128 vVX = _mm_sub_ps(_mm_mul_ps(vCosW, vPVX), _mm_mul_ps(vSinW, vPVY));
+		__m128 vVY = _mm_add_ps(_mm_mul_ps(vSinW, vPVX), _mm_mul_ps(vCosW, vPVY));
+
+		// 4תó4
+		_MM_TRANSPOSE4_PS(vX, vY, vVX, vVY);
+		_mm_storeu_ps(pTarget + 4 * i, vX);
+		_mm_storeu_ps(pTarget + 4 * i + 4, vY);
+		_mm_storeu_ps(pTarget + 4 * i + 8, vVX);
+		_mm_storeu_ps(pTarget + 4 * i + 12, vVY);
+	}
+	return i;
+}
+
+GM_TARGET_AVX2
+size_t CGMAsteroidKepler::_EvaluateAVX2(const float* pMean, const float* pPeri, const size_t iFirst, const size_t iNum, float* pTarget) const
+{
+	const __m256 vSignMask = _mm256_set1_ps(-0.0f);
+	const __m256 vOne = _mm256_set1_ps(1.0f);
+	const __m256 vHalf = _mm256_set1_ps(0.5f);
+	const __m256 vDanby = _mm256_set1_ps(KEPLER_DANBY);
+
+	size_t i = 0;
+	for (; i + 8 <= iNum; i += 8)
+	{
+		const __m256 vA = _mm256_loadu_ps(m_fSemiMajorVector.data() + iFirst + i);
+		const __m256 vB = _mm256_loadu_ps(m_fSemiMinorVector.data() + iFirst + i);
+		const __m256 vEcc = _mm256_loadu_ps(m_fEccVector.data() + iFirst + i);
+		const __m256 vN = _mm256_loadu_ps(m_fAngularSpeedVector.data() + iFirst + i);
+		const __m256 vM = _mm256_loadu_ps(pMean + i);
+
+		// SolveKepler˳ͬʹFMA
+		__m256 vE = _mm256_add_ps(vM, _mm256_or_ps(_mm256_mul_ps(vDanby, vEcc), _mm256_and_ps(vM, vSignMask)));
+		__m256 vSinE, vCosE;
+		for (int k = 0; k < GM_KEPLER_ITERATION; k++)
+		{
+			_SinCosAVX2(vE, vSinE, vCosE);
+			const __m256 vF = _mm256_sub_ps(_mm256_sub_ps(vE, _mm256_mul_ps(vEcc, vSinE)), vM);
+			const __m256 vDF = _mm256_sub_ps(vOne, _mm256_mul_ps(vEcc, vCosE));
+			const __m256 vDDF = _mm256_mul_ps(vEcc, vSinE);
+			vE = _mm256_sub_ps(vE, _mm256_div_ps(vF,
+				_mm256_sub_ps(vDF, _mm256_div_ps(_mm256_mul_ps(_mm256_mul_ps(vHalf, vF), vDDF), vDF))));
+		}
+		_SinCosAVX2(vE, vSinE, vCosE);
+
+		const __m256 vK = _mm256_div_ps(vN, _mm256_sub_ps(vOne, _mm256_mul_ps(vEcc, vCosE)));
+		const __m256 vPX = _mm256_mul_ps(vA, _mm256_sub_ps(vCosE, vEcc));
+		const __m256 vPY = _mm256_mul_ps(vB, vSinE);
+		const __m256 vPVX = _mm256_xor_ps(_mm256_mul_ps(_mm256_mul_ps(vA, vSinE), vK), vSignMask);
+		const __m256 vPVY = _mm256_mul_ps(_mm256_mul_ps(vB, vCosE), vK);
+
+		__m256 vSinW, vCosW;
+		_SinCosAVX2(_mm256_loadu_ps(pPeri + i), vSinW, vCosW);
+		const __m256 vX = _mm256_sub_ps(_mm256_mul_ps(vCosW, vPX), _mm256_mul_ps(vSinW, vPY));
+		const __m256 vY = _mm256_add_ps(_mm256_mul_ps(vSinW, vPX), _mm256_mul_ps(vCosW, vPY));
+		const __m256 vVX = _mm256_sub_ps(_mm256_mul_ps(vCosW, vPVX), _mm256_mul_ps(vSinW, vPVY));
+		const __m256 vVY = _mm256_add_ps(_mm256_mul_ps(vSinW, vPVX), _mm256_mul_ps(vCosW, vPVY));
+
+		// 128λתãkĴĵ128λǵkأ128λǵk+4
+		const __m256 vT0 = _mm256_unpacklo_ps(vX, vY);
+		const __m256 vT1 = _mm256_unpackhi_ps(vX, vY);
+		const __m256 vT2 = _mm256_unpacklo_ps(vVX, vVY);
+		const __m256 vT3 = _mm256_unpackhi_ps(vVX, vVY);
+		__m256 vRow[4];
+		vRow[0] = _mm256_shuffle_ps(vT0, vT2, _MM_SHUFFLE(1, 0, 1, 0));
+		vRow[1] = _mm256_shuffle_ps(vT0, vT2, _MM_SHUFFLE(3, 2, 3, 2));
+		vRow[2] = _mm256_shuffle_ps(vT1, vT3, _MM_SHUFFLE(1, 0, 1, 0));
+		vRow[3] = _mm256_shuffle_ps(vT1, vT3, _MM_SHUFFLE(3, 2, 3, 2));
+		float* pDst = pTarget + 4 * i;
+		for (int k = 0; k < 4; k++)
+		{
+			_mm_storeu_ps(pDst + 4 * k, _mm256_castps256_ps128(vRow[k]));
+			_mm_storeu_ps(pDst + 4 * k + 16, _mm256_extractf128_ps(vRow[k], 1));
+		}
+	}
+	return i;
+}
+
+double CGMAsteroidKepler::_LaplaceCoefficient(const double fAlpha)
+{
+	// b_{3/2}^{(1)}(alpha) = 3*alpha * F(3/2, 5/2; 2; alpha^2)
+	// ֮Ϊ (k+3/2)(k+5/2)/((k+2)(k+1)) * alpha^2alpha <= 0.95ʱ
+	const double fAlpha2 = fAlpha * fAlpha;
+	double fTerm = 1.0;
+	double fSum = 1.0;
+	for (int k = 0; k < 10000 && fTerm > 1e-16 * fSum; k++)
+	{
+		fTerm *= (k + 1.5) * (k + 2.5) / ((k + 2.0) * (k + 1.0)) * fAlpha2;
+		fSum += fTerm;
+	}
+	return 3.0 * fAlpha * fSum;
+}
@@ -0,0 +1,186 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAsteroidKepler.h
+/// @brief		Galaxy-Music Engine - GMAsteroidKepler
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMAsteroidSolver.h"
+#include <vector>
+#include <osg/Image>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_KEPLER_ECC_MAX			(0.9)			// ƫޣİǰ뾶ԲҲǹ̶÷Χ
+	#define GM_KEPLER_ITERATION			(3)				// ⿪շ̵HalleyƫʲGM_KEPLER_ECC_MAXʱﵽfloat
+	#define GM_KEPLER_ALPHA_MAX			(0.95)			// 㳤㶯ʱľǰ볤֮ȵޣԽ1˹ϵԽɢ
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAsteroidKepler
+	*  @brief СǴĽģʽÿСֻʱֱλúٶ
+	*	CGMAsteroidSolverֲ֡ͬûһ֡״̬ʱ̶ֱֵʱת
+	*	ĳһʱ̵λúٶȻ㣬ֻ̫⣩
+	*	ľǵֻԳ㶯ʽ֣յ㾭Ȱ˹-ٽԹر
+	*	ݲСͼͬRGBA32FRG = λãBA = ٶȣλס/
+	*	ƽdouble¼㲢һշfloatHalley̶
+	*	AVX2ÿ8ţSSEÿ4ţ··λһ£߳޹
+	*/
+	class CGMAsteroidKepler
+	{
+		// 
+	public:
+		/**
+		* 
+		* @param iThreadNum:	߳0ʾʹӲ߳
+		*/
+		CGMAsteroidKepler(const unsigned int iThreadNum = 0);
+		/** @brief  */
+		~CGMAsteroidKepler();
+
+		/**
+		* SetOrbits
+		* СǵλúٶȻʱ̼ΪԪ
+		* ݻƫʳGM_KEPLER_ECC_MAXСǣΪǰ뾶ǰϵԲ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pState:		СݣiNum * 4floatRG = λãBA = ٶ
+		* @param iNum:			С
+		* @param sParam:		飬õ̫ľǵGMԼľǹ뾶
+		* @return bool:			ɹtrueΪfalse
+		*/
+		bool SetOrbits(const float* pState, const size_t iNum, const SGMAsteroidParam& sParam);
+
+		/**
+		* SetOrbits
+		* RGBA32FСͼʱ̼ΪԪ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pState:		Сͼ
+		* @param sParam:		
+		* @return bool:			ɹtrueͼƬΪջʽfalse
+		*/
+		bool SetOrbits(const osg::Image* pState, const SGMAsteroidParam& sParam);
+
+		/**
+		* Evaluate
+		* fTimeʱСǵλúٶ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fTime:			Ԫʱ䣬λ룬Ϊ
+		* @param pTarget:		GetNum() * 4float
+		* @return bool:			ɹtrueûйfalse
+		*/
+		bool Evaluate(const double fTime, float* pTarget);
+
+		/**
+		* Evaluate
+		* fTimeʱСǵλúٶȣдRGBA32FСͼ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fTime:			Ԫʱ䣬λ룬Ϊ
+		* @param pTarget:		ͼGetNum()ͬ
+		* @return bool:			ɹtrueͼƬΪջʽfalse
+		*/
+		bool Evaluate(const double fTime, osg::Image* pTarget);
+
+		/**
+		* SolveKepler
+		* ⿪շ E - e*sin(E) = MEvaluateеı·ͬ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fMeanAnomaly:	ƽMλȣΧ[-PI, PI]
+		* @param fEcc:			ƫeΧ[0, GM_KEPLER_ECC_MAX]
+		* @return float:		ƫEλ
+		*/
+		static float SolveKepler(const float fMeanAnomaly, const float fEcc);
+
+		/**
+		* SetSecular
+		* /رճ㶯յĬϿ
+		* @param bEnable:		Ƿ
+		*/
+		inline void SetSecular(const bool bEnable)
+		{
+			m_bSecular = bEnable;
+		}
+		/** @brief Ƿ˳㶯 */
+		inline bool GetSecular() const
+		{
+			return m_bSecular;
+		}
+
+		/**
+		* SetSIMD
+		* ʹõָڲԺͶԱȣĬʹCPUֵ֧·
+		* @param iLevel:		0 = 1 = SSE2 = AVX2CPU֧ʱԶ
+		*/
+		void SetSIMD(const int iLevel);
+		/** @brief ǰʹõָ0 = 1 = SSE2 = AVX2 */
+		inline int GetSIMD() const
+		{
+			return m_iSIMD;
+		}
+
+		/** @brief С */
+		inline size_t GetNum() const
+		{
+			return m_fSemiMajorVector.size();
+		}
+		/** @brief ߳ */
+		inline unsigned int GetThreadNum() const
+		{
+			return m_threadPool.GetThreadNum();
+		}
+
+	private:
+		/**
+		* _EvaluateBlock
+		* iNumСǵλúٶȣdoubleһʱ̵ĽǶȣSIMD·ʣñ·
+		* @param fTime:				Ԫʱ䣬λ
+		* @param iFirst:			һСǵ
+		* @param iNum:				СGM_ASTEROID_GROUP
+		* @param pTarget:			ѾƫƵһС
+		*/
+		void _EvaluateBlock(const double fTime, const size_t iFirst, const size_t iNum, float* pTarget) const;
+		/** @brief ·pMeanpPeriһʱ̹һƽǺͽյ㾭 */
+		void _EvaluateScalar(const float* pMean, const float* pPeri, const size_t iFirst, const size_t iNum, float* pTarget) const;
+		/** @brief SSE·ÿ4ţѾ */
+		size_t _EvaluateSSE(const float* pMean, const float* pPeri, const size_t iFirst, const size_t iNum, float* pTarget) const;
+		/** @brief AVX2·ÿ8ţѾ */
+		size_t _EvaluateAVX2(const float* pMean, const float* pPeri, const size_t iFirst, const size_t iNum, float* pTarget) const;
+		/**
+		* _LaplaceCoefficient
+		* ˹ϵb_{3/2}^{(1)}(alpha)óμ
+		* @param fAlpha:			볤֮ȣΧ[0, 1)
+		* @return double:			˹ϵ
+		*/
+		static double _LaplaceCoefficient(const double fAlpha);
+
+		// 
+	private:
+		CGMThreadPool						m_threadPool;					//!< ̳߳
+		int									m_iSIMD;						//!< ʹõָ
+		bool								m_bSecular;						//!< Ƿ㶯
+		std::vector<double>					m_fMeanAnomalyVector;			//!< Ԫʱƽǣλ
+		std::vector<double>					m_fMeanMotionVector;			//!< ƽٶȣλ/
+		std::vector<double>					m_fPeriVector;					//!< ԪʱĽյ㾭ȣλ
+		std::vector<double>					m_fPeriRateVector;				//!< յ㾭ȵĳڽٶȣλ/
+		std::vector<float>					m_fSemiMajorVector;				//!< 볤aλ
+		std::vector<float>					m_fEccVector;					//!< ƫe
+		std::vector<float>					m_fSemiMinorVector;				//!< bλףйΪ
+		std::vector<float>					m_fAngularSpeedVector;			//!< ƽٶȵfloatڼٶȣλ/
+	};
+}	// GM
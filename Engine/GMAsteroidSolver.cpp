@@ -0,0 +1,386 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAsteroidSolver.cpp
+/// @brief		Galaxy-Music Engine - GMAsteroidSolver
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAsteroidSolver.h"
+#include "GMKit.h"
+#include <cmath>
+#include <algorithm>
+#include <immintrin.h>
+
+using namespace GM;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+// MSVCֱʹAVX2úGCC/ClangҪΪָĿָ
+#ifdef _MSC_VER
+#define GM_TARGET_AVX2
+#else
+#define GM_TARGET_AVX2				__attribute__((target("avx2")))
+#endif
+
+/*************************************************************************
+constexpr
+*************************************************************************/
+// ³ԭAsteroidData.compеͬfloat㣬;ͨ鴫shader
+constexpr float ASTEROID_PI			= 3.141592657f;						// shaderеM_PI
+constexpr float ASTEROID_GM_SUN		= 6.67349e-11f * 1.98855e30f;		//  * ̫
+constexpr float ASTEROID_GM_JUPITER	= 6.67349e-11f * 1.8986e27f;		//  * ľ
+constexpr float ASTEROID_TOO_FAR	= 1e12f;							// Сλ
+constexpr float ASTEROID_TOO_NEAR	= 2.3e10f;							// ССλ
+constexpr float ASTEROID_REBORN_V	= 16000.0f;							// ʱٶȣλ/
+
+/*************************************************************************
+SGMAsteroidParam Methods
+*************************************************************************/
+
+SGMAsteroidParam::SGMAsteroidParam() :
+	vStep(0.0f, 1.0f, 0.0f, 0.0f),
+	vJupiter(float(1.495978707e11 * 5.20), 0.0f, 0.0f, 0.0f),
+	vGravity(ASTEROID_GM_SUN, ASTEROID_GM_JUPITER, ASTEROID_TOO_FAR, ASTEROID_TOO_NEAR)
+{
+}
+
+void SGMAsteroidParam::SetStep(const float fStepTime, const double fJupiterRadius, const double fJupiterAngle, const double fJupiterOmega)
+{
+	const int iSubStepNum = (std::max)(1, (std::min)(GM_ASTEROID_SUBSTEP_NUM_MAX, int(std::ceil(fStepTime / GM_ASTEROID_SUBSTEP_MAX))));
+	vStep = osg::Vec4f(fStepTime, float(iSubStepNum), fStepTime / float(iSubStepNum), 0.0f);
+	vJupiter = osg::Vec4f(float(fJupiterRadius), float(fJupiterAngle), float(fJupiterOmega), 0.0f);
+}
+
+/*************************************************************************
+CGMAsteroidSolver Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAsteroidSolver::CGMAsteroidSolver(const unsigned int iThreadNum) : m_threadPool(iThreadNum), m_iSIMD(0),
+	m_sParam(), m_jupiterPosVector(), m_vJupiterPos(0.0f, 1e12f), m_vJupiterFrontDir(-1.0f, 0.0f)
+{
+	SetSIMD(2);
+}
+
+/** @brief  */
+CGMAsteroidSolver::~CGMAsteroidSolver()
+{
+}
+
+bool CGMAsteroidSolver::Step(const float* pLast, float* pTarget, const unsigned int iWidth, const unsigned int iHeight,
+	const SGMAsteroidParam& sParam)
+{
+	if (!pLast || !pTarget || 0 == iWidth || 0 != iWidth % GM_ASTEROID_GROUP) return false;
+
+	m_sParam = sParam;
+	const int iSubStepNum = int(sParam.vStep.y());
+	const float fSubStep = sParam.vStep.z();
+	const float fJupiterR = sParam.vJupiter.x();
+	const float fJupiterAngle = sParam.vJupiter.y();
+	const float fJupiterOmega = sParam.vJupiter.z();
+	// ľλshaderеļ㷽ʽͬÿӲеһ
+	m_jupiterPosVector.resize((std::max)(0, iSubStepNum));
+	for (int k = 0; k < iSubStepNum; k++)
+	{
+		const float fAngle = fJupiterAngle + fJupiterOmega * ((float(k) + 0.5f) * fSubStep);
+		m_jupiterPosVector[k] = osg::Vec2f(fJupiterR * std::cos(fAngle), fJupiterR * std::sin(fAngle));
+	}
+	const float fEndAngle = fJupiterAngle + fJupiterOmega * sParam.vStep.x();
+	m_vJupiterPos = osg::Vec2f(fJupiterR * std::cos(fEndAngle), fJupiterR * std::sin(fEndAngle));
+	m_vJupiterFrontDir = osg::Vec2f(-std::sin(fEndAngle), std::cos(fEndAngle));
+
+	// ǹȵıԡ % GM_ASTEROID_GROUPǹڵ
+	const size_t iNum = size_t(iWidth) * iHeight;
+	const int iBlockNum = int((iNum + GM_ASTEROID_BLOCK - 1) / GM_ASTEROID_BLOCK);
+	m_threadPool.ParallelFor(0, iBlockNum, [&](int b)
+	{
+		const size_t iFirst = size_t(b) * GM_ASTEROID_BLOCK;
+		const size_t iBlockSize = (std::min)(size_t(GM_ASTEROID_BLOCK), iNum - iFirst);
+		_StepBlock(pLast + 4 * iFirst, pTarget + 4 * iFirst, iFirst, iBlockSize);
+	});
+	return true;
+}
+
+bool CGMAsteroidSolver::Step(const osg::Image* pLast, osg::Image* pTarget, const SGMAsteroidParam& sParam)
+{
+	if (!pLast || !pTarget || !pLast->data() || !pTarget->data()) return false;
+	if (GL_RGBA != pLast->getPixelFormat() || GL_FLOAT != pLast->getDataType()) return false;
+	if (GL_RGBA != pTarget->getPixelFormat() || GL_FLOAT != pTarget->getDataType()) return false;
+	if (pLast->s() != pTarget->s() || pLast->t() != pTarget->t() || 1 != pLast->r() || 1 != pTarget->r()) return false;
+
+	return Step((const float*)(pLast->data()), (float*)(pTarget->data()),
+		(unsigned int)(pLast->s()), (unsigned int)(pLast->t()), sParam);
+}
+
+void CGMAsteroidSolver::SetSIMD(const int iLevel)
+{
+	m_iSIMD = (iLevel < 0) ? 0 : ((iLevel > 2) ? 2 : iLevel);
+	if (2 == m_iSIMD && !CGMKit::HasAVX2()) m_iSIMD = 1;
+}
+
+void CGMAsteroidSolver::_StepBlock(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const
+{
+	size_t iDone = 0;
+	if (2 == m_iSIMD)
+	{
+		iDone = _StepAVX2(pLast, pTarget, iFirst, iNum);
+	}
+	else if (1 == m_iSIMD)
+	{
+		iDone = _StepSSE(pLast, pTarget, iFirst, iNum);
+	}
+	_StepScalar(pLast + 4 * iDone, pTarget + 4 * iDone, iFirst + iDone, iNum - iDone);
+}
+
+void CGMAsteroidSolver::_StepScalar(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const
+{
+	const float fGMSun = m_sParam.vGravity.x();
+	const float fGMJupiter = m_sParam.vGravity.y();
+	const float fTooFar = m_sParam.vGravity.z();
+	const float fTooNear = m_sParam.vGravity.w();
+	const float fSubStep = m_sParam.vStep.z();
+	const float fHalfStep = fSubStep * 0.5f;
+	for (size_t i = 0; i < iNum; i++)
+	{
+		float fPX = pLast[4 * i];
+		float fPY = pLast[4 * i + 1];
+		float fVX = pLast[4 * i + 2];
+		float fVY = pLast[4 * i + 3];
+
+		for (const osg::Vec2f& vJupiterPos : m_jupiterPosVector)
+		{
+			// Ưư벽
+			fPX += fVX * fHalfStep;
+			fPY += fVY * fHalfStep;
+
+			// Ӳе
+			const float fJX = vJupiterPos.x();
+			const float fJY = vJupiterPos.y();
+			const float fDisS2A2 = fPX * fPX + fPY * fPY;
+			const float fDisS2A = std::sqrt(fDisS2A2);
+			const float fA2JX = fJX - fPX;
+			const float fA2JY = fJY - fPY;
+			const float fDisJ2A2 = fA2JX * fA2JX + fA2JY * fA2JY;
+			const float fDisJ2A = std::sqrt(fDisJ2A2);
+
+			const float fGravitySun = fGMSun / fDisS2A2;
+			const float fGravityJupiter = fGMJupiter / fDisJ2A2;
+			const float fAX = -(fPX / fDisS2A) * fGravitySun + (fA2JX / fDisJ2A) * fGravityJupiter;
+			const float fAY = -(fPY / fDisS2A) * fGravitySun + (fA2JY / fDisJ2A) * fGravityJupiter;
+
+			// һƯư벽
+			fVX += fAX * fSubStep;
+			fVY += fAY * fSubStep;
+			fPX += fVX * fHalfStep;
+			fPY += fVY * fHalfStep;
+		}
+
+		float* pPixel = pTarget + 4 * i;
+		pPixel[0] = fPX;
+		pPixel[1] = fPY;
+		pPixel[2] = fVX;
+		pPixel[3] = fVY;
+
+		// step(1e12, len)NaN1NaNҲ㡰̫Զ
+		const float fDis = std::sqrt(fPX * fPX + fPY * fPY);
+		if (!(fDis < fTooFar) || fDis < fTooNear)
+		{
+			_Reborn(pPixel, (unsigned int)((iFirst + i) % GM_ASTEROID_GROUP));
+		}
+	}
+}
+
+size_t CGMAsteroidSolver::_StepSSE(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const
+{
+	const __m128 vSignMask = _mm_set1_ps(-0.0f);
+	const __m128 vGMSun = _mm_set1_ps(m_sParam.vGravity.x());
+	const __m128 vGMJupiter = _mm_set1_ps(m_sParam.vGravity.y());
+	const __m128 vTooFar = _mm_set1_ps(m_sParam.vGravity.z());
+	const __m128 vTooNear = _mm_set1_ps(m_sParam.vGravity.w());
+	const __m128 vSubStep = _mm_set1_ps(m_sParam.vStep.z());
+	const __m128 vHalfStep = _mm_set1_ps(m_sParam.vStep.z() * 0.5f);
+
+	size_t i = 0;
+	for (; i + 4 <= iNum; i += 4)
+	{
+		// 4תóλúٶȵ4
+		__m128 vPX = _mm_loadu_ps(pLast + 4 * i);
+		__m128 vPY = _mm_loadu_ps(pLast + 4 * i + 4);
+		__m128 vVX = _mm_loadu_ps(pLast + 4 * i + 8);
+		__m128 vVY = _mm_loadu_ps(pLast + 4 * i + 12);
+		_MM_TRANSPOSE4_PS(vPX, vPY, vVX, vVY);
+
+		// ·˳ͬ
+		for (const osg::Vec2f& vJupiterPos : m_jupiterPosVector)
+		{
+			vPX = _mm_add_ps(vPX, _mm_mul_ps(vVX, vHalfStep));
+			vPY = _mm_add_ps(vPY, _mm_mul_ps(vVY, vHalfStep));
+
+			const __m128 vJX = _mm_set1_ps(vJupiterPos.x());
+			const __m128 vJY = _mm_set1_ps(vJupiterPos.y());
+			const __m128 vDisS2A2 = _mm_add_ps(_mm_mul_ps(vPX, vPX), _mm_mul_ps(vPY, vPY));
+			const __m128 vDisS2A = _mm_sqrt_ps(vDisS2A2);
+			const __m128 vA2JX = _mm_sub_ps(vJX, vPX);
+			const __m128 vA2JY = _mm_sub_ps(vJY, vPY);
+			const __m128 vDisJ2A2 = _mm_add_ps(_mm_mul_ps(vA2JX, vA2JX), _mm_mul_ps(vA2JY, vA2JY));
+			const __m128 vDisJ2A = _mm_sqrt_ps(vDisJ2A2);
+
+			const __m128 vGravitySun = _mm_div_ps(vGMSun, vDisS2A2);
+			const __m128 vGravityJupiter = _mm_div_ps(vGMJupiter, vDisJ2A2);
+			const __m128 vAX = _mm_add_ps(
+				_mm_mul_ps(_mm_xor_ps(_mm_div_ps(vPX, vDisS2A), vSignMask), vGravitySun),
+				_mm_mul_ps(_mm_div_ps(vA2JX, vDisJ2A), vGravityJupiter));
+			const __m128 vAY = _mm_add_ps(
+				_mm_mul_ps(_mm_xor_ps(_mm_div_ps(vPY, vDisS2A), vSignMask), vGravitySun),
+				_mm_mul_ps(_mm_div_ps(vA2JY, vDisJ2A), vGravityJupiter));
+
+			vVX = _mm_add_ps(vVX, _mm_mul_ps(vAX, vSubStep));
+			vVY = _mm_add_ps(vVY, _mm_mul_ps(vAY, vSubStep));
+			vPX = _mm_add_ps(vPX, _mm_mul_ps(vVX, vHalfStep));
+			vPY = _mm_add_ps(vPY, _mm_mul_ps(vVY, vHalfStep));
+		}
+
+		const __m128 vDis = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vPX, vPX), _mm_mul_ps(vPY, vPY)));
+		const int iDeadMask = _mm_movemask_ps(_mm_or_ps(_mm_cmpnlt_ps(vDis, vTooFar), _mm_cmplt_ps(vDis, vTooNear)));
+
+		_MM_TRANSPOSE4_PS(vPX, vPY, vVX, vVY);
+		_mm_storeu_ps(pTarget + 4 * i, vPX);
+		_mm_storeu_ps(pTarget + 4 * i + 4, vPY);
+		_mm_storeu_ps(pTarget + 4 * i + 8, vVX);
+		_mm_storeu_ps(pTarget + 4 * i + 12, vVY);
+
+		// ҪСǺ٣ñ
+		for (int k = 0; iDeadMask && k < 4; k++)
+		{
+			if (iDeadMask & (1 << k))
+			{
+				_Reborn(pTarget + 4 * (i + k), (unsigned int)((iFirst + i + k) % GM_ASTEROID_GROUP));
+			}
+		}
+	}
+	return i;
+}
+
+GM_TARGET_AVX2
+size_t CGMAsteroidSolver::_StepAVX2(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const
+{
+	const __m256 vSignMask = _mm256_set1_ps(-0.0f);
+	const __m256 vGMSun = _mm256_set1_ps(m_sParam.vGravity.x());
+	const __m256 vGMJupiter = _mm256_set1_ps(m_sParam.vGravity.y());
+	const __m256 vTooFar = _mm256_set1_ps(m_sParam.vGravity.z());
+	const __m256 vTooNear = _mm256_set1_ps(m_sParam.vGravity.w());
+	const __m256 vSubStep = _mm256_set1_ps(m_sParam.vStep.z());
+	const __m256 vHalfStep = _mm256_set1_ps(m_sParam.vStep.z() * 0.5f);
+
+	size_t i = 0;
+	for (; i + 8 <= iNum; i += 8)
+	{
+		// kĴĵ128λǵkأ128λǵk+4أ128λת
+		const float* pSrc = pLast + 4 * i;
+		__m256 vRow[4];
+		for (int k = 0; k < 4; k++)
+		{
+			vRow[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(pSrc + 4 * k)), _mm_loadu_ps(pSrc + 4 * k + 16), 1);
+		}
+		__m256 vT0 = _mm256_unpacklo_ps(vRow[0], vRow[1]);
+		__m256 vT1 = _mm256_unpackhi_ps(vRow[0], vRow[1]);
+		__m256 vT2 = _mm256_unpacklo_ps(vRow[2], vRow[3]);
+		__m256 vT3 = _mm256_unpackhi_ps(vRow[2], vRow[3]);
+		__m256 vPX = _mm256_shuffle_ps(vT0, vT2, _MM_SHUFFLE(1, 0, 1, 0));
+		__m256 vPY = _mm256_shuffle_ps(vT0, vT2, _MM_SHUFFLE(3, 2, 3, 2));
+		__m256 vVX = _mm256_shuffle_ps(vT1, vT3, _MM_SHUFFLE(1, 0, 1, 0));
+		__m256 vVY = _mm256_shuffle_ps(vT1, vT3, _MM_SHUFFLE(3, 2, 3, 2));
+
+		// ·˳ͬʹFMA
+		for (const osg::Vec2f& vJupiterPos : m_jupiterPosVector)
+		{
+			vPX = _mm256_add_ps(vPX, _mm256_mul_ps(vVX, vHalfStep));
+			vPY = _mm256_add_ps(vPY, _mm256_mul_ps(vVY, vHalfStep));
+
+			const __m256 vJX = _mm256_set1_ps(vJupiterPos.x());
+			const __m256 vJY = _mm256_set1_ps(vJupiterPos.y());
+			const __m256 vDisS2A2 = _mm256_add_ps(_mm256_mul_ps(vPX, vPX), _mm256_mul_ps(vPY, vPY));
+			const __m256 vDisS2A = _mm256_sqrt_ps(vDisS2A2);
+			const __m256 vA2JX = _mm256_sub_ps(vJX, vPX);
+			const __m256 vA2JY = _mm256_sub_ps(vJY, vPY);
+			const __m256 vDisJ2A2 = _mm256_add_ps(_mm256_mul_ps(vA2JX, vA2JX), _mm256_mul_ps(vA2JY, vA2JY));
+			const __m256 vDisJ2A = _mm256_sqrt_ps(vDisJ2A2);
+
+			const __m256 vGravitySun = _mm256_div_ps(vGMSun, vDisS2A2);
+			const __m256 vGravityJupiter = _mm256_div_ps(vGMJupiter, vDisJ2A2);
+			const __m256 vAX = _mm256_add_ps(
+				_mm256_mul_ps(_mm256_xor_ps(_mm256_div_ps(vPX, vDisS2A), vSignMask), vGravitySun),
+				_mm256_mul_ps(_mm256_div_ps(vA2JX, vDisJ2A), vGravityJupiter));
+			const __m256 vAY = _mm256_add_ps(
+				_mm256_mul_ps(_mm256_xor_ps(_mm256_div_ps(vPY, vDisS2A), vSignMask), vGravitySun),
+				_mm256_mul_ps(_mm256_div_ps(vA2JY, vDisJ2A), vGravityJupiter));
+
+			vVX = _mm256_add_ps(vVX, _mm256_mul_ps(vAX, vSubStep));
+			vVY = _mm256_add_ps(vVY, _mm256_mul_ps(vAY, vSubStep));
+			vPX = _mm256_add_ps(vPX, _mm256_mul_ps(vVX, vHalfStep));
+			vPY = _mm256_add_ps(vPY, _mm256_mul_ps(vVY, vHalfStep));
+		}
+
+		const __m256 vDis = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vPX, vPX), _mm256_mul_ps(vPY, vPY)));
+		const int iDeadMask = _mm256_movemask_ps(_mm256_or_ps(
+			_mm256_cmp_ps(vDis, vTooFar, _CMP_NLT_UQ), _mm256_cmp_ps(vDis, vTooNear, _CMP_LT_OQ)));
+
+		// תûأȡʱ˳ͬ
+		vT0 = _mm256_unpacklo_ps(vPX, vPY);
+		vT1 = _mm256_unpackhi_ps(vPX, vPY);
+		vT2 = _mm256_unpacklo_ps(vVX, vVY);
+		vT3 = _mm256_unpackhi_ps(vVX, vVY);
+		vRow[0] = _mm256_shuffle_ps(vT0, vT2, _MM_SHUFFLE(1, 0, 1, 0));
+		vRow[1] = _mm256_shuffle_ps(vT0, vT2, _MM_SHUFFLE(3, 2, 3, 2));
+		vRow[2] = _mm256_shuffle_ps(vT1, vT3, _MM_SHUFFLE(1, 0, 1, 0));
+		vRow[3] = _mm256_shuffle_ps(vT1, vT3, _MM_SHUFFLE(3, 2, 3, 2));
+		float* pDst = pTarget + 4 * i;
+		for (int k = 0; k < 4; k++)
+		{
+			_mm_storeu_ps(pDst + 4 * k, _mm256_castps256_ps128(vRow[k]));
+			_mm_storeu_ps(pDst + 4 * k + 16, _mm256_extractf128_ps(vRow[k], 1));
+		}
+
+		// ҪСǺ٣ñ
+		for (int k = 0; iDeadMask && k < 8; k++)
+		{
+			if (iDeadMask & (1 << k))
+			{
+				_Reborn(pDst + 4 * k, (unsigned int)((iFirst + i + k) % GM_ASTEROID_GROUP));
+			}
+		}
+	}
+	return i;
+}
+
+void CGMAsteroidSolver::_Reborn(float* pPixel, const unsigned int iLocalIndex) const
+{
+	// shaderеRandom(uv)
+	auto Random = [](const float fX, const float fY)
+	{
+		const float fValue = std::sin(fX * 12.9898f + fY * 78.233f) * 43758.5453123f;
+		return fValue - std::floor(fValue);
+	};
+
+	const float fNoise_0 = std::sin(Random(pPixel[0], pPixel[1]) + float(iLocalIndex));
+	const float fNoise_1 = std::sin(Random(pPixel[2], pPixel[3]) + 2.03f * float(iLocalIndex));
+	const float fCosTheta = std::cos(fNoise_0 * ASTEROID_PI);
+	const float fSinTheta = std::sin(fNoise_0 * ASTEROID_PI);
+
+	// shaderеmat2(cos, -sin, sin, cos)ǰйģv(cos*v.x + sin*v.y, -sin*v.x + cos*v.y)
+	const float fJX = m_vJupiterPos.x();
+	const float fJY = m_vJupiterPos.y();
+	const float fFX = m_vJupiterFrontDir.x();
+	const float fFY = m_vJupiterFrontDir.y();
+	const float fPosScale = -(0.7f + 0.2f * fNoise_1);
+	pPixel[0] = fPosScale * (fCosTheta * fJX + fSinTheta * fJY);
+	pPixel[1] = fPosScale * (-fSinTheta * fJX + fCosTheta * fJY);
+	pPixel[2] = -ASTEROID_REBORN_V * (fCosTheta * fFX + fSinTheta * fFY);
+	pPixel[3] = -ASTEROID_REBORN_V * (-fSinTheta * fFX + fCosTheta * fFY);
+}
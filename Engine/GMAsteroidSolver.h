@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAsteroidSolver.h
+/// @brief		Galaxy-Music Engine - GMAsteroidSolver
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMThreadPool.h"
+#include <cstddef>
+#include <vector>
+#include <osg/Vec2f>
+#include <osg/Vec4f>
+#include <osg/Image>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_ASTEROID_GROUP			(256)			// Ŀȣ롰AsteroidData.complocal_size_xͬ
+	#define GM_ASTEROID_BLOCK			(2048)			// ̼߳ʱÿС
+	#define GM_ASTEROID_PARAM_NUM		(3)				// vec4롰AsteroidData.compasteroidParamͬ
+	#define GM_ASTEROID_SUBSTEP_MAX		(1e5f)			// Ӳλ룬ԼΪСǴڲڵǧ֮һ
+	#define GM_ASTEROID_SUBSTEP_NUM_MAX	(64)			// ÿһӲٴʱֻܼӴӲ
+
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/*!
+	*  @struct SGMAsteroidParam
+	*  @brief СǴĲ飬CPU롰AsteroidData.comp
+	*	shaderǡuniform vec4 asteroidParam[GM_ASTEROID_PARAM_NUM]Ա˳vec4Ӧ
+	*/
+	struct SGMAsteroidParam
+	{
+		SGMAsteroidParam();
+
+		/**
+		* SetStep
+		* һĲľǹӲGM_ASTEROID_SUBSTEP_MAXԶ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fStepTime:			沽λ
+		* @param fJupiterRadius:	ľǵĹ뾶λ
+		* @param fJupiterAngle:		һʼʱľǵǣλ
+		* @param fJupiterOmega:		ľǵĹתٶȣλ/
+		* @return void
+		*/
+		void SetStep(const float fStepTime, const double fJupiterRadius, const double fJupiterAngle, const double fJupiterOmega);
+
+		osg::Vec4f vStep;		//!< x = y = Ӳz = Ӳλ
+		osg::Vec4f vJupiter;	//!< x = ľǹ뾶λףy = һʼʱľǣλȣz = ľǹתٶȣλ/
+		osg::Vec4f vGravity;	//!< x = ̫GMy = ľǵGMz = Զ룬w = 룬λ
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAsteroidSolver
+	*  @brief СǴCPUʵ֣롰AsteroidData.comp㷨ͬ
+	*	ݲСͼͬRGBA32FÿһСǣRG = λãBA = ٶȣλס/
+	*	ǡƯ--ƯơDKDʱۻ
+	*	ÿӲֻһľӲеλɹԴ󲽳ʱľҲ
+	*	ڲ֧compute shaderʱı÷ҲΪcompute shaderĲο
+	*	ÿСǻָ̳߳ؼ㣬AVX2ÿ8ţSSEÿ4ţ·
+	*	·˳ͬλһ£߳޹
+	*	GPUsqrtsinȺľcompute shaderĽֻΧһ
+	*/
+	class CGMAsteroidSolver
+	{
+		// 
+	public:
+		/**
+		* 
+		* @param iThreadNum:	߳0ʾʹӲ߳
+		*/
+		CGMAsteroidSolver(const unsigned int iThreadNum = 0);
+		/** @brief  */
+		~CGMAsteroidSolver();
+
+		/**
+		* Step
+		* һ൱ִһΡAsteroidData.comp
+		* ÿСֻдԼأpLastpTargetͬһڴ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pLast:			һݣiWidth * iHeight * 4float
+		* @param pTarget:		һĽiWidth * iHeight * 4float
+		* @param iWidth:		ͼĿGM_ASTEROID_GROUPı
+		* @param iHeight:		ͼĸ
+		* @param sParam:		
+		* @return bool:			ɹtrueȲfalse
+		*/
+		bool Step(const float* pLast, float* pTarget, const unsigned int iWidth, const unsigned int iHeight,
+			const SGMAsteroidParam& sParam);
+
+		/**
+		* Step
+		* һΪRGBA32FСͼͼͬһ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pLast:			һͼ
+		* @param pTarget:		һĽͼߴʽpLastͬ
+		* @param sParam:		
+		* @return bool:			ɹtrueͼƬΪջʽfalse
+		*/
+		bool Step(const osg::Image* pLast, osg::Image* pTarget, const SGMAsteroidParam& sParam);
+
+		/**
+		* SetSIMD
+		* ʹõָڲԺͶԱȣĬʹCPUֵ֧·
+		* @param iLevel:		0 = 1 = SSE2 = AVX2CPU֧ʱԶ
+		*/
+		void SetSIMD(const int iLevel);
+
+		/** @brief ǰʹõָ0 = 1 = SSE2 = AVX2 */
+		inline int GetSIMD() const
+		{
+			return m_iSIMD;
+		}
+
+		/** @brief ߳ */
+		inline unsigned int GetThreadNum() const
+		{
+			return m_threadPool.GetThreadNum();
+		}
+
+	private:
+		/**
+		* _StepBlock
+		* iNumСǣSIMD·ʣñ·
+		* @param pLast, pTarget:	ָ룬ѾƫƵһС
+		* @param iFirst:			һСǵţڼ㹤ڵ
+		* @param iNum:				С
+		*/
+		void _StepBlock(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const;
+		/** @brief · */
+		void _StepScalar(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const;
+		/** @brief SSE·ÿ4ţѾ */
+		size_t _StepSSE(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const;
+		/** @brief AVX2·ÿ8ţѾ */
+		size_t _StepAVX2(const float* pLast, float* pTarget, const size_t iFirst, const size_t iNum) const;
+		/**
+		* _Reborn
+		* ̫ܵԶ̫СǷŻľǹshaderеġreborn in asteroid beltͬ
+		* @param pPixel:			Сǵݣᱻд
+		* @param iLocalIndex:		ڵţgl_LocalInvocationIndex
+		*/
+		void _Reborn(float* pPixel, const unsigned int iLocalIndex) const;
+
+		// 
+	private:
+		CGMThreadPool						m_threadPool;					//!< ̳߳
+		int									m_iSIMD;						//!< ʹõָ
+		SGMAsteroidParam					m_sParam;						//!< ǰĲ
+		std::vector<osg::Vec2f>				m_jupiterPosVector;				//!< ǰÿӲеľ꣬λ
+		osg::Vec2f							m_vJupiterPos;					//!< ǰʱľ꣬λ
+		osg::Vec2f							m_vJupiterFrontDir;				//!< ǰʱľǰ
+	};
+}	// GM
@@ -0,0 +1,588 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAtmosPrecompute.cpp
+/// @brief		Galaxy-Music Engine - GMAtmosPrecompute
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAtmosPrecompute.h"
+#include "GMKit.h"
+#include <algorithm>
+#include <fstream>
+#include <osg/Image>
+#include <osgDB/ReadFile>
+#include <osgDB/WriteFile>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* @brief Ѹԭдļͷ.rawʱsetImageָߴ͸ʽ
+* @param strFile:		ļ·
+* @param pData:			
+* @param iNum:			floatĸ
+* @return bool:			ɹtruefalse
+*/
+static bool _WriteRaw(const std::string& strFile, const float* pData, const size_t iNum)
+{
+	std::ofstream file(strFile, std::ios::binary | std::ios::trunc);
+	if (!file) return false;
+	file.write((const char*)pData, iNum * sizeof(float));
+	return file.good();
+}
+
+/*************************************************************************
+CGMAtmosPrecompute Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAtmosPrecompute::CGMAtmosPrecompute(const std::string& strCorePath, const unsigned int iThreadNum)
+	: m_threadPool(iThreadNum), m_strCorePath(strCorePath), m_sRes(), m_progressFunc(),
+	m_strProgressTable(), m_iProgressDone(0), m_iProgressTotal(0)
+{
+}
+
+/** @brief  */
+CGMAtmosPrecompute::~CGMAtmosPrecompute()
+{
+}
+
+void CGMAtmosPrecompute::SetProgress(const ProgressFunc& func)
+{
+	m_progressFunc = func;
+}
+
+bool CGMAtmosPrecompute::MakeTransmittance()
+{
+	const int iW = m_sRes.iTransPitchNum;
+	const int iH = m_sRes.iTransAltNum;
+	const int iTransmittanceNum = iW * iH * 3;
+	const std::string strTexPath = m_strCorePath + "Textures/Sphere/Transmittance/Transmittance_";
+	bool bOK = true;
+
+	_BeginProgress("Transmittance", m_sRes.iAtmosNum * m_sRes.iRadiusNum * m_sRes.iTransAltNum);
+	for (int h = 0; h < m_sRes.iAtmosNum; h++) //
+	{
+		double fAtmosThick = ATMOS_MIN * 1e3 * exp2(h); // ȣλ
+		double fDensAtmosBottom = _GetAtmosBottomDens(fAtmosThick); // ܶ
+
+		for (int r = 0; r < m_sRes.iRadiusNum; r++) //뾶
+		{
+			double fSphereR = (fAtmosThick / ATMOS_2_RADIUS) * exp2(r); //뾶λ
+			double fTopR = fSphereR + fAtmosThick;
+			float* data = new float[iTransmittanceNum];
+
+			m_threadPool.ParallelFor(0, m_sRes.iTransAltNum, [&](int t) // θ߶
+			{
+				// ݺθ߶ƽֶ
+				double fEyeR = CGMKit::Mix(fSphereR + 1, fTopR - 1, t / double(m_sRes.iTransAltNum));
+				// ۾λõ
+				osg::Vec2d vEyePos = osg::Vec2d(0, fEyeR);
+				for (int s = 0; s < m_sRes.iTransPitchNum; s++) // Ϸ̫нֵ
+				{
+					// ƽߵֵ
+					double fSinHoriz = fSphereR / fEyeR;
+					// ƽߵֵ
+					double fCosHoriz = -sqrt((std::max)(0.0, 1 - fSinHoriz * fSinHoriz));
+					// Ϸ̫нңڵƽֵ1.0֮ı
+					double fCosUL = CGMKit::Mix(fCosHoriz, 1.0, double(s) / double(m_sRes.iTransPitchNum));
+					double fSinUL = sqrt(1 - fCosUL * fCosUL);
+
+					double fTmp = fEyeR * fSinUL;
+					// vEyePosvTopPosľ
+					double fLen = sqrt(fTopR * fTopR - fTmp * fTmp) - fEyeR * fCosUL;
+					// 㶥λõ
+					osg::Vec2d vTopPos = osg::Vec2d(fLen * fSinUL, fEyeR + fLen * fCosUL);
+					// ֱ͸
+					osg::Vec3d vTransmittance = _Transmittance(fDensAtmosBottom, fSphereR, fAtmosThick, vEyePos, vTopPos);
+					int iAddress = m_sRes.iTransPitchNum * t + s;
+					data[3 * iAddress] = float(vTransmittance.x());
+					data[3 * iAddress + 1] = float(vTransmittance.y());
+					data[3 * iAddress + 2] = float(vTransmittance.z());
+				}
+				_StepProgress();
+			});
+
+			osg::ref_ptr<osg::Image> pAtmosTransmittanceImage = new osg::Image();
+			pAtmosTransmittanceImage->setImage(iW, iH, 1, GL_RGB32F_ARB, GL_RGB, GL_FLOAT, (unsigned char*)data, osg::Image::USE_NEW_DELETE);
+			bOK = osgDB::writeImageFile(*(pAtmosTransmittanceImage.get()),
+				strTexPath + _TableName(fAtmosThick, fSphereR) + ".tif") && bOK;
+		}
+	}
+	return bOK;
+}
+
+bool CGMAtmosPrecompute::MakeIrradiance()
+{
+	const int iSurfaceNum = 512;	// رܲ
+	const int iPitchNum = 256;		// 
+	const int iYawNum = 32;			// ƫ
+	const double fStepUnit = 100;	// λ
+	const int iW = m_sRes.iIrraUpNum;
+	const int iH = m_sRes.iIrraAltNum;
+	const int iIrradianceNum = iW * iH * 3;
+	const std::string strTransPath = m_strCorePath + "Textures/Sphere/Transmittance/Transmittance_";
+	const std::string strTexPath = m_strCorePath + "Textures/Sphere/Irradiance/Irradiance_";
+	bool bOK = true;
+	// 赽̫ⵥλΪ 1
+	// Ҳ˵Ϊ1Ϊ(H)ԲϣÿλڷֻУ1/ H
+
+	_BeginProgress("Irradiance", m_sRes.iAtmosNum * m_sRes.iRadiusNum * m_sRes.iIrraUpNum);
+	for (int h = 0; h < m_sRes.iAtmosNum; h++) //
+	{
+		double fAtmosThick = ATMOS_MIN * 1e3 * exp2(h);				// ȣλ
+		double fDensAtmosBottom = _GetAtmosBottomDens(fAtmosThick);		// ܶ
+
+		for (int r = 0; r < m_sRes.iRadiusNum; r++) //뾶
+		{
+			double fSphereR = (fAtmosThick / ATMOS_2_RADIUS) * exp2(r); //뾶λ
+			double fTopR = fSphereR + fAtmosThick;
+
+			// ͸ͼֻһΣ߳ͬʱپosg::Image
+			SGMFloatImage sTransImg;
+			osg::ref_ptr<osg::Image> pTransImg = osgDB::readImageFile(strTransPath + _TableName(fAtmosThick, fSphereR) + ".tif");
+			if (!CGMKit::DecodeImage(pTransImg.get(), sTransImg))
+			{
+				bOK = false;
+				continue;
+			}
+			float* data = new float[iIrradianceNum];
+
+			m_threadPool.ParallelFor(0, m_sRes.iIrraUpNum, [&](int s) // Ϸ̫нֵ
+			{
+				double fCosUL = 2 * double(s) / double(m_sRes.iIrraUpNum) - 1;
+				// ̫
+				osg::Vec3d vSun = osg::Vec3d(0, sqrt(1 - fCosUL* fCosUL), fCosUL);
+				for (int t = 0; t < m_sRes.iIrraAltNum; t++) // θ߶
+				{
+					// ݺθ߶ƽֶ
+					double fEyeR = CGMKit::Mix(fSphereR + 1, fTopR - 1, t / double(m_sRes.iIrraAltNum));
+					// ۵㿴ĵƽߵֵ
+					double fSinHoriz = fSphereR / fEyeR;
+					// ۵㿴ĵƽߵֵ
+					double fCosHoriz = -sqrt((std::max)(0.0, 1 - fSinHoriz * fSinHoriz));
+					// ۵㵽ƽߵ·ļн
+					double fHorizonAngle = std::asin(fSinHoriz);
+					// ۵㿴ĵ
+					double fGroundS = osg::PI * 2 * fSphereR * fSphereR * (1 - fSinHoriz);
+					// ۵λ
+					osg::Vec3d vEyePos = osg::Vec3d(0, 0, fEyeR);
+
+					osg::Vec3f vAlbedo(0, 0, 0);
+// ֲĹԾϵ淴
+//#define SURFACE_ALBEDO 0.1
+#ifdef SURFACE_ALBEDO
+					// 		(%)
+					// ˮ			6~8
+					// Ҷ		13~15
+					// ݵ			10~18
+					// ˮ		12~18
+					// ľ			16~18
+					// Ұ			15~20
+					// ԭ			20~25
+					// ɳĮ			25~30
+					// ѩ			> 50
+					for (int j = 0; j < iSurfaceNum; j++)
+					{
+						// ü湲棬ÿصĲ߳޹
+						const unsigned long long iCounter = 2 * ((unsigned long long)(t) * iSurfaceNum + j);
+						float fRandomX = (CGMKit::CounterRandom(s, iCounter) % 10000) * 1e-4f;		// 0.0-1.0
+						float fRandomY = (CGMKit::CounterRandom(s, iCounter + 1) % 10000) * 1e-4f;	// 0.0-1.0
+						double fAngle = fRandomX * fHorizonAngle;
+						double fSinAngle = sin(fAngle);
+						osg::Vec3d vDir(
+							fSinAngle * cos(fRandomY * 2 * osg::PI),
+							fSinAngle * sin(fRandomY * 2 * osg::PI),
+							-cos(fAngle));
+						// ۵Ϸֵ >0
+						double fCosAngle = sqrt(1 - fSinAngle * fSinAngle);
+						double fTmp = fEyeR * fSinAngle;
+						// ۵㵽潹ľ
+						double fLen = fEyeR * fCosAngle - sqrt(fSphereR * fSphereR - fTmp * fTmp);
+
+						// 
+						osg::Vec3d vGroundPos = vEyePos + vDir * fLen;
+						// 淨
+						osg::Vec3d vGroundNorm = vGroundPos;
+						vGroundNorm.normalize();
+						// ̫淨ߵֵ
+						double fCosNorm2Sun = vGroundNorm * vSun;
+						if (fCosNorm2Sun > 0)
+						{
+							// 䣬ȡرǿ
+							osg::Vec4 vD = CGMKit::GetImageColor(sTransImg,
+								fCosNorm2Sun,
+								0.0f,
+								true);
+							vD *= fCosNorm2Sun * (1 - fCosAngle);
+
+							// ۵㴦߷˥
+							osg::Vec4 vEyeT = CGMKit::GetImageColor(sTransImg,
+								(fCosAngle - fCosHoriz) / (std::max)(0.0, 1 - fCosHoriz),
+								float(t) / m_sRes.iIrraAltNum,
+								true);
+
+							// ⷽ
+							osg::Vec3d vDiffuseDir = osg::Vec3d(0, fSinAngle, fCosAngle);
+							// 淨ߵֵ
+							double fCosDiffuse2Norm = vDiffuseDir * vGroundNorm;
+							// ر߷˥
+							osg::Vec4 vGroundT = CGMKit::GetImageColor(sTransImg,
+								fCosDiffuse2Norm,
+								0.0f,
+								true);
+
+							// ⻹ᱻ
+							vD.x() *= vGroundT.x() / (std::max)(1e-20f, vEyeT.x());
+							vD.y() *= vGroundT.y() / (std::max)(1e-20f, vEyeT.y());
+							vD.z() *= vGroundT.z() / (std::max)(1e-20f, vEyeT.z());
+							vAlbedo += osg::Vec3(vD.x(), vD.y(), vD.z()) * std::abs(-vDir * vGroundNorm) / (fLen * fLen);
+						}
+					}
+					vAlbedo *= SURFACE_ALBEDO * 1e-4 * fGroundS / iSurfaceNum;
+#endif // SURFACE_ALBEDO
+
+					osg::Vec3d vIrradiance(0, 0, 0);
+					for (int iX = 0; iX < iPitchNum; iX++)
+					{
+						// Ϸ롰ɢԴ򡱵ļн
+						double fCosUV = 2.0 * (iX + 0.5) / (double)iPitchNum - 1.0;
+						double fSinUV = std::sqrt(1 - fCosUV * fCosUV);
+
+						for (int iY = 0; iY < iYawNum; iY++)
+						{
+							double fYaw = 2.0 * osg::PI * (iY + (double)iX / (double)iPitchNum) / (double)iYawNum;
+							// ɢԴ
+							osg::Vec3d vOffsetDir = osg::Vec3d(fSinUV * cos(fYaw), fSinUV * sin(fYaw), fCosUV);
+							double fIrraDis = vOffsetDir.normalize();
+							// ɢⷽ
+							osg::Vec3d vIrraDir = -vOffsetDir;
+
+							double fTmp = fEyeR * fSinUV;
+							// vEyePosvTopPosľ
+							double fLenET = sqrt(fTopR * fTopR - fTmp * fTmp) - fEyeR * fCosUV;
+							// ɢԴԶ
+							double fLenMax = fLenET;
+							// ɢԴֵСڵƽֵԶΪ
+							if (fCosUV < fCosHoriz)
+							{
+								// vEyePosvGroundPosľ
+								double fLenEG = -fEyeR * fCosUV - sqrt(fSphereR * fSphereR - fTmp * fTmp);
+								fLenMax = fLenEG;
+							}
+
+							fLenMax = (std::min)(1e3, fLenMax);
+							double fSampleNum = fLenMax / fStepUnit;
+							for (int c = 0; c < int(fSampleNum + 1); c++)
+							{
+								// ע⣺ĲΪ˱ݣ΢Сĵ
+								double fLenS = fStepUnit * (c + fmod(fSampleNum, 1));
+								// ɢ
+								osg::Vec3d vIrraPos = vEyePos + vOffsetDir * fLenS;
+								osg::Vec3d vIrraUp = vIrraPos;
+								double fIrraR = vIrraUp.normalize();
+								double fIrraAlt = fIrraR - fSphereR;
+								double fIrraAltCoord = fIrraAlt / fAtmosThick;
+								// ɢ㿴ĵƽߵֵ
+								double fSinHoriz_Source = fSphereR / fIrraR;
+								// ɢ㿴ĵƽߵֵ
+								double fCosHoriz_Source = -sqrt((std::max)(0.0, 1 - fSinHoriz_Source * fSinHoriz_Source));
+								// ۵Χֱ̫
+								osg::Vec4d vSunLight = CGMKit::GetImageColor(sTransImg,
+									(vIrraUp * vSun - fCosHoriz_Source) / (std::max)(0.0, 1 - fCosHoriz_Source),
+									fIrraAltCoord,
+									true);
+
+								double fCosIL = vIrraDir * vSun;
+								// ɢ
+								double fMie = _MieCoefficient(fIrraAlt, fAtmosThick) * _MiePhase(fCosIL);
+								// ۵Χɢ
+								osg::Vec3d vScattering =
+									(_RayleighCoefficient(fIrraAlt, fAtmosThick) * _RayleighPhase(fCosIL)
+										+ osg::Vec3d(fMie, fMie, fMie));
+								osg::Vec3d vI = osg::Vec3(
+									vSunLight.r() * vScattering.x(),
+									vSunLight.g() * vScattering.y(),
+									vSunLight.b() * vScattering.z());
+
+								// ۵յɢⷽ
+								double fIrraCos_Eye = vIrraDir.z();
+								// ɢɢⷽ
+								double fIrraCos_Source = vIrraUp * vIrraDir;
+								// "fIrraCos_Eye < fCosHoriz"  "fIrraCos_Source < fCosHoriz_Source"
+								// Ȼͬʱͬʱ
+								if (fIrraCos_Eye >= fCosHoriz) // ɢ룬۾
+								{
+									// ۵ɢⷽ˥
+									osg::Vec4d vEyeT = CGMKit::GetImageColor(sTransImg,
+										(std::max)(0.0, fIrraCos_Eye - fCosHoriz) / (1 - fCosHoriz),
+										float(t) / m_sRes.iIrraAltNum,
+										true);
+									// ɢɢⷽ˥
+									osg::Vec4d vIrraT = CGMKit::GetImageColor(sTransImg,
+										(std::max)(0.0, fIrraCos_Source - fCosHoriz_Source) / (std::max)(0.0, 1 - fCosHoriz_Source),
+										fIrraAltCoord,
+										true);
+									// ɢĹ⴫۵㣬ᱻ
+									// ۾λõ͸СΪ
+									vI.x() *= vEyeT.x() / (std::max)(1e-20, vIrraT.x());
+									vI.y() *= vEyeT.y() / (std::max)(1e-20, vIrraT.y());
+									vI.z() *= vEyeT.z() / (std::max)(1e-20, vIrraT.z());
+								}
+								else // fIrraCos_Eye < fCosHoriz  // ɢ룬۾
+								{
+									// ۵λõɢ⡰˥
+									osg::Vec4d vEyeT = CGMKit::GetImageColor(sTransImg,
+										(std::max)(0.0, -fIrraCos_Eye - fCosHoriz) / (1 - fCosHoriz),
+										float(t) / m_sRes.iIrraAltNum,
+										true);
+									// ɢɢ⡰˥
+									osg::Vec4d vIrraT = CGMKit::GetImageColor(sTransImg,
+										(std::max)(0.0, -fIrraCos_Source - fCosHoriz_Source) / (std::max)(0.0, 1 - fCosHoriz_Source),
+										fIrraAltCoord,
+										true);
+									// ɢĹ⴫۵㣬ᱻ
+									// ۾λõ͸ʴΪĸ
+									vI.x() *= vIrraT.x() / (std::max)(1e-20, vEyeT.x());
+									vI.y() *= vIrraT.y() / (std::max)(1e-20, vEyeT.y());
+									vI.z() *= vIrraT.z() / (std::max)(1e-20, vEyeT.z());
+								}
+								// 
+								double fAA = fSampleNum / int(fSampleNum + 1);
+								vIrradiance += vI * fAA;
+							}
+						}
+					}
+					vIrradiance *= 1.5e6 / double(iPitchNum * iYawNum);
+
+					osg::Vec3d vSumColor = (vAlbedo + vIrradiance) * fmin(1.0, fDensAtmosBottom);
+					int iAddress = m_sRes.iIrraUpNum * t + s;
+					data[3 * iAddress] = float(vSumColor.x());
+					data[3 * iAddress + 1] = float(vSumColor.y());
+					data[3 * iAddress + 2] = float(vSumColor.z());
+				}
+				_StepProgress();
+			});
+
+			osg::ref_ptr<osg::Image> pImage = new osg::Image();
+			pImage->setImage(iW, iH, 1, GL_RGB32F_ARB, GL_RGB, GL_FLOAT, (unsigned char*)data, osg::Image::USE_NEW_DELETE);
+			bOK = osgDB::writeImageFile(*(pImage.get()), strTexPath + _TableName(fAtmosThick, fSphereR) + ".tif") && bOK;
+		}
+	}
+	return bOK;
+}
+
+bool CGMAtmosPrecompute::MakeInscattering()
+{
+	/*	Ӿ:						뾶λ	100km
+		16 km									8,16,32,64			*100km
+		32 km									16,32,64,128		*100km
+		64 km			̩̹		32,64,128,256		*100km
+		128 km			졢ľ			64,128,256,512		*100km
+
+		ָ߶ȵһ㣨ΪOmniܷߣڵĹߴõɢֵ
+	*/
+	const double STEP_UNIT = 50;				// 
+	const int iAtmosImageNum = 4 * m_sRes.iScatPitchNum * m_sRes.iScatLightNum * m_sRes.iScatCosNum * m_sRes.iScatAltNum;
+	const std::string strIrradiancePath = m_strCorePath + "Textures/Sphere/Irradiance/Irradiance_";
+	const std::string strTexPath = m_strCorePath + "Textures/Sphere/Inscattering/Inscattering_";
+	bool bOK = true;
+
+	_BeginProgress("Inscattering", m_sRes.iAtmosNum * m_sRes.iRadiusNum * m_sRes.iScatPitchNum);
+	for (int h = 0; h < m_sRes.iAtmosNum; h++) //
+	{
+		double fAtmosThick = ATMOS_MIN * 1e3 * exp2(h);				// ȣλ
+
+		for (int r = 0; r < m_sRes.iRadiusNum; r++) //뾶
+		{
+			double fSphereR = (fAtmosThick / ATMOS_2_RADIUS) * exp2(r); //뾶λ
+			double fTopR = fSphereR + fAtmosThick;
+			double fSphereR2 = fSphereR * fSphereR;
+			double fTopR2 = fTopR * fTopR;
+			double fMinDotUL = GetMinDotUL(fAtmosThick, fSphereR);
+
+			SGMFloatImage sIrraImg;
+			osg::ref_ptr<osg::Image> pIrraImg = osgDB::readImageFile(strIrradiancePath + _TableName(fAtmosThick, fSphereR) + ".tif");
+			if (!CGMKit::DecodeImage(pIrraImg.get(), sIrraImg))
+			{
+				bOK = false;
+				continue;
+			}
+
+			// ɢֵ
+			float* data = new float[iAtmosImageNum];
+
+			m_threadPool.ParallelFor(0, m_sRes.iScatPitchNum, [&](int s) // d0/dH  d0/dh
+			{
+				for (int t = 0; t < m_sRes.iScatAltNum; t++) // θ߶
+				{
+					double fOmniAltCoord = (m_sRes.iScatAltNum - 1 - t) / double(m_sRes.iScatAltNum - 1);
+					double fOmniAltRatio = fOmniAltCoord * fOmniAltCoord;
+					// ݺθ߶ȷֶΣԽֶͣԽϸ
+					double fOmniR = CGMKit::Mix(fSphereR + 1, fTopR - 1, fOmniAltRatio);
+					double fOmniR2 = fOmniR * fOmniR;
+
+					// ÿһsոɸߵ
+					// fRatioS  d0/dH  d0/dh
+					// ȡ1.0Сһֵ֤춥λòͻ
+					// ȡ-1.0һֵ֤λòͻ
+					double fRatioS = 2 * double(s) / double(m_sRes.iScatPitchNum - 1) - 1;
+					fRatioS = osg::clampBetween(fRatioS, -0.99999, 0.99999);
+					// Ƿ
+					bool bSky = fRatioS > 0.0;
+					// ƽߣߵƽߺյģԶ
+					// Omniƽߵľ
+					double fDisOmni2Horizon = sqrt(fOmniR2 - fSphereR2);
+					// ƽ浽ˮƽ˵ľ
+					double fDisHorizon2Top = sqrt(fTopR2 - fSphereR2);
+					// OmniƽߺĴ˵ľ
+					double fDisOmni2Top = fDisOmni2Horizon + fDisHorizon2Top;
+
+					// ĩ˾루ĬϹ棩
+					double fDisMax = CGMKit::Mix(fDisOmni2Horizon, (std::max)(0.0, fOmniR - fSphereR), std::abs(fRatioS));
+					// Ϸнֵ(ĬϹ)
+					double fCosUV = -(fOmniR2 + fDisMax * fDisMax - fSphereR2) / (2 * fOmniR * fDisMax);
+					if (bSky)// 
+					{
+						// ĩ˾루
+						fDisMax = CGMKit::Mix(fDisOmni2Top, (std::max)(0.0, fTopR - fOmniR), fRatioS);
+						// Ϸнֵ
+						fCosUV = -(fOmniR2 + fDisMax * fDisMax - fTopR2) / (2 * fOmniR * fDisMax);
+					}
+					double fSinUV = sqrt(1 - fCosUV * fCosUV);
+					double fSampleNum = fDisMax / STEP_UNIT;
+
+					for (int y = 0; y < m_sRes.iScatLightNum; y++) // Ϸ̫нֵ
+					{
+						// С fMinDotUL Ͳ㣬
+						double fCosUL = 1 - (1 - fMinDotUL) * double(y+1) / double(m_sRes.iScatLightNum);
+						double fSinUL = sqrt(1 - fCosUL * fCosUL);
+						for (int x = 0; x < m_sRes.iScatCosNum; x++) // ̫нǵֵ
+						{
+							// ȶlocalϵ
+							// ˳̫վڵƽϣYᣬXᣬͷZᣬԭ
+
+							// localռµOmni
+							osg::Vec3d vOmniPos = osg::Vec3d(0, 0, fOmniR);
+							// localռµ̫
+							osg::Vec3d vSunDir = osg::Vec3d(0, fSinUL, fCosUL);
+							// ߷ڵǰPitchڵĴֱƽƫ
+							double fYaw = osg::PI * (1 - double(x) / double(m_sRes.iScatCosNum-1));
+							// localռ£߷
+							osg::Vec3d vScatterDir = osg::Vec3d(fSinUV * sin(fYaw), fSinUV * cos(fYaw), fCosUV);
+
+							osg::Vec4d vInscatterSum(0,0,0,0);
+							for (int j = 0; j < int(fSampleNum + 1); j++)
+							{
+								// ע⣺ĲΪ˱ݣ΢Сĵ
+								double fLenS = (j + fmod(fSampleNum, 1)) * STEP_UNIT;
+								// ÿһλ
+								osg::Vec3d vStepPos = vOmniPos + vScatterDir * fLenS;
+								// ÿһϷ
+								osg::Vec3d vStepUp = vStepPos;
+								// ÿһĵľ
+								double fStepR = vStepUp.normalize();
+								// ÿһĺθ߶
+								double fStepAlt = fStepR - fSphereR;
+								// ÿһλõĸ߶
+								double fStepAltCoord = fStepAlt / fAtmosThick;
+								// ÿһɢϵ
+								osg::Vec4d vStepCoef = osg::Vec4d(_RayleighCoefficient(fStepAlt, fAtmosThick), _MieCoefficient(fStepAlt, fAtmosThick));
+								// ÿһϷ̫нֵ
+								float fStepCosUL = vStepUp * vSunDir;
+
+								// ն
+								osg::Vec4d vI = CGMKit::GetImageColor(sIrraImg,
+									fStepCosUL * 0.5f + 0.5f,
+									fStepAltCoord,
+									true);
+
+								// 
+								vStepCoef *= fSampleNum / int(fSampleNum + 1);
+
+								vInscatterSum += osg::Vec4d(
+									vStepCoef.x() * vI.x(),
+									vStepCoef.y() * vI.y(),
+									vStepCoef.z() * vI.z(),
+									vStepCoef.w() * (vI.x() + vI.y() + vI.z())*0.3333);
+							}
+							vInscatterSum *= STEP_UNIT;
+
+							int iAddress = ((t * m_sRes.iScatCosNum + x) * m_sRes.iScatLightNum + y) * m_sRes.iScatPitchNum + s;
+							data[4 * iAddress] = float(vInscatterSum.x());
+							data[4 * iAddress + 1] = float(vInscatterSum.y());
+							data[4 * iAddress + 2] = float(vInscatterSum.z());
+							data[4 * iAddress + 3] = float(vInscatterSum.w());
+						}
+					}
+				}
+				_StepProgress();
+			});
+
+			// ʱȡ.raw.tifֻͬûļͷ
+			const std::string strFile = strTexPath + _TableName(fAtmosThick, fSphereR);
+			bOK = _WriteRaw(strFile + ".raw", data, iAtmosImageNum) && bOK;
+
+			// 洢dataͼƬ
+			osg::ref_ptr<osg::Image> pAtmosScatteringImage = new osg::Image();
+			pAtmosScatteringImage->setImage(m_sRes.iScatPitchNum, m_sRes.iScatLightNum * m_sRes.iScatCosNum * m_sRes.iScatAltNum, 1,
+				GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)data, osg::Image::USE_NEW_DELETE);
+			bOK = osgDB::writeImageFile(*(pAtmosScatteringImage.get()), strFile + ".tif") && bOK;
+		}
+	}
+	return bOK;
+}
+
+bool CGMAtmosPrecompute::MakeAll()
+{
+	return MakeTransmittance() && MakeIrradiance() && MakeInscattering();
+}
+
+void CGMAtmosPrecompute::_BeginProgress(const std::string& strTable, const int iTotal)
+{
+	std::lock_guard<std::mutex> lock(m_progressMutex);
+	m_strProgressTable = strTable;
+	m_iProgressDone = 0;
+	m_iProgressTotal = iTotal;
+}
+
+void CGMAtmosPrecompute::_StepProgress()
+{
+	std::lock_guard<std::mutex> lock(m_progressMutex);
+	m_iProgressDone++;
+	if (m_progressFunc) m_progressFunc(m_strProgressTable, m_iProgressDone, m_iProgressTotal);
+}
+
+osg::Vec3d CGMAtmosPrecompute::_Transmittance(const double& fAtmosDens,
+	const double& fR, const double& fAtmosThick,
+	const osg::Vec2d& vP0, const osg::Vec2d& vP1) const
+{
+	const int iLoop = 1024;
+	osg::Vec2d vDir = vP1 - vP0;
+	double fLen = vDir.normalize();
+	double fStepLen = fLen / iLoop;
+	osg::Vec3d vSum = osg::Vec3d(0, 0, 0);
+	osg::Vec2d vStepPos = vP0 + vDir * fStepLen * 0.5;
+
+	for (int i = 0; i < iLoop; i++)
+	{
+		double fAlt = vStepPos.length() - fR;
+		double fMie = _MieCoefficient(fAlt, fAtmosThick);
+		osg::Vec3d vScattering = _RayleighCoefficient(fAlt, fAtmosThick) + osg::Vec3d(fMie, fMie, fMie);
+		osg::Vec3d vAbsorption = _MieAbsorption(fAlt, fAtmosThick) + _OzoneAbsorption(fAlt, fAtmosThick);
+		osg::Vec3d vExtinction = vScattering + vAbsorption;
+
+		vSum += vExtinction * fStepLen;
+		vStepPos += vDir * fStepLen;
+	}
+	vSum *= fAtmosDens;
+	return osg::Vec3d(std::exp(-vSum.x()), std::exp(-vSum.y()), std::exp(-vSum.z()));
+}
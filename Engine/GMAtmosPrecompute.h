@@ -0,0 +1,301 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAtmosPrecompute.h
+/// @brief		Galaxy-Music Engine - GMAtmosPrecompute
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMCommon.h"
+#include "GMThreadPool.h"
+#include <cmath>
+#include <string>
+#include <functional>
+#include <mutex>
+#include <osg/Vec2d>
+#include <osg/Vec3d>
+#include <osg/Math>
+
+namespace GM
+{
+	/*************************************************************************
+	constexpr
+	*************************************************************************/
+
+	constexpr double ATMOS_FADE_R = 5.802e-6;		// ĺɢϵ
+	constexpr double ATMOS_FADE_G = 1.3558e-5; 		// ̹ɢϵ
+	constexpr double ATMOS_FADE_B = 3.31e-5; 		// ɢϵ
+
+	constexpr double ATMOS_RAYLEIGH_H = 0.132; 		// ɢ߱
+	constexpr double ATMOS_MIE_H = 0.019; 			// ɢ߱
+	constexpr int ATMOS_MIN = 16;					// СĴȣλkm
+
+	constexpr int ATMOS_NUM = 4;					// ȷ
+	constexpr int RADIUS_NUM = 4;					// 뾶
+	constexpr double ATMOS_2_RADIUS = 0.02;			// ת뾶ʱתϵ
+
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/**
+	* ұķֱʣĬֵʱȡĳߴ磬ֻвԻʹøСķֱ
+	* Ⱥ뾶СĿʼȡСֱʵǰűֱʵĶӦ
+	* @author LiuTao
+	* @since 2026.10.17
+	*/
+	struct SGMAtmosResolution
+	{
+		SGMAtmosResolution() : iAtmosNum(ATMOS_NUM), iRadiusNum(RADIUS_NUM),
+			iTransAltNum(128), iTransPitchNum(256), iIrraAltNum(128), iIrraUpNum(128),
+			iScatPitchNum(SCAT_PITCH_NUM), iScatLightNum(SCAT_LIGHT_NUM), iScatCosNum(SCAT_COS_NUM), iScatAltNum(SCAT_ALT_NUM)
+		{}
+
+		int iAtmosNum;			// ȷֶ
+		int iRadiusNum;			// 뾶ֶ
+		int iTransAltNum;		// ͸ͼĸ߶Ȳ [0,fAtmosThick]m
+		int iTransPitchNum;		// ͸ͼֵ̫ [ƽֵ,1]
+		int iIrraAltNum;		// նȵĸ߶Ȳ [0,fAtmosThick]m
+		int iIrraUpNum;			// նȵ̫Ϸĵ˲ [-1,1]
+		int iScatPitchNum;		// ɢ߸
+		int iScatLightNum;		// ɢ̫Ϸнǲ
+		int iScatCosNum;		// ɢ̫нǲ
+		int iScatAltNum;		// ɢĸ߶Ȳ
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAtmosPrecompute
+	*  @brief ұԤ㣺͸ʡնȡɢ
+	*	ֻOSGͱ׼⣬ãҲйߡAtmosPrecompute
+	*	ÿűзָCGMThreadPoolÿֻԼдԼĵַ
+	*	ִ߳˳޹أλͬ
+	*	͸ʡնдRGB32F.tifɢдRGBA32F.tifʱȡļͷ.raw
+	*/
+	class CGMAtmosPrecompute
+	{
+		// 
+	public:
+		/**
+		* Ȼص
+		* ÿһеһΣ߳еã֮ѾᲢ
+		* @param strTable:		ұƣTransmittanceIrradianceInscattering
+		* @param iDone:			ǰұѾɵдȺ뾶һ
+		* @param iTotal:		ǰұ
+		*/
+		typedef std::function<void(const std::string& strTable, const int iDone, const int iTotal)> ProgressFunc;
+
+		/**
+		* 
+		* @param strCorePath:	Դ·ұдڡTextures/Sphere/
+		* @param iThreadNum:	߳0ʾʹӲ߳
+		*/
+		CGMAtmosPrecompute(const std::string& strCorePath, const unsigned int iThreadNum = 0);
+		/** @brief  */
+		~CGMAtmosPrecompute();
+
+		/** @brief ýȻصպ򲻱 */
+		void SetProgress(const ProgressFunc& func);
+
+		/** @brief òұķֱʣʱֻܶȡĬϷֱʵĲұ */
+		inline void SetResolution(const SGMAtmosResolution& sRes)
+		{
+			m_sRes = sRes;
+		}
+		/** @brief ұķֱ */
+		inline const SGMAtmosResolution& GetResolution() const
+		{
+			return m_sRes;
+		}
+
+		/**
+		* MakeTransmittance
+		* ɴ͸ʡ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:			ȫдtruefalse
+		*/
+		bool MakeTransmittance();
+
+		/**
+		* MakeIrradiance
+		* ɴնȡҪС͸ʡ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:			ȫдtrueȱдʧfalse
+		*/
+		bool MakeIrradiance();
+
+		/**
+		* MakeInscattering
+		* ɴɢ䡱ҪСնȡ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:			ȫдtrueȱдʧfalse
+		*/
+		bool MakeInscattering();
+
+		/**
+		* MakeAll
+		* ˳ȫĳһʧټ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:			ȫдtruefalse
+		*/
+		bool MakeAll();
+
+		/** @brief ߳ */
+		inline unsigned int GetThreadNum() const
+		{
+			return m_threadPool.GetThreadNum();
+		}
+
+		/**
+		* @brief ݡܺȡ͡뾶й"DotUL"Сֵdot(upDir, lightDir)СһЩ
+		* @param fAtmosThick:		ܺȣλ
+		* @param fRadius:			뾶λ
+		* @return float:			й"DotUL"Сֵ,Χ(-1.0f, 0.0f)
+		*/
+		inline static float GetMinDotUL(const double& fAtmosThick, const double& fRadius)
+		{
+			float fSinUL = fRadius / (fAtmosThick + fRadius);
+			return -sqrt(std::fmax(0.0f, 1.0f - fSinUL * fSinUL))-0.1f;
+		};
+
+	private:
+		/**
+		* @brief ʼһŲұĽȼ
+		* @param strTable:			ұ
+		* @param iTotal:			
+		*/
+		void _BeginProgress(const std::string& strTable, const int iTotal);
+		/** @brief һУýȻص */
+		void _StepProgress();
+
+		/**
+		* @brief ұļĺ׺_뾶λkm
+		* @param fAtmosThick:		ܺȣλ
+		* @param fSphereR:			뾶λ
+		*/
+		inline std::string _TableName(const double fAtmosThick, const double fSphereR) const
+		{
+			return std::to_string(int(fAtmosThick * 1e-3)) + "_" + std::to_string(int(fSphereR * 1e-3));
+		}
+
+		/**
+		* @brief ͸ʡ
+		*/
+		osg::Vec3d _Transmittance(const double& fAtmosDens,
+			const double& fR, const double& fAtmosThick,
+			const osg::Vec2d& vP0, const osg::Vec2d& vP1) const;
+
+		/**
+		* @brief ݡθ߶ȡܺ͡ȡλõɢϵ
+		* @param fAlt:				θ߶ȣλ
+		* @param fAtmosThick:		ܺȣλ
+		* @return osg::Vec3d:		λõɢϵ,(0,1]
+		*/
+		inline osg::Vec3d _RayleighCoefficient(const double& fAlt, const double& fAtmosThick) const
+		{
+			// ܶ߶˥еɢıߣ8500m
+			double fEarthH = fAtmosThick * ATMOS_RAYLEIGH_H;
+			return osg::Vec3d(ATMOS_FADE_R, ATMOS_FADE_G, ATMOS_FADE_B) * exp2(-std::fmax(0, fAlt) / fEarthH);
+		};
+		/**
+		* @brief ݡθ߶ȡܺ͡ȡλõɢϵ
+		* @param fAlt:				θ߶ȣλ
+		* @param fAtmosThick:		ܺȣλ
+		* @return double:			λõɢϵ,(0,1]
+		*/
+		inline double _MieCoefficient(const double& fAlt, const double& fAtmosThick) const
+		{
+			// ܶ߶˥еɢıߣ1200m
+			double fEarthH = fAtmosThick * ATMOS_MIE_H;
+			return 3.996e-6 * exp2(-std::fmax(0, fAlt) / fEarthH);
+		};
+
+		/**
+		* @brief ɢλ
+		* @param fCosVL:		viewDirLightSourceļнֵ
+		* @return double:		ɢλ
+		*/
+		inline double _RayleighPhase(const double& fCosVL) const
+		{
+			return 3.0 / (16 * osg::PI) * (1 + fCosVL * fCosVL);
+		};
+		/**
+		* @brief ɢλ
+		* @param fCosVL:		viewDirLightSourceļнֵ
+		* @return double:		ɢλ
+		*/
+		inline double _MiePhase(const double& fCosVL) const
+		{
+			constexpr double g = 0.8;
+			constexpr double g2 = g * g;
+			const double a = 3.0 / (8 * osg::PI);
+			constexpr double b = (1 - g2) / (2 + g2);
+			double c = 1.0 + fCosVL * fCosVL;
+			double d = pow(1 + g2 - 2 * g * fCosVL, 1.5);
+			return a * b * (c / d);
+		};
+
+		/**
+		* @brief ɢ䵼µ
+		* @param fAlt:				θ߶ȣλ
+		* @param fAtmosThick:		ܺȣλ
+		* @return osg::Vec3d:		ɢ䵼µձ
+		*/
+		inline osg::Vec3d _MieAbsorption(const double& fAlt, const double& fAtmosThick) const
+		{
+			// ܶ߶˥еɢıߣ1200m
+			double fEarthH = fAtmosThick * ATMOS_MIE_H;
+			double fMie = 4.4e-6 * exp2(-std::fmax(0, fAlt) / fEarthH);
+			return osg::Vec3d(fMie, fMie, fMie);
+		};
+		/**
+		* @brief 
+		* @param fAlt:				θ߶ȣλ
+		* @param fAtmosThick:		ܺȣλ
+		* @return osg::Vec3d:		ձ
+		*/
+		inline osg::Vec3d _OzoneAbsorption(const double& fAlt, const double& fAtmosThick) const
+		{
+			// еĳozoneҲߵգԲͬĹŲͬЧʣɢûй
+			// һض߶ȵĲ㣬ͨĸ߶ȡ͡ȡзֱȡ 25km  15km
+			// ̫ӣûۿԾͲЩأ͵һֻɫб仯
+			double fCenterHeight = fAtmosThick * 0.39;
+			double fHalfThick = fAtmosThick * 0.234;
+			return osg::Vec3d(0.65e-6, 1.881e-6, 0.085e-6) * std::fmax(0, 1- std::abs(fAlt- fCenterHeight) / fHalfThick);
+		};
+
+		/**
+		* @brief ݡܺȡرԴܶȣ涨ƽܶΪ1
+		* @param fAtmosThick:		ܺȣλ
+		* @return double:			رԴܶ
+		*/
+		inline double _GetAtmosBottomDens(const double& fAtmosThick) const
+		{
+			// ֤ƽܶΪ1
+			return fAtmosThick / 64000.0;
+		};
+
+		// 
+	private:
+		CGMThreadPool						m_threadPool;					//!< ̳߳
+		std::string							m_strCorePath;					//!< Դ·
+		SGMAtmosResolution					m_sRes;							//!< ұķֱ
+		ProgressFunc						m_progressFunc;					//!< Ȼص
+		std::mutex							m_progressMutex;				//!< ȼͻص
+		std::string							m_strProgressTable;				//!< ǰұ
+		int									m_iProgressDone;				//!< ǰұѾɵ
+		int									m_iProgressTotal;				//!< ǰұ
+	};
+}	// GM
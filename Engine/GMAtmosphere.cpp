@@ -15,30 +15,8 @@
 #include "GMKit.h"
 #include <osg/Texture3D>
 #include <osgDB/ReadFile>
-#include <osgDB/WriteFile>
-
-#include <ppl.h>
-using namespace concurrency;
 
 using namespace GM;
-/*************************************************************************
-Macro Defines
-*************************************************************************/
-
-#define TRANS_ALT_NUM			(128)			// ͸ͼĸ߶Ȳ [0,fAtmosThick]m
-#define TRANS_PITCH_NUM			(256)			// ͸ͼֵ̫ [ƽֵ,1]
-
-#define IRRA_ALT_NUM			(128)			// նȵĸ߶Ȳ [0,fAtmosThick]m
-#define IRRA_UP_NUM				(128)			// նȵ̫Ϸĵ˲ [-1,1]
-
-/*************************************************************************
-constexpr
-*************************************************************************/
-
-constexpr int ATMOS_NUM = 4;					// ȷ
-constexpr int RADIUS_NUM = 4;					// 뾶
-constexpr double ATMOS_2_RADIUS = 0.02;			// ת뾶ʱתϵ
-
 /*************************************************************************
 Class
 *************************************************************************/
@@ -50,7 +28,6 @@ CGMAtmosphere Methods
 /** @brief  */
 CGMAtmosphere::CGMAtmosphere(): m_pConfigData(nullptr), m_strCoreModelPath("Models/")
 {
-	m_iRandom.seed(0);
 }
 
 /** @brief  */
@@ -65,12 +42,8 @@ bool CGMAtmosphere::Init(SGMConfigData * pConfigData)
 {
 	m_pConfigData = pConfigData;
 
-	////͸ʡ
-	//_MakeAtmosTransmittance();
-	////նȡ
-	//_MakeAtmosIrradiance();
-	////ɢ䡱
-	//_MakeAtmosInscattering();
+	////͸ʡնȡɢ䡱飬ҲйAtmosPrecompute
+	//CGMAtmosPrecompute(m_pConfigData->strCorePath).MakeAll();
 
 	m_pInscatteringTexVector.reserve(ATMOS_NUM * RADIUS_NUM);
 	for (int h = 0; h < ATMOS_NUM; h++)
@@ -126,512 +99,3 @@ osg::Texture3D* CGMAtmosphere::GetInscattering(const EGMAtmosHeight eAtmosH, con
 	else
 		return nullptr;
 }
-
-void CGMAtmosphere::_MakeAtmosTransmittance()
-{
-	const int iW = TRANS_PITCH_NUM;
-	const int iH = TRANS_ALT_NUM;
-	const int iTransmittanceBytes = iW * iH * sizeof(float) * 3;
-
-	//int h = 3; //
-	for (int h = 0; h < ATMOS_NUM; h++) //	
-	{
-		double fAtmosThick = ATMOS_MIN * 1e3 * exp2(h); // ȣλ
-		double fDensAtmosBottom = _GetAtmosBottomDens(fAtmosThick); // ܶ
-
-		//int r = 0; //뾶
-		for (int r = 0; r < RADIUS_NUM; r++) //뾶
-		{
-			double fSphereR = (fAtmosThick / ATMOS_2_RADIUS) * exp2(r); //뾶λ
-			double fTopR = fSphereR + fAtmosThick;
-			float* data = new float[iTransmittanceBytes];
-
-			parallel_for(int(0), int(TRANS_ALT_NUM), [&](int t) // ߳
-			//for (int t = 0; t < TRANS_ALT_NUM; t++) // θ߶
-			{
-				// ݺθ߶ƽֶ		
-				double fEyeR = CGMKit::Mix(fSphereR + 1, fTopR - 1, t / double(TRANS_ALT_NUM));
-				// ۾λõ
-				osg::Vec2d vEyePos = osg::Vec2d(0, fEyeR);
-				for (int s = 0; s < TRANS_PITCH_NUM; s++) // Ϸ̫нֵ
-				{
-					// ƽߵֵ
-					double fSinHoriz = fSphereR / fEyeR;
-					// ƽߵֵ
-					double fCosHoriz = -sqrt(max(0, 1 - fSinHoriz * fSinHoriz));
-					// Ϸ̫нңڵƽֵ1.0֮ı
-					double fCosUL = CGMKit::Mix(fCosHoriz, 1.0, double(s) / double(TRANS_PITCH_NUM));
-					double fSinUL = sqrt(1 - fCosUL * fCosUL);
-
-					double fTmp = fEyeR * fSinUL;
-					// vEyePosvTopPosľ
-					double fLen = sqrt(fTopR * fTopR - fTmp * fTmp) - fEyeR * fCosUL;
-					// 㶥λõ
-					osg::Vec2d vTopPos = osg::Vec2d(fLen * fSinUL, fEyeR + fLen * fCosUL);
-					// ֱ͸
-					osg::Vec3d vTransmittance = _Transmittance(fDensAtmosBottom, fSphereR, fAtmosThick, vEyePos, vTopPos);
-					int iAddress = TRANS_PITCH_NUM * t + s;
-					data[3 * iAddress] = float(vTransmittance.x());
-					data[3 * iAddress + 1] = float(vTransmittance.y());
-					data[3 * iAddress + 2] = float(vTransmittance.z());
-				}
-			}
-			); // end parallel_for
-
-			osg::ref_ptr<osg::Image> pAtmosTransmittanceImage = new osg::Image();
-			pAtmosTransmittanceImage->setImage(iW, iH, 1, GL_RGB32F_ARB, GL_RGB, GL_FLOAT, (unsigned char*)data, osg::Image::USE_NEW_DELETE);
-			std::string strTexPath = m_pConfigData->strCorePath + "Textures/Sphere/Transmittance/Transmittance_";
-			osgDB::writeImageFile(*(pAtmosTransmittanceImage.get()),
-				strTexPath + std::to_string(int(fAtmosThick*1e-3)) + "_" + std::to_string(int(fSphereR*1e-3)) + ".tif");
-		}
-	}
-}
-
-void CGMAtmosphere::_MakeAtmosIrradiance()
-{
-	const int iSurfaceNum = 512;	// رܲ
-	const int iPitchNum = 256;		// 
-	const int iYawNum = 32;			// ƫ
-	const double fStepUnit = 100;	// λ
-	const int iW = IRRA_UP_NUM;
-	const int iH = IRRA_ALT_NUM;
-	const int iIrradianceBytes = iW * iH * sizeof(float) * 3;
-	std::uniform_int_distribution<> iPseudoNoise(0, 9999);
-	// 赽̫ⵥλΪ 1
-	// Ҳ˵Ϊ1Ϊ(H)ԲϣÿλڷֻУ1/ H
-
-	//int h = 2; //
-	for (int h = 0; h < ATMOS_NUM; h++) //
-	{
-		double fAtmosThick = ATMOS_MIN * 1e3 * exp2(h);				// ȣλ
-		double fDensAtmosBottom = _GetAtmosBottomDens(fAtmosThick);		// ܶ
-
-		//for (int r = 1; r < 2; r++) //뾶
-		for (int r = 0; r < RADIUS_NUM; r++) //뾶
-		{
-			float* data = new float[iIrradianceBytes];
-			double fSphereR = (fAtmosThick / ATMOS_2_RADIUS) * exp2(r); //뾶λ
-			double fTopR = fSphereR + fAtmosThick;
-
-			osg::ref_ptr<osg::Image> pTransImg = osgDB::readImageFile(
-				m_pConfigData->strCorePath + "Textures/Sphere/Transmittance/Transmittance_"
-				+ std::to_string(int(fAtmosThick*1e-3)) + "_" + std::to_string(int(fSphereR*1e-3)) + ".tif");
-			if (!pTransImg.valid()) break;
-
-			parallel_for(int(0), int(IRRA_UP_NUM), [&](int s) // ߳
-			//for (int s = 0; s < IRRA_UP_NUM; s++) // Ϸ̫нֵ
-			{
-				double fCosUL = 2 * double(s) / double(IRRA_UP_NUM) - 1;
-				// ̫
-				osg::Vec3d vSun = osg::Vec3d(0, sqrt(1 - fCosUL* fCosUL), fCosUL);
-				for (int t = 0; t < IRRA_ALT_NUM; t++) // θ߶
-				{
-					//// ƽԶ
-					//double fHorizonDisMax = sqrt(fAtmosThick * fAtmosThick + 2 * fAtmosThick * fSphereR);
-					// ݺθ߶ƽֶ		
-					double fEyeR = CGMKit::Mix(fSphereR + 1, fTopR - 1, t / double(IRRA_ALT_NUM));
-					// ۵㿴ĵƽߵֵ
-					double fSinHoriz = fSphereR / fEyeR;
-					// ۵㿴ĵƽߵֵ
-					double fCosHoriz = -sqrt(max(0, 1 - fSinHoriz * fSinHoriz));
-					// ۵㵽ƽߵ·ļн
-					double fHorizonAngle = std::asin(fSinHoriz);
-					// ۵㿴ĵ
-					double fGroundS = osg::PI * 2 * fSphereR * fSphereR * (1 - fSinHoriz);
-					// ۵λ
-					osg::Vec3d vEyePos = osg::Vec3d(0, 0, fEyeR);
-
-					osg::Vec3f vAlbedo(0, 0, 0);
-// ֲĹԾϵ淴
-//#define SURFACE_ALBEDO 0.1
-#ifdef SURFACE_ALBEDO
-					// 		(%)
-					// ˮ			6~8
-					// Ҷ		13~15
-					// ݵ			10~18
-					// ˮ		12~18
-					// ľ			16~18
-					// Ұ			15~20
-					// ԭ			20~25
-					// ɳĮ			25~30
-					// ѩ			> 50
-					for (int j = 0; j < iSurfaceNum; j++)
-					{
-						float fRandomX = iPseudoNoise(m_iRandom) * 1e-4f;	// 0.0-1.0
-						float fRandomY = iPseudoNoise(m_iRandom) * 1e-4f;	// 0.0-1.0
-						double fAngle = fRandomX * fHorizonAngle;
-						double fSinAngle = sin(fAngle);
-						osg::Vec3d vDir(
-							fSinAngle * cos(fRandomY * 2 * osg::PI),
-							fSinAngle * sin(fRandomY * 2 * osg::PI),
-							-cos(fAngle));
-						// ۵Ϸֵ >0
-						double fCosAngle = sqrt(1 - fSinAngle * fSinAngle);
-						double fTmp = fEyeR * fSinAngle;
-						// ۵㵽潹ľ
-						double fLen = fEyeR * fCosAngle - sqrt(fSphereR * fSphereR - fTmp * fTmp);
-
-						// 
-						osg::Vec3d vGroundPos = vEyePos + vDir * fLen;
-						// 淨
-						osg::Vec3d vGroundNorm = vGroundPos;
-						vGroundNorm.normalize();
-						// ̫淨ߵֵ
-						double fCosNorm2Sun = vGroundNorm * vSun;
-						if (fCosNorm2Sun > 0)
-						{
-							// 䣬ȡرǿ
-							osg::Vec4 vD = CGMKit::GetImageColor(pTransImg.get(),
-								fCosNorm2Sun,
-								0.0f,
-								true);
-							vD *= fCosNorm2Sun * (1 - fCosAngle);
-
-							// ۵㴦߷˥
-							osg::Vec4 vEyeT = CGMKit::GetImageColor(pTransImg.get(),
-								(fCosAngle - fCosHoriz) / max(0, 1 - fCosHoriz),
-								float(t) / IRRA_ALT_NUM,
-								true);
-
-							// ⷽ
-							osg::Vec3d vDiffuseDir = osg::Vec3d(0, fSinAngle, fCosAngle);
-							// 淨ߵֵ
-							double fCosDiffuse2Norm = vDiffuseDir * vGroundNorm;
-							// ر߷˥
-							osg::Vec4 vGroundT = CGMKit::GetImageColor(pTransImg.get(),
-								fCosDiffuse2Norm,
-								0.0f,
-								true);
-
-							// ⻹ᱻ
-							vD.x() *= vGroundT.x() / max(1e-20, vEyeT.x());
-							vD.y() *= vGroundT.y() / max(1e-20, vEyeT.y());
-							vD.z() *= vGroundT.z() / max(1e-20, vEyeT.z());
-							vAlbedo += osg::Vec3(vD.x(), vD.y(), vD.z()) * abs(-vDir * vGroundNorm) / (fLen * fLen);
-						}
-					}
-					vAlbedo *= SURFACE_ALBEDO * 1e-4 * fGroundS / iSurfaceNum;
-#endif // SURFACE_ALBEDO
-
-					osg::Vec3d vIrradiance(0, 0, 0);
-					for (int iX = 0; iX < iPitchNum; iX++)
-					{
-						// Ϸ롰ɢԴ򡱵ļн
-						double fCosUV = 2.0 * (iX + 0.5) / (double)iPitchNum - 1.0;
-						double fSinUV = std::sqrt(1 - fCosUV * fCosUV);
-
-						for (int iY = 0; iY < iYawNum; iY++)
-						{
-							double fYaw = 2.0 * osg::PI * (iY + (double)iX / (double)iPitchNum) / (double)iYawNum;
-							// ɢԴ
-							osg::Vec3d vOffsetDir = osg::Vec3d(fSinUV * cos(fYaw), fSinUV * sin(fYaw), fCosUV);
-							double fIrraDis = vOffsetDir.normalize();
-							// ɢⷽ
-							osg::Vec3d vIrraDir = -vOffsetDir;
-
-							double fTmp = fEyeR * fSinUV;
-							// vEyePosvTopPosľ
-							double fLenET = sqrt(fTopR * fTopR - fTmp * fTmp) - fEyeR * fCosUV;
-							// ɢԴԶ
-							double fLenMax = fLenET;
-							// ɢԴֵСڵƽֵԶΪ
-							if (fCosUV < fCosHoriz)
-							{
-								// vEyePosvGroundPosľ	
-								double fLenEG = -fEyeR * fCosUV - sqrt(fSphereR * fSphereR - fTmp * fTmp);
-								fLenMax = fLenEG;
-							}
-
-							fLenMax = min(1e3, fLenMax);
-							double fSampleNum = fLenMax / fStepUnit;
-							for (int c = 0; c < int(fSampleNum + 1); c++)
-							{
-								// ע⣺ĲΪ˱ݣ΢Сĵ
-								double fLenS = fStepUnit * (c + fmod(fSampleNum, 1));
-								// ɢ
-								osg::Vec3d vIrraPos = vEyePos + vOffsetDir * fLenS;
-								osg::Vec3d vIrraUp = vIrraPos;
-								double fIrraR = vIrraUp.normalize();
-								double fIrraAlt = fIrraR - fSphereR;
-								double fIrraAltCoord = fIrraAlt / fAtmosThick;
-								// ɢ㿴ĵƽߵֵ
-								double fSinHoriz_Source = fSphereR / fIrraR;
-								// ɢ㿴ĵƽߵֵ
-								double fCosHoriz_Source = -sqrt(max(0, 1 - fSinHoriz_Source * fSinHoriz_Source));
-								// ۵Χֱ̫
-								osg::Vec4d vSunLight = CGMKit::GetImageColor(pTransImg.get(),
-									(vIrraUp * vSun - fCosHoriz_Source) / max(0, 1 - fCosHoriz_Source),
-									fIrraAltCoord,
-									true);
-
-								double fCosIL = vIrraDir * vSun;
-								// ɢ
-								double fMie = _MieCoefficient(fIrraAlt, fAtmosThick) * _MiePhase(fCosIL);
-								// ۵Χɢ
-								osg::Vec3d vScattering =
-									(_RayleighCoefficient(fIrraAlt, fAtmosThick) * _RayleighPhase(fCosIL)
-										+ osg::Vec3d(fMie, fMie, fMie));
-								osg::Vec3d vI = osg::Vec3(
-									vSunLight.r() * vScattering.x(),
-									vSunLight.g() * vScattering.y(),
-									vSunLight.b() * vScattering.z());
-
-								// ۵յɢⷽ
-								double fIrraCos_Eye = vIrraDir.z();
-								// ɢɢⷽ
-								double fIrraCos_Source = vIrraUp * vIrraDir;
-								// "fIrraCos_Eye < fCosHoriz"  "fIrraCos_Source < fCosHoriz_Source"
-								// Ȼͬʱͬʱ
-								if (fIrraCos_Eye >= fCosHoriz) // ɢ룬۾
-								{
-									// ۵ɢⷽ˥
-									osg::Vec4d vEyeT = CGMKit::GetImageColor(pTransImg.get(),
-										max(0, fIrraCos_Eye - fCosHoriz) / (1 - fCosHoriz),
-										float(t) / IRRA_ALT_NUM,
-										true);
-									// ɢɢⷽ˥
-									osg::Vec4d vIrraT = CGMKit::GetImageColor(pTransImg.get(),
-										max(0, fIrraCos_Source - fCosHoriz_Source) / max(0, 1 - fCosHoriz_Source),
-										fIrraAltCoord,
-										true);
-									// ɢĹ⴫۵㣬ᱻ
-									// ۾λõ͸СΪ
-									vI.x() *= vEyeT.x() / max(1e-20, vIrraT.x());
-									vI.y() *= vEyeT.y() / max(1e-20, vIrraT.y());
-									vI.z() *= vEyeT.z() / max(1e-20, vIrraT.z());
-								}
-								else // fIrraCos_Eye < fCosHoriz  // ɢ룬۾
-								{
-									// ۵λõɢ⡰˥
-									osg::Vec4d vEyeT = CGMKit::GetImageColor(pTransImg.get(),
-										max(0, -fIrraCos_Eye - fCosHoriz) / (1 - fCosHoriz),
-										float(t) / IRRA_ALT_NUM,
-										true);
-									// ɢɢ⡰˥
-									osg::Vec4d vIrraT = CGMKit::GetImageColor(pTransImg.get(),
-										max(0, -fIrraCos_Source - fCosHoriz_Source) / max(0, 1 - fCosHoriz_Source),
-										fIrraAltCoord,
-										true);
-									// ɢĹ⴫۵㣬ᱻ
-									// ۾λõ͸ʴΪĸ
-									vI.x() *= vIrraT.x() / max(1e-20, vEyeT.x());
-									vI.y() *= vIrraT.y() / max(1e-20, vEyeT.y());
-									vI.z() *= vIrraT.z() / max(1e-20, vEyeT.z());
-								}
-								// 
-								double fAA = fSampleNum / int(fSampleNum + 1);
-								vIrradiance += vI * fAA;
-							}
-						}
-					}
-					vIrradiance *= 1.5e6 / double(iPitchNum * iYawNum);
-
-					osg::Vec3d vSumColor = (vAlbedo + vIrradiance) * fmin(1.0, fDensAtmosBottom);
-					int iAddress = IRRA_UP_NUM * t + s;
-					data[3 * iAddress] = float(vSumColor.x());
-					data[3 * iAddress + 1] = float(vSumColor.y());
-					data[3 * iAddress + 2] = float(vSumColor.z());
-				}
-			}
-			); // end parallel_for
-
-			osg::ref_ptr<osg::Image> pImage = new osg::Image();
-			pImage->setImage(iW, iH, 1, GL_RGB32F_ARB, GL_RGB, GL_FLOAT, (unsigned char*)data, osg::Image::USE_NEW_DELETE);
-			std::string strTexPath = m_pConfigData->strCorePath + "Textures/Sphere/Irradiance/Irradiance_";
-			osgDB::writeImageFile(*(pImage.get()),
-				strTexPath + std::to_string(int(fAtmosThick*1e-3)) + "_" + std::to_string(int(fSphereR*1e-3)) + ".tif");
-		}
-	}
-}
-
-void CGMAtmosphere::_MakeAtmosInscattering()
-{
-	/*	Ӿ:						뾶λ	100km
-		16 km									8,16,32,64			*100km
-		32 km									16,32,64,128		*100km
-		64 km			̩̹		32,64,128,256		*100km
-		128 km			졢ľ			64,128,256,512		*100km
-
-		ָ߶ȵһ㣨ΪOmniܷߣڵĹߴõɢֵ
-	*/
-	const double STEP_UNIT = 50;				// 
-	const int iAtmosImageBytes = 4 * sizeof(float)
-		* SCAT_PITCH_NUM * SCAT_LIGHT_NUM * SCAT_COS_NUM * SCAT_ALT_NUM;
-
-	std::string strTransmittancePath = m_pConfigData->strCorePath + "Textures/Sphere/Transmittance/Transmittance_";
-	std::string strIrradiancePath = m_pConfigData->strCorePath + "Textures/Sphere/Irradiance/Irradiance_";
-
-	//int h = 2; //
-	for (int h = 0; h < ATMOS_NUM; h++) //
-	{
-		double fAtmosThick = ATMOS_MIN * 1e3 * exp2(h);				// ȣλ
-		double fDensAtmosBottom = _GetAtmosBottomDens(fAtmosThick);		// ܶ
-
-		//for (int r = 1; r < 2; r++) //  뾶
-		for (int r = 0; r < RADIUS_NUM; r++) //뾶
-		{
-			double fSphereR = (fAtmosThick / ATMOS_2_RADIUS) * exp2(r); //뾶λ
-			double fTopR = fSphereR + fAtmosThick;
-			double fSphereR2 = fSphereR * fSphereR;
-			double fTopR2 = fTopR * fTopR;
-			double fMinDotUL = GetMinDotUL(fAtmosThick, fSphereR);
-
-			//osg::ref_ptr<osg::Image> pTransImg = osgDB::readImageFile(strTransmittancePath
-			//	+ std::to_string(int(fAtmosThick*1e-3)) + "_" + std::to_string(int(fSphereR*1e-3)) + ".tif");
-			//if (!pTransImg.valid()) break;
-
-			osg::ref_ptr<osg::Image> pIrraImg = osgDB::readImageFile(strIrradiancePath
-				+ std::to_string(int(fAtmosThick * 1e-3)) + "_" + std::to_string(int(fSphereR * 1e-3)) + ".tif");
-			if (!pIrraImg.valid()) break;
-
-			// ɢֵ
-			float* data = new float[iAtmosImageBytes];
-
-			parallel_for(int(0), int(SCAT_PITCH_NUM), [&](int s) // ߳
-			//for (int s = 0; s < SCAT_PITCH_NUM; s++) // d0/dH  d0/dh
-			{
-				for (int t = 0; t < SCAT_ALT_NUM; t++) // θ߶ 
-				{
-					double fOmniAltCoord = (SCAT_ALT_NUM - 1 - t) / double(SCAT_ALT_NUM - 1);
-					double fOmniAltRatio = fOmniAltCoord * fOmniAltCoord;
-					// ݺθ߶ȷֶΣԽֶͣԽϸ
-					double fOmniR = CGMKit::Mix(fSphereR + 1, fTopR - 1, fOmniAltRatio);
-					double fOmniR2 = fOmniR * fOmniR;
-
-					// ƽߵֵ
-					double fSinHoriz = fSphereR / fOmniR;
-					// ƽߵֵ
-					double fCosHoriz = -sqrt(max(0, 1 - fSinHoriz * fSinHoriz));
-					// ÿһsոɸߵ
-					// fRatioS  d0/dH  d0/dh
-					// ȡ1.0Сһֵ֤춥λòͻ
-					// ȡ-1.0һֵ֤λòͻ
-					double fRatioS = 2 * double(s) / double(SCAT_PITCH_NUM - 1) - 1;
-					fRatioS = osg::clampBetween(fRatioS, -0.99999, 0.99999);
-					// Ƿ
-					bool bSky = fRatioS > 0.0;
-					// ƽߣߵƽߺյģԶ
-					// Omniƽߵľ
-					double fDisOmni2Horizon = sqrt(fOmniR2 - fSphereR2);
-					// ƽ浽ˮƽ˵ľ
-					double fDisHorizon2Top = sqrt(fTopR2 - fSphereR2);
-					// OmniƽߺĴ˵ľ
-					double fDisOmni2Top = fDisOmni2Horizon + fDisHorizon2Top;
-
-					// ĩ˾루ĬϹ棩
-					double fDisMax = CGMKit::Mix(fDisOmni2Horizon, max(0.0, fOmniR - fSphereR), abs(fRatioS));
-					// Ϸнֵ(ĬϹ)
-					double fCosUV = -(fOmniR2 + fDisMax * fDisMax - fSphereR2) / (2 * fOmniR * fDisMax);
-					if (bSky)// 
-					{
-						// ĩ˾루
-						 fDisMax = CGMKit::Mix(fDisOmni2Top, max(0.0, fTopR - fOmniR), fRatioS);
-						// Ϸнֵ
-						fCosUV = -(fOmniR2 + fDisMax * fDisMax - fTopR2) / (2 * fOmniR * fDisMax);
-					}	
-					double fSinUV = sqrt(1 - fCosUV * fCosUV);
-					double fSampleNum = fDisMax / STEP_UNIT;
-
-					for (int y = 0; y < SCAT_LIGHT_NUM; y++) // Ϸ̫нֵ
-					{
-						// С fMinDotUL Ͳ㣬
-						double fCosUL = 1 - (1 - fMinDotUL) * double(y+1) / double(SCAT_LIGHT_NUM);
-						double fSinUL = sqrt(1 - fCosUL * fCosUL);
-						for (int x = 0; x < SCAT_COS_NUM; x++) // ̫нǵֵ
-						{
-							// ȶlocalϵ
-							// ˳̫վڵƽϣYᣬXᣬͷZᣬԭ
-
-							// localռµOmni
-							osg::Vec3d vOmniPos = osg::Vec3d(0, 0, fOmniR);
-							// localռµ̫
-							osg::Vec3d vSunDir = osg::Vec3d(0, fSinUL, fCosUL);
-							// ߷ڵǰPitchڵĴֱƽƫ
-							double fYaw = osg::PI * (1 - double(x) / double(SCAT_COS_NUM-1));
-							// localռ£߷
-							osg::Vec3d vScatterDir = osg::Vec3d(fSinUV * sin(fYaw), fSinUV * cos(fYaw), fCosUV);
-
-							osg::Vec4d vInscatterSum(0,0,0,0);
-							for (int j = 0; j < int(fSampleNum + 1); j++)
-							{
-								// ע⣺ĲΪ˱ݣ΢Сĵ
-								double fLenS = (j + fmod(fSampleNum, 1)) * STEP_UNIT;
-								// ÿһλ
-								osg::Vec3d vStepPos = vOmniPos + vScatterDir * fLenS;
-								// ÿһϷ
-								osg::Vec3d vStepUp = vStepPos;
-								// ÿһĵľ
-								double fStepR = vStepUp.normalize();
-								// ÿһĺθ߶
-								double fStepAlt = fStepR - fSphereR;
-								// ÿһλõĸ߶
-								double fStepAltCoord = fStepAlt / fAtmosThick;
-								// ÿһɢϵ
-								osg::Vec4d vStepCoef = osg::Vec4d(_RayleighCoefficient(fStepAlt, fAtmosThick), _MieCoefficient(fStepAlt, fAtmosThick));
-								// ÿһϷ̫нֵ
-								float fStepCosUL = vStepUp * vSunDir;
-
-								// ն	
-								osg::Vec4d vI = CGMKit::GetImageColor(pIrraImg.get(),
-									fStepCosUL * 0.5f + 0.5f,
-									fStepAltCoord,
-									true);
-
-								// 
-								vStepCoef *= fSampleNum / int(fSampleNum + 1);
-
-								vInscatterSum += osg::Vec4d(
-									vStepCoef.x() * vI.x(),
-									vStepCoef.y() * vI.y(),
-									vStepCoef.z() * vI.z(),
-									vStepCoef.w() * (vI.x() + vI.y() + vI.z())*0.3333);
-							}
-							vInscatterSum *= STEP_UNIT;
-
-							int iAddress = ((t * SCAT_COS_NUM + x) * SCAT_LIGHT_NUM + y) * SCAT_PITCH_NUM + s;
-							data[4 * iAddress] = float(vInscatterSum.x());
-							data[4 * iAddress + 1] = float(vInscatterSum.y());
-							data[4 * iAddress + 2] = float(vInscatterSum.z());
-							data[4 * iAddress + 3] = float(vInscatterSum.w());
-						}
-					}
-				}
-			}
-			); // end parallel_for
-
-			// 洢dataͼƬ
-			osg::ref_ptr<osg::Image> pAtmosScatteringImage = new osg::Image();
-			pAtmosScatteringImage->setImage(SCAT_PITCH_NUM, SCAT_LIGHT_NUM * SCAT_COS_NUM * SCAT_ALT_NUM, 1,
-				GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)data, osg::Image::USE_NEW_DELETE);
-			std::string strTexPath = m_pConfigData->strCorePath + "Textures/Sphere/Inscattering/Inscattering_";
-			osgDB::writeImageFile(*(pAtmosScatteringImage.get()),
-				strTexPath + std::to_string(int(fAtmosThick*1e-3)) + "_" + std::to_string(int(fSphereR*1e-3)) + ".tif");
-		}
-	}
-}
-
-osg::Vec3d CGMAtmosphere::_Transmittance(const double& fAtmosDens,
-	const double& fR, const double& fAtmosThick,
-	const osg::Vec2d& vP0, const osg::Vec2d& vP1)
-{
-	const int iLoop = 1024;
-	osg::Vec2d vDir = vP1 - vP0;
-	double fLen = vDir.normalize();
-	double fStepLen = fLen / iLoop;
-	osg::Vec3d vSum = osg::Vec3d(0, 0, 0);
-	osg::Vec2d vStepPos = vP0 + vDir * fStepLen * 0.5;
-
-	for (int i = 0; i < iLoop; i++)
-	{
-		double fAlt = vStepPos.length() - fR;
-		double fMie = _MieCoefficient(fAlt, fAtmosThick);
-		osg::Vec3d vScattering = _RayleighCoefficient(fAlt, fAtmosThick) + osg::Vec3d(fMie, fMie, fMie);
-		osg::Vec3d vAbsorption = _MieAbsorption(fAlt, fAtmosThick) + _OzoneAbsorption(fAlt, fAtmosThick);
-		osg::Vec3d vExtinction = vScattering + vAbsorption;
-
-		vSum += vExtinction * fStepLen;
-		vStepPos += vDir * fStepLen;
-	}
-	vSum *= fAtmosDens;
-	return osg::Vec3d(std::exp(-vSum.x()), std::exp(-vSum.y()), std::exp(-vSum.z()));
-}
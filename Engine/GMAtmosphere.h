@@ -15,8 +15,8 @@
 #include "GMCommonUniform.h"
 #include "GMKernel.h"
 #include "GMDispatchCompute.h"
+#include "GMAtmosPrecompute.h"
 
-#include <random>
 #include <osg/Node>
 #include <osg/Texture>
 
@@ -26,18 +26,6 @@ namespace GM
 	Macro Defines
 	*************************************************************************/
 
-	/*************************************************************************
-	constexpr
-	*************************************************************************/
-
-	constexpr double ATMOS_FADE_R = 5.802e-6;		// ĺɢϵ
-	constexpr double ATMOS_FADE_G = 1.3558e-5; 		// ̹ɢϵ
-	constexpr double ATMOS_FADE_B = 3.31e-5; 		// ɢϵ
-
-	constexpr double ATMOS_RAYLEIGH_H = 0.132; 		// ɢ߱
-	constexpr double ATMOS_MIE_H = 0.019; 			// ɢ߱
-	constexpr int ATMOS_MIN = 16;					// СĴȣλkm
-
 	/*************************************************************************
 	 Enums
 	*************************************************************************/
@@ -93,129 +81,13 @@ namespace GM
 		*/
 		inline float GetMinDotUL(const double& fAtmosThick, const double& fRadius) const
 		{
-			float fSinUL = fRadius / (fAtmosThick + fRadius);
-			return -sqrt(std::fmax(0.0f, 1.0f - fSinUL * fSinUL))-0.1f;
-		};
-
-	private:
-
-		/**
-		* @brief ɴ͸ʡ
-		*/
-		void _MakeAtmosTransmittance();
-
-		/**
-		* @brief ɴնȡ
-		*/
-		void _MakeAtmosIrradiance();
-
-		/**
-		* @brief ɴɢ䡱
-		*/
-		void _MakeAtmosInscattering();
-
-		/**
-		* @brief ͸ʡ
-		*/
-		osg::Vec3d _Transmittance(const double& fAtmosDens,
-			const double& fR, const double& fAtmosThick,
-			const osg::Vec2d& vP0, const osg::Vec2d& vP1);
-
-		/**
-		* @brief ݡθ߶ȡܺ͡ȡλõɢϵ
-		* @param fAlt:				θ߶ȣλ
-		* @param fAtmosThick:		ܺȣλ
-		* @return osg::Vec3d:		λõɢϵ,(0,1]
-		*/
-		inline osg::Vec3d _RayleighCoefficient(const double& fAlt, const double& fAtmosThick) const
-		{
-			// ܶ߶˥еɢıߣ8500m
-			double fEarthH = fAtmosThick * ATMOS_RAYLEIGH_H;
-			return osg::Vec3d(ATMOS_FADE_R, ATMOS_FADE_G, ATMOS_FADE_B) * exp2(-std::fmax(0, fAlt) / fEarthH);
-		};
-		/**
-		* @brief ݡθ߶ȡܺ͡ȡλõɢϵ
-		* @param fAlt:				θ߶ȣλ
-		* @param fAtmosThick:		ܺȣλ
-		* @return double:			λõɢϵ,(0,1]
-		*/
-		inline double _MieCoefficient(const double& fAlt, const double& fAtmosThick) const
-		{
-			// ܶ߶˥еɢıߣ1200m
-			double fEarthH = fAtmosThick * ATMOS_MIE_H;
-			return 3.996e-6 * exp2(-std::fmax(0, fAlt) / fEarthH);
-		};
-
-		/**
-		* @brief ɢλ
-		* @param fCosVL:		viewDirLightSourceļнֵ
-		* @return double:		ɢλ
-		*/
-		inline double _RayleighPhase(const double& fCosVL) const
-		{
-			return 3.0 / (16 * osg::PI) * (1 + fCosVL * fCosVL);
-		};
-		/**
-		* @brief ɢλ
-		* @param fCosVL:		viewDirLightSourceļнֵ
-		* @return double:		ɢλ
-		*/
-		inline double _MiePhase(const double& fCosVL) const
-		{
-			constexpr double g = 0.8;
-			constexpr double g2 = g * g;
-			const double a = 3.0 / (8 * osg::PI);
-			constexpr double b = (1 - g2) / (2 + g2);
-			double c = 1.0 + fCosVL * fCosVL;
-			double d = pow(1 + g2 - 2 * g * fCosVL, 1.5);
-			return a * b * (c / d);
-		};
-
-		/**
-		* @brief ɢ䵼µ
-		* @param fAlt:				θ߶ȣλ
-		* @param fAtmosThick:		ܺȣλ
-		* @return osg::Vec3d:		ɢ䵼µձ
-		*/
-		inline osg::Vec3d _MieAbsorption(const double& fAlt, const double& fAtmosThick) const
-		{
-			// ܶ߶˥еɢıߣ1200m
-			double fEarthH = fAtmosThick * ATMOS_MIE_H;
-			double fMie = 4.4e-6 * exp2(-std::fmax(0, fAlt) / fEarthH);
-			return osg::Vec3d(fMie, fMie, fMie);
-		};
-		/**
-		* @brief 
-		* @param fAlt:				θ߶ȣλ
-		* @param fAtmosThick:		ܺȣλ
-		* @return osg::Vec3d:		ձ
-		*/
-		inline osg::Vec3d _OzoneAbsorption(const double& fAlt, const double& fAtmosThick) const
-		{
-			// еĳozoneҲߵգԲͬĹŲͬЧʣɢûй
-			// һض߶ȵĲ㣬ͨĸ߶ȡ͡ȡзֱȡ 25km  15km
-			// ̫ӣûۿԾͲЩأ͵һֻɫб仯
-			double fCenterHeight = fAtmosThick * 0.39;
-			double fHalfThick = fAtmosThick * 0.234;
-			return osg::Vec3d(0.65e-6, 1.881e-6, 0.085e-6) * std::fmax(0, 1- std::abs(fAlt- fCenterHeight) / fHalfThick);
-		};
-
-		/**
-		* @brief ݡܺȡرԴܶȣ涨ƽܶΪ1
-		* @param fAtmosThick:		ܺȣλ
-		* @return double:			رԴܶ
-		*/
-		inline double _GetAtmosBottomDens(const double& fAtmosThick) const
-		{
-			// ֤ƽܶΪ1
-			return fAtmosThick / 64000.0;
+			return CGMAtmosPrecompute::GetMinDotUL(fAtmosThick, fRadius);
 		};
 
 		// 
 	private:
 		SGMConfigData*									m_pConfigData;					//!< 
 
-		std::default_random_engine						m_iRandom;						//!< ֵ
 		std::string										m_strCoreModelPath;				//!< ģԴ·
 		std::vector<osg::ref_ptr<osg::Texture3D>>		m_pInscatteringTexVector;		//!< ɢ
 	};
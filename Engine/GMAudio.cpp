@@ -28,8 +28,9 @@ CGMAudio Methods
 
 /** @brief  */
 CGMAudio::CGMAudio():
-	m_pConfigData(nullptr),m_streamAudio(0),
+	m_pConfigData(nullptr), m_streamAudio(0), m_iActiveSlot(0), m_bPlayPending(false), m_iAudioStartTime(0),
 	m_strCoreAudioPath("Audio/"), m_strAudioPath(L"Music/"), m_strCurrentFile(L""),
+	m_strNextFile(L""), m_bNextQueued(false), m_bNextSlotStale(false), m_iSwitchCount(0),
 	m_eAudioState(EGMA_STA_MUTE),
 	m_iAudioLastTime(0), m_iAudioCurrentTime(0), m_iAudioDuration(0),
 	m_fDeltaStep(0.0f), m_fConstantStep(0.1f), m_bWelcomeStart(false), m_bWelcomeEnd(false),
@@ -40,6 +41,8 @@ CGMAudio::CGMAudio():
 /** @brief  */
 CGMAudio::~CGMAudio()
 {
+	_FreeOutput();
+	m_audioDecoder.Stop();
 }
 
 /** @brief ʼ */
@@ -50,6 +53,8 @@ bool CGMAudio::Init(SGMConfigData * pConfigData)
 	m_fVolume = m_pConfigData->fVolume;
 
 	_InitBASS();
+	m_audioDecoder.SetCrossfade(m_pConfigData->fCrossfade);
+	m_audioDecoder.Start();
 	// ΪӭЧ׼
 	_PreWelcome();
 
@@ -69,12 +74,18 @@ bool CGMAudio::Update(double dDeltaTime)
 		if (m_iWelcomeDuration <= static_cast<int>(pos_sec * 1000))
 		{
 			BASS_StreamFree(m_streamAudio);
+			m_streamAudio = 0;
 			m_eAudioState = EGMA_STA_MUTE;
 
 			m_bWelcomeEnd = true;
 		}
 	}
 
+	_UpdateTransition();
+	_UpdateOutput();
+	_UpdatePreload();
+	_UpdateSpectrum(float(dDeltaTime));
+
 	float fDeltaTime = float(dDeltaTime);
 	fDeltaTime += m_fDeltaStep;
 	float updateStep = m_fConstantStep;
@@ -101,6 +112,12 @@ bool CGMAudio::IsWelcomeFinished()
 	return m_bWelcomeEnd;
 }
 
+void CGMAudio::PreloadAudio(const std::wstring& strAudioFile)
+{
+	// 򿪺Ŷ_UpdatePreloadɣһ׵ڼۻܸ
+	m_strNextFile = strAudioFile;
+}
+
 bool CGMAudio::SetCurrentAudio(std::wstring& strAudioFile)
 {
 	if (!m_bWelcomeEnd) return false;
@@ -126,13 +143,28 @@ void CGMAudio::AudioControl(EGMA_COMMAND command)
 	{
 	case EGMA_CMD_OPEN:
 	{
-		std::wstring strFile = m_pConfigData->strMediaPath + m_strAudioPath + m_strCurrentFile;
-		m_streamAudio = BASS_StreamCreateFile(FALSE, strFile.c_str(), 0, 0, 0);
+		const std::wstring strFile = _GetFullPath(m_strCurrentFile);
+		// Ѿ򿪣ڴ򿪣ͬһļظ
+		if (strFile == m_audioDecoder.GetFile(m_iActiveSlot)) break;
 
-		// ȡǰƵʱ
-		QWORD length_bytes = BASS_ChannelGetLength(m_streamAudio, BASS_POS_BYTE);
-		double length_sec = BASS_ChannelBytes2Seconds(m_streamAudio, length_bytes);
-		m_iAudioDuration = static_cast<int>(std::fmax(0.0,length_sec) * 1000);
+		_FreeOutput();
+		const int iNextSlot = (m_iActiveSlot + 1) % GM_DECODE_SLOT_NUM;
+		if (!m_bNextSlotStale && strFile == m_audioDecoder.GetFile(iNextSlot))
+		{
+			// ԤУֱл
+			m_audioDecoder.Close(m_iActiveSlot);
+			m_iActiveSlot = iNextSlot;
+		}
+		else
+		{
+			// ļڽ߳д򿪣ʱԤϺ_UpdateOutputлȡ
+			m_audioDecoder.Open(m_iActiveSlot, strFile);
+		}
+		m_iAudioDuration = 0;
+		m_iAudioStartTime = 0;
+		m_bPlayPending = false;
+		// ǰƵˣԤԼһҪѡ
+		m_strNextFile = L"";
 
 		//const char* tag = BASS_ChannelGetTags(m_streamAudio, BASS_TAG_ID3V2);
 		// https://blog.csdn.net/u013401219/article/details/48103315
@@ -146,27 +178,45 @@ void CGMAudio::AudioControl(EGMA_COMMAND command)
 	break;
 	case EGMA_CMD_PLAY:
 	{
-		BASS_ChannelSetAttribute(m_streamAudio, BASS_ATTRIB_VOL, m_fVolume);
-		BASS_ChannelPlay(m_streamAudio, FALSE);
+		const unsigned long long iEndFrame = m_audioDecoder.GetEndFrame();
+		if (0 != m_streamAudio && GM_DECODE_NO_FRAME != iEndFrame && _GetPlayedFrames() >= iEndFrame)
+		{
+			// Ѿϣͷʼ
+			_SeekTo(0);
+			m_bPlayPending = true;
+		}
+		else if (0 != m_streamAudio)
+		{
+			BASS_ChannelSetAttribute(m_streamAudio, BASS_ATTRIB_VOL, m_fVolume);
+			BASS_ChannelPlay(m_streamAudio, FALSE);
+		}
+		else
+		{
+			// Ԥ壬ٲ
+			m_bPlayPending = true;
+		}
 		m_eAudioState = EGMA_STA_PLAY;
 	}
 	break;
 	case EGMA_CMD_CLOSE:
 	{
-		BASS_StreamFree(m_streamAudio);
+		_FreeOutput();
+		m_audioDecoder.Close(m_iActiveSlot);
+		m_bPlayPending = false;
 		m_eAudioState = EGMA_STA_MUTE;
 	}
 	break;
 	case EGMA_CMD_PAUSE:
 	{
-		BASS_ChannelPause(m_streamAudio);
+		if (0 != m_streamAudio) BASS_ChannelPause(m_streamAudio);
+		m_bPlayPending = false;
 		m_eAudioState = EGMA_STA_PAUSE;
 	}
 	break;
 	case EGMA_CMD_STOP:
 	{
-		BASS_ChannelStop(m_streamAudio);
 		_SeekTo(0);
+		m_bPlayPending = false;
 		m_eAudioState = EGMA_STA_MUTE;
 	}
 	break;
@@ -177,17 +227,15 @@ void CGMAudio::AudioControl(EGMA_COMMAND command)
 
 bool CGMAudio::IsAudioOver()
 {
-	if (EGMA_STA_PLAY == m_eAudioState
-		&& m_iAudioCurrentTime == m_iAudioLastTime
-		&& m_iAudioCurrentTime != 0
-		&& m_iAudioCurrentTime > m_iAudioDuration - 100)
-	{
-		return true;
-	}
-	else
-	{
-		return false;
-	}
+	if (EGMA_STA_PLAY != m_eAudioState) return false;
+	// ļ޷ʱֱΪϣԱлһ
+	if (EGMDECODE_FAILED == m_audioDecoder.GetState(m_iActiveSlot)) return true;
+
+	if (0 == m_streamAudio) return false;
+
+	// ڻصм¼Ľ֡λõһ֡
+	const unsigned long long iEndFrame = m_audioDecoder.GetEndFrame();
+	return GM_DECODE_NO_FRAME != iEndFrame && _GetPlayedFrames() >= iEndFrame;
 }
 
 bool CGMAudio::SetVolume(float fLevel)
@@ -198,7 +246,7 @@ bool CGMAudio::SetVolume(float fLevel)
 
 float CGMAudio::GetLevel()
 {
-	if (EGMA_STA_PLAY != m_eAudioState || IsAudioOver())
+	if (EGMA_STA_PLAY != m_eAudioState || 0 == m_streamAudio || IsAudioOver())
 	{
 		return 0.0f;
 	}
@@ -255,13 +303,177 @@ void CGMAudio::_InnerUpdate(float updateStep)
 	m_iAudioCurrentTime = _GetAudioCurrentTime();
 }
 
+void CGMAudio::_UpdateOutput()
+{
+	if (!m_bWelcomeEnd || 0 != m_streamAudio) return;
+	if (EGMDECODE_READY != m_audioDecoder.GetState(m_iActiveSlot)) return;
+
+	m_streamAudio = m_audioDecoder.CreateOutput(m_iActiveSlot);
+	if (0 == m_streamAudio) return;
+
+	m_iAudioDuration = static_cast<int>(m_audioDecoder.GetDuration(m_iActiveSlot) * 1000);
+	m_iAudioStartTime = static_cast<int>(m_audioDecoder.GetStartTime(m_iActiveSlot) * 1000);
+	m_bNextQueued = false;
+	BASS_ChannelSetAttribute(m_streamAudio, BASS_ATTRIB_VOL, m_fVolume);
+	if (m_bPlayPending)
+	{
+		BASS_ChannelPlay(m_streamAudio, FALSE);
+		m_bPlayPending = false;
+	}
+}
+
+void CGMAudio::_UpdateTransition()
+{
+	if (0 == m_streamAudio) return;
+
+	const unsigned int iSwitchCount = m_audioDecoder.GetSwitchCount();
+	if (iSwitchCount == m_iSwitchCount) return;
+	// л֡ڲŻУûб
+	const unsigned long long iSwitchFrame = m_audioDecoder.GetSwitchFrame();
+	if (_GetPlayedFrames() < iSwitchFrame) return;
+
+	BASS_CHANNELINFO sInfo;
+	if (!BASS_ChannelGetInfo(m_streamAudio, &sInfo) || 0 == sInfo.freq) return;
+
+	m_iSwitchCount = iSwitchCount;
+	m_iActiveSlot = m_audioDecoder.GetMixSlot();
+	// ԤԼŶֱ֮޸ĹļԽʵʴ򿪵ļΪ׼
+	m_strCurrentFile = m_audioDecoder.GetFile(m_iActiveSlot).substr(_GetFullPath(L"").size());
+	m_strNextFile = L"";
+	m_bNextQueued = false;
+	// һ׵ĽѾ꣨ڵر
+	m_bNextSlotStale = true;
+
+	// ûؽƵʱл֡ʼ
+	m_iAudioDuration = static_cast<int>(m_audioDecoder.GetDuration(m_iActiveSlot) * 1000);
+	m_iAudioStartTime = static_cast<int>(m_audioDecoder.GetStartTime(m_iActiveSlot) * 1000)
+		- static_cast<int>(iSwitchFrame * 1000 / sInfo.freq);
+	m_iAudioCurrentTime = _GetAudioCurrentTime();
+	m_iAudioLastTime = m_iAudioCurrentTime;
+}
+
+void CGMAudio::_UpdatePreload()
+{
+	if (!m_bWelcomeEnd) return;
+	// Ѿлûвŵл֡_UpdateTransition
+	if (m_audioDecoder.GetSwitchCount() != m_iSwitchCount) return;
+
+	const int iNextSlot = (m_iActiveSlot + 1) % GM_DECODE_SLOT_NUM;
+	const std::wstring strFile = (L"" == m_strNextFile) ? L"" : _GetFullPath(m_strNextFile);
+	if (m_bNextQueued)
+	{
+		if (strFile == m_audioDecoder.GetFile(iNextSlot)) return;
+		// ԤԼˣȳŶӣʧ˵ոлȥ
+		if (!m_audioDecoder.Unqueue(iNextSlot)) return;
+		m_bNextQueued = false;
+	}
+
+	// һ׻ڵ
+	if (m_audioDecoder.IsMixing(iNextSlot)) return;
+	if (m_bNextSlotStale)
+	{
+		m_audioDecoder.Close(iNextSlot);
+		m_bNextSlotStale = false;
+	}
+
+	if (L"" == strFile)
+	{
+		if (L"" != m_audioDecoder.GetFile(iNextSlot)) m_audioDecoder.Close(iNextSlot);
+		return;
+	}
+	if (strFile != m_audioDecoder.GetFile(iNextSlot))
+	{
+		m_audioDecoder.Open(iNextSlot, strFile);
+	}
+	// ûʱֻԤ壬Ŷ
+	if (0 != m_streamAudio)
+	{
+		m_audioDecoder.Queue(iNextSlot);
+		m_bNextQueued = true;
+	}
+}
+
+unsigned long long CGMAudio::_GetPlayedFrames() const
+{
+	BASS_CHANNELINFO sInfo;
+	if (0 == m_streamAudio || !BASS_ChannelGetInfo(m_streamAudio, &sInfo) || 0 == sInfo.chans) return 0;
+
+	// еصλãŻе
+	const QWORD iBytes = BASS_ChannelGetPosition(m_streamAudio, BASS_POS_BYTE);
+	if ((QWORD)-1 == iBytes) return 0;
+	return iBytes / (sizeof(float) * sInfo.chans);
+}
+
+void CGMAudio::_UpdateSpectrum(const float fDeltaTime)
+{
+	size_t iFrames = 0;
+	if (EGMA_STA_PLAY == m_eAudioState && 0 != m_streamAudio
+		&& BASS_ACTIVE_PLAYING == BASS_ChannelIsActive(m_streamAudio))
+	{
+		BASS_CHANNELINFO sInfo;
+		if (BASS_ChannelGetInfo(m_streamAudio, &sInfo) && 0 < sInfo.chans)
+		{
+			if (float(sInfo.freq) != m_spectrum.GetSampleRate())
+			{
+				m_spectrum.Init(float(sInfo.freq));
+			}
+
+			// еͨصǲŻмݣı䲥λ
+			m_pcmVector.resize(size_t(GM_SPECTRUM_FFT_SIZE) * sInfo.chans);
+			const DWORD iBytes = BASS_ChannelGetData(m_streamAudio, m_pcmVector.data(),
+				DWORD(m_pcmVector.size() * sizeof(float)) | BASS_DATA_FLOAT);
+			if ((DWORD)-1 != iBytes)
+			{
+				iFrames = iBytes / sizeof(float) / sInfo.chans;
+				m_monoVector.resize(iFrames);
+				const float fInvChans = 1.0f / sInfo.chans;
+				for (size_t i = 0; i < iFrames; i++)
+				{
+					float fSum = 0.0f;
+					for (DWORD c = 0; c < sInfo.chans; c++)
+					{
+						fSum += m_pcmVector[i * sInfo.chans + c];
+					}
+					m_monoVector[i] = fSum * fInvChans;
+				}
+			}
+		}
+	}
+	m_spectrum.Analyze(m_monoVector.data(), iFrames, fDeltaTime);
+}
+
+void CGMAudio::_FreeOutput()
+{
+	if (!m_bWelcomeEnd || 0 == m_streamAudio) return;
+
+	m_audioDecoder.FreeOutput();
+	m_streamAudio = 0;
+	m_bNextQueued = false;
+
+	const unsigned int iSwitchCount = m_audioDecoder.GetSwitchCount();
+	if (iSwitchCount != m_iSwitchCount)
+	{
+		// Ѿлл֡ûвŵлһѾһ֣Ҫ´
+		m_iSwitchCount = iSwitchCount;
+		m_bNextSlotStale = true;
+	}
+}
+
+std::wstring CGMAudio::_GetFullPath(const std::wstring& strAudioFile) const
+{
+	return m_pConfigData->strMediaPath + m_strAudioPath + strAudioFile;
+}
+
 int CGMAudio::_GetAudioCurrentTime()
 {
+	// תԤڼûϴελ
+	if (0 == m_streamAudio) return m_iAudioCurrentTime;
+
 	QWORD pos_bytes;
 	pos_bytes = BASS_ChannelGetPosition(m_streamAudio, BASS_POS_BYTE);
 	double pos_sec;
 	pos_sec = BASS_ChannelBytes2Seconds(m_streamAudio, pos_bytes);
-	return static_cast<int>(pos_sec * 1000);
+	return m_iAudioStartTime + static_cast<int>(pos_sec * 1000);
 }
 
 bool CGMAudio::_SeekTo(int iTime)
@@ -270,10 +482,21 @@ bool CGMAudio::_SeekTo(int iTime)
 	{
 		iTime = m_iAudioDuration;
 	}
+	if (iTime < 0)
+	{
+		iTime = 0;
+	}
 	m_iAudioCurrentTime = iTime;
-	double pos_sec = static_cast<double>(iTime) / 1000.0;
-	QWORD pos_bytes = BASS_ChannelSeconds2Bytes(m_streamAudio, pos_sec);
-	return BASS_ChannelSetPosition(m_streamAudio, pos_bytes, BASS_POS_BYTE);
+	m_iAudioLastTime = iTime;
+	if (!m_bWelcomeEnd || EGMDECODE_EMPTY == m_audioDecoder.GetState(m_iActiveSlot)) return false;
+
+	// ͷ֤BASSٶȡý߳תԤ_UpdateOutput
+	const bool bPlaying = m_bPlayPending
+		|| (0 != m_streamAudio && BASS_ACTIVE_PLAYING == BASS_ChannelIsActive(m_streamAudio));
+	_FreeOutput();
+	m_audioDecoder.Seek(m_iActiveSlot, static_cast<double>(iTime) / 1000.0);
+	m_bPlayPending = bPlaying;
+	return true;
 }
 
 void CGMAudio::_PreWelcome()
@@ -12,6 +12,8 @@
 #pragma once
 
 #include "GMCommon.h"
+#include "GMAudioDecoder.h"
+#include "GMSpectrum.h"
 #include "bass.h"
 #include <osg/Vec2f>
 namespace GM
@@ -97,6 +99,29 @@ namespace GM
 		*/
 		bool SetCurrentAudio(std::wstring& strAudioFile);
 
+		/**
+		* PreloadAudio
+		* ԤԼһƵں̨Ԥȴ򿪲壬ǰƵŵβʱ浭޷죩νӹȥ
+		* ֮SetCurrentAudioƵʱҲšǰƵıԤԼᱻ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strAudioFile:	һƵļƣ磺xxx.mp3L""ʾȡԤԼ
+		* @return void
+		*/
+		void PreloadAudio(const std::wstring& strAudioFile);
+
+		/**
+		* GetNextAudio
+		* ȡԤԼһƵļ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return std::wstring һƵļƣ磺xxx.mp3,L""
+		*/
+		inline std::wstring GetNextAudio()
+		{
+			return m_strNextFile;
+		}
+
 		/**
 		* GetCurrentAudio
 		* ȡǰƵļ
@@ -117,7 +142,8 @@ namespace GM
 		void AudioControl(EGMA_COMMAND command);
 
 		/**
-		* @brief жƵǷ񲥷
+		* @brief жƵǷ񲥷ϣѾŵ¼Ľ֡
+		* @brief ԤԼһѾνʱGetCurrentAudioһ
 		* @return bool ϷtrueδϷfalse
 		*/
 		bool IsAudioOver();
@@ -150,6 +176,18 @@ namespace GM
 		*/
 		float GetLevel();
 
+		/**
+		* GetSpectrum
+		* ȡǰ֡ƽĶƵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return std::vector<float> GM_SPECTRUM_BAND_NUMΧ[0.0f,1.0f]Ƶǰ
+		*/
+		inline const std::vector<float>& GetSpectrum() const
+		{
+			return m_spectrum.GetBands();
+		}
+
 		/**
 		* GetAudioDuration
 		* ȡǰƵʱλms
@@ -209,6 +247,71 @@ namespace GM
 			);
 		}
 
+		/**
+		* _UpdateOutput
+		* ǰԤϺ󣬴Ҫʼ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void _UpdateOutput();
+
+		/**
+		* _UpdateTransition
+		* лԤԼһ׺󣬵ŵл֡ʱһΪǰƵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void _UpdateTransition();
+
+		/**
+		* _UpdatePreload
+		* ԤԼһڿеĽд򿪲Ŷӣһ׻ڵʱȵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void _UpdatePreload();
+
+		/**
+		* _GetPlayedFrames
+		* Ѿŵ֡
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return unsigned long long ֡ţûʱΪ0
+		*/
+		unsigned long long _GetPlayedFrames() const;
+
+		/**
+		* _UpdateSpectrum
+		* ȡڲŵPCMƵ׷ʱƵ˥
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fDeltaTime:	֡λs
+		* @return void
+		*/
+		void _UpdateSpectrum(const float fDeltaTime);
+
+		/**
+		* _FreeOutput
+		* ͷŵǰͷźBASSٵøĻصԤԼһҪŶ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void _FreeOutput();
+
+		/**
+		* _GetFullPath
+		* Ƶļ -> ·
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strAudioFile:	Ƶļƣ磺xxx.mp3
+		* @return std::wstring:	·
+		*/
+		std::wstring _GetFullPath(const std::wstring& strAudioFile) const;
+
 		/**
 		* _GetAudioCurrentTime
 		* ȡǰŵλãʱ꣩
@@ -243,10 +346,18 @@ namespace GM
 	private:
 		SGMConfigData*								m_pConfigData;					//!< 
 
-		HSTREAM										m_streamAudio;
+		CGMAudioDecoder								m_audioDecoder;					//!< ̨
+		HSTREAM										m_streamAudio;					//!< ӭƵӭΪǰ۵
+		int											m_iActiveSlot;					//!< ǰƵڵĽ
+		bool										m_bPlayPending;					//!< 
+		int											m_iAudioStartTime;				//!< ǰƵʱ,λms
 		std::string									m_strCoreAudioPath;				//!< Ƶ·
 		std::wstring								m_strAudioPath;					//!< ִ·
 		std::wstring								m_strCurrentFile;				//!< ڲŵļ,XXX.mp3
+		std::wstring								m_strNextFile;					//!< ԤԼһļ,XXX.mp3
+		bool										m_bNextQueued;					//!< һѾڻŶ
+		bool										m_bNextSlotStale;				//!< һѱȡҪرպܸ
+		unsigned int								m_iSwitchCount;					//!< ѾĻл
 		EGMA_STATE									m_eAudioState;					//!< ǰ״̬
 		int											m_iAudioLastTime;				//!< һ֡Ƶʱ,λms
 		int											m_iAudioCurrentTime;			//!< ǰ֡Ƶʱ,λms
@@ -259,5 +370,9 @@ namespace GM
 		int											m_iWelcomeDuration;				//!< ӭƵʱ,λms
 
 		float										m_fVolume;						//!< 
+
+		CGMSpectrum									m_spectrum;						//!< Ƶ׷
+		std::vector<float>							m_pcmVector;					//!< ӲŻȡĽPCM
+		std::vector<float>							m_monoVector;					//!< ϳɵPCM
 	};
 }	// GM
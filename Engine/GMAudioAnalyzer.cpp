@@ -0,0 +1,355 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioAnalyzer.cpp
+/// @brief		Galaxy-Music Engine - GMAudioAnalyzer
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioAnalyzer.h"
+#include "bass.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+using namespace GM;
+namespace fs = std::filesystem;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+#define GM_ANALYZE_EXCERPT_SEC		(90.0)			// ÿƵʱλs
+#define GM_ANALYZE_SKIP_SEC			(30.0)			// ǰʱλs
+#define GM_ANALYZE_CHUNK_FRAMES		(8192)			// ÿν֡
+#define GM_HASH_BLOCK				(65536)			// ļϣȡβȣλֽ
+#define GM_FEATURE_CACHE_MAGIC		(0x46414D47)	// "GMAF"
+#define GM_FEATURE_CACHE_VERSION	(1)				// ʽ汾޸ĸʽ
+
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* ļͷ
+* @param iChecksum:			ļͷ֮м¼FNV-1aУ
+*/
+struct SGMFeatureCacheHeader
+{
+	unsigned int		iMagic;
+	unsigned int		iVersion;
+	unsigned int		iFeatureVersion;
+	unsigned int		iRecordSize;
+	unsigned long long	iRecordNum;
+	unsigned long long	iChecksum;
+};
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief FNV-1a ϣiHashΪһεĽ */
+static unsigned long long _FNV1a(const unsigned char* pData, const size_t iBytes,
+	unsigned long long iHash = 14695981039346656037ULL)
+{
+	for (size_t i = 0; i < iBytes; i++)
+	{
+		iHash ^= pData[i];
+		iHash *= 1099511628211ULL;
+	}
+	return iHash;
+}
+
+/*************************************************************************
+CGMAudioAnalyzer Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioAnalyzer::CGMAudioAnalyzer() :
+	m_strCacheFile(""), m_bCacheLoaded(false),
+	m_iNext(0), m_iRunning(0), m_bStop(false)
+{
+}
+
+/** @brief  */
+CGMAudioAnalyzer::~CGMAudioAnalyzer()
+{
+	Stop();
+}
+
+bool CGMAudioAnalyzer::Start(const std::wstring& strPath, const std::vector<std::wstring>& nameVector, const std::string& strCacheFile)
+{
+	if (m_iRunning > 0) return false;
+	// һ߳Ѿȫд뻺棩պµһ
+	for (auto& itr : m_threadVector)
+	{
+		if (itr.joinable()) itr.join();
+	}
+	m_threadVector.clear();
+	if (nameVector.empty()) return true;
+
+	if (!m_bCacheLoaded || m_strCacheFile != strCacheFile)
+	{
+		m_strCacheFile = strCacheFile;
+		_LoadCache();
+		m_bCacheLoaded = true;
+	}
+
+	m_strPath = strPath;
+	m_nameVector = nameVector;
+	m_iNext = 0;
+	m_bStop = false;
+
+	// һĸȾ߳
+	const unsigned int iCores = std::thread::hardware_concurrency();
+	const size_t iThreadNum = (std::min)(nameVector.size(), size_t(iCores > 1 ? iCores - 1 : 1));
+	m_iRunning = int(iThreadNum);
+	for (size_t i = 0; i < iThreadNum; i++)
+	{
+		m_threadVector.push_back(std::thread(&CGMAudioAnalyzer::_Work, this));
+	}
+	return true;
+}
+
+void CGMAudioAnalyzer::Stop()
+{
+	m_bStop = true;
+	for (auto& itr : m_threadVector)
+	{
+		if (itr.joinable()) itr.join();
+	}
+	m_threadVector.clear();
+	m_iRunning = 0;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_resultDeque.clear();
+}
+
+bool CGMAudioAnalyzer::IsRunning() const
+{
+	if (m_iRunning > 0) return true;
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return !m_resultDeque.empty();
+}
+
+size_t CGMAudioAnalyzer::PopResults(std::vector<SGMAudioAnalysis>& resultVector, const size_t iMaxNum)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	size_t iNum = 0;
+	while (iNum < iMaxNum && !m_resultDeque.empty())
+	{
+		resultVector.push_back(std::move(m_resultDeque.front()));
+		m_resultDeque.pop_front();
+		iNum++;
+	}
+	return iNum;
+}
+
+bool CGMAudioAnalyzer::HashFile(const std::wstring& strFile, unsigned long long& iHash)
+{
+	std::error_code ec;
+	const unsigned long long iSize = fs::file_size(fs::path(strFile), ec);
+	if (ec) return false;
+
+	std::ifstream file(fs::path(strFile), std::ios::binary);
+	if (!file) return false;
+
+	iHash = _FNV1a((const unsigned char*)&iSize, sizeof(iSize));
+	std::vector<unsigned char> blockVector(GM_HASH_BLOCK);
+	const size_t iHead = size_t((std::min)(iSize, (unsigned long long)GM_HASH_BLOCK));
+	if (!file.read((char*)blockVector.data(), iHead)) return false;
+	iHash = _FNV1a(blockVector.data(), iHead, iHash);
+
+	if (iSize > GM_HASH_BLOCK)
+	{
+		const unsigned long long iTailStart = (std::max)(iSize - GM_HASH_BLOCK, (unsigned long long)GM_HASH_BLOCK);
+		const size_t iTail = size_t(iSize - iTailStart);
+		file.seekg(std::streamoff(iTailStart));
+		if (!file.read((char*)blockVector.data(), iTail)) return false;
+		iHash = _FNV1a(blockVector.data(), iTail, iHash);
+	}
+	return true;
+}
+
+void CGMAudioAnalyzer::_Work()
+{
+	// ÿ߳ʹøԵȡͻ棬ֻ֮߳š棨ֻͽ
+	CGMAudioFeature audioFeature;
+	std::vector<float> monoVector;
+	while (!m_bStop)
+	{
+		const size_t i = m_iNext.fetch_add(1);
+		if (i >= m_nameVector.size()) break;
+
+		SGMAudioAnalysis sResult(m_nameVector[i]);
+		const std::wstring strFile = m_strPath + sResult.name;
+		unsigned long long iHash = 0;
+		const bool bHashed = HashFile(strFile, iHash);
+		auto cacheItr = bHashed ? m_cacheMap.find(iHash) : m_cacheMap.end();
+		if (cacheItr != m_cacheMap.end())
+		{
+			sResult.sFeature = cacheItr->second;
+			sResult.bValid = true;
+		}
+		else
+		{
+			float fSampleRate = 0.0f;
+			if (bHashed && _Decode(strFile, monoVector, fSampleRate))
+			{
+				sResult.bValid = audioFeature.Extract(monoVector.data(), monoVector.size(), fSampleRate, sResult.sFeature);
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (sResult.bValid && cacheItr == m_cacheMap.end())
+		{
+			m_newRecordVector.push_back({ iHash, sResult.sFeature });
+		}
+		m_resultDeque.push_back(sResult);
+	}
+
+	// ̶߳Ѿ˳ѭٶȡm_cacheMap
+	if (1 == m_iRunning.fetch_sub(1))
+	{
+		_SaveCache();
+	}
+}
+
+bool CGMAudioAnalyzer::_Decode(const std::wstring& strFile, std::vector<float>& monoVector, float& fSampleRate) const
+{
+	monoVector.clear();
+	// ֻ룬ҪPRESCANתλӰ
+	HSTREAM stream = BASS_StreamCreateFile(FALSE, strFile.c_str(), 0, 0,
+		BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT | BASS_SAMPLE_MONO);
+	BASS_CHANNELINFO sInfo;
+	if (0 == stream || !BASS_ChannelGetInfo(stream, &sInfo) || 0 == sInfo.chans || 0 == sInfo.freq)
+	{
+		if (stream) BASS_StreamFree(stream);
+		return false;
+	}
+
+	// ǰ࣬ȡмһΣǰͽβͨûȶĽ
+	const double fDuration = BASS_ChannelBytes2Seconds(stream, BASS_ChannelGetLength(stream, BASS_POS_BYTE));
+	if (fDuration > GM_ANALYZE_EXCERPT_SEC)
+	{
+		const double fSkip = (std::min)(GM_ANALYZE_SKIP_SEC, (fDuration - GM_ANALYZE_EXCERPT_SEC) * 0.5);
+		BASS_ChannelSetPosition(stream, BASS_ChannelSeconds2Bytes(stream, fSkip), BASS_POS_BYTE);
+	}
+
+	const size_t iChans = sInfo.chans;
+	const size_t iMaxFrames = size_t(GM_ANALYZE_EXCERPT_SEC * sInfo.freq);
+	monoVector.reserve(iMaxFrames);
+	std::vector<float> chunkVector(GM_ANALYZE_CHUNK_FRAMES * iChans);
+	const float fScale = 1.0f / float(iChans);
+	while (monoVector.size() < iMaxFrames && !m_bStop)
+	{
+		const DWORD iBytes = BASS_ChannelGetData(stream, chunkVector.data(),
+			DWORD(chunkVector.size() * sizeof(float)) | BASS_DATA_FLOAT);
+		if (DWORD(-1) == iBytes || 0 == iBytes) break;
+
+		const size_t iFrames = iBytes / (sizeof(float) * iChans);
+		for (size_t f = 0; f < iFrames; f++)
+		{
+			const float* pFrame = chunkVector.data() + f * iChans;
+			float fSum = 0.0f;
+			for (size_t c = 0; c < iChans; c++) fSum += pFrame[c];
+			monoVector.push_back(fSum * fScale);
+		}
+	}
+	BASS_StreamFree(stream);
+
+	fSampleRate = float(sInfo.freq);
+	return !monoVector.empty();
+}
+
+void CGMAudioAnalyzer::_LoadCache()
+{
+	m_cacheMap.clear();
+
+	std::ifstream file(m_strCacheFile, std::ios::binary);
+	if (!file) return;
+
+	SGMFeatureCacheHeader sHeader;
+	if (!file.read((char*)&sHeader, sizeof(SGMFeatureCacheHeader))
+		|| GM_FEATURE_CACHE_MAGIC != sHeader.iMagic
+		|| GM_FEATURE_CACHE_VERSION != sHeader.iVersion
+		|| GM_FEATURE_VERSION != sHeader.iFeatureVersion
+		|| sizeof(SGMFeatureRecord) != sHeader.iRecordSize
+		|| sHeader.iRecordNum > (1ULL << 24))
+	{
+		return;
+	}
+
+	std::vector<SGMFeatureRecord> recordVector(size_t(sHeader.iRecordNum));
+	const size_t iBytes = recordVector.size() * sizeof(SGMFeatureRecord);
+	if (!file.read((char*)recordVector.data(), iBytes)) return;
+	if (sHeader.iChecksum != _FNV1a((const unsigned char*)recordVector.data(), iBytes)) return;
+
+	m_cacheMap.reserve(recordVector.size());
+	for (auto& itr : recordVector)
+	{
+		m_cacheMap[itr.iHash] = itr.sFeature;
+	}
+}
+
+void CGMAudioAnalyzer::_SaveCache()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_newRecordVector.empty()) return;
+		for (auto& itr : m_newRecordVector)
+		{
+			m_cacheMap[itr.iHash] = itr.sFeature;
+		}
+		m_newRecordVector.clear();
+	}
+	if (m_strCacheFile.empty()) return;
+
+	std::vector<SGMFeatureRecord> recordVector;
+	recordVector.reserve(m_cacheMap.size());
+	for (auto& itr : m_cacheMap)
+	{
+		SGMFeatureRecord sRecord;
+		// ṹֽҲУ飬
+		memset(&sRecord, 0, sizeof(SGMFeatureRecord));
+		sRecord.iHash = itr.first;
+		sRecord.sFeature = itr.second;
+		recordVector.push_back(sRecord);
+	}
+
+	SGMFeatureCacheHeader sHeader;
+	memset(&sHeader, 0, sizeof(SGMFeatureCacheHeader));
+	sHeader.iMagic = GM_FEATURE_CACHE_MAGIC;
+	sHeader.iVersion = GM_FEATURE_CACHE_VERSION;
+	sHeader.iFeatureVersion = GM_FEATURE_VERSION;
+	sHeader.iRecordSize = sizeof(SGMFeatureRecord);
+	sHeader.iRecordNum = recordVector.size();
+	sHeader.iChecksum = _FNV1a((const unsigned char*)recordVector.data(), recordVector.size() * sizeof(SGMFeatureRecord));
+
+	// дʱļɹ滻²Ļ
+	const std::string strTempFile = m_strCacheFile + ".tmp";
+	bool bOK = false;
+	{
+		std::ofstream file(strTempFile, std::ios::binary | std::ios::trunc);
+		if (file)
+		{
+			file.write((const char*)&sHeader, sizeof(SGMFeatureCacheHeader));
+			file.write((const char*)recordVector.data(), recordVector.size() * sizeof(SGMFeatureRecord));
+			bOK = file.good();
+		}
+	}
+	std::error_code ec;
+	if (bOK)
+	{
+		fs::rename(fs::path(strTempFile), fs::path(m_strCacheFile), ec);
+		bOK = !ec;
+	}
+	if (!bOK)
+	{
+		fs::remove(fs::path(strTempFile), ec);
+	}
+}
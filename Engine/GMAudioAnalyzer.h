@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioAnalyzer.h
+/// @brief		Galaxy-Music Engine - GMAudioAnalyzer
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMAudioFeature.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+namespace GM
+{
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/**
+	* Ƶ
+	* @author LiuTao
+	* @since 2026.10.17
+	* @param name:			Ƶļƣ·
+	* @param bValid:		ǷɹʧܻǾʱΪfalse
+	* @param sFeature:		ƵBPM
+	*/
+	struct SGMAudioAnalysis
+	{
+		SGMAudioAnalysis() : name(L""), bValid(false), sFeature() {}
+		SGMAudioAnalysis(const std::wstring& strName) : name(strName), bValid(false), sFeature() {}
+
+		std::wstring name;
+		bool bValid;
+		SGMAudioFeature sFeature;
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioAnalyzer
+	*  @brief Ƶ
+	*	̴߳ͬһбȡƵļÿļֻмһΣ
+	*	ͨزֱӻΪCGMAudioFeatureȡBPM
+	*	ļݵĹϣڴϣļƶҪ½룬ļ㷽汾仯󻺴ʧЧ
+	*	У߳ȡдƵ
+	*/
+	class CGMAudioAnalyzer
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioAnalyzer();
+		/** @brief ȴ߳̽ */
+		~CGMAudioAnalyzer();
+
+		/**
+		* Start
+		* ̷߳һƵļһûн򷵻false
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strPath:			Ƶļ·
+		* @param nameVector:		ҪƵļƣ·
+		* @param strCacheFile:		ļ·һʱȡÿʱдµ
+		* @return bool:				ɹtruefalse
+		*/
+		bool Start(const std::wstring& strPath, const std::vector<std::wstring>& nameVector, const std::string& strCacheFile);
+
+		/**
+		* Stop
+		* ֹ֪ͨ߳ͣȴδȡĽᱻѾԻд뻺
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Stop();
+
+		/**
+		* IsRunning
+		* @return bool:		߳ڷ߶лδȡĽtrue
+		*/
+		bool IsRunning() const;
+
+		/**
+		* PopResults
+		* ӶȡiMaxNum׷ӵresultVector
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param resultVector:		ķ
+		* @param iMaxNum:			ȡ
+		* @return size_t:			ȡ
+		*/
+		size_t PopResults(std::vector<SGMAudioAnalysis>& resultVector, const size_t iMaxNum);
+
+		/**
+		* HashFile
+		* ļݵĹϣļСβ64KB㣬Ҫȡļ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strFile:				ļ·
+		* @param iHash:					Ĺϣ
+		* @return bool:					ɹtrueļ޷ȡfalse
+		*/
+		static bool HashFile(const std::wstring& strFile, unsigned long long& iHash);
+
+	private:
+		/**
+		* ¼
+		*/
+		struct SGMFeatureRecord
+		{
+			unsigned long long	iHash;
+			SGMAudioFeature		sFeature;
+		};
+
+		/** @brief ̺߳ѭȡֱбΪգһ߳д뻺 */
+		void _Work();
+		/**
+		* @brief ƵļһΣΪ
+		* @param strFile:		Ƶļ·
+		* @param monoVector:	ĵ
+		* @param fSampleRate:	Ĳ
+		* @return bool:			ɹtrueʧfalse
+		*/
+		bool _Decode(const std::wstring& strFile, std::vector<float>& monoVector, float& fSampleRate) const;
+		/** @brief ȡ棬ļڡ𻵻߰汾һʱ */
+		void _LoadCache();
+		/** @brief µ뻺沢дļдʱļ滻 */
+		void _SaveCache();
+
+		// 
+	private:
+		std::vector<std::thread>			m_threadVector;					//!< ߳
+		mutable std::mutex					m_mutex;						//!< m_resultDequem_newRecordVector
+		std::deque<SGMAudioAnalysis>		m_resultDeque;					//!< ȴ߳ȡķ
+		std::vector<SGMFeatureRecord>		m_newRecordVector;				//!< ûд뻺
+		std::unordered_map<unsigned long long, SGMAudioFeature>	m_cacheMap;	//!< 棬߳ʱֻ
+		std::string							m_strCacheFile;					//!< ļ·
+		bool								m_bCacheLoaded;					//!< ǷѾȡļ
+		std::wstring						m_strPath;						//!< Ƶļ·ֻ߳
+		std::vector<std::wstring>			m_nameVector;					//!< бֻ߳
+		std::atomic<size_t>					m_iNext;						//!< һȡ
+		std::atomic<int>					m_iRunning;						//!< еĹ߳
+		std::atomic<bool>					m_bStop;						//!< ֹ֪ͨ߳ͣ
+	};
+}	// GM
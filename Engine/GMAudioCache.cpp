@@ -0,0 +1,340 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioCache.cpp
+/// @brief		Galaxy-Music Engine - GMAudioCache
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioCache.h"
+#include <cstring>
+
+using namespace GM;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+#define GM_CACHE_MAGIC				(0x43414D47)	// "GMAC"
+#define GM_CACHE_VERSION			(1)				// ʽ汾޸ĸʽ
+#define GM_CACHE_SOURCE_MAX			(4)				// Դļ
+
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* ļͷ
+* @param iSourceStamp:		Դļ {С, ޸ʱ}ڵԴļΪ {0, 0}
+* @param iChecksum:			ļͷ֮ݵFNV-1aУ
+*/
+struct SGMCacheHeader
+{
+	unsigned int		iMagic;
+	unsigned int		iVersion;
+	unsigned int		iCharSize;
+	unsigned int		iAudioNum;
+	unsigned int		iOrderNum;
+	unsigned int		iCharNum;
+	unsigned int		iSourceNum;
+	unsigned int		iReserved;
+	double				fKey;
+	unsigned long long	iSourceStamp[GM_CACHE_SOURCE_MAX][2];
+	unsigned long long	iChecksum;
+};
+
+/** @brief Ƶ¼Ʊַ */
+struct SGMCacheAudio
+{
+	unsigned int		iUID;
+	unsigned int		iNameOffset;
+	unsigned int		iNameLength;
+	int					iRank;
+	double				fBPM;
+	double				fAngle;
+	float				fX;
+	float				fY;
+	float				fZ;
+	unsigned int		iReserved;
+};
+
+/** @brief ˳¼ */
+struct SGMCacheOrder
+{
+	unsigned int		iNameOffset;
+	unsigned int		iNameLength;
+};
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief FNV-1a У */
+static unsigned long long _Checksum(const unsigned char* pData, const size_t iBytes)
+{
+	unsigned long long iHash = 14695981039346656037ULL;
+	for (size_t i = 0; i < iBytes; i++)
+	{
+		iHash ^= pData[i];
+		iHash *= 1099511628211ULL;
+	}
+	return iHash;
+}
+
+/** @brief ȡļ {С, ޸ʱ}ļΪ {0, 0} */
+static void _GetFileStamp(const std::string& strFile, unsigned long long iStamp[2])
+{
+	iStamp[0] = 0;
+	iStamp[1] = 0;
+	WIN32_FILE_ATTRIBUTE_DATA sAttr;
+	if (GetFileAttributesExA(strFile.c_str(), GetFileExInfoStandard, &sAttr))
+	{
+		iStamp[0] = ((unsigned long long)sAttr.nFileSizeHigh << 32) | sAttr.nFileSizeLow;
+		iStamp[1] = ((unsigned long long)sAttr.ftLastWriteTime.dwHighDateTime << 32) | sAttr.ftLastWriteTime.dwLowDateTime;
+	}
+}
+
+/** @brief ļֽ */
+static size_t _GetCacheBytes(const SGMCacheHeader& sHeader)
+{
+	return sizeof(SGMCacheHeader)
+		+ sizeof(SGMCacheAudio) * size_t(sHeader.iAudioNum)
+		+ sizeof(SGMCacheOrder) * size_t(sHeader.iOrderNum)
+		+ sizeof(wchar_t) * size_t(sHeader.iCharNum);
+}
+
+/*************************************************************************
+CGMAudioCache Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioCache::CGMAudioCache() :
+	m_hFile(INVALID_HANDLE_VALUE), m_hMapping(NULL), m_pView(nullptr),
+	m_iAudioNum(0), m_iOrderNum(0), m_iCharNum(0)
+{
+}
+
+/** @brief  */
+CGMAudioCache::~CGMAudioCache()
+{
+	Close();
+}
+
+bool CGMAudioCache::Open(const std::string& strCacheFile, const std::vector<std::string>& sourceVector, const double fKey)
+{
+	Close();
+	if (sourceVector.size() > GM_CACHE_SOURCE_MAX) return false;
+
+	m_hFile = CreateFileA(strCacheFile.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (INVALID_HANDLE_VALUE == m_hFile) return false;
+
+	LARGE_INTEGER iFileSize;
+	if (!GetFileSizeEx(m_hFile, &iFileSize) || iFileSize.QuadPart < LONGLONG(sizeof(SGMCacheHeader)))
+	{
+		Close();
+		return false;
+	}
+
+	m_hMapping = CreateFileMappingA(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (NULL != m_hMapping)
+	{
+		m_pView = (const unsigned char*)MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+	}
+	if (nullptr == m_pView)
+	{
+		Close();
+		return false;
+	}
+
+	const SGMCacheHeader& sHeader = *(const SGMCacheHeader*)m_pView;
+	bool bValid = GM_CACHE_MAGIC == sHeader.iMagic
+		&& GM_CACHE_VERSION == sHeader.iVersion
+		&& sizeof(wchar_t) == sHeader.iCharSize
+		&& fKey == sHeader.fKey
+		&& sourceVector.size() == sHeader.iSourceNum
+		&& LONGLONG(_GetCacheBytes(sHeader)) == iFileSize.QuadPart;
+
+	// Դļ޸Ĺ˵ѹ
+	for (size_t i = 0; bValid && i < sourceVector.size(); i++)
+	{
+		unsigned long long iStamp[2];
+		_GetFileStamp(sourceVector[i], iStamp);
+		bValid = iStamp[0] == sHeader.iSourceStamp[i][0] && iStamp[1] == sHeader.iSourceStamp[i][1];
+	}
+
+	if (bValid)
+	{
+		bValid = sHeader.iChecksum == _Checksum(m_pView + sizeof(SGMCacheHeader),
+			size_t(iFileSize.QuadPart) - sizeof(SGMCacheHeader));
+	}
+
+	if (bValid)
+	{
+		// ƶַ
+		const SGMCacheAudio* pAudio = (const SGMCacheAudio*)(m_pView + sizeof(SGMCacheHeader));
+		const SGMCacheOrder* pOrder = (const SGMCacheOrder*)(pAudio + sHeader.iAudioNum);
+		for (unsigned int i = 0; bValid && i < sHeader.iAudioNum; i++)
+		{
+			bValid = 0 != pAudio[i].iUID
+				&& pAudio[i].iNameOffset <= sHeader.iCharNum
+				&& pAudio[i].iNameLength <= sHeader.iCharNum - pAudio[i].iNameOffset;
+		}
+		for (unsigned int i = 0; bValid && i < sHeader.iOrderNum; i++)
+		{
+			bValid = pOrder[i].iNameOffset <= sHeader.iCharNum
+				&& pOrder[i].iNameLength <= sHeader.iCharNum - pOrder[i].iNameOffset;
+		}
+	}
+
+	if (!bValid)
+	{
+		Close();
+		return false;
+	}
+
+	m_iAudioNum = sHeader.iAudioNum;
+	m_iOrderNum = sHeader.iOrderNum;
+	m_iCharNum = sHeader.iCharNum;
+	return true;
+}
+
+void CGMAudioCache::Close()
+{
+	if (m_pView)
+	{
+		UnmapViewOfFile(m_pView);
+		m_pView = nullptr;
+	}
+	if (NULL != m_hMapping)
+	{
+		CloseHandle(m_hMapping);
+		m_hMapping = NULL;
+	}
+	if (INVALID_HANDLE_VALUE != m_hFile)
+	{
+		CloseHandle(m_hFile);
+		m_hFile = INVALID_HANDLE_VALUE;
+	}
+	m_iAudioNum = 0;
+	m_iOrderNum = 0;
+	m_iCharNum = 0;
+}
+
+unsigned int CGMAudioCache::GetAudioNum() const
+{
+	return m_iAudioNum;
+}
+
+bool CGMAudioCache::GetAudioData(const unsigned int i, SGMAudioData& sData) const
+{
+	if (i >= m_iAudioNum) return false;
+
+	const SGMCacheAudio& sAudio = ((const SGMCacheAudio*)(m_pView + sizeof(SGMCacheHeader)))[i];
+	sData.UID = sAudio.iUID;
+	sData.name = _GetString(sAudio.iNameOffset, sAudio.iNameLength);
+	sData.audioCoord = SGMAudioCoord(sAudio.fBPM, sAudio.fAngle, sAudio.iRank);
+	sData.galaxyCoord = SGMGalaxyCoord(sAudio.fX, sAudio.fY, sAudio.fZ);
+	return true;
+}
+
+unsigned int CGMAudioCache::GetOrderNum() const
+{
+	return m_iOrderNum;
+}
+
+std::wstring CGMAudioCache::GetOrder(const unsigned int i) const
+{
+	if (i >= m_iOrderNum) return L"";
+
+	const SGMCacheOrder* pOrder = (const SGMCacheOrder*)(m_pView + sizeof(SGMCacheHeader) + sizeof(SGMCacheAudio) * m_iAudioNum);
+	return _GetString(pOrder[i].iNameOffset, pOrder[i].iNameLength);
+}
+
+bool CGMAudioCache::Write(const std::string& strCacheFile, const std::vector<std::string>& sourceVector, const double fKey,
+	const std::map<unsigned int, SGMAudioData>& dataMap, const std::vector<std::wstring>& orderVector)
+{
+	if (sourceVector.size() > GM_CACHE_SOURCE_MAX) return false;
+
+	SGMCacheHeader sHeader;
+	memset(&sHeader, 0, sizeof(SGMCacheHeader));
+	sHeader.iMagic = GM_CACHE_MAGIC;
+	sHeader.iVersion = GM_CACHE_VERSION;
+	sHeader.iCharSize = sizeof(wchar_t);
+	sHeader.iAudioNum = (unsigned int)dataMap.size();
+	sHeader.iOrderNum = (unsigned int)orderVector.size();
+	sHeader.fKey = fKey;
+	sHeader.iSourceNum = (unsigned int)sourceVector.size();
+	for (size_t i = 0; i < sourceVector.size(); i++)
+	{
+		_GetFileStamp(sourceVector[i], sHeader.iSourceStamp[i]);
+	}
+
+	size_t iCharNum = 0;
+	for (auto& itr : dataMap) iCharNum += itr.second.name.size();
+	for (auto& itr : orderVector) iCharNum += itr.size();
+	sHeader.iCharNum = (unsigned int)iCharNum;
+
+	std::vector<unsigned char> buffer(_GetCacheBytes(sHeader), 0);
+	SGMCacheAudio* pAudio = (SGMCacheAudio*)(buffer.data() + sizeof(SGMCacheHeader));
+	SGMCacheOrder* pOrder = (SGMCacheOrder*)(pAudio + sHeader.iAudioNum);
+	wchar_t* pChar = (wchar_t*)(pOrder + sHeader.iOrderNum);
+
+	unsigned int iOffset = 0;
+	for (auto& itr : dataMap)
+	{
+		const SGMAudioData& sData = itr.second;
+		pAudio->iUID = sData.UID;
+		pAudio->iNameOffset = iOffset;
+		pAudio->iNameLength = (unsigned int)sData.name.size();
+		pAudio->iRank = sData.audioCoord.rank;
+		pAudio->fBPM = sData.audioCoord.BPM;
+		pAudio->fAngle = sData.audioCoord.angle;
+		pAudio->fX = sData.galaxyCoord.x;
+		pAudio->fY = sData.galaxyCoord.y;
+		pAudio->fZ = sData.galaxyCoord.z;
+		memcpy(pChar + iOffset, sData.name.data(), sizeof(wchar_t) * sData.name.size());
+		iOffset += pAudio->iNameLength;
+		pAudio++;
+	}
+	for (auto& itr : orderVector)
+	{
+		pOrder->iNameOffset = iOffset;
+		pOrder->iNameLength = (unsigned int)itr.size();
+		memcpy(pChar + iOffset, itr.data(), sizeof(wchar_t) * itr.size());
+		iOffset += pOrder->iNameLength;
+		pOrder++;
+	}
+
+	sHeader.iChecksum = _Checksum(buffer.data() + sizeof(SGMCacheHeader), buffer.size() - sizeof(SGMCacheHeader));
+	memcpy(buffer.data(), &sHeader, sizeof(SGMCacheHeader));
+
+	// дʱļɹ滻²Ļ
+	const std::string strTempFile = strCacheFile + ".tmp";
+	HANDLE hFile = CreateFileA(strTempFile.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (INVALID_HANDLE_VALUE == hFile) return false;
+
+	DWORD iWritten = 0;
+	bool bOK = WriteFile(hFile, buffer.data(), DWORD(buffer.size()), &iWritten, NULL) && buffer.size() == iWritten;
+	CloseHandle(hFile);
+
+	if (bOK)
+	{
+		bOK = MoveFileExA(strTempFile.c_str(), strCacheFile.c_str(), MOVEFILE_REPLACE_EXISTING) ? true : false;
+	}
+	if (!bOK)
+	{
+		DeleteFileA(strTempFile.c_str());
+	}
+	return bOK;
+}
+
+std::wstring CGMAudioCache::_GetString(const unsigned int iOffset, const unsigned int iLength) const
+{
+	const wchar_t* pChar = (const wchar_t*)(m_pView + sizeof(SGMCacheHeader)
+		+ sizeof(SGMCacheAudio) * m_iAudioNum + sizeof(SGMCacheOrder) * m_iOrderNum);
+	return std::wstring(pChar + iOffset, iLength);
+}
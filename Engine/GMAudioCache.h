@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioCache.h
+/// @brief		Galaxy-Music Engine - GMAudioCache
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMCommon.h"
+#include <map>
+
+namespace GM
+{
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioCache
+	*  @brief ƵĶƻ棬m_audioDataMap벥˳Ŀ
+	*	ļɶ¼ + ַɣʱֱڴӳ䣬У󰴼¼ȡҪ
+	*	¼ԴXMLļĴС޸ʱ䣬κһһ¶Ϊڣɵ߻˵XML
+	*/
+	class CGMAudioCache
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioCache();
+		/** @brief  */
+		~CGMAudioCache();
+
+		/**
+		* Open
+		* ڴӳ仺ļ汾СԴļʱУ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strCacheFile:		ļ·
+		* @param sourceVector:		Դļ·4
+		* @param fKey:				Ӱ컺ݵĲСBPM
+		* @return bool:				Чtrueڻ𻵷false
+		*/
+		bool Open(const std::string& strCacheFile, const std::vector<std::string>& sourceVector, const double fKey);
+
+		/**
+		* Close
+		* ڴӳ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Close();
+
+		/**
+		* GetAudioNum
+		* @return unsigned int:		еƵδʱΪ0
+		*/
+		unsigned int GetAudioNum() const;
+
+		/**
+		* GetAudioData
+		* ȡiƵݣ¼UID򱣴
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param i:					Ƶţ[0, GetAudioNum())
+		* @param sData:				Ƶ
+		* @return bool:				ɹtrueԽfalse
+		*/
+		bool GetAudioData(const unsigned int i, SGMAudioData& sData) const;
+
+		/**
+		* GetOrderNum
+		* @return unsigned int:		в˳ĳȣδʱΪ0
+		*/
+		unsigned int GetOrderNum() const;
+
+		/**
+		* GetOrder
+		* ȡ˳еiƵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param i:					ţ[0, GetOrderNum())
+		* @return std::wstring:		ƵƣԽ緵 L""
+		*/
+		std::wstring GetOrder(const unsigned int i) const;
+
+		/**
+		* Write
+		* ƵݺͲ˳д뻺ļдʱļ滻дһļȡ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strCacheFile:		ļ·
+		* @param sourceVector:		Դļ·4ӦԴļ
+		* @param fKey:				Ӱ컺ݵĲСBPM
+		* @param dataMap:			Ƶmap
+		* @param orderVector:		˳
+		* @return bool:				ɹtrueʧfalse
+		*/
+		static bool Write(const std::string& strCacheFile, const std::vector<std::string>& sourceVector, const double fKey,
+			const std::map<unsigned int, SGMAudioData>& dataMap, const std::vector<std::wstring>& orderVector);
+
+	private:
+		/** @brief ȡַеַ */
+		std::wstring _GetString(const unsigned int iOffset, const unsigned int iLength) const;
+
+		// 
+	private:
+		HANDLE						m_hFile;						//!< ļ
+		HANDLE						m_hMapping;						//!< ļӳ
+		const unsigned char*		m_pView;						//!< ӳļ
+		unsigned int				m_iAudioNum;					//!< Ƶ
+		unsigned int				m_iOrderNum;					//!< ˳򳤶
+		unsigned int				m_iCharNum;						//!< ַصַ
+	};
+}	// GM
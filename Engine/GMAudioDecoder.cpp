@@ -0,0 +1,514 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioDecoder.cpp
+/// @brief		Galaxy-Music Engine - GMAudioDecoder
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioDecoder.h"
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_DECODE_RING_SEC			(4)				// ÿ۵Ļλʱλs
+#define GM_DECODE_PREBUFFER_SEC		(0.5)			// Ԥʱﵽλs
+#define GM_DECODE_CHUNK_FRAMES		(4096)			// ÿν֡
+#define GM_DECODE_IDLE_MS			(5)				// ¿ʱ̵߳ĵȴʱ䣬λms
+#define GM_DECODE_HALF_PI			(1.5707963267948966)	// /2
+
+/*************************************************************************
+CGMAudioDecoder Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioDecoder::CGMAudioDecoder() : m_bStop(true),
+	m_streamOutput(0), m_iOutFreq(44100), m_iOutChans(2), m_fCrossfade(0.0f),
+	m_iQueuedSlot(-1), m_iMixSlot(-1), m_iFadeSlot(-1), m_iFadeLength(0), m_iFadePos(0),
+	m_iMixedFrames(0), m_iSwitchFrame(0), m_iSwitchCount(0), m_iEndFrame(GM_DECODE_NO_FRAME)
+{
+}
+
+/** @brief  */
+CGMAudioDecoder::~CGMAudioDecoder()
+{
+	Stop();
+}
+
+bool CGMAudioDecoder::Start()
+{
+	if (m_decodeThread.joinable()) return true;
+
+	m_bStop = false;
+	m_decodeThread = std::thread(&CGMAudioDecoder::_Run, this);
+	return true;
+}
+
+void CGMAudioDecoder::Stop()
+{
+	FreeOutput();
+	if (!m_decodeThread.joinable()) return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_commandMutex);
+		m_bStop = true;
+	}
+	m_commandCondition.notify_one();
+	m_decodeThread.join();
+
+	// ߳˳ʣֱӶ
+	m_commandDeque.clear();
+	for (auto& sSlot : m_slots)
+	{
+		_FreeDecodeStream(sSlot);
+		sSlot.eState = EGMDECODE_EMPTY;
+		sSlot.iPending = 0;
+		sSlot.strFile.clear();
+	}
+}
+
+void CGMAudioDecoder::Open(const int iSlot, const std::wstring& strFile, const double fStartSec)
+{
+	if (iSlot < 0 || iSlot >= GM_DECODE_SLOT_NUM) return;
+
+	SGMDecodeCommand sCommand;
+	sCommand.eType = EGMDECODE_CMD_OPEN;
+	sCommand.iSlot = iSlot;
+	sCommand.strFile = strFile;
+	sCommand.fSec = fStartSec;
+	m_slots[iSlot].strFile = strFile;
+	_PostCommand(sCommand);
+}
+
+void CGMAudioDecoder::Seek(const int iSlot, const double fSec)
+{
+	if (iSlot < 0 || iSlot >= GM_DECODE_SLOT_NUM) return;
+
+	SGMDecodeCommand sCommand;
+	sCommand.eType = EGMDECODE_CMD_SEEK;
+	sCommand.iSlot = iSlot;
+	sCommand.fSec = fSec;
+	_PostCommand(sCommand);
+}
+
+void CGMAudioDecoder::Close(const int iSlot)
+{
+	if (iSlot < 0 || iSlot >= GM_DECODE_SLOT_NUM) return;
+
+	SGMDecodeCommand sCommand;
+	sCommand.eType = EGMDECODE_CMD_CLOSE;
+	sCommand.iSlot = iSlot;
+	m_slots[iSlot].strFile.clear();
+	_PostCommand(sCommand);
+}
+
+HSTREAM CGMAudioDecoder::CreateOutput(const int iSlot)
+{
+	FreeOutput();
+	if (EGMDECODE_READY != GetState(iSlot)) return 0;
+
+	// ֮ǰ̲߳Уֱû״̬
+	const SGMDecodeSlot& sSlot = m_slots[iSlot];
+	m_iOutFreq = sSlot.iFreq;
+	m_iOutChans = sSlot.iChans;
+	m_mixBuffer.resize(size_t(GM_DECODE_CHUNK_FRAMES) * m_iOutChans);
+	m_iFadeLength = 0;
+	m_iFadePos = 0;
+	m_iMixedFrames = 0;
+	m_iEndFrame = GM_DECODE_NO_FRAME;
+	m_iMixSlot = iSlot;
+	m_streamOutput = BASS_StreamCreate(m_iOutFreq, m_iOutChans, BASS_SAMPLE_FLOAT, &CGMAudioDecoder::_StreamProc, this);
+	if (0 == m_streamOutput) m_iMixSlot = -1;
+	return m_streamOutput;
+}
+
+void CGMAudioDecoder::FreeOutput()
+{
+	if (0 != m_streamOutput)
+	{
+		BASS_StreamFree(m_streamOutput);
+		m_streamOutput = 0;
+	}
+	m_iQueuedSlot = -1;
+	m_iMixSlot = -1;
+	m_iFadeSlot = -1;
+}
+
+void CGMAudioDecoder::SetCrossfade(const double fSec)
+{
+	m_fCrossfade = float(std::fmax(0.0, std::fmin(fSec, GM_DECODE_CROSSFADE_MAX)));
+}
+
+void CGMAudioDecoder::Queue(const int iSlot)
+{
+	if (iSlot < 0 || iSlot >= GM_DECODE_SLOT_NUM) return;
+	m_iQueuedSlot.store(iSlot, std::memory_order_release);
+}
+
+bool CGMAudioDecoder::Unqueue(const int iSlot)
+{
+	// ߳лʱҲCASȡŶӵĲֻۣһܳɹ
+	int iExpected = iSlot;
+	return m_iQueuedSlot.compare_exchange_strong(iExpected, -1, std::memory_order_acq_rel);
+}
+
+size_t CGMAudioDecoder::Mix(float* pOut, const size_t iFrames)
+{
+	const int iMixSlot = m_iMixSlot.load(std::memory_order_relaxed);
+	if (-1 == iMixSlot || GM_DECODE_NO_FRAME != m_iEndFrame.load(std::memory_order_relaxed)) return 0;
+
+	const size_t iChans = m_iOutChans;
+	const size_t iCrossfade = size_t(double(m_fCrossfade.load(std::memory_order_relaxed)) * m_iOutFreq);
+	size_t iDone = 0;
+	while (iDone < iFrames)
+	{
+		float* pDst = pOut + iDone * iChans;
+		SGMDecodeSlot& sSlot = m_slots[m_iMixSlot.load(std::memory_order_relaxed)];
+		const int iFadeSlot = m_iFadeSlot.load(std::memory_order_relaxed);
+		if (-1 != iFadeSlot)
+		{
+			// 浭һʣ֡õڵȣߵƽͺΪ1
+			const size_t iNum = (std::min)({ iFrames - iDone, m_iFadeLength - m_iFadePos, size_t(GM_DECODE_CHUNK_FRAMES) });
+			_ReadSlot(m_slots[iFadeSlot], pDst, iNum);
+			_ReadSlot(sSlot, m_mixBuffer.data(), iNum);
+			const double fStep = GM_DECODE_HALF_PI / double(m_iFadeLength);
+			for (size_t i = 0; i < iNum; i++)
+			{
+				const double fAngle = (double(m_iFadePos + i) + 0.5) * fStep;
+				const float fOut = float(std::cos(fAngle));
+				const float fIn = float(std::sin(fAngle));
+				for (size_t c = 0; c < iChans; c++)
+				{
+					pDst[i * iChans + c] = pDst[i * iChans + c] * fOut + m_mixBuffer[i * iChans + c] * fIn;
+				}
+			}
+			m_iFadePos += iNum;
+			iDone += iNum;
+			if (m_iFadePos >= m_iFadeLength)
+			{
+				m_iFadeSlot.store(-1, std::memory_order_release);
+			}
+			continue;
+		}
+
+		// ȶ־ٶ󻺳е֡Ǿȷʣ֡
+		const bool bDecodeEnded = sSlot.bDecodeEnded.load(std::memory_order_acquire);
+		const size_t iReadable = sSlot.pcmRing.GetReadable() / iChans;
+		size_t iNum = iFrames - iDone;
+		if (bDecodeEnded)
+		{
+			int iNext = _GetMixNext();
+			if (0 <= iNext && iReadable <= iCrossfade)
+			{
+				if (!m_iQueuedSlot.compare_exchange_strong(iNext, -1, std::memory_order_acq_rel)) continue;
+
+				// лһ״һ֡ʼʣ֡
+				const int iLastSlot = m_iMixSlot.load(std::memory_order_relaxed);
+				m_iFadeLength = iReadable;
+				m_iFadePos = 0;
+				m_iSwitchFrame.store(m_iMixedFrames.load(std::memory_order_relaxed) + iDone, std::memory_order_relaxed);
+				if (0 < iReadable) m_iFadeSlot.store(iLastSlot, std::memory_order_release);
+				m_iMixSlot.store(iNext, std::memory_order_release);
+				m_iSwitchCount.fetch_add(1, std::memory_order_release);
+				continue;
+			}
+			if (0 == iReadable)
+			{
+				if (-2 == iNext)
+				{
+					// һ׻Ԥ壬
+					std::fill(pDst, pDst + iNum * iChans, 0.0f);
+					iDone += iNum;
+					break;
+				}
+				m_iEndFrame.store(m_iMixedFrames.load(std::memory_order_relaxed) + iDone, std::memory_order_release);
+				break;
+			}
+			// ֻʼλ
+			iNum = (std::min)(iNum, (0 <= iNext) ? iReadable - iCrossfade : iReadable);
+		}
+		_ReadSlot(sSlot, pDst, iNum);
+		iDone += iNum;
+	}
+	m_iMixedFrames.fetch_add(iDone, std::memory_order_release);
+	return iDone;
+}
+
+bool CGMAudioDecoder::IsMixing(const int iSlot) const
+{
+	return iSlot == m_iMixSlot.load(std::memory_order_acquire) || iSlot == m_iFadeSlot.load(std::memory_order_acquire);
+}
+
+int CGMAudioDecoder::GetMixSlot() const
+{
+	return m_iMixSlot.load(std::memory_order_acquire);
+}
+
+unsigned int CGMAudioDecoder::GetSwitchCount() const
+{
+	return m_iSwitchCount.load(std::memory_order_acquire);
+}
+
+unsigned long long CGMAudioDecoder::GetSwitchFrame() const
+{
+	return m_iSwitchFrame.load(std::memory_order_relaxed);
+}
+
+unsigned long long CGMAudioDecoder::GetEndFrame() const
+{
+	return m_iEndFrame.load(std::memory_order_acquire);
+}
+
+EGMDECODE_STATE CGMAudioDecoder::GetState(const int iSlot) const
+{
+	if (iSlot < 0 || iSlot >= GM_DECODE_SLOT_NUM) return EGMDECODE_EMPTY;
+
+	const SGMDecodeSlot& sSlot = m_slots[iSlot];
+	if (0 != sSlot.iPending.load(std::memory_order_acquire))
+	{
+		return sSlot.strFile.empty() ? EGMDECODE_EMPTY : EGMDECODE_OPENING;
+	}
+	return EGMDECODE_STATE(sSlot.eState.load(std::memory_order_acquire));
+}
+
+const std::wstring& CGMAudioDecoder::GetFile(const int iSlot) const
+{
+	return m_slots[iSlot].strFile;
+}
+
+double CGMAudioDecoder::GetDuration(const int iSlot) const
+{
+	return (EGMDECODE_READY == GetState(iSlot)) ? m_slots[iSlot].fDuration : 0.0;
+}
+
+double CGMAudioDecoder::GetStartTime(const int iSlot) const
+{
+	return (EGMDECODE_READY == GetState(iSlot)) ? m_slots[iSlot].fStartSec : 0.0;
+}
+
+bool CGMAudioDecoder::IsEnded(const int iSlot) const
+{
+	if (EGMDECODE_READY != GetState(iSlot)) return false;
+
+	const SGMDecodeSlot& sSlot = m_slots[iSlot];
+	return sSlot.bDecodeEnded.load(std::memory_order_acquire) && 0 == sSlot.pcmRing.GetReadable();
+}
+
+void CGMAudioDecoder::_PostCommand(const SGMDecodeCommand& sCommand)
+{
+	m_slots[sCommand.iSlot].iPending.fetch_add(1, std::memory_order_acq_rel);
+	{
+		std::lock_guard<std::mutex> lock(m_commandMutex);
+		m_commandDeque.push_back(sCommand);
+	}
+	m_commandCondition.notify_one();
+}
+
+void CGMAudioDecoder::_Run()
+{
+	m_decodeBuffer.resize(GM_DECODE_CHUNK_FRAMES * 8);
+
+	while (true)
+	{
+		std::deque<SGMDecodeCommand> commandDeque;
+		{
+			std::lock_guard<std::mutex> lock(m_commandMutex);
+			if (m_bStop) break;
+			commandDeque.swap(m_commandDeque);
+		}
+
+		for (auto& itr : commandDeque)
+		{
+			_Execute(itr);
+			m_slots[itr.iSlot].iPending.fetch_sub(1, std::memory_order_acq_rel);
+		}
+
+		bool bBusy = false;
+		for (auto& sSlot : m_slots)
+		{
+			bBusy |= _DecodeChunk(sSlot);
+		}
+
+		if (!bBusy)
+		{
+			// л˻ûݿɽ룬ȴ̶߲߳
+			std::unique_lock<std::mutex> lock(m_commandMutex);
+			m_commandCondition.wait_for(lock, std::chrono::milliseconds(GM_DECODE_IDLE_MS),
+				[this] { return m_bStop || !m_commandDeque.empty(); });
+		}
+	}
+}
+
+void CGMAudioDecoder::_Execute(const SGMDecodeCommand& sCommand)
+{
+	SGMDecodeSlot& sSlot = m_slots[sCommand.iSlot];
+	switch (sCommand.eType)
+	{
+	case EGMDECODE_CMD_OPEN:
+	{
+		_FreeDecodeStream(sSlot);
+		sSlot.eState.store(EGMDECODE_OPENING, std::memory_order_release);
+		sSlot.bDecodeEnded = false;
+
+		sSlot.streamDecode = BASS_StreamCreateFile(FALSE, sCommand.strFile.c_str(), 0, 0,
+			BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT | BASS_STREAM_PRESCAN);
+		BASS_CHANNELINFO sInfo;
+		if (0 == sSlot.streamDecode || !BASS_ChannelGetInfo(sSlot.streamDecode, &sInfo) || 0 == sInfo.chans)
+		{
+			_FreeDecodeStream(sSlot);
+			sSlot.eState.store(EGMDECODE_FAILED, std::memory_order_release);
+			break;
+		}
+
+		sSlot.iFreq = sInfo.freq;
+		sSlot.iChans = sInfo.chans;
+		QWORD iLengthBytes = BASS_ChannelGetLength(sSlot.streamDecode, BASS_POS_BYTE);
+		sSlot.fDuration = std::fmax(0.0, BASS_ChannelBytes2Seconds(sSlot.streamDecode, iLengthBytes));
+
+		const size_t iRingSize = size_t(sInfo.freq) * sInfo.chans * GM_DECODE_RING_SEC;
+		if (sSlot.pcmRing.GetCapacity() < iRingSize)
+			sSlot.pcmRing.Init(iRingSize);
+		else
+			sSlot.pcmRing.Reset();
+		if (m_decodeBuffer.size() < size_t(GM_DECODE_CHUNK_FRAMES) * sInfo.chans)
+		{
+			m_decodeBuffer.resize(size_t(GM_DECODE_CHUNK_FRAMES) * sInfo.chans);
+		}
+
+		sSlot.fStartSec = 0.0;
+		if (sCommand.fSec > 0.0)
+		{
+			QWORD iPosBytes = BASS_ChannelSeconds2Bytes(sSlot.streamDecode, sCommand.fSec);
+			if (BASS_ChannelSetPosition(sSlot.streamDecode, iPosBytes, BASS_POS_BYTE))
+				sSlot.fStartSec = sCommand.fSec;
+		}
+	}
+	break;
+	case EGMDECODE_CMD_SEEK:
+	{
+		if (0 == sSlot.streamDecode) break;
+
+		sSlot.eState.store(EGMDECODE_OPENING, std::memory_order_release);
+		const double fSec = std::fmax(0.0, std::fmin(sCommand.fSec, sSlot.fDuration));
+		QWORD iPosBytes = BASS_ChannelSeconds2Bytes(sSlot.streamDecode, fSec);
+		if (BASS_ChannelSetPosition(sSlot.streamDecode, iPosBytes, BASS_POS_BYTE))
+		{
+			sSlot.fStartSec = fSec;
+		}
+		else
+		{
+			// תʧͷʼ
+			BASS_ChannelSetPosition(sSlot.streamDecode, 0, BASS_POS_BYTE);
+			sSlot.fStartSec = 0.0;
+		}
+		sSlot.pcmRing.Reset();
+		sSlot.bDecodeEnded = false;
+	}
+	break;
+	case EGMDECODE_CMD_CLOSE:
+	{
+		_FreeDecodeStream(sSlot);
+		sSlot.pcmRing.Reset();
+		sSlot.bDecodeEnded = false;
+		sSlot.eState.store(EGMDECODE_EMPTY, std::memory_order_release);
+	}
+	break;
+	default:
+		break;
+	}
+}
+
+void CGMAudioDecoder::_FreeDecodeStream(SGMDecodeSlot& sSlot)
+{
+	if (0 != sSlot.streamDecode)
+	{
+		BASS_StreamFree(sSlot.streamDecode);
+		sSlot.streamDecode = 0;
+	}
+}
+
+bool CGMAudioDecoder::_DecodeChunk(SGMDecodeSlot& sSlot)
+{
+	const int eState = sSlot.eState.load(std::memory_order_relaxed);
+	if (EGMDECODE_OPENING != eState && EGMDECODE_READY != eState) return false;
+	if (0 == sSlot.streamDecode || sSlot.bDecodeEnded) return false;
+
+	// ֻ֡Ҳʣռ
+	const size_t iFrames = (std::min)(size_t(GM_DECODE_CHUNK_FRAMES), sSlot.pcmRing.GetWritable() / sSlot.iChans);
+	bool bWritten = false;
+	if (iFrames > 0)
+	{
+		const DWORD iBytes = DWORD(iFrames * sSlot.iChans * sizeof(float));
+		const DWORD iRead = BASS_ChannelGetData(sSlot.streamDecode, m_decodeBuffer.data(), iBytes | BASS_DATA_FLOAT);
+		if ((DWORD)-1 == iRead || 0 == iRead)
+		{
+			// 뵽ļĩβ߳Ϊ
+			sSlot.bDecodeEnded.store(true, std::memory_order_release);
+		}
+		else
+		{
+			sSlot.pcmRing.Write(m_decodeBuffer.data(), iRead / sizeof(float));
+			bWritten = true;
+		}
+	}
+
+	if (EGMDECODE_OPENING == eState
+		&& (sSlot.bDecodeEnded || sSlot.pcmRing.GetReadable() >= size_t(GM_DECODE_PREBUFFER_SEC * sSlot.iFreq) * sSlot.iChans))
+	{
+		sSlot.eState.store(EGMDECODE_READY, std::memory_order_release);
+	}
+	return bWritten;
+}
+
+bool CGMAudioDecoder::_IsSlotReady(const SGMDecodeSlot& sSlot) const
+{
+	return 0 == sSlot.iPending.load(std::memory_order_acquire)
+		&& EGMDECODE_READY == sSlot.eState.load(std::memory_order_acquire);
+}
+
+int CGMAudioDecoder::_GetMixNext() const
+{
+	const int iQueued = m_iQueuedSlot.load(std::memory_order_acquire);
+	if (iQueued < 0 || iQueued == m_iMixSlot.load(std::memory_order_relaxed)) return -1;
+
+	const SGMDecodeSlot& sSlot = m_slots[iQueued];
+	if (!_IsSlotReady(sSlot))
+	{
+		// ʧܻѾرٵȴ
+		const int eState = sSlot.eState.load(std::memory_order_acquire);
+		const bool bWaiting = 0 != sSlot.iPending.load(std::memory_order_acquire) || EGMDECODE_OPENING == eState;
+		return bWaiting ? -2 : -1;
+	}
+	// ʻͬʱ޷ͬһν
+	return (sSlot.iFreq == m_iOutFreq && sSlot.iChans == m_iOutChans) ? iQueued : -1;
+}
+
+void CGMAudioDecoder::_ReadSlot(SGMDecodeSlot& sSlot, float* pOut, const size_t iFrames)
+{
+	const size_t iWant = iFrames * m_iOutChans;
+	const size_t iRead = sSlot.pcmRing.Read(pOut, iWant);
+	std::fill(pOut + iRead, pOut + iWant, 0.0f);
+}
+
+DWORD CALLBACK CGMAudioDecoder::_StreamProc(HSTREAM handle, void* pBuffer, DWORD iLength, void* pUser)
+{
+	CGMAudioDecoder* pDecoder = static_cast<CGMAudioDecoder*>(pUser);
+	const size_t iFrameSize = pDecoder->m_iOutChans * sizeof(float);
+	const size_t iWant = iLength / iFrameSize;
+	const size_t iFrames = pDecoder->Mix(static_cast<float*>(pBuffer), iWant);
+	DWORD iResult = DWORD(iFrames * iFrameSize);
+	if (iFrames < iWant)
+	{
+		iResult |= BASS_STREAMPROC_END;
+	}
+	return iResult;
+}
@@ -0,0 +1,304 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioDecoder.h
+/// @brief		Galaxy-Music Engine - GMAudioDecoder
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMPcmRing.h"
+#include "bass.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_DECODE_SLOT_NUM			(2)				// ǰƵ + Ԥصһ
+	#define GM_DECODE_CROSSFADE_MAX		(3.0)			// 浭ʱСڻλʱλs
+	#define GM_DECODE_NO_FRAME			(~0ULL)			// ûнʱĽ֡
+
+	/*************************************************************************
+	Enums
+	*************************************************************************/
+
+	// ״̬
+	enum EGMDECODE_STATE
+	{
+		EGMDECODE_EMPTY,			// 
+		EGMDECODE_OPENING,			// ڴ򿪻Ԥ
+		EGMDECODE_READY,			// ԤϣԴ
+		EGMDECODE_FAILED			// ʧ
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioDecoder
+	*  @brief ̨Ƶ
+	*	ļ򿪡롢תڹ߳ɣPCMдÿ۵λ
+	*	Ⱦֻ߳𴴽/ͷΨһBASSĻصӻλȡPCM
+	*	ǰ۽ϡʣ֡浭ʱʱŶӵһѾҸʽͬ
+	*	Ͱȹߵǰۡһۣһ֡һ׵һ֡
+	*	浭ʱΪ0ʱβӣûм϶л㶼֡¼ȷ
+	*	ע⣺ʱܶڻĲۣIsMixingѾŶӵĲ۵Open/Seek/Close
+	*	ȳŶӣUnqueueͷ
+	*/
+	class CGMAudioDecoder
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioDecoder();
+		/** @brief  */
+		~CGMAudioDecoder();
+
+		/**
+		* Start
+		* ̣߳ҪBASS_Init֮
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:		ɹtrueʧfalse
+		*/
+		bool Start();
+
+		/**
+		* Stop
+		* ֹ̣ͣ߳رн
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Stop();
+
+		/**
+		* Open
+		* ڽ첽ƵļָλÿʼԤ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSlot:			
+		* @param strFile:		Ƶļ·
+		* @param fStartSec:		ʼλãλs
+		* @return void
+		*/
+		void Open(const int iSlot, const std::wstring& strFile, const double fStartSec = 0.0);
+
+		/**
+		* Seek
+		* 첽תλãۻ½Ԥ״̬
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSlot:			
+		* @param fSec:			תλãλs
+		* @return void
+		*/
+		void Seek(const int iSlot, const double fSec);
+
+		/**
+		* Close
+		* 첽رս
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSlot:			
+		* @return void
+		*/
+		void Close(const int iSlot);
+
+		/**
+		* CreateOutput
+		* ΪѾԤϵĽ۴BASSݲ
+		* ĸʽò֮ͬǰŶӻᱻͷ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSlot:			
+		* @return HSTREAM:		δʧʱ0
+		*/
+		HSTREAM CreateOutput(const int iSlot);
+
+		/**
+		* FreeOutput
+		* ͷغصٱãв۶Բ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void FreeOutput();
+
+		/**
+		* SetCrossfade
+		* ý浭ʱ[0, GM_DECODE_CROSSFADE_MAX]ʱض
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fSec:			浭ʱ0ʾ޷νӣλs
+		* @return void
+		*/
+		void SetCrossfade(const double fSec);
+
+		/**
+		* Queue
+		* Ѳڵǰ֮󣬵ǰ۲ŵβʱԶлȥ
+		* ۿԻԤ壬ʽͬʱл
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSlot:			
+		* @return void
+		*/
+		void Queue(const int iSlot);
+
+		/**
+		* Unqueue
+		* ŶӣɹܶԸò۵Open/Seek/Close
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSlot:			֮ǰŶӵĽ
+		* @return bool:			ɹtrueѾлòfalse
+		*/
+		bool Unqueue(const int iSlot);
+
+		/**
+		* Mix
+		* ӵǰۣ͵еĲۣȡPCMĻصãûʱҲֱӵã൱ڿ
+		* ʱʱ0֤
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pOut:			Ľfloat PCMiFrames * 
+		* @param iFrames:		Ҫ֡
+		* @return size_t:		ʵ֡СiFrames˵Ѿ
+		*/
+		size_t Mix(float* pOut, const size_t iFrames);
+
+		/** @brief ڶȡòۣǰۻ򵭳еĲۣ */
+		bool IsMixing(const int iSlot) const;
+		/** @brief ĵǰۣûʱΪ-1 */
+		int GetMixSlot() const;
+		/** @brief л۵ۼƴÿл1 */
+		unsigned int GetSwitchCount() const;
+		/** @brief һлʱһ׵һ֡е֡ */
+		unsigned long long GetSwitchFrame() const;
+		/** @brief һ֮֡֡ţûнʱΪGM_DECODE_NO_FRAME */
+		unsigned long long GetEndFrame() const;
+
+		/** @brief ״̬ */
+		EGMDECODE_STATE GetState(const int iSlot) const;
+		/** @brief еļ·ۿʱΪL"" */
+		const std::wstring& GetFile(const int iSlot) const;
+		/** @brief Ƶʱλs۾Ч */
+		double GetDuration(const int iSlot) const;
+		/** @brief ǰһԤʼλãλs۾Ч */
+		double GetStartTime(const int iSlot) const;
+		/** @brief ļѾϣһλѾ */
+		bool IsEnded(const int iSlot) const;
+
+	private:
+		// 
+		enum EGMDECODE_COMMAND
+		{
+			EGMDECODE_CMD_OPEN,
+			EGMDECODE_CMD_SEEK,
+			EGMDECODE_CMD_CLOSE
+		};
+
+		/**
+		* 
+		* @param eType:			
+		* @param iSlot:			
+		* @param strFile:		Ƶļ·ֻOPENʹ
+		* @param fSec:			ʼλãλs
+		*/
+		struct SGMDecodeCommand
+		{
+			SGMDecodeCommand() : eType(EGMDECODE_CMD_CLOSE), iSlot(0), strFile(L""), fSec(0.0) {}
+			EGMDECODE_COMMAND	eType;
+			int					iSlot;
+			std::wstring		strFile;
+			double				fSec;
+		};
+
+		/**
+		* 
+		* ԭӱstrFile⣬Աֻڲ۷Ǿ״̬ʱɽ߳д룬
+		* eStaterelease/acquireΪ㣻iPendingΪ0ʱeStateǾĽΪδ
+		* ֻ߳ȡĲۣҲȡstrFile
+		*/
+		struct SGMDecodeSlot
+		{
+			SGMDecodeSlot() : eState(EGMDECODE_EMPTY), bDecodeEnded(false),
+				streamDecode(0), iFreq(44100), iChans(2), fDuration(0.0), fStartSec(0.0), iPending(0) {}
+			std::atomic<int>	eState;				//!< EGMDECODE_STATE
+			std::atomic<bool>	bDecodeEnded;		//!< ļѾ뵽ĩβ
+			CGMPcmRing			pcmRing;			//!< float PCM
+			HSTREAM				streamDecode;		//!< BASSֻڽ߳ʹ
+			DWORD				iFreq;				//!< 
+			DWORD				iChans;				//!< 
+			double				fDuration;			//!< ʱλs
+			double				fStartSec;			//!< Ԥʼλãλs
+			std::atomic<int>	iPending;			//!< ύδִеύʱ1ִк1
+			std::wstring		strFile;			//!< ļ·ֻȾ߳ʹ
+		};
+
+		/** @brief ύѽ߳ */
+		void _PostCommand(const SGMDecodeCommand& sCommand);
+		/** @brief ߳ѭ */
+		void _Run();
+		/** @brief ڽִ߳ */
+		void _Execute(const SGMDecodeCommand& sCommand);
+		/** @brief ڽ߳ͷŲ۵Ľ */
+		void _FreeDecodeStream(SGMDecodeSlot& sSlot);
+		/**
+		* @brief ڽ߳Ϊһ۽һ
+		* @return bool: д򷵻true
+		*/
+		bool _DecodeChunk(SGMDecodeSlot& sSlot);
+
+		/** @brief ڻ߳жϲǷȡstrFile */
+		bool _IsSlotReady(const SGMDecodeSlot& sSlot) const;
+		/**
+		* @brief ڻ߳лȡлȥŶӲ
+		* @return int: ţûŶӻʽͬ-1Ԥ巵-2
+		*/
+		int _GetMixNext() const;
+		/** @brief ڻ߳дӲ۶ȡiFrames֡Ĳֲ0 */
+		void _ReadSlot(SGMDecodeSlot& sSlot, float* pOut, const size_t iFrames);
+
+		/** @brief BASSصBASSĲ߳л */
+		static DWORD CALLBACK _StreamProc(HSTREAM handle, void* pBuffer, DWORD iLength, void* pUser);
+
+		// 
+	private:
+		SGMDecodeSlot						m_slots[GM_DECODE_SLOT_NUM];	//!< 
+		std::vector<float>					m_decodeBuffer;					//!< ̵߳ʱ
+		std::deque<SGMDecodeCommand>		m_commandDeque;					//!< ִе
+		std::mutex							m_commandMutex;					//!< 
+		std::condition_variable				m_commandCondition;				//!< ѽ߳
+		std::thread							m_decodeThread;					//!< ߳
+		std::atomic<bool>					m_bStop;						//!< ߳˳־
+
+		HSTREAM								m_streamOutput;					//!< 
+		DWORD								m_iOutFreq;						//!< 
+		DWORD								m_iOutChans;					//!< 
+		std::vector<float>					m_mixBuffer;					//!< ̵߳ʱ
+		std::atomic<float>					m_fCrossfade;					//!< 浭ʱλs
+		std::atomic<int>					m_iQueuedSlot;					//!< Ŷӵһۣ-1ʾû
+		std::atomic<int>					m_iMixSlot;						//!< ĵǰۣ-1ʾû
+		std::atomic<int>					m_iFadeSlot;					//!< ڵĲۣ-1ʾû
+		size_t								m_iFadeLength;					//!< εֻ֡ڻ߳ʹ
+		size_t								m_iFadePos;						//!< εѾֻ֡ڻ߳ʹ
+		std::atomic<unsigned long long>		m_iMixedFrames;					//!< Ѿ֡
+		std::atomic<unsigned long long>		m_iSwitchFrame;					//!< һл֡
+		std::atomic<unsigned int>			m_iSwitchCount;					//!< лۼƴ
+		std::atomic<unsigned long long>		m_iEndFrame;					//!< Ľ֡
+	};
+}	// GM
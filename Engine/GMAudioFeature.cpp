@@ -0,0 +1,274 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioFeature.cpp
+/// @brief		Galaxy-Music Engine - GMAudioFeature
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioFeature.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_FEATURE_FFT_SIZE			(8192)			// ֡FFT֮֡䲻ص44.1kHzʱԷֱ90Hzϵİ
+#define GM_FEATURE_ROLLOFF			(0.85)			// Ƶʵ
+#define GM_FEATURE_SILENCE_DB		(-60.0)			// ڴRMS֡Ϊͳ
+#define GM_FEATURE_SEMITONE_MIN		(24)			// ׵MIDIţC1
+#define GM_FEATURE_SEMITONE_MAX		(120)			// ׵MIDIţC9
+#define GM_FEATURE_PITCH_MIN		(36)			// ɫȵߣMIDIţC2
+#define GM_FEATURE_PITCH_MAX		(84)			// ɫȵߣMIDIţC6
+#define GM_FEATURE_HARMONIC_NUM		(8)				// г͵г
+#define GM_FEATURE_HARMONIC_DECAY	(0.8)			// ÿһгȨ˥
+#define GM_FEATURE_PI				(3.14159265358979323846)
+
+// ģ͵ϵÿһȰ任0ټȨͣtanhѹ(-1,1)
+#define GM_EMOTION_TEMPO_CENTER		(110.0)			// ѶԵBPM
+#define GM_EMOTION_TEMPO_AROUSAL	(1.2)			// ÿƵBPMԻѶȵĹ
+#define GM_EMOTION_NO_TEMPO			(-0.4)			// ûԽʱԻѶȵĹ
+#define GM_EMOTION_LOUD_CENTER		(-20.0)			// ѶԵȣλdBFS
+#define GM_EMOTION_LOUD_AROUSAL		(0.08)			// ÿdBȶԻѶȵĹ
+#define GM_EMOTION_BRIGHT_CENTER	(1500.0)		// ԵƵģλHz
+#define GM_EMOTION_BRIGHT_AROUSAL	(0.5)			// ÿƵƵĶԻѶȵĹ
+#define GM_EMOTION_FLUX_CENTER		(0.25)			// ԵƵͨ
+#define GM_EMOTION_FLUX_AROUSAL		(2.0)			// ƵͨԻѶȵĹ
+#define GM_EMOTION_DYN_CENTER		(6.0)			// ԵλdB
+#define GM_EMOTION_DYN_AROUSAL		(-0.03)			// ÿdBԻѶȵĹףѹԽԽ
+#define GM_EMOTION_MODE_VALENCE		(4.0)			// СЧ۵Ĺ
+#define GM_EMOTION_BRIGHT_VALENCE	(0.3)			// ÿƵƵĶЧ۵Ĺ
+#define GM_EMOTION_TEMPO_VALENCE	(0.3)			// ÿƵBPMЧ۵Ĺ
+
+/*************************************************************************
+Static Variables
+*************************************************************************/
+
+// Krumhansl-Kessler ģ壬Ϊ0
+static const double s_majorProfile[12] = { 6.35, 2.23, 3.48, 2.33, 4.38, 4.09, 2.52, 5.19, 2.39, 3.66, 2.29, 2.88 };
+static const double s_minorProfile[12] = { 6.33, 2.68, 3.52, 5.38, 2.60, 3.53, 2.54, 4.75, 3.98, 2.69, 3.34, 3.17 };
+
+/*************************************************************************
+CGMAudioFeature Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioFeature::CGMAudioFeature() : m_spectrum(GM_FEATURE_FFT_SIZE)
+{
+}
+
+/** @brief  */
+CGMAudioFeature::~CGMAudioFeature()
+{
+}
+
+bool CGMAudioFeature::Extract(const float* pMono, const size_t iNum, const float fSampleRate, SGMAudioFeature& sFeature)
+{
+	sFeature = SGMAudioFeature();
+	if (nullptr == pMono || fSampleRate <= 0.0f || iNum < GM_FEATURE_FFT_SIZE * 4) return false;
+
+	const size_t iHalf = GM_FEATURE_FFT_SIZE / 2;
+	const double fBinHz = double(fSampleRate) / GM_FEATURE_FFT_SIZE;
+	const int iSemitoneNum = GM_FEATURE_SEMITONE_MAX - GM_FEATURE_SEMITONE_MIN + 1;
+	if (m_spectrum.GetSampleRate() != fSampleRate || m_semitoneBinVector.empty())
+	{
+		m_spectrum.Init(fSampleRate);
+		// ÿȡƵ1/4ڵƵ㣬ƵһƵ㶼ûʱȡƵ㣬A4 = 440Hz
+		m_semitoneBinVector.assign(iSemitoneNum * 2, 0);
+		m_semitoneVector.assign(iSemitoneNum, 0.0f);
+		for (int m = 0; m < iSemitoneNum; m++)
+		{
+			const double fFreq = 440.0 * std::pow(2.0, (m + GM_FEATURE_SEMITONE_MIN - 69) / 12.0);
+			unsigned int iBegin = (unsigned int)std::ceil(fFreq * std::pow(2.0, -1.0 / 24.0) / fBinHz);
+			unsigned int iEnd = (unsigned int)std::ceil(fFreq * std::pow(2.0, 1.0 / 24.0) / fBinHz);
+			if (iBegin >= iEnd)
+			{
+				iBegin = (unsigned int)std::lround(fFreq / fBinHz);
+				iEnd = iBegin + 1;
+			}
+			m_semitoneBinVector[2 * m] = (unsigned int)std::min(size_t(iBegin), iHalf + 1);
+			m_semitoneBinVector[2 * m + 1] = (unsigned int)std::min(size_t(iEnd), iHalf + 1);
+		}
+	}
+	m_lastMagnitudeVector.assign(iHalf + 1, 0.0f);
+	bool bHasLast = false;
+
+	double fSumCentroid = 0.0;
+	double fSumRolloff = 0.0;
+	double fSumFlux = 0.0;
+	double fSumDB = 0.0;
+	double fSumDB2 = 0.0;
+	double fChroma[12] = { 0.0 };
+	size_t iFrameNum = 0;
+	size_t iFluxNum = 0;
+
+	const std::vector<float>& powerVector = m_spectrum.GetPower();
+	const size_t iFrames = iNum / GM_FEATURE_FFT_SIZE;
+	for (size_t f = 0; f < iFrames; f++)
+	{
+		const float* pFrame = pMono + f * GM_FEATURE_FFT_SIZE;
+		double fEnergy = 0.0;
+		for (size_t i = 0; i < GM_FEATURE_FFT_SIZE; i++) fEnergy += double(pFrame[i]) * pFrame[i];
+		const double fDB = 10.0 * std::log10(fEnergy / GM_FEATURE_FFT_SIZE + 1e-12);
+		if (fDB < GM_FEATURE_SILENCE_DB)
+		{
+			// ֡ƵͨѾĵһ֡ұ仯
+			bHasLast = false;
+			continue;
+		}
+
+		m_spectrum.Analyze(pFrame, GM_FEATURE_FFT_SIZE, 0.0f);
+
+		double fTotal = 0.0;
+		double fWeighted = 0.0;
+		double fMagnitudeSum = 0.0;
+		double fRise = 0.0;
+		for (size_t k = 1; k <= iHalf; k++)
+		{
+			const double fPower = powerVector[k];
+			fTotal += fPower;
+			fWeighted += fPower * k;
+
+			const float fMagnitude = std::sqrt(powerVector[k]);
+			fMagnitudeSum += fMagnitude;
+			fRise += std::max(0.0f, fMagnitude - m_lastMagnitudeVector[k]);
+			m_lastMagnitudeVector[k] = fMagnitude;
+		}
+		if (fTotal <= 0.0) continue;
+
+		// ףÿڵֵ
+		for (int m = 0; m < iSemitoneNum; m++)
+		{
+			float fMax = 0.0f;
+			for (unsigned int k = m_semitoneBinVector[2 * m]; k < m_semitoneBinVector[2 * m + 1]; k++)
+			{
+				fMax = std::max(fMax, m_lastMagnitudeVector[k]);
+			}
+			m_semitoneVector[m] = fMax;
+		}
+		// г͵õȣƽ۵ͻĻ
+		for (int iPitch = GM_FEATURE_PITCH_MIN; iPitch <= GM_FEATURE_PITCH_MAX; iPitch++)
+		{
+			double fSalience = 0.0;
+			double fWeight = 1.0;
+			for (int h = 1; h <= GM_FEATURE_HARMONIC_NUM; h++)
+			{
+				const int m = iPitch + int(std::lround(12.0 * std::log2(double(h)))) - GM_FEATURE_SEMITONE_MIN;
+				if (m >= iSemitoneNum) break;
+				fSalience += fWeight * m_semitoneVector[m];
+				fWeight *= GM_FEATURE_HARMONIC_DECAY;
+			}
+			fChroma[iPitch % 12] += fSalience * fSalience;
+		}
+
+		double fCumulative = 0.0;
+		size_t iRolloff = iHalf;
+		for (size_t k = 1; k <= iHalf; k++)
+		{
+			fCumulative += powerVector[k];
+			if (fCumulative >= GM_FEATURE_ROLLOFF * fTotal)
+			{
+				iRolloff = k;
+				break;
+			}
+		}
+
+		fSumCentroid += fWeighted / fTotal * fBinHz;
+		fSumRolloff += iRolloff * fBinHz;
+		fSumDB += fDB;
+		fSumDB2 += fDB * fDB;
+		iFrameNum++;
+		if (bHasLast && fMagnitudeSum > 0.0)
+		{
+			fSumFlux += fRise / fMagnitudeSum;
+			iFluxNum++;
+		}
+		bHasLast = true;
+	}
+	if (0 == iFrameNum) return false;
+
+	const double fMeanDB = fSumDB / iFrameNum;
+	sFeature.fCentroid = float(fSumCentroid / iFrameNum);
+	sFeature.fRolloff = float(fSumRolloff / iFrameNum);
+	sFeature.fFlux = (iFluxNum > 0) ? float(fSumFlux / iFluxNum) : 0.0f;
+	sFeature.fLoudness = float(fMeanDB);
+	sFeature.fDynamics = float(std::sqrt(std::max(0.0, fSumDB2 / iFrameNum - fMeanDB * fMeanDB)));
+
+	const double fMajor = _BestKeyCorrelation(fChroma, s_majorProfile);
+	const double fMinor = _BestKeyCorrelation(fChroma, s_minorProfile);
+	sFeature.fMode = float(std::min(1.0, std::max(-1.0, fMajor - fMinor)));
+	sFeature.fKeyClarity = float(std::min(1.0, std::max(0.0, std::max(fMajor, fMinor))));
+
+	double fConfidence = 0.0;
+	sFeature.fBPM = float(m_tempoDetector.Detect(pMono, iNum, fSampleRate, &fConfidence));
+	sFeature.fTempoConfidence = float(fConfidence);
+	return true;
+}
+
+void CGMAudioFeature::Feature2Emotion(const SGMAudioFeature& sFeature, double& fValence, double& fArousal)
+{
+	const double fBright = std::log2(std::max(1.0, double(sFeature.fCentroid)) / GM_EMOTION_BRIGHT_CENTER);
+	const double fTempo = (sFeature.fBPM > 0.0f) ? std::log2(sFeature.fBPM / GM_EMOTION_TEMPO_CENTER) : 0.0;
+
+	double fA = (sFeature.fBPM > 0.0f) ? GM_EMOTION_TEMPO_AROUSAL * fTempo : GM_EMOTION_NO_TEMPO;
+	fA += GM_EMOTION_LOUD_AROUSAL * (sFeature.fLoudness - GM_EMOTION_LOUD_CENTER);
+	fA += GM_EMOTION_BRIGHT_AROUSAL * fBright;
+	fA += GM_EMOTION_FLUX_AROUSAL * (sFeature.fFlux - GM_EMOTION_FLUX_CENTER);
+	fA += GM_EMOTION_DYN_AROUSAL * (sFeature.fDynamics - GM_EMOTION_DYN_CENTER);
+
+	double fV = GM_EMOTION_MODE_VALENCE * sFeature.fMode;
+	fV += GM_EMOTION_BRIGHT_VALENCE * fBright;
+	fV += GM_EMOTION_TEMPO_VALENCE * fTempo;
+
+	fValence = std::tanh(fV);
+	fArousal = std::tanh(fA);
+}
+
+double CGMAudioFeature::Emotion2Angle(const double fValence, const double fArousal)
+{
+	// Ч-Ѷƽϣŭ(-,+)135㣬ϲ(+,+)45㣬(+,-)-45㣬(-,-)-135㣬
+	// Ƕ˳ʱ뷽ӣŭʼ
+	// atan2ķΧ(-PI, PI]fAngle[-0.25*PI, 1.75*PI)֮
+	double fAngle = GM_FEATURE_PI * 0.75 - std::atan2(fArousal, fValence);
+	if (fAngle < 0.0) fAngle += GM_FEATURE_PI * 2.0;
+	return fAngle;
+}
+
+double CGMAudioFeature::_BestKeyCorrelation(const double* pChroma, const double* pProfile)
+{
+	double fChromaMean = 0.0;
+	double fProfileMean = 0.0;
+	for (int i = 0; i < 12; i++)
+	{
+		fChromaMean += pChroma[i];
+		fProfileMean += pProfile[i];
+	}
+	fChromaMean /= 12.0;
+	fProfileMean /= 12.0;
+
+	double fBest = -1.0;
+	for (int iKey = 0; iKey < 12; iKey++)
+	{
+		// Ƥѷϵģ뵽iKey
+		double fXY = 0.0;
+		double fXX = 0.0;
+		double fYY = 0.0;
+		for (int i = 0; i < 12; i++)
+		{
+			const double fX = pChroma[(iKey + i) % 12] - fChromaMean;
+			const double fY = pProfile[i] - fProfileMean;
+			fXY += fX * fY;
+			fXX += fX * fX;
+			fYY += fY * fY;
+		}
+		if (fXX <= 0.0 || fYY <= 0.0) continue;
+		fBest = std::max(fBest, fXY / std::sqrt(fXX * fYY));
+	}
+	return std::max(0.0, fBest);
+}
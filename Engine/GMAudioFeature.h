@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioFeature.h
+/// @brief		Galaxy-Music Engine - GMAudioFeature
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMSpectrum.h"
+#include "GMTempoDetector.h"
+#include <vector>
+#include <cstddef>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_FEATURE_VERSION			(1)				// ļ㷽汾޸ļ㷽ɵ֮ʧЧ
+
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/**
+	* ƵȫƵͳ
+	* @author LiuTao
+	* @since 2026.10.17
+	* @param fCentroid:			ƵĵƽֵλHz
+	* @param fRolloff:			85%ƵʵƽֵλHz
+	* @param fFlux:				һƵͨƽֵ[0,1]Խ仯Խ
+	* @param fLoudness:			֡RMSƽֵλdBFS
+	* @param fDynamics:			֡RMSı׼λdB
+	* @param fMode:				С[-1,1]0ƫС0ƫС
+	* @param fKeyClarity:		ȣ[0,1]ƥʽϵ
+	* @param fBPM:				BPMûԽʱΪ0
+	* @param fTempoConfidence:	BPMŶȣ[0,1]
+	*/
+	struct SGMAudioFeature
+	{
+		SGMAudioFeature() : fCentroid(0.0f), fRolloff(0.0f), fFlux(0.0f), fLoudness(0.0f), fDynamics(0.0f),
+			fMode(0.0f), fKeyClarity(0.0f), fBPM(0.0f), fTempoConfidence(0.0f) {}
+
+		float fCentroid;
+		float fRolloff;
+		float fFlux;
+		float fLoudness;
+		float fDynamics;
+		float fMode;
+		float fKeyClarity;
+		float fBPM;
+		float fTempoConfidence;
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioFeature
+	*  @brief Ƶȡ
+	*	8192֡PCMƵġƵʡƵͨRMS
+	*	ٰƵװۺϣг͹ÿߵȣ۵Ϊ12ɫ
+	*	Krumhansl-Kessler/СģأõСȣгͱⷺѴΪС
+	*	̶ϵģӳΪЧ(valence)뻽Ѷ(arousal)ӳΪǶȣȫȷ
+	*	㣬BASS߳ʹãÿ߳ʹøԵʵ
+	*/
+	class CGMAudioFeature
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioFeature();
+		/** @brief  */
+		~CGMAudioFeature();
+
+		/**
+		* Extract
+		* ȡPCMBPM
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pMono:			
+		* @param iNum:			20s
+		* @param fSampleRate:	ʣλHz
+		* @param sFeature:		
+		* @return bool:			ɹtrueƵ̫̻Ǿfalse
+		*/
+		bool Extract(const float* pMono, const size_t iNum, const float fSampleRate, SGMAudioFeature& sFeature);
+
+		/**
+		* Feature2Emotion
+		* ƵתЧ뻽Ѷ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param sFeature:		Ƶ
+		* @param fValence:		Чۣ[-1,1]Ϊ
+		* @param fArousal:		ĻѶȣ[-1,1]Ϊ
+		* @return void
+		*/
+		static void Feature2Emotion(const SGMAudioFeature& sFeature, double& fValence, double& fArousal);
+
+		/**
+		* Emotion2Angle
+		* Ч뻽ѶתǶȣSGMAudioCoord::angleԼһ£
+		*	Ҹ棨ŭΪ0棨ϲΪ0.5*PIƽ棨֣ΪPIƽҸ棨Ϊ1.5*PI
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fValence:		Чۣ[-1,1]
+		* @param fArousal:		Ѷȣ[-1,1]
+		* @return double:		Ƕȣ[0.0,2*PI)
+		*/
+		static double Emotion2Angle(const double fValence, const double fArousal);
+
+	private:
+		/** @brief ɫ12ģأϵ */
+		static double _BestKeyCorrelation(const double* pChroma, const double* pProfile);
+
+		// 
+	private:
+		CGMSpectrum							m_spectrum;						//!< ֡FFT
+		CGMTempoDetector					m_tempoDetector;				//!< BPM
+		std::vector<float>					m_lastMagnitudeVector;			//!< һ֡ƵֵƵͨ
+		std::vector<unsigned int>			m_semitoneBinVector;			//!< ӦƵ㷶Χ[begin, end)ÿԪһ
+		std::vector<float>					m_semitoneVector;				//!< ǰֵ֡
+	};
+}	// GM
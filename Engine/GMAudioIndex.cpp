@@ -0,0 +1,240 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioIndex.cpp
+/// @brief		Galaxy-Music Engine - GMAudioIndex
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioIndex.h"
+#include <algorithm>
+#include <cwctype>
+
+using namespace GM;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+#define GM_INDEX_TOMB				(0xFFFFFFFF)	// ɾλUID
+#define GM_INDEX_MIN_CAPACITY		(64)			// ϣС
+
+/*************************************************************************
+CGMAudioIndex Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioIndex::CGMAudioIndex() : m_iSize(0), m_iUsed(0)
+{
+	_Rehash(GM_INDEX_MIN_CAPACITY);
+}
+
+/** @brief  */
+CGMAudioIndex::~CGMAudioIndex()
+{
+	Clear();
+}
+
+void CGMAudioIndex::Clear()
+{
+	m_slotVector.clear();
+	m_UIDSlotVector.clear();
+	m_rankTree.clear();
+	m_iSize = 0;
+	m_iUsed = 0;
+	_Rehash(GM_INDEX_MIN_CAPACITY);
+}
+
+void CGMAudioIndex::Reserve(const size_t iNum)
+{
+	// ӱ 0.5 
+	size_t iCapacity = GM_INDEX_MIN_CAPACITY;
+	while (iCapacity < iNum * 2) iCapacity <<= 1;
+	if (iCapacity > m_slotVector.size())
+	{
+		_Rehash(iCapacity);
+	}
+}
+
+bool CGMAudioIndex::Insert(const std::wstring& strName, const unsigned int iUID)
+{
+	if (0 == iUID || GM_INDEX_TOMB == iUID) return false;
+
+	const std::wstring strKey = Normalize(strName);
+	const size_t iHash = _Hash(strKey);
+
+	int iSlot = _FindSlot(strKey, iHash);
+	if (-1 != iSlot)
+	{
+		// ѴڣͬһUID޸
+		return iUID == m_slotVector[iSlot].iUID;
+	}
+
+	// UIDƣɾ
+	Erase(iUID);
+
+	if ((m_iUsed + 1) * 2 > m_slotVector.size())
+	{
+		// ɾĲλʱԭؽ
+		_Rehash((m_iSize + 1) * 4 > m_slotVector.size() ? m_slotVector.size() * 2 : m_slotVector.size());
+	}
+
+	const size_t iMask = m_slotVector.size() - 1;
+	size_t i = iHash & iMask;
+	while (0 != m_slotVector[i].iUID && GM_INDEX_TOMB != m_slotVector[i].iUID)
+	{
+		i = (i + 1) & iMask;
+	}
+	if (0 == m_slotVector[i].iUID) m_iUsed++;
+
+	m_slotVector[i].iHash = iHash;
+	m_slotVector[i].iUID = iUID;
+	m_slotVector[i].strKey = strKey;
+
+	if (iUID >= m_UIDSlotVector.size())
+	{
+		size_t iNewSize = std::max(size_t(iUID) + 1, m_UIDSlotVector.size() * 2);
+		m_UIDSlotVector.resize(iNewSize, -1);
+	}
+	m_UIDSlotVector[iUID] = int(i);
+	_RankAdd(iUID, 1);
+	m_iSize++;
+	return true;
+}
+
+bool CGMAudioIndex::Erase(const unsigned int iUID)
+{
+	if (!Contains(iUID)) return false;
+
+	SGMIndexSlot& sSlot = m_slotVector[m_UIDSlotVector[iUID]];
+	sSlot.iUID = GM_INDEX_TOMB;
+	sSlot.strKey.clear();
+	m_UIDSlotVector[iUID] = -1;
+	_RankAdd(iUID, -1);
+	m_iSize--;
+	return true;
+}
+
+unsigned int CGMAudioIndex::Find(const std::wstring& strName) const
+{
+	const std::wstring strKey = Normalize(strName);
+	int iSlot = _FindSlot(strKey, _Hash(strKey));
+	return (-1 == iSlot) ? 0 : m_slotVector[iSlot].iUID;
+}
+
+bool CGMAudioIndex::Contains(const unsigned int iUID) const
+{
+	return iUID < m_UIDSlotVector.size() && -1 != m_UIDSlotVector[iUID];
+}
+
+int CGMAudioIndex::Rank(const unsigned int iUID) const
+{
+	if (!Contains(iUID)) return -1;
+	return _RankSum(iUID) - 1;
+}
+
+std::wstring CGMAudioIndex::Normalize(const std::wstring& strName)
+{
+	std::wstring strKey = strName;
+	for (auto& c : strKey)
+	{
+		if (L'\\' == c)
+			c = L'/';
+		else
+			c = wchar_t(std::towlower(c));
+	}
+	return strKey;
+}
+
+size_t CGMAudioIndex::_Hash(const std::wstring& strKey)
+{
+	unsigned long long iHash = 14695981039346656037ULL;
+	for (auto c : strKey)
+	{
+		iHash ^= (unsigned long long)(c);
+		iHash *= 1099511628211ULL;
+	}
+	return size_t(iHash ^ (iHash >> 32));
+}
+
+int CGMAudioIndex::_FindSlot(const std::wstring& strKey, const size_t iHash) const
+{
+	const size_t iMask = m_slotVector.size() - 1;
+	size_t i = iHash & iMask;
+	// Ӳ0.5ԱȻղλ
+	while (0 != m_slotVector[i].iUID)
+	{
+		const SGMIndexSlot& sSlot = m_slotVector[i];
+		if (GM_INDEX_TOMB != sSlot.iUID && iHash == sSlot.iHash && strKey == sSlot.strKey)
+		{
+			return int(i);
+		}
+		i = (i + 1) & iMask;
+	}
+	return -1;
+}
+
+void CGMAudioIndex::_Rehash(const size_t iCapacity)
+{
+	std::vector<SGMIndexSlot> oldSlotVector;
+	oldSlotVector.swap(m_slotVector);
+	m_slotVector.resize(iCapacity);
+	m_iUsed = 0;
+
+	const size_t iMask = iCapacity - 1;
+	for (auto& itr : oldSlotVector)
+	{
+		if (0 == itr.iUID || GM_INDEX_TOMB == itr.iUID) continue;
+
+		size_t i = itr.iHash & iMask;
+		while (0 != m_slotVector[i].iUID)
+		{
+			i = (i + 1) & iMask;
+		}
+		m_slotVector[i].iHash = itr.iHash;
+		m_slotVector[i].iUID = itr.iUID;
+		m_slotVector[i].strKey.swap(itr.strKey);
+		m_UIDSlotVector[itr.iUID] = int(i);
+		m_iUsed++;
+	}
+}
+
+void CGMAudioIndex::_RankAdd(const unsigned int iUID, const int iDelta)
+{
+	if (iUID >= m_rankTree.size())
+	{
+		// ״ݺҪµĳؽ
+		std::vector<int> countVector(std::max(size_t(iUID) + 1, m_rankTree.size() * 2), 0);
+		for (size_t i = 1; i < m_UIDSlotVector.size() && i < countVector.size(); i++)
+		{
+			if (-1 != m_UIDSlotVector[i] && i != iUID) countVector[i] = 1;
+		}
+		m_rankTree.assign(countVector.size(), 0);
+		for (size_t i = 1; i < countVector.size(); i++)
+		{
+			m_rankTree[i] += countVector[i];
+			size_t iParent = i + (i & (~i + 1));
+			if (iParent < m_rankTree.size()) m_rankTree[iParent] += m_rankTree[i];
+		}
+	}
+
+	for (size_t i = iUID; i < m_rankTree.size(); i += (i & (~i + 1)))
+	{
+		m_rankTree[i] += iDelta;
+	}
+}
+
+int CGMAudioIndex::_RankSum(unsigned int iUID) const
+{
+	if (m_rankTree.empty()) return 0;
+
+	int iSum = 0;
+	for (size_t i = std::min(size_t(iUID), m_rankTree.size() - 1); i > 0; i -= (i & (~i + 1)))
+	{
+		iSum += m_rankTree[i];
+	}
+	return iSum;
+}
@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioIndex.h
+/// @brief		Galaxy-Music Engine - GMAudioIndex
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace GM
+{
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioIndex
+	*  @brief ƵĶ淶ļ -> UIDĿѰַϣ
+	*	ԼUID -> ϣλ飬ȽϵԲ
+	*	״¼UIDռԱO(logN)ȡUIDƵе
+	*/
+	class CGMAudioIndex
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioIndex();
+		/** @brief  */
+		~CGMAudioIndex();
+
+		/**
+		* Clear
+		* 
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Clear();
+
+		/**
+		* Reserve
+		* Ԥռ䣬ǰãؽϣ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iNum:		ԤƵƵ
+		* @return void
+		*/
+		void Reserve(const size_t iNum);
+
+		/**
+		* Insert
+		* һUIDƣɾ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strName:	Ƶļ
+		* @param iUID:		ƵUID0ΪǷ
+		* @return bool:		ɹtrueUIDǷѱUIDռfalse
+		*/
+		bool Insert(const std::wstring& strName, const unsigned int iUID);
+
+		/**
+		* Erase
+		* UIDɾһ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:		ƵUID
+		* @return bool:		ڲɾtruefalse
+		*/
+		bool Erase(const unsigned int iUID);
+
+		/**
+		* Find
+		* ƵļƲѯUIDO(1)
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strName:			Ƶļ
+		* @return unsigned int:		ƵUID򷵻0
+		*/
+		unsigned int Find(const std::wstring& strName) const;
+
+		/**
+		* Contains
+		* ѯUIDǷ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:		ƵUID
+		* @return bool:		truefalse
+		*/
+		bool Contains(const unsigned int iUID) const;
+
+		/**
+		* Rank
+		* ȡUIDЧUIDеţڰUIDƵеλã
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:		ƵUID
+		* @return int:		0ʼţ򷵻-1
+		*/
+		int Rank(const unsigned int iUID) const;
+
+		/**
+		* GetSize
+		* @return size_t:	еƵ
+		*/
+		inline size_t GetSize() const
+		{
+			return m_iSize;
+		}
+
+		/**
+		* Normalize
+		* ļ淶Windows ļִСдͳһתΪСдͳһ·ָ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strName:			Ƶļ
+		* @return std::wstring:		淶ļ
+		*/
+		static std::wstring Normalize(const std::wstring& strName);
+
+	private:
+		/**
+		* ϣλ
+		* @param iHash:			淶ļĹϣֵ
+		* @param iUID:			ƵUID0 ղλGM_INDEX_TOMB ɾ
+		* @param strKey:		淶ļ
+		*/
+		struct SGMIndexSlot
+		{
+			SGMIndexSlot() : iHash(0), iUID(0), strKey(L"") {}
+			size_t			iHash;
+			unsigned int	iUID;
+			std::wstring	strKey;
+		};
+
+		/** @brief FNV-1a ϣ */
+		static size_t _Hash(const std::wstring& strKey);
+		/**
+		* @brief ҹ淶ļڵĲλ
+		* @return int: λţ򷵻-1
+		*/
+		int _FindSlot(const std::wstring& strKey, const size_t iHash) const;
+		/** @brief ؽϣiCapacity 2 */
+		void _Rehash(const size_t iCapacity);
+		/** @brief ״飺UIDռ += iDelta */
+		void _RankAdd(const unsigned int iUID, const int iDelta);
+		/** @brief ״飺UID[1, iUID]Χڵռ */
+		int _RankSum(unsigned int iUID) const;
+
+		// 
+	private:
+		std::vector<SGMIndexSlot>			m_slotVector;					//!< Ѱַ̽⣩ϣ
+		std::vector<int>					m_UIDSlotVector;				//!< UID -> λţ-1 
+		std::vector<int>					m_rankTree;						//!< UIDռ״飬±1ʼ
+		size_t								m_iSize;						//!< Ч
+		size_t								m_iUsed;						//!< Ч + ɾĲλ
+	};
+}	// GM
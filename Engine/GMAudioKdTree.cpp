@@ -0,0 +1,234 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioKdTree.cpp
+/// @brief		Galaxy-Music Engine - GMAudioKdTree
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioKdTree.h"
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+#define GM_KD_PENDING_MIN			(64)			// ϲбСؽֵ
+#define GM_KD_STACK_MAX				(64)			// ѯջȣᳬ
+
+/*************************************************************************
+CGMAudioKdTree Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioKdTree::CGMAudioKdTree() : m_iDeadNum(0)
+{
+}
+
+/** @brief  */
+CGMAudioKdTree::~CGMAudioKdTree()
+{
+	Clear();
+}
+
+void CGMAudioKdTree::Clear()
+{
+	m_nodeVector.clear();
+	m_deadVector.clear();
+	m_pendingVector.clear();
+	m_UIDLocVector.clear();
+	m_iDeadNum = 0;
+}
+
+void CGMAudioKdTree::Build(const std::vector<SGMKdPoint>& pointVector)
+{
+	Clear();
+	m_pendingVector.reserve(pointVector.size());
+	for (auto& itr : pointVector)
+	{
+		if (0 == itr.UID) continue;
+
+		if (itr.UID < m_UIDLocVector.size() && -1 != m_UIDLocVector[itr.UID])
+		{
+			// UIDظԺΪ׼
+			m_pendingVector[-2 - m_UIDLocVector[itr.UID]] = itr;
+		}
+		else
+		{
+			m_pendingVector.push_back(itr);
+			_SetLocation(itr.UID, -2 - int(m_pendingVector.size() - 1));
+		}
+	}
+	_Rebuild();
+}
+
+bool CGMAudioKdTree::Insert(const unsigned int iUID, const float fX, const float fY)
+{
+	if (0 == iUID) return false;
+
+	Erase(iUID);
+	m_pendingVector.push_back(SGMKdPoint(fX, fY, iUID));
+	_SetLocation(iUID, -2 - int(m_pendingVector.size() - 1));
+
+	// ϲбԲѯģ̫ؽֵĹģ֤̯
+	if (m_pendingVector.size() > GM_KD_PENDING_MIN + (m_nodeVector.size() - m_iDeadNum) / 8)
+	{
+		_Rebuild();
+	}
+	return true;
+}
+
+bool CGMAudioKdTree::Erase(const unsigned int iUID)
+{
+	if (iUID >= m_UIDLocVector.size() || -1 == m_UIDLocVector[iUID]) return false;
+
+	int iLoc = m_UIDLocVector[iUID];
+	if (iLoc >= 0)
+	{
+		m_deadVector[iLoc] = 1;
+		m_iDeadNum++;
+	}
+	else
+	{
+		// ϲбеĵ㣬һɾ
+		size_t i = size_t(-2 - iLoc);
+		if (i + 1 != m_pendingVector.size())
+		{
+			m_pendingVector[i] = m_pendingVector.back();
+			m_UIDLocVector[m_pendingVector[i].UID] = iLoc;
+		}
+		m_pendingVector.pop_back();
+	}
+	m_UIDLocVector[iUID] = -1;
+
+	// ɾؽѯʱ̫Чڵ
+	if (m_iDeadNum > GM_KD_PENDING_MIN && m_iDeadNum * 2 > m_nodeVector.size())
+	{
+		_Rebuild();
+	}
+	return true;
+}
+
+void CGMAudioKdTree::Flush()
+{
+	if (!m_pendingVector.empty() || 0 != m_iDeadNum)
+	{
+		_Rebuild();
+	}
+}
+
+bool CGMAudioKdTree::Nearest(const float fX, const float fY, const float fMaxDistance, SGMKdPoint& sPoint) const
+{
+	float fBestDis2 = fMaxDistance * fMaxDistance;
+	unsigned int iBestUID = 0;
+
+	// ԲѯϲбõһСĳʼ뾶ڼ֦
+	for (auto& itr : m_pendingVector)
+	{
+		float fDX = itr.x - fX;
+		float fDY = itr.y - fY;
+		float fDis2 = fDX * fDX + fDY * fDY;
+		if (fDis2 <= fBestDis2 && (0 == iBestUID || _Closer(fDis2, itr.UID, fBestDis2, iBestUID)))
+		{
+			fBestDis2 = fDis2;
+			iBestUID = itr.UID;
+			sPoint = itr;
+		}
+	}
+
+	// ǵݹk-dѯջм¼뻮
+	struct SGMKdRange { size_t iBegin; size_t iEnd; int iAxis; };
+	SGMKdRange rangeStack[GM_KD_STACK_MAX];
+	int iTop = 0;
+	if (!m_nodeVector.empty())
+	{
+		rangeStack[iTop++] = { 0, m_nodeVector.size(), 0 };
+	}
+
+	while (iTop > 0)
+	{
+		SGMKdRange sRange = rangeStack[--iTop];
+		if (sRange.iBegin >= sRange.iEnd) continue;
+
+		size_t iMid = (sRange.iBegin + sRange.iEnd) / 2;
+		const SGMKdPoint& sNode = m_nodeVector[iMid];
+		float fDX = sNode.x - fX;
+		float fDY = sNode.y - fY;
+		if (!m_deadVector[iMid])
+		{
+			float fDis2 = fDX * fDX + fDY * fDY;
+			if (fDis2 <= fBestDis2 && (0 == iBestUID || _Closer(fDis2, sNode.UID, fBestDis2, iBestUID)))
+			{
+				fBestDis2 = fDis2;
+				iBestUID = sNode.UID;
+				sPoint = sNode;
+			}
+		}
+
+		// ѯһջȳջһָֻ㹻ʱҪѯ
+		float fDelta = (0 == sRange.iAxis) ? -fDX : -fDY;
+		int iNextAxis = 1 - sRange.iAxis;
+		SGMKdRange sNear = { sRange.iBegin, iMid, iNextAxis };
+		SGMKdRange sFar = { iMid + 1, sRange.iEnd, iNextAxis };
+		if (fDelta > 0.0f) std::swap(sNear, sFar);
+
+		if (fDelta * fDelta <= fBestDis2) rangeStack[iTop++] = sFar;
+		rangeStack[iTop++] = sNear;
+	}
+
+	return 0 != iBestUID;
+}
+
+void CGMAudioKdTree::_Build(const size_t iBegin, const size_t iEnd, const int iAxis)
+{
+	if (iEnd - iBegin < 2) return;
+
+	size_t iMid = (iBegin + iEnd) / 2;
+	std::nth_element(m_nodeVector.begin() + iBegin, m_nodeVector.begin() + iMid, m_nodeVector.begin() + iEnd,
+		[iAxis](const SGMKdPoint& a, const SGMKdPoint& b)
+	{
+		return (0 == iAxis) ? (a.x < b.x) : (a.y < b.y);
+	});
+	_Build(iBegin, iMid, 1 - iAxis);
+	_Build(iMid + 1, iEnd, 1 - iAxis);
+}
+
+void CGMAudioKdTree::_Rebuild()
+{
+	std::vector<SGMKdPoint> aliveVector;
+	aliveVector.reserve(m_nodeVector.size() - m_iDeadNum + m_pendingVector.size());
+	for (size_t i = 0; i < m_nodeVector.size(); i++)
+	{
+		if (!m_deadVector[i]) aliveVector.push_back(m_nodeVector[i]);
+	}
+	aliveVector.insert(aliveVector.end(), m_pendingVector.begin(), m_pendingVector.end());
+
+	// ȰUID򣬱֤ͬܽͬ
+	std::sort(aliveVector.begin(), aliveVector.end(),
+		[](const SGMKdPoint& a, const SGMKdPoint& b) { return a.UID < b.UID; });
+
+	m_nodeVector.swap(aliveVector);
+	m_pendingVector.clear();
+	m_deadVector.assign(m_nodeVector.size(), 0);
+	m_iDeadNum = 0;
+
+	_Build(0, m_nodeVector.size(), 0);
+	for (size_t i = 0; i < m_nodeVector.size(); i++)
+	{
+		_SetLocation(m_nodeVector[i].UID, int(i));
+	}
+}
+
+void CGMAudioKdTree::_SetLocation(const unsigned int iUID, const int iLoc)
+{
+	if (iUID >= m_UIDLocVector.size())
+	{
+		m_UIDLocVector.resize(std::max(size_t(iUID) + 1, m_UIDLocVector.size() * 2), -1);
+	}
+	m_UIDLocVector[iUID] = iLoc;
+}
@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioKdTree.h
+/// @brief		Galaxy-Music Engine - GMAudioKdTree
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace GM
+{
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/*!
+	*  @struct SGMKdPoint
+	*  @brief k-dеƵ㣺xy + ƵUID
+	*/
+	struct SGMKdPoint
+	{
+		SGMKdPoint() : x(0.0f), y(0.0f), UID(0) {}
+		SGMKdPoint(const float fX, const float fY, const unsigned int iUID) : x(fX), y(fY), UID(iUID) {}
+
+		float x;
+		float y;
+		unsigned int UID;
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioKdTree
+	*  @brief ƵǵĶάk-dϵоȷѯƵO(logN)
+	*	Ǿ̬ƽģʽ洢λ֣ɾȼ¼ڡϲб롰ɾǡУ
+	*	ۻһؽԵ޸ĵľ̯ҲO(logN)
+	*	C++ʵ֣OpenGL
+	*/
+	class CGMAudioKdTree
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioKdTree();
+		/** @brief  */
+		~CGMAudioKdTree();
+
+		/**
+		* Clear
+		* Ƶ
+		* @author LiuTao
+		* @since 2026.10.18
+		* @return void
+		*/
+		void Clear();
+
+		/**
+		* Build
+		* һƵؽUIDظʱԺΪ׼
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param pointVector:	Ƶ
+		* @return void
+		*/
+		void Build(const std::vector<SGMKdPoint>& pointVector);
+
+		/**
+		* Insert
+		* ޸һƵ㣨޸ == ɾɵ + 
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param iUID:		ƵUID0ΪǷ
+		* @param fX, fY:	꣬[-1,1]
+		* @return bool:		ɹtrueUIDǷfalse
+		*/
+		bool Insert(const unsigned int iUID, const float fX, const float fY);
+
+		/**
+		* Erase
+		* ɾһƵ
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param iUID:		ƵUID
+		* @return bool:		ڲɾtruefalse
+		*/
+		bool Erase(const unsigned int iUID);
+
+		/**
+		* Flush
+		* ϲ޸ȫϲƽ޸Ľ
+		* @author LiuTao
+		* @since 2026.10.18
+		* @return void
+		*/
+		void Flush();
+
+		/**
+		* Nearest
+		* ѯƵ㣬ͬʱȡUIDС
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param fX, fY:		ѯλõ
+		* @param fMaxDistance:	ѯ뾶˰뾶Ƶ㱻
+		* @param sPoint:		ѯɹʱƵ
+		* @return bool:			뾶Ƶtruefalse
+		*/
+		bool Nearest(const float fX, const float fY, const float fMaxDistance, SGMKdPoint& sPoint) const;
+
+		/**
+		* GetSize
+		* @return size_t:	ЧƵ
+		*/
+		inline size_t GetSize() const
+		{
+			return m_nodeVector.size() - m_iDeadNum + m_pendingVector.size();
+		}
+
+	private:
+		/** @brief ݹض [iBegin, iEnd) λ */
+		void _Build(const size_t iBegin, const size_t iEnd, const int iAxis);
+		/** @brief Ч㣨 + ϲбؽƽ */
+		void _Rebuild();
+		/** @brief ¼UIDڵλ */
+		void _SetLocation(const unsigned int iUID, const int iLoc);
+		/** @brief жһǷȵǰ */
+		inline bool _Closer(const float fDis2, const unsigned int iUID, const float fBestDis2, const unsigned int iBestUID) const
+		{
+			return (fDis2 < fBestDis2) || (fDis2 == fBestDis2 && iUID < iBestUID);
+		}
+
+		// 
+	private:
+		std::vector<SGMKdPoint>				m_nodeVector;					//!< ʽƽе㼴Ϊڵ
+		std::vector<char>					m_deadVector;					//!< ڵɾ
+		std::vector<SGMKdPoint>				m_pendingVector;				//!< δϲ
+		std::vector<int>					m_UIDLocVector;					//!< UID -> λã>=0 ڵ㣬<=-2 ϲб-1 
+		size_t								m_iDeadNum;						//!< бɾĽڵ
+	};
+}	// GM
@@ -0,0 +1,224 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioScanner.cpp
+/// @brief		Galaxy-Music Engine - GMAudioScanner
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioScanner.h"
+#include "GMAudioIndex.h"
+#include <filesystem>
+#include <algorithm>
+
+using namespace GM;
+namespace fs = std::filesystem;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+#define GM_SCAN_BATCH				(256)			// ߳ÿηеĽ
+
+/*************************************************************************
+CGMAudioScanner Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioScanner::CGMAudioScanner() : m_bRunning(false), m_bStop(false), m_bScanDone(false),
+	m_bScanFull(false), m_bLastScanFull(false)
+{
+}
+
+/** @brief  */
+CGMAudioScanner::~CGMAudioScanner()
+{
+	Stop();
+}
+
+bool CGMAudioScanner::Start(const std::wstring& strPath, const std::vector<std::wstring>& formatVector)
+{
+	// һεĽûȫȡʱܿʼµɨ裬µɨʱļ¼Ƚ
+	if (IsScanning()) return false;
+	// һε߳Ѿɨϣպµɨ
+	if (m_thread.joinable()) m_thread.join();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		_CommitScanMap();
+		m_scanMap = m_lastScanMap;
+	}
+
+	m_bStop = false;
+	m_bRunning = true;
+	m_thread = std::thread(&CGMAudioScanner::_Scan, this, strPath, formatVector);
+	return true;
+}
+
+void CGMAudioScanner::Stop()
+{
+	m_bStop = true;
+	if (m_thread.joinable()) m_thread.join();
+	m_bRunning = false;
+
+	// δȡĽɨļ¼Ҳ֮
+	// һεļ¼ûбѾļҲΪļб
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_eventDeque.clear();
+	m_bScanDone = false;
+	m_bLastScanFull = false;
+	m_scanMap.clear();
+}
+
+bool CGMAudioScanner::GetScannedNames(std::unordered_set<std::wstring>& nameSet)
+{
+	nameSet.clear();
+	if (m_bRunning) return false;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	// һȡ̲߳Żǽﲹύ
+	_CommitScanMap();
+	if (m_bScanDone || !m_eventDeque.empty() || !m_bLastScanFull) return false;
+
+	nameSet.reserve(m_lastScanMap.size());
+	for (auto& itr : m_lastScanMap)
+	{
+		nameSet.insert(itr.first);
+	}
+	return true;
+}
+
+bool CGMAudioScanner::IsScanning() const
+{
+	if (m_bRunning) return true;
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return !m_eventDeque.empty();
+}
+
+size_t CGMAudioScanner::PopEvents(std::vector<SGMScanEvent>& eventVector, const size_t iMaxNum)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	size_t iNum = 0;
+	while (iNum < iMaxNum && !m_eventDeque.empty())
+	{
+		eventVector.push_back(std::move(m_eventDeque.front()));
+		m_eventDeque.pop_front();
+		iNum++;
+	}
+	_CommitScanMap();
+	return iNum;
+}
+
+void CGMAudioScanner::_Scan(const std::wstring strPath, const std::vector<std::wstring> formatVector)
+{
+	// ͳһתΪСдչ L".mp3"
+	std::vector<std::wstring> extVector;
+	for (auto& itr : formatVector)
+	{
+		extVector.push_back(CGMAudioIndex::Normalize(L"." + itr));
+	}
+
+	for (auto& itr : m_scanMap)
+	{
+		itr.second.bSeen = false;
+	}
+
+	std::vector<SGMScanEvent> eventVector;
+	eventVector.reserve(GM_SCAN_BATCH);
+
+	std::error_code ec;
+	fs::directory_iterator dirItr(fs::path(strPath), fs::directory_options::skip_permission_denied, ec);
+	const fs::directory_iterator dirEnd;
+	for (; !ec && dirItr != dirEnd && !m_bStop; dirItr.increment(ec))
+	{
+		std::error_code fileEC;
+		if (!dirItr->is_regular_file(fileEC)) continue;
+
+		const fs::path& filePath = dirItr->path();
+		const std::wstring strExt = CGMAudioIndex::Normalize(filePath.extension().wstring());
+		if (extVector.end() == std::find(extVector.begin(), extVector.end(), strExt)) continue;
+
+		const std::wstring strName = filePath.filename().wstring();
+		SGMFileStamp sStamp;
+		sStamp.name = strName;
+		sStamp.iSize = dirItr->file_size(fileEC);
+		sStamp.iTime = dirItr->last_write_time(fileEC).time_since_epoch().count();
+		sStamp.bSeen = true;
+
+		const std::wstring strKey = CGMAudioIndex::Normalize(strName);
+		auto stampItr = m_scanMap.find(strKey);
+		if (stampItr == m_scanMap.end())
+		{
+			m_scanMap[strKey] = sStamp;
+			eventVector.push_back(SGMScanEvent(EGMSCAN_ADD, strName));
+		}
+		else
+		{
+			if (stampItr->second.iSize != sStamp.iSize || stampItr->second.iTime != sStamp.iTime)
+			{
+				eventVector.push_back(SGMScanEvent(EGMSCAN_CHANGE, strName));
+			}
+			stampItr->second = sStamp;
+		}
+
+		if (eventVector.size() >= GM_SCAN_BATCH)
+		{
+			_Push(eventVector);
+		}
+	}
+
+	// ɨ豻жϻļ޷ʱܾݴжļɾ
+	if (!ec && !m_bStop)
+	{
+		for (auto itr = m_scanMap.begin(); itr != m_scanMap.end(); )
+		{
+			if (itr->second.bSeen)
+			{
+				itr++;
+			}
+			else
+			{
+				eventVector.push_back(SGMScanEvent(EGMSCAN_REMOVE, itr->second.name));
+				itr = m_scanMap.erase(itr);
+				if (eventVector.size() >= GM_SCAN_BATCH)
+				{
+					_Push(eventVector);
+				}
+			}
+		}
+	}
+	_Push(eventVector);
+
+	// жϵɨ費ύ¼ѾĽһɨʱ̴߳ʱظĽ
+	if (!m_bStop)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bScanDone = true;
+		m_bScanFull = !ec;
+	}
+	m_bRunning = false;
+}
+
+void CGMAudioScanner::_Push(std::vector<SGMScanEvent>& eventVector)
+{
+	if (eventVector.empty()) return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& itr : eventVector)
+	{
+		m_eventDeque.push_back(std::move(itr));
+	}
+	eventVector.clear();
+}
+
+void CGMAudioScanner::_CommitScanMap()
+{
+	if (!m_bScanDone || !m_eventDeque.empty()) return;
+
+	m_lastScanMap.swap(m_scanMap);
+	m_scanMap.clear();
+	m_bScanDone = false;
+	m_bLastScanFull = m_bScanFull;
+}
@@ -0,0 +1,158 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioScanner.h
+/// @brief		Galaxy-Music Engine - GMAudioScanner
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <unordered_set>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+namespace GM
+{
+	/*************************************************************************
+	Enums
+	*************************************************************************/
+
+	// ɨ
+	enum EGMSCAN_EVENT
+	{
+		EGMSCAN_ADD,				// µƵļ
+		EGMSCAN_REMOVE,				// ϴɨʱڣβڵƵļ
+		EGMSCAN_CHANGE				// С޸ʱ䷢仯Ƶļ
+	};
+
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/**
+	* ɨ
+	* @author LiuTao
+	* @since 2026.10.17
+	* @param eType:			
+	* @param name:			Ƶļƣ·
+	*/
+	struct SGMScanEvent
+	{
+		SGMScanEvent() : eType(EGMSCAN_ADD), name(L"") {}
+		SGMScanEvent(const EGMSCAN_EVENT eEvent, const std::wstring& strName) : eType(eEvent), name(strName) {}
+
+		EGMSCAN_EVENT eType;
+		std::wstring name;
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioScanner
+	*  @brief Ƶļɨstd::filesystemڹ߳ɨ
+	*	¼ÿļĴС޸ʱ䣬һɨĽȽϣֻɾ޸Ĺļ
+	*	У߳ÿ֡ȡһִ
+	*/
+	class CGMAudioScanner
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioScanner();
+		/** @brief ȴ߳̽ */
+		~CGMAudioScanner();
+
+		/**
+		* Start
+		* ߳ɨļУһɨ軹ûн߽ûȫȡ򷵻false
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strPath:			Ƶļ·ɨļ
+		* @param formatVector:		ֵ֧ļͣ L"mp3"ִСд
+		* @return bool:				ɹtruefalse
+		*/
+		bool Start(const std::wstring& strPath, const std::vector<std::wstring>& formatVector);
+
+		/**
+		* Stop
+		* ֹ֪ͨ߳ͣȴδĽᱻ
+		* ɨļ¼ͬʱϣһɨȻһļ¼ȽϣĽ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Stop();
+
+		/**
+		* IsScanning
+		* @return bool:		߳ɨ裬߶лδȡĽtrue
+		*/
+		bool IsScanning() const;
+
+		/**
+		* PopEvents
+		* ӶȡiMaxNumɨ׷ӵeventVector
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param eventVector:		ɨ
+		* @param iMaxNum:			ȡ
+		* @return size_t:			ȡ
+		*/
+		size_t PopEvents(std::vector<SGMScanEvent>& eventVector, const size_t iMaxNum);
+
+		/**
+		* GetScannedNames
+		* һɨ¼ȫƵļƵѾڵƵҪٴζȡļ
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param nameSet:			淶ļCGMAudioIndex::Normalize
+		* @return bool:				ɨҽȫȡtrue
+		*							ɨ衢ɨ豻жϡļ޷ȡʱfalsenameSetΪ
+		*/
+		bool GetScannedNames(std::unordered_set<std::wstring>& nameSet);
+
+	private:
+		/**
+		* ļС޸ʱ
+		*/
+		struct SGMFileStamp
+		{
+			SGMFileStamp() : name(L""), iSize(0), iTime(0), bSeen(false) {}
+			std::wstring		name;
+			unsigned long long	iSize;
+			long long			iTime;
+			bool				bSeen;
+		};
+
+		/** @brief ̵߳ɨ躯 */
+		void _Scan(const std::wstring strPath, const std::vector<std::wstring> formatVector);
+		/** @brief һ */
+		void _Push(std::vector<SGMScanEvent>& eventVector);
+		/** @brief нѾȡύɨļ¼ǰסm_mutex */
+		void _CommitScanMap();
+
+		// 
+	private:
+		std::thread										m_thread;						//!< ߳
+		mutable std::mutex								m_mutex;						//!< m_eventDequem_lastScanMapm_bScanDone
+		std::deque<SGMScanEvent>						m_eventDeque;					//!< ȴ߳ȡɨ
+		std::atomic<bool>								m_bRunning;						//!< ߳Ƿɨ
+		std::atomic<bool>								m_bStop;						//!< ֹ֪ͨ߳ͣ
+		bool											m_bScanDone;					//!< ɨѾm_scanMapȴȫȡύ
+		bool											m_bScanFull;					//!< ɨļ
+		bool											m_bLastScanFull;				//!< ύļ¼Զļеɨ
+		std::unordered_map<std::wstring, SGMFileStamp>	m_lastScanMap;					//!< һɨ貢ҽȫȡļ¼Ϊ淶ļ
+		std::unordered_map<std::wstring, SGMFileStamp>	m_scanMap;						//!< ɨļ¼ֻڹ߳޸
+	};
+}	// GM
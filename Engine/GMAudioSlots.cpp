@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioSlots.cpp
+/// @brief		Galaxy-Music Engine - GMAudioSlots
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMAudioSlots.h"
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+CGMAudioSlots Methods
+*************************************************************************/
+
+/** @brief  */
+CGMAudioSlots::CGMAudioSlots(const size_t iPageSize) : m_iSize(0), m_iPageSize((std::max)(iPageSize, size_t(1)))
+{
+}
+
+/** @brief  */
+CGMAudioSlots::~CGMAudioSlots()
+{
+	Clear();
+}
+
+void CGMAudioSlots::Clear()
+{
+	m_slotUIDVector.clear();
+	m_UIDSlotVector.clear();
+	m_freeVector.clear();
+	m_dirtyBeginVector.clear();
+	m_dirtyEndVector.clear();
+	m_dirtyPageVector.clear();
+	m_iSize = 0;
+}
+
+int CGMAudioSlots::Acquire(const unsigned int iUID)
+{
+	if (0 == iUID) return -1;
+
+	int iSlot = GetSlot(iUID);
+	if (-1 == iSlot)
+	{
+		// ȸÿвλûʱĩβ
+		if (!m_freeVector.empty())
+		{
+			iSlot = int(m_freeVector.back());
+			m_freeVector.pop_back();
+		}
+		else
+		{
+			iSlot = int(m_slotUIDVector.size());
+			m_slotUIDVector.push_back(0);
+		}
+
+		if (iUID >= m_UIDSlotVector.size())
+		{
+			size_t iNewSize = (std::max)(size_t(iUID) + 1, m_UIDSlotVector.size() * 2);
+			m_UIDSlotVector.resize(iNewSize, -1);
+		}
+		m_slotUIDVector[iSlot] = iUID;
+		m_UIDSlotVector[iUID] = iSlot;
+		m_iSize++;
+	}
+	_MarkDirty(size_t(iSlot));
+	return iSlot;
+}
+
+bool CGMAudioSlots::Release(const unsigned int iUID)
+{
+	int iSlot = GetSlot(iUID);
+	if (-1 == iSlot) return false;
+
+	m_slotUIDVector[iSlot] = 0;
+	m_UIDSlotVector[iUID] = -1;
+	m_freeVector.push_back(size_t(iSlot));
+	m_iSize--;
+	_MarkDirty(size_t(iSlot));
+	return true;
+}
+
+bool CGMAudioSlots::Touch(const unsigned int iUID)
+{
+	int iSlot = GetSlot(iUID);
+	if (-1 == iSlot) return false;
+
+	_MarkDirty(size_t(iSlot));
+	return true;
+}
+
+int CGMAudioSlots::GetSlot(const unsigned int iUID) const
+{
+	return (iUID < m_UIDSlotVector.size()) ? m_UIDSlotVector[iUID] : -1;
+}
+
+unsigned int CGMAudioSlots::GetUID(const size_t iSlot) const
+{
+	return (iSlot < m_slotUIDVector.size()) ? m_slotUIDVector[iSlot] : 0;
+}
+
+size_t CGMAudioSlots::PopDirtyRanges(std::vector<SGMSlotRange>& rangeVector)
+{
+	rangeVector.clear();
+	std::sort(m_dirtyPageVector.begin(), m_dirtyPageVector.end());
+	for (auto iPage : m_dirtyPageVector)
+	{
+		rangeVector.push_back(SGMSlotRange(iPage, m_dirtyBeginVector[iPage], m_dirtyEndVector[iPage]));
+		m_dirtyBeginVector[iPage] = 0;
+		m_dirtyEndVector[iPage] = 0;
+	}
+	m_dirtyPageVector.clear();
+	return rangeVector.size();
+}
+
+void CGMAudioSlots::_MarkDirty(const size_t iSlot)
+{
+	const size_t iPage = iSlot / m_iPageSize;
+	if (iPage >= m_dirtyBeginVector.size())
+	{
+		m_dirtyBeginVector.resize(iPage + 1, 0);
+		m_dirtyEndVector.resize(iPage + 1, 0);
+	}
+
+	if (m_dirtyBeginVector[iPage] == m_dirtyEndVector[iPage])
+	{
+		// һҳһα޸
+		m_dirtyBeginVector[iPage] = iSlot;
+		m_dirtyEndVector[iPage] = iSlot + 1;
+		m_dirtyPageVector.push_back(iPage);
+	}
+	else
+	{
+		m_dirtyBeginVector[iPage] = (std::min)(m_dirtyBeginVector[iPage], iSlot);
+		m_dirtyEndVector[iPage] = (std::max)(m_dirtyEndVector[iPage], iSlot + 1);
+	}
+}
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMAudioSlots.h
+/// @brief		Galaxy-Music Engine - GMAudioSlots
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_AUDIO_PAGE_SIZE			(4096)			// ÿһҳƵǵĲλÿһҳһ
+
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/**
+	* ҪϴĲλΧҳ
+	* @author LiuTao
+	* @since 2026.10.17
+	* @param iPage:			ҳ
+	* @param iBegin:		ʼλ
+	* @param iEnd:			λ
+	*/
+	struct SGMSlotRange
+	{
+		SGMSlotRange() : iPage(0), iBegin(0), iEnd(0) {}
+		SGMSlotRange(const size_t page, const size_t begin, const size_t end) : iPage(page), iBegin(begin), iEnd(end) {}
+
+		size_t iPage;
+		size_t iBegin;
+		size_t iEnd;
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMAudioSlots
+	*  @brief ƵǶ㻺Ĳλֻ¼漰Ⱦ
+	*	ÿUIDռһ̶ĲλֱͷţͷŵĲλбȱµUID
+	*	λҳ֣¼ÿһҳб޸ĵķΧȾʱֻҪϴ޸ĵҳ
+	*/
+	class CGMAudioSlots
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMAudioSlots(const size_t iPageSize = GM_AUDIO_PAGE_SIZE);
+		/** @brief  */
+		~CGMAudioSlots();
+
+		/**
+		* Clear
+		* вλ޸ļ¼
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Clear();
+
+		/**
+		* Acquire
+		* ΪUIDλѾвλʱԭĲλΪ޸
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:			ƵUID0ΪǷ
+		* @return int:			λUIDǷʱ-1
+		*/
+		int Acquire(const unsigned int iUID);
+
+		/**
+		* Release
+		* ͷUIDĲλλбΪ޸
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:			ƵUID
+		* @return bool:			вλͷtruefalse
+		*/
+		bool Release(const unsigned int iUID);
+
+		/**
+		* Touch
+		* UIDݱ޸ģĲλΪ޸
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:			ƵUID
+		* @return bool:			вλtruefalse
+		*/
+		bool Touch(const unsigned int iUID);
+
+		/**
+		* GetSlot
+		* @param iUID:			ƵUID
+		* @return int:			UIDĲλûʱ-1
+		*/
+		int GetSlot(const unsigned int iUID) const;
+
+		/**
+		* GetUID
+		* @param iSlot:				λ
+		* @return unsigned int:		ռòλUIDʱ0
+		*/
+		unsigned int GetUID(const size_t iSlot) const;
+
+		/** @brief ռõĲλ */
+		inline size_t GetSize() const
+		{
+			return m_iSize;
+		}
+
+		/** @brief Ĳλе */
+		inline size_t GetCapacity() const
+		{
+			return m_slotUIDVector.size();
+		}
+
+		/** @brief ÿһҳĲλ */
+		inline size_t GetPageSize() const
+		{
+			return m_iPageSize;
+		}
+
+		/** @brief ҳ */
+		inline size_t GetPageNum() const
+		{
+			return (m_slotUIDVector.size() + m_iPageSize - 1) / m_iPageSize;
+		}
+
+		/**
+		* PopDirtyRanges
+		* ȡб޸ĵķΧ޸ļ¼ÿһҳһΧҳ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param rangeVector:		޸ķΧ
+		* @return size_t:			Χ
+		*/
+		size_t PopDirtyRanges(std::vector<SGMSlotRange>& rangeVector);
+
+	private:
+		/** @brief λΪ޸ */
+		void _MarkDirty(const size_t iSlot);
+
+		// 
+	private:
+		std::vector<unsigned int>			m_slotUIDVector;				//!< λ -> UID0ʾ
+		std::vector<int>					m_UIDSlotVector;				//!< UID -> λ-1ʾû
+		std::vector<size_t>					m_freeVector;					//!< вλȳ
+		std::vector<size_t>					m_dirtyBeginVector;				//!< ÿһҳ޸ķΧ
+		std::vector<size_t>					m_dirtyEndVector;				//!< ÿһҳ޸ķΧյ㣬ʱʾδ޸
+		std::vector<size_t>					m_dirtyPageVector;				//!< ޸ĵҳţ
+		size_t								m_iSize;						//!< ռõĲλ
+		size_t								m_iPageSize;					//!< ÿһҳĲλ
+	};
+}	// GM
@@ -10,7 +10,9 @@
 /// @date		2020.12.09
 //////////////////////////////////////////////////////////////////////////
 #pragma once
+#ifdef _WIN32
 #include <Windows.h>
+#endif
 #include "GMStructs.h"
 #include "GMEnums.h"
 
@@ -76,8 +78,8 @@ namespace GM
 	{
 		SGMConfigData()
 			: strCorePath("../../Data/Core/"), strMediaPath(L"../../Data/Media/"),
-			eRenderQuality(EGMRENDER_LOW), bPhoto(false), bWanderingEarth(false),
-			fFovy(40.0f), fVolume(0.5f), fMinBPM(23.0),
+			eRenderQuality(EGMRENDER_LOW), bPhoto(false), bWanderingEarth(false), bAsteroidCPU(false), bAsteroidKepler(false),
+			fFovy(40.0f), fVolume(0.5f), fCrossfade(2.0f), fMinBPM(23.0),
 			iScreenWidth(1920), iScreenHeight(1080)
 		{}
 
@@ -86,8 +88,11 @@ namespace GM
 		EGMRENDER_QUALITY				eRenderQuality;			//!< ߻ģʽ
 		bool							bPhoto;					//!< Ƭģʽ
 		bool							bWanderingEarth;		//!< ˵ģʽ
+		bool							bAsteroidCPU;			//!< СǴCPU㣬ڲ֧compute shaderԿ
+		bool							bAsteroidKepler;		//!< СǴùֵ֡
 		float							fFovy;					//!< ĴֱFOVλ
 		float							fVolume;				//!< [0.0,1.0]
+		float							fCrossfade;				//!< лһʱĽ浭ʱ0Ϊ޷νӣλs
 		double							fMinBPM;				//!< ƵСBPM
 		int								iScreenWidth;			//!< Ļȣλ
 		int								iScreenHeight;			//!< Ļ߶ȣλ
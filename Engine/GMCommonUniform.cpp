@@ -13,6 +13,7 @@
 
 #include "GMEngine.h"
 #include "GMCommonUniform.h"
+#include "GMSpectrum.h"
 #include <osg/Timer>
 
 using namespace GM;
@@ -20,7 +21,6 @@ using namespace GM;
 /*************************************************************************
  Macro Defines
 *************************************************************************/
-#define PULSE_NUM				128 		// max number of audio pulse
 
 /*************************************************************************
 CGMCommonUniform Methods
@@ -30,7 +30,9 @@ CGMCommonUniform::CGMCommonUniform():
 	m_vScreenSizeUniform(new osg::Uniform("screenSize", osg::Vec3f(1920.0f, 1080.0f, 0.5f))),
 	m_fTimeUniform(new osg::Uniform("times", 0.0f)),
 	m_vStarColorUniform(new osg::Uniform("playingStarColor", osg::Vec4f(1.0f, 1.0f, 1.0f, 1.0f))),
-	m_fLevelArrayUniform(new osg::Uniform(osg::Uniform::Type::FLOAT, "level", PULSE_NUM)),
+	m_fLevelArrayUniform(new osg::Uniform(osg::Uniform::Type::FLOAT, "level", GM_LEVEL_NUM)),
+	m_iLevelHeadUniform(new osg::Uniform("levelHead", 0)),
+	m_fSpectrumArrayUniform(new osg::Uniform(osg::Uniform::Type::FLOAT, "spectrum", GM_SPECTRUM_BAND_NUM)),
 	m_fUnitUniform(new osg::Uniform("unit", 1.0f)),
 	m_vStarHiePosUniform(new osg::Uniform("starWorldPos", osg::Vec3f(0.0f, 0.0f, 0.0f))),
 	m_fGalaxyAlphaUniform(new osg::Uniform("galaxyAlpha", 1.0f)),
@@ -40,12 +42,16 @@ CGMCommonUniform::CGMCommonUniform():
 	m_vEyeRightDirUniform(new osg::Uniform("eyeRightDir", osg::Vec3f(1.0f, 0.0f, 0.0f))),
 	m_vEyeUpDirUniform(new osg::Uniform("eyeUpDir", osg::Vec3f(0.0f, 1.0f, 0.0f))),
 	m_vViewUpUniform(new osg::Uniform("viewUp", osg::Vec3f(0.0f, 1.0f, 0.0f))),
-	m_fRenderingTime(0.0)
+	m_fRenderingTime(0.0), m_levelRing()
 {
-	for (int i = 0; i < PULSE_NUM; i++)
+	for (int i = 0; i < GM_LEVEL_NUM; i++)
 	{
 		m_fLevelArrayUniform->setElement(i, 0.0f);
 	}
+	for (int i = 0; i < GM_SPECTRUM_BAND_NUM; i++)
+	{
+		m_fSpectrumArrayUniform->setElement(i, 0.0f);
+	}
 }
 
 CGMCommonUniform::~CGMCommonUniform()
@@ -101,11 +107,17 @@ void CGMCommonUniform::ResizeScreen(const int width, const int height)
 
 void CGMCommonUniform::SetAudioLevel(const float fLevel)
 {
-	for (int i = PULSE_NUM - 2; i >= 0; i--)
+	// headÿ֡һ֮ǰiֵ֡Զɵi+1֡Ҫƶ
+	const int iHead = m_levelRing.Push();
+	m_fLevelArrayUniform->setElement(iHead, fLevel);
+	m_iLevelHeadUniform->set(iHead);
+}
+
+void CGMCommonUniform::SetAudioSpectrum(const std::vector<float>& bandVector)
+{
+	const int iNum = osg::minimum(int(bandVector.size()), GM_SPECTRUM_BAND_NUM);
+	for (int i = 0; i < iNum; i++)
 	{
-		float fL;
-		m_fLevelArrayUniform->getElement(i, fL);
-		m_fLevelArrayUniform->setElement(i + 1, fL);
+		m_fSpectrumArrayUniform->setElement(i, bandVector[i]);
 	}
-	m_fLevelArrayUniform->setElement(0, fLevel);
 }
\ No newline at end of file
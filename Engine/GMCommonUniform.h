@@ -13,6 +13,7 @@
 
 #include "GMCommon.h"
 #include "GMKernel.h"
+#include "GMLevelRing.h"
 #include <osg/Uniform>
 
 namespace GM
@@ -74,13 +75,29 @@ namespace GM
 		{
 			return m_fLevelArrayUniform.get();
 		}
+		inline osg::Uniform*const GetLevelHead() const
+		{
+			return m_iLevelHeadUniform.get();
+		}
 		/**
 		* SetAudioLevel
 		* õǰ֡Ƶֵ
+		* ǻλÿֻ֡дһֵshaderеi֡ǰΪ level[(levelHead + i) & 127]
 		* @param fLevel ֵ [0.0f,1.0f]
 		*/
 		void SetAudioLevel(const float fLevel);
 
+		inline osg::Uniform*const GetSpectrumArray() const
+		{
+			return m_fSpectrumArrayUniform.get();
+		}
+		/**
+		* SetAudioSpectrum
+		* õǰ֡ƵĶƵ
+		* @param bandVector ƵGM_SPECTRUM_BAND_NUMΧ[0.0f,1.0f]Ƶǰ
+		*/
+		void SetAudioSpectrum(const std::vector<float>& bandVector);
+
 		inline osg::Uniform* const GetUnit() const
 		{
 			return m_fUnitUniform.get();
@@ -165,7 +182,9 @@ namespace GM
 		osg::ref_ptr<osg::Uniform> m_vScreenSizeUniform;			//!< vec3(ĻĻRTT)
 		osg::ref_ptr<osg::Uniform> m_fTimeUniform;					//!< ʱ䣬λ
 		osg::ref_ptr<osg::Uniform> m_vStarColorUniform;				//!< ǰɫ
-		osg::ref_ptr<osg::Uniform> m_fLevelArrayUniform;			//!< 
+		osg::ref_ptr<osg::Uniform> m_fLevelArrayUniform;			//!< 飬λ
+		osg::ref_ptr<osg::Uniform> m_iLevelHeadUniform;				//!< ֵλ
+		osg::ref_ptr<osg::Uniform> m_fSpectrumArrayUniform;			//!< Ƶ
 		osg::ref_ptr<osg::Uniform> m_fUnitUniform;					//!< ǰ㼶λ
 		osg::ref_ptr<osg::Uniform> m_vStarHiePosUniform;			//!< Ƶǵǰ㼶ռ
 		osg::ref_ptr<osg::Uniform> m_fGalaxyAlphaUniform;			//!< ϵalpha
@@ -178,6 +197,7 @@ namespace GM
 		osg::ref_ptr<osg::Uniform> m_vViewUpUniform;				//!< ۵viewռUpָ
 
 		double m_fRenderingTime;									//!< άȾĳʱ䣬ǳʱ
+		CGMLevelRing m_levelRing;									//!< 黷λ±
 	};
 
 }	// GM
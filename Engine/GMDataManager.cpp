@@ -13,15 +13,19 @@
 #include "GMDataManager.h"
 #include "GMXml.h"
 #include "GMKit.h"
-#include <osgDB/ReadFile>
-#include <io.h>
+#include "GMAudioCache.h"
+#include <unordered_set>
 using namespace GM;
 
 /*************************************************************************
  Macro Defines
 *************************************************************************/
 #define GM_LIST_MAX					(50)	// б󳤶
-#define LUT_WIDTH					8192	// ұ
+#define GM_AUDIO_MAX				(65536)	// ƵƵ
+#define GM_SCAN_EVENT_MAX			(256)	// ÿ֡ദɨ
+#define GM_ANALYSIS_APPLY_INTERVAL	(2.0)	// дƵ̼λsÿд붼ʹƵؽ
+#define GM_NEAR_RADIUS				(0.0625f)	// λƵǵ룬꣬Ϊûе
+#define GM_AUDIO_SAVE_IDLE			(10.0)	// Ƶֹͣ仯֮AudioData.xmlλs
 
 /*************************************************************************
 Structs
@@ -40,15 +44,22 @@ CGMDataManager::CGMDataManager() :
 	m_pKernelData(nullptr), m_pConfigData(nullptr),
 	m_strAudioPath(L"Music/"), m_strCurrentAudio(L""),
 	m_formatVector({ L"mp3", L"wma", L"wav", L"ogg" }),
-	m_iFreeUID(1),
-	m_pAudioNumUniform(new osg::Uniform("audioNum", 4096.0f))
+	m_iFreeUID(1), m_iGeneration(0), m_iSavedGeneration(0),
+	m_iIdleGeneration(0), m_fIdleTime(0.0),
+	m_bScanPending(false), m_fAnalysisApplyTime(0.0)
 {
 }
 
 /** @brief  */
 CGMDataManager::~CGMDataManager()
 {
+	m_audioScanner.Stop();
+	m_audioAnalyzer.Stop();
 	m_audioDataMap.clear();
+	m_audioIndex.Clear();
+	m_playOrder.Clear();
+	m_audioCoordSet.clear();
+	m_galaxyCoordSet.clear();
 }
 
 /** @brief ʼ */
@@ -57,34 +68,89 @@ bool CGMDataManager::Init(SGMKernelData* pKernelData, SGMConfigData * pConfigDat
 	m_pKernelData = pKernelData;
 	m_pConfigData = pConfigData;
 
-	// ȡѾƵ
-	_RefreshAudioCoordinates();
-	// ɨData/Media/Music·ֵ֧Ƶļļm_fileVector
+	// ȶȡƻ棬ڻʱٶȡѾƵͲ˳
+	// ֻAudioData.xml֮д룬ЧĻXMLһ£ҪXML
+	// XMLȡʱ޸UIDغϵ꣬Ա֡޸ġ֮һXMLͻ
+	if (_LoadAudioCache())
+	{
+		m_iSavedGeneration = m_iGeneration;
+	}
+	else
+	{
+		_RefreshAudioCoordinates();
+		_LoadPlayingOrder();
+	}
+	// ں̨ɨData/Media/Music·ֵ֧ƵļµƵļUpdatemap
 	_RefreshAudioFiles();
 
-	// ȡѾƵ˳
-	_LoadPlayingOrder();
-
-	// ʼcompute shader
-	_InitComputeNearUID();
+	// ؽƵǺϲk-d
+	m_nearTree.Flush();
 
 	return true;
 }
 
 bool CGMDataManager::Update(double dDeltaTime)
 {
-	if (m_pNearComputeNode->getDirty())
+	// ÿֻ֡һ̨ɨĽļ¿
+	std::vector<SGMScanEvent> eventVector;
+	if (m_audioScanner.PopEvents(eventVector, GM_SCAN_EVENT_MAX))
 	{
-		if (!(GM_Root->containsNode(m_pReadPixelCam.get())))
+		for (auto& itr : eventVector)
 		{
-			GM_Root->addChild(m_pReadPixelCam.get());
+			switch (itr.eType)
+			{
+			case EGMSCAN_ADD:
+				_AddAudioFile(itr.name);
+				break;
+			case EGMSCAN_REMOVE:
+				_RemoveAudioFile(itr.name);
+				break;
+			case EGMSCAN_CHANGE:
+				// ļݱˣɨ·BPMǰԭλ
+				if (0 != m_audioIndex.Find(itr.name)) m_changedVector.push_back(itr.name);
+				break;
+			default:
+				break;
+			}
 		}
-		m_pNearComputeNode->setDirty(false);
-		m_pReadPixelFinishCallback->SetReady(true);
 	}
-	if (m_pReadPixelFinishCallback->GetWritten())
+
+	// ɨȫļѾڵƵٷƵBPM
+	// ĵһɨûһεļ¼ɾرڼ䱻ɾƵֻ
+	if (m_bScanPending && !m_audioScanner.IsScanning())
 	{
-		GM_Root->removeChild(m_pReadPixelCam.get());
+		m_bScanPending = false;
+		_DeleteOverdueAudios();
+		_AnalyzeAudios();
+	}
+
+	// һʱͳһд룬ÿ֡޸Ƶ
+	m_fAnalysisApplyTime += dDeltaTime;
+	if (m_fAnalysisApplyTime >= GM_ANALYSIS_APPLY_INTERVAL)
+	{
+		m_fAnalysisApplyTime = 0.0;
+		std::vector<SGMAudioAnalysis> resultVector;
+		m_audioAnalyzer.PopResults(resultVector, GM_AUDIO_MAX);
+		for (auto& itr : resultVector)
+		{
+			_ApplyAudioAnalysis(itr);
+		}
+	}
+
+	// Ƶֹͣ仯һʱAudioData.xmlͻ棬ɨͷڼ䷴дļ
+	if (m_iGeneration != m_iIdleGeneration)
+	{
+		m_iIdleGeneration = m_iGeneration;
+		m_fIdleTime = 0.0;
+	}
+	else
+	{
+		m_fIdleTime += dDeltaTime;
+	}
+	if (m_iGeneration != m_iSavedGeneration && m_fIdleTime >= GM_AUDIO_SAVE_IDLE && !m_audioScanner.IsScanning())
+	{
+		// дʧʱȴһٳ
+		if (!_SaveAudioData()) m_fIdleTime = 0.0;
 	}
 	return true;
 }
@@ -92,8 +158,22 @@ bool CGMDataManager::Update(double dDeltaTime)
 /** @brief  */
 bool CGMDataManager::Save()
 {
-	//_SaveAudioCoordinates();
-	return SavePlayingOrder();
+	bool bSaved = SavePlayingOrder();
+	// Ƶû޸ʱAudioData.xmlֻ»еĲ˳
+	if (m_iGeneration != m_iSavedGeneration)
+	{
+		bSaved = _SaveAudioData() && bSaved;
+	}
+	else
+	{
+		_SaveAudioCache();
+	}
+	return bSaved;
+}
+
+bool CGMDataManager::RescanAudioFiles()
+{
+	return _RefreshAudioFiles();
 }
 
 bool CGMDataManager::GetAudioDataMap(std::map<unsigned int, SGMAudioData>& dataMap)
@@ -104,47 +184,27 @@ bool CGMDataManager::GetAudioDataMap(std::map<unsigned int, SGMAudioData>& dataM
 
 bool CGMDataManager::FindAudio(const std::wstring & strName)
 {
-	for (auto itr : m_audioDataMap)
-	{
-		if (strName == itr.second.name)
-		{
-			return true;
-		}
-	}
-	return false;
+	return 0 != m_audioIndex.Find(strName);
 }
 
 bool CGMDataManager::FindAudio(double& fX, double& fY, double& fZ, std::wstring& strName)
 {
-	if (m_pNearUIDImage.valid())
+	SGMKdPoint sNear;
+	if (m_nearTree.Nearest(float(fX), float(fY), GM_NEAR_RADIUS, sNear))
 	{
-		unsigned int iWidth = m_pNearUIDImage->s();
-		unsigned int iHeight = m_pNearUIDImage->t();
-		unsigned int s = osg::clampBetween(fX * 0.5 + 0.5, 0.0, 1.0) * iWidth;
-		unsigned int t = osg::clampBetween(fY * 0.5 + 0.5, 0.0, 1.0) * iHeight;
-
-		float fR = m_pNearUIDImage->getColor(s, t).r();
-		float fG = m_pNearUIDImage->getColor(s, t).g();
-		float fB = m_pNearUIDImage->getColor(s, t).b();
-		float fA = m_pNearUIDImage->getColor(s, t).a();
-
-		if (1.0f > fA) // ε̫ԶƵ
+		auto itr = m_audioDataMap.find(sNear.UID);
+		if (itr != m_audioDataMap.end())
 		{
-			int iUID = (fR + (fG + fB * 255) * 255) * 255;
-			auto itr = m_audioDataMap.find(iUID);
-			if (itr != m_audioDataMap.end())
-			{
-				SGMGalaxyCoord sGC = itr->second.galaxyCoord;
-				// ޸fX,fY,fZֵ
-				fX = sGC.x;
-				fY = sGC.y;
-				fZ = sGC.z;
-				m_strCurrentAudio = itr->second.name;
-				// ѯƵƺ󣬸²˳бʷ¼
-				_UpdateAudioList(m_strCurrentAudio);
-				strName = m_strCurrentAudio;
-				return true;
-			}
+			SGMGalaxyCoord sGC = itr->second.galaxyCoord;
+			// ޸fX,fY,fZֵ
+			fX = sGC.x;
+			fY = sGC.y;
+			fZ = sGC.z;
+			m_strCurrentAudio = itr->second.name;
+			// ѯƵƺ󣬸²˳бʷ¼
+			_UpdateAudioList(m_strCurrentAudio);
+			strName = m_strCurrentAudio;
+			return true;
 		}
 	}
 
@@ -165,21 +225,34 @@ std::wstring CGMDataManager::FindAudio(const unsigned int iUID)
 	return L"";
 }
 
-std::wstring CGMDataManager::GetLastAudio()
+std::wstring CGMDataManager::GetNextAudio(const EGMPLAY_ORDER eOrder)
 {
-	// ֻһƵûƵ򷵻ؿַ
-	if (L"" == m_strCurrentAudio || 2 > m_historyList.size())
-	{
-		return L"";
-	}
+	auto itr = m_audioDataMap.find(m_playOrder.Next(eOrder));
+	if (itr == m_audioDataMap.end()) return L"";
+
+	m_strCurrentAudio = itr->second.name;
+	// ˳Ѿʷﲻظ¼
+	_UpdateAudioList(m_strCurrentAudio);
+	return m_strCurrentAudio;
+}
+
+std::wstring CGMDataManager::PeekNextAudio(const EGMPLAY_ORDER eOrder)
+{
+	auto itr = m_audioDataMap.find(m_playOrder.Peek(eOrder));
+	return (itr != m_audioDataMap.end()) ? itr->second.name : L"";
+}
 
-	auto itr = m_historyList.end();
-	itr--; itr--;
-	m_strCurrentAudio = itr->data();
+std::wstring CGMDataManager::GetLastAudio()
+{
+	// ʷûһף򷵻ؿַ
+	if (L"" == m_strCurrentAudio) return L"";
 
 	// һصȥ۲ʷϢδı
-	m_historyList.pop_back();
-	return itr->data();
+	auto itr = m_audioDataMap.find(m_playOrder.Previous());
+	if (itr == m_audioDataMap.end()) return L"";
+
+	m_strCurrentAudio = itr->second.name;
+	return m_strCurrentAudio;
 }
 
 int CGMDataManager::GetCurrentAudioID() const
@@ -189,17 +262,8 @@ int CGMDataManager::GetCurrentAudioID() const
 		return -1;
 	}
 
-	int i = 0;
-	for (auto itr = m_audioDataMap.begin();
-		itr != m_audioDataMap.end();
-		itr++, i++)
-	{
-		if (m_strCurrentAudio == itr->second.name)
-		{
-			return i;
-		}
-	}
-	return 0;
+	int iRank = m_audioIndex.Rank(m_audioIndex.Find(m_strCurrentAudio));
+	return (-1 == iRank) ? 0 : iRank;
 }
 
 osg::Vec4f CGMDataManager::GetAudioColor(const SGMAudioCoord& audioCoord) const
@@ -247,36 +311,25 @@ unsigned int CGMDataManager::GetUID() const
 
 unsigned int CGMDataManager::GetUID(const std::wstring& strName) const
 {
-	for (auto itr : m_audioDataMap)
-	{
-		if (strName == itr.second.name)
-		{
-			return itr.second.UID;
-		}
-	}
-	return 0;
+	return m_audioIndex.Find(strName);
 }
 
 SGMAudioCoord CGMDataManager::GetAudioCoord(const std::wstring& strName) const
 {
-	for (auto itr : m_audioDataMap)
+	auto itr = m_audioDataMap.find(m_audioIndex.Find(strName));
+	if (itr != m_audioDataMap.end())
 	{
-		if (strName == itr.second.name)
-		{
-			return itr.second.audioCoord;
-		}
+		return itr->second.audioCoord;
 	}
 	return SGMAudioCoord();
 }
 
 SGMGalaxyCoord CGMDataManager::GetGalaxyCoord(const std::wstring & strName) const
 {
-	for (auto itr : m_audioDataMap)
+	auto itr = m_audioDataMap.find(m_audioIndex.Find(strName));
+	if (itr != m_audioDataMap.end())
 	{
-		if (strName == itr.second.name)
-		{
-			return itr.second.galaxyCoord;
-		}
+		return itr->second.galaxyCoord;
 	}
 	return SGMGalaxyCoord();
 }
@@ -292,44 +345,26 @@ bool CGMDataManager::EditAudioData(SGMAudioData& sData)
 	{
 		return false;
 	}
+	return _UpdateAudioData(sData);
+}
 
+bool CGMDataManager::_UpdateAudioData(SGMAudioData& sData)
+{
 	// ƵǷغϣκһغϾӦ޸
-	auto iter = m_audioDataMap.begin();
-	while (iter != m_audioDataMap.end())
-	{
-		if ((sData.galaxyCoord == iter->second.galaxyCoord) || (sData.audioCoord == iter->second.audioCoord))
-		{
-			// غ
-			if (sData.galaxyCoord == iter->second.galaxyCoord)
-			{
-				sData.galaxyCoord.z += fmod(sData.galaxyCoord.z + 1.011f, 2.0f) - 1.0f;
-			}
-			if (sData.audioCoord == iter->second.audioCoord)
-			{
-				sData.audioCoord.rank += 1;
-			}
-			// صʼ¼Ƿغ
-			iter = m_audioDataMap.begin();
-		}
-		else
-		{
-			iter++;
-		}
-	}
-
-	bool bExist = false;
-	for (auto& itr : m_audioDataMap)
-	{
-		if (sData.name == itr.second.name)
-		{
-			itr.second = sData;
-			bExist = true;
-			break;
-		}
-	}
+	_ResolveCoordCollision(sData.audioCoord, sData.galaxyCoord);
 
-	if (bExist)
+	auto itr = m_audioDataMap.find(m_audioIndex.Find(sData.name));
+	if (itr != m_audioDataMap.end())
 	{
+		// ļUID޸
+		sData.UID = itr->first;
+		sData.name = itr->second.name;
+		_ReleaseCoord(itr->second);
+		itr->second = sData;
+		_OccupyCoord(sData);
+		m_iGeneration++;
+		// ֻһƵk-dеλ
+		m_nearTree.Insert(sData.UID, sData.galaxyCoord.x, sData.galaxyCoord.y);
 		return true;
 	}
 	else
@@ -392,6 +427,7 @@ void CGMDataManager::_RefreshAudioCoordinates()
 		std::vector<SGMAudioData> tempAudioVector;
 
 		VGMXmlNodeVec vAudioVec = aXML.GetChildren("Audio");
+		m_audioIndex.Reserve(vAudioVec.size());
 		for (auto audioItr : vAudioVec)
 		{
 			const std::wstring wStr = audioItr.GetPropWStr("name");
@@ -420,54 +456,23 @@ void CGMDataManager::_RefreshAudioCoordinates()
 				else
 				{
 					bool bExist = false;
-					for (auto iter : m_audioDataMap)
+					if (0 != m_audioIndex.Find(wStr))
 					{
-						if (fUID == iter.second.UID && wStr == iter.second.name)
-						{
-							// UIDƶͬ˵ƵѴ
-							bExist = true;
-							break;
-						}
-						else if (fUID == iter.second.UID && wStr != iter.second.name)
-						{
-							// UIDͬƲͬ˵UID
-							// ҪʱUID޸Ϊ0ȵƵļȫͳһ޸дUID
-							bExist = true;
-							fUID = 0;
-							SGMAudioData sTempData(fUID, wStr, vAudioCoord, vGalaxyCoord);
-							tempAudioVector.push_back(sTempData);
-						}
-						else if (fUID != iter.second.UID && wStr == iter.second.name)
-						{
-							//  UIDͬͬ˵ļеƵظ
-							bExist = true;
-							break;
-						}
+						// ͬ˵ƵѴڣļеƵظ
+						bExist = true;
+					}
+					else if (m_audioIndex.Contains((unsigned int)fUID))
+					{
+						// UIDͬƲͬ˵UID
+						// ҪʱUID޸Ϊ0ȵƵļȫͳһ޸дUID
+						bExist = true;
+						fUID = 0;
+						SGMAudioData sTempData(fUID, wStr, vAudioCoord, vGalaxyCoord);
+						tempAudioVector.push_back(sTempData);
 					}
 					if (!bExist)
 					{
-						auto iter = m_audioDataMap.begin();
-						while (iter != m_audioDataMap.end())
-						{
-							if ((vGalaxyCoord == iter->second.galaxyCoord) || (vAudioCoord == iter->second.audioCoord))
-							{
-								// غ
-								if (vGalaxyCoord == iter->second.galaxyCoord)
-								{
-									vGalaxyCoord.z += fmod(vGalaxyCoord.z + 1.011f, 2.0f) - 1.0f;
-								}
-								if (vAudioCoord == iter->second.audioCoord)
-								{
-									vAudioCoord.rank += 1;
-								}
-								// صʼ¼Ƿغ
-								iter = m_audioDataMap.begin();
-							}
-							else
-							{
-								iter++;
-							}
-						}
+						_ResolveCoordCollision(vAudioCoord, vGalaxyCoord);
 						SGMAudioData sData(fUID, wStr, vAudioCoord, vGalaxyCoord);
 						_AddAudioData2Map(sData);
 					}
@@ -502,101 +507,133 @@ bool CGMDataManager::_SaveAudioCoordinates() const
 	return aXML.Save();
 }
 
-void CGMDataManager::_RefreshAudioFiles()
+bool CGMDataManager::_SaveAudioData()
+{
+	if (!_SaveAudioCoordinates()) return false;
+	m_iSavedGeneration = m_iGeneration;
+	// ¼XMLʱԱXML֮д
+	_SaveAudioCache();
+	return true;
+}
+
+bool CGMDataManager::_RefreshAudioFiles()
 {
-	//ļ 
-	intptr_t hFile = 0;
-	//ļϢUnicodeʹ_wfinddata_tַֽʹ_finddata_t
-	_wfinddata_t fileinfo;
-	std::wstring strFilePath;
-	std::wstring strFile = m_pConfigData->strMediaPath + m_strAudioPath;
+	if (!m_audioScanner.Start(m_pConfigData->strMediaPath + m_strAudioPath, m_formatVector))
+		return false;
+	m_bScanPending = true;
+	return true;
+}
 
-	double fAngle = 0.01;
-	for (auto formatItr : m_formatVector)
+bool CGMDataManager::_AnalyzeAudios()
+{
+	// ¼ƵBPMͣBPMƵֶ༭ģٷ
+	// ûԽƵÿ·кҪ
+	// ļݱ޸ĹƵǷBPM·ļΪԲоɵĽ
+	std::vector<std::wstring> nameVector;
+	for (auto& itr : m_audioDataMap)
 	{
-		if ((hFile = _wfindfirst(strFilePath.assign(strFile).append(L"/*.").append(formatItr).c_str(), &fileinfo)) != -1)
+		if (itr.second.audioCoord.BPM < m_pConfigData->fMinBPM)
 		{
-			do{
-				if (m_audioDataMap.size() >= 65536) break;
-				std::wstring strFileName = strFilePath.assign(fileinfo.name);
+			nameVector.push_back(itr.second.name);
+		}
+	}
+	for (auto& itr : m_changedVector)
+	{
+		auto dataItr = m_audioDataMap.find(m_audioIndex.Find(itr));
+		if (dataItr != m_audioDataMap.end() && dataItr->second.audioCoord.BPM >= m_pConfigData->fMinBPM)
+		{
+			nameVector.push_back(dataItr->second.name);
+		}
+	}
+	if (!m_audioAnalyzer.Start(m_pConfigData->strMediaPath + m_strAudioPath, nameVector,
+		m_pConfigData->strCorePath + "Users/AudioFeature.cache"))
+		return false;
+	m_changedVector.clear();
+	return true;
+}
 
-				bool bFind = false;
-				for (auto iter : m_audioDataMap)
-				{
-					if (strFileName == iter.second.name)
-					{
-						bFind = true;
-						break;
-					}
-				}
-				if (!bFind)
-				{
-					// ûҵµƵļmapBPM
-					SGMAudioCoord vAudioCoord = SGMAudioCoord(0, fAngle, 1);
-					// ƵǷغϣо޸
-					auto iter = m_audioDataMap.begin();
-					while (iter != m_audioDataMap.end())
-					{
-						if (vAudioCoord == iter->second.audioCoord)
-						{
-							// غ
-							vAudioCoord.angle = fmod(vAudioCoord.angle + 0.01234, osg::PI * 2);
-							// صʼ¼Ƿغ
-							iter = m_audioDataMap.begin();
-						}
-						else
-						{
-							iter++;
-						}
-					}
-					// Ƶռת
-					SGMGalaxyCoord vGalaxyCoord = AudioCoord2GalaxyCoord(vAudioCoord);
+bool CGMDataManager::_ApplyAudioAnalysis(const SGMAudioAnalysis& sResult)
+{
+	if (!sResult.bValid) return false;
 
-					// ںʵλòƵ
-					SGMAudioData sData(m_iFreeUID, strFileName, vAudioCoord, vGalaxyCoord);
-					_AddAudioData2Map(sData);
-				}
-			} while (_wfindnext(hFile, &fileinfo) == 0);
-		}
-		_findclose(hFile);
+	auto itr = m_audioDataMap.find(m_audioIndex.Find(sResult.name));
+	if (itr == m_audioDataMap.end()) return false;
+
+	double fValence = 0.0;
+	double fArousal = 0.0;
+	CGMAudioFeature::Feature2Emotion(sResult.sFeature, fValence, fArousal);
+
+	SGMAudioData sData = itr->second;
+	// ûм⵽ʱBPMֻͣ޸Ƕ
+	if (sResult.sFeature.fBPM > 0.0f) sData.audioCoord.BPM = sResult.sFeature.fBPM;
+	sData.audioCoord.angle = CGMAudioFeature::Emotion2Angle(fValence, fArousal);
+	sData.galaxyCoord = AudioCoord2GalaxyCoord(sData.audioCoord);
+	return _UpdateAudioData(sData);
+}
+
+void CGMDataManager::_AddAudioFile(const std::wstring& strFileName)
+{
+	if (m_audioDataMap.size() >= GM_AUDIO_MAX) return;
+	// ѾڵƵļ޸
+	if (0 != m_audioIndex.Find(strFileName)) return;
+
+	// µƵļmapBPM
+	SGMAudioCoord vAudioCoord = SGMAudioCoord(0, 0.01, 1);
+	// ƵǷغϣо޸
+	while (m_audioCoordSet.end() != m_audioCoordSet.find(vAudioCoord))
+	{
+		vAudioCoord.angle = fmod(vAudioCoord.angle + 0.01234, osg::PI * 2);
 	}
+	// Ƶռת
+	SGMGalaxyCoord vGalaxyCoord = AudioCoord2GalaxyCoord(vAudioCoord);
+
+	// ںʵλòƵ
+	SGMAudioData sData(m_iFreeUID, strFileName, vAudioCoord, vGalaxyCoord);
+	_AddAudioData2Map(sData);
+}
+
+void CGMDataManager::_RemoveAudioFile(const std::wstring& strFileName)
+{
+	auto itr = m_audioDataMap.find(m_audioIndex.Find(strFileName));
+	if (itr == m_audioDataMap.end()) return;
+
+	_EraseAudioData(itr);
+	m_iGeneration++;
+}
+
+void CGMDataManager::_EraseAudioData(std::map<unsigned int, SGMAudioData>::iterator itr)
+{
+	m_audioIndex.Erase(itr->first);
+	m_playOrder.Erase(itr->first);
+	m_nearTree.Erase(itr->first);
+	_ReleaseCoord(itr->second);
+	m_audioDataMap.erase(itr);
 }
 
 void CGMDataManager::_DeleteOverdueAudios()
 {
-	//ļ 
-	intptr_t hFile = 0;
-	//ļϢUnicodeʹ_wfinddata_tַֽʹ_finddata_t
-	_wfinddata_t fileinfo;
-	std::wstring strFilePath;
-	std::wstring strFile = m_pConfigData->strMediaPath + m_strAudioPath;
+	// ǣ̨ɨոռ¼ļеƵļ߳ٴζȡļ
+	// ɨ豻жϻļ޷ȡʱΪƵѹ
+	std::unordered_set<std::wstring> fileSet;
+	if (!m_audioScanner.GetScannedNames(fileSet)) return;
 
-	for (auto itr = m_audioDataMap.begin(); itr != m_audioDataMap.end(); )
+	std::vector<std::map<unsigned int, SGMAudioData>::iterator> overdueVector;
+	for (auto itr = m_audioDataMap.begin(); itr != m_audioDataMap.end(); itr++)
 	{
-		if ((hFile = _wfindfirst(strFilePath.assign(strFile).append(itr->second.name.c_str()).c_str(), &fileinfo)) != -1)
-		{
-			itr++;
-		}
-		else
+		if (fileSet.end() == fileSet.find(CGMAudioIndex::Normalize(itr->second.name)))
 		{
-			for (auto it = m_audioDataMap.begin(); it != m_audioDataMap.end(); )
-			{
-				if (it->second.name == itr->second.name)
-				{
-					it = m_audioDataMap.erase(it);
-					break;
-				}
-				else
-				{
-					it++;
-				}
-			}
-			itr = m_audioDataMap.erase(itr);
+			overdueVector.push_back(itr);
 		}
-		_findclose(hFile);
 	}
+	if (overdueVector.empty()) return;
 
-	m_pAudioNumUniform->set(float(m_audioDataMap.size()));
+	// ͳһɾйڵƵk-dͰ汾ŶֻһΣXMLͻ֮Updateͳһд
+	for (auto& itr : overdueVector)
+	{
+		_EraseAudioData(itr);
+	}
+	m_nearTree.Flush();
+	m_iGeneration++;
 }
 
 void CGMDataManager::_UpdateAudioList(const std::wstring & strName)
@@ -613,22 +650,14 @@ void CGMDataManager::_UpdateAudioList(const std::wstring & strName)
 		m_playingOrder.push_back(strName);
 	}
 
-	// ʷ¼
-	if (m_historyList.empty())
-	{
-		m_historyList.push_back(strName);
-	}
-	else if (strName != m_historyList.back())
-	{
-		m_historyList.push_back(strName);
-	}
+	// ʷ¼һͬʱ
+	m_playOrder.SetCurrent(m_audioIndex.Find(strName));
 }
 
 void CGMDataManager::_LoadPlayingOrder()
 {
 	// вб
 	m_playingOrder.clear();
-	m_historyList.clear();
 
 	CGMXml aXML;
 	if (aXML.Load(m_pConfigData->strCorePath + "Users/AudioPlayingOrder.xml", "Order"))
@@ -639,7 +668,7 @@ void CGMDataManager::_LoadPlayingOrder()
 		{
 			const std::wstring wStr = audioItr.GetPropWStr("name");
 			m_playingOrder.push_back(wStr);
-			m_historyList.push_back(wStr);
+			m_playOrder.SetCurrent(m_audioIndex.Find(wStr));
 
 			i++;
 			if (vAudioVec.size() == i)
@@ -651,182 +680,89 @@ void CGMDataManager::_LoadPlayingOrder()
 	}
 }
 
+bool CGMDataManager::_LoadAudioCache()
+{
+	std::vector<std::string> sourceVector = {
+		m_pConfigData->strCorePath + "Users/AudioData.xml",
+		m_pConfigData->strCorePath + "Users/AudioPlayingOrder.xml" };
+
+	CGMAudioCache aCache;
+	if (!aCache.Open(m_pConfigData->strCorePath + "Users/AudioData.cache", sourceVector, m_pConfigData->fMinBPM))
+		return false;
+
+	// еѾUIDغϣֱӰUID
+	m_audioIndex.Reserve(aCache.GetAudioNum());
+	SGMAudioData sData;
+	for (unsigned int i = 0; i < aCache.GetAudioNum(); i++)
+	{
+		aCache.GetAudioData(i, sData);
+		_AddAudioData2Map(sData);
+	}
+
+	m_playingOrder.clear();
+	for (unsigned int i = 0; i < aCache.GetOrderNum(); i++)
+	{
+		const std::wstring wStr = aCache.GetOrder(i);
+		m_playingOrder.push_back(wStr);
+		m_playOrder.SetCurrent(m_audioIndex.Find(wStr));
+		// ǰŵƵ޸ΪϴβŵһƵ
+		m_strCurrentAudio = wStr;
+	}
+	return true;
+}
+
+bool CGMDataManager::_SaveAudioCache() const
+{
+	std::vector<std::string> sourceVector = {
+		m_pConfigData->strCorePath + "Users/AudioData.xml",
+		m_pConfigData->strCorePath + "Users/AudioPlayingOrder.xml" };
+
+	return CGMAudioCache::Write(m_pConfigData->strCorePath + "Users/AudioData.cache",
+		sourceVector, m_pConfigData->fMinBPM, m_audioDataMap, m_playingOrder);
+}
+
 bool CGMDataManager::_AddAudioData2Map(SGMAudioData & sData)
 {
-	if (m_iFreeUID <= sData.UID)
+	// еƵܱǣBPMͽǶȻᶪʧҲָ򱻸ǵUID
+	if (m_audioDataMap.end() != m_audioDataMap.find(sData.UID)) return false;
+
+	_OccupyCoord(sData);
+	m_iGeneration++;
+	m_audioDataMap[sData.UID] = sData;
+	m_audioIndex.Insert(sData.name, sData.UID);
+	m_playOrder.Insert(sData.UID);
+	m_nearTree.Insert(sData.UID, sData.galaxyCoord.x, sData.galaxyCoord.y);
+
+	// ɾƵ󣬱UIDпնFreeUIDҪռõUID
+	while (m_audioDataMap.end() != m_audioDataMap.find(m_iFreeUID))
 	{
-		m_audioDataMap[sData.UID] = sData;
-		if (m_iFreeUID == sData.UID)
-		{
-			m_iFreeUID++;
-		}
+		m_iFreeUID++;
+	}
+	return true;
+}
 
-		m_pAudioNumUniform->set(float(m_audioDataMap.size()));
-		return true;
+void CGMDataManager::_ResolveCoordCollision(SGMAudioCoord& vAudioCoord, SGMGalaxyCoord& vGalaxyCoord) const
+{
+	while (m_galaxyCoordSet.end() != m_galaxyCoordSet.find(vGalaxyCoord))
+	{
+		vGalaxyCoord.z += fmod(vGalaxyCoord.z + 1.011f, 2.0f) - 1.0f;
 	}
-	else
+	while (m_audioCoordSet.end() != m_audioCoordSet.find(vAudioCoord))
 	{
-		m_audioDataMap.at(sData.UID) = sData;
-		return false;
+		vAudioCoord.rank += 1;
 	}
 }
 
-void CGMDataManager::_InitComputeNearUID()
+void CGMDataManager::_OccupyCoord(const SGMAudioData& sData)
 {
-	int iSize = 1024;
-	m_pNearComputeNode = new CGMDispatchCompute(iSize / 16, iSize / 16, 1);
-	osg::ref_ptr<osg::Geode> pNearCSGeode = new osg::Geode();
-	pNearCSGeode->setCullingActive(false);
-	pNearCSGeode->addDrawable(m_pNearComputeNode.get());
-	GM_Root->addChild(pNearCSGeode.get());
-	osg::ref_ptr<osg::StateSet> pNearSS = m_pNearComputeNode->getOrCreateStateSet();
+	m_audioCoordSet.insert(sData.audioCoord);
+	m_galaxyCoordSet.insert(sData.galaxyCoord);
+}
 
-	const std::string strImgPath = m_pConfigData->strCorePath + "Users/NearUID.tga";
-	if (!m_pNearUIDImage.valid()) m_pNearUIDImage = osgDB::readImageFile(strImgPath);
-	// ͼƬڣͼƬ
-	if (!m_pNearUIDImage.valid())
-	{
-		m_pNearUIDImage = new osg::Image;
-		unsigned int* pNearUIDData = new unsigned int[iSize*iSize];
-		for (int j = 0; j < iSize*iSize; j++)
-		{
-			pNearUIDData[j] = 0;
-		}
-		m_pNearUIDImage->setImage(iSize, iSize, 1, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, (unsigned char*)pNearUIDData, osg::Image::USE_NEW_DELETE);
-
-		// ʼʱִһΣɺԶر
-		m_pNearComputeNode->setDispatch(true);
-	}
-
-	// ʹ compute shader ƵUID洢
-	// LUTͼ,UIDС˳򣬼¼Ƶӿռά
-	float* pDataLUT = new float[LUT_WIDTH];
-	for (int j = 0; j < LUT_WIDTH; j++)
-	{
-		pDataLUT[j] = 0.0f;
-	}
-	int i = 0;
-	for (auto& itr = m_audioDataMap.begin();
-		(itr != m_audioDataMap.end()) && (i+1 < LUT_WIDTH);
-		itr++, i += 2)
-	{
-		pDataLUT[i] = itr->second.galaxyCoord.x;
-		pDataLUT[i+1] = itr->second.galaxyCoord.y;
-	}
-	// Create Galaxy Coord LUT image 
-	m_pGalaxyCoordImage = new osg::Image;
-	m_pGalaxyCoordImage->setImage(LUT_WIDTH, 1, 1, GL_R32F, GL_RED, GL_FLOAT, (unsigned char*)pDataLUT, osg::Image::USE_NEW_DELETE);
-	// Create Galaxy Coord LUT texture 
-	m_pGalaxyCoordTex = new osg::Texture2D;
-	m_pGalaxyCoordTex->setImage(m_pGalaxyCoordImage.get());
-	m_pGalaxyCoordTex->setName("galaxyCoordTex");
-	m_pGalaxyCoordTex->setInternalFormat(GL_R32F);
-	m_pGalaxyCoordTex->setSourceFormat(GL_RED);
-	m_pGalaxyCoordTex->setSourceType(GL_FLOAT);
-	m_pGalaxyCoordTex->setFilter(osg::Texture2D::MIN_FILTER, osg::Texture2D::NEAREST);
-	m_pGalaxyCoordTex->setFilter(osg::Texture2D::MAG_FILTER, osg::Texture2D::NEAREST);
-	m_pGalaxyCoordTex->setWrap(osg::Texture2D::WRAP_S, osg::Texture2D::CLAMP_TO_BORDER);
-	m_pGalaxyCoordTex->setWrap(osg::Texture2D::WRAP_T, osg::Texture2D::CLAMP_TO_BORDER);
-	m_pGalaxyCoordTex->setDataVariance(osg::Object::DYNAMIC);
-	m_pGalaxyCoordTex->setTextureSize(LUT_WIDTH, 1);
-	m_pGalaxyCoordTex->setBorderColor(osg::Vec4(0.0f, 0.0f, 0.0f, 0.0f));
-
-	int iUnit = 0;
-
-	m_pGalaxyCoordTex->bindToImageUnit(iUnit, osg::Texture::READ_ONLY);
-	m_pGalaxyCoordTex->setUnRefImageDataAfterApply(false);
-	pNearSS->setTextureAttribute(iUnit, m_pGalaxyCoordTex.get());
-	pNearSS->addUniform(new osg::Uniform("galaxyCoordImg", iUnit));
-	iUnit++;
-
-	m_pNearUIDTex = new osg::Texture2D();
-	m_pNearUIDTex->setTextureSize(iSize, iSize);
-	m_pNearUIDTex->setFilter(osg::Texture::MIN_FILTER, osg::Texture::NEAREST);
-	m_pNearUIDTex->setFilter(osg::Texture::MAG_FILTER, osg::Texture::NEAREST);
-	m_pNearUIDTex->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_BORDER);
-	m_pNearUIDTex->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_BORDER);
-	m_pNearUIDTex->setBorderColor(osg::Vec4(0, 0, 0, 0));
-	m_pNearUIDTex->setInternalFormat(GL_RGBA8);
-	m_pNearUIDTex->setSourceFormat(GL_RGBA);
-	m_pNearUIDTex->setSourceType(GL_UNSIGNED_BYTE);
-	m_pNearUIDTex->bindToImageUnit(iUnit, osg::Texture::WRITE_ONLY);
-	m_pNearUIDTex->setUnRefImageDataAfterApply(false);
-
-	osg::ref_ptr<osg::Uniform> pTargetUniform = new osg::Uniform("targetImg", iUnit);
-	pNearSS->addUniform(pTargetUniform.get());
-	pNearSS->setTextureAttribute(iUnit, m_pNearUIDTex.get());
-	iUnit++;
-
-	m_pAudioNumUniform->set(float(m_audioDataMap.size()));
-	pNearSS->addUniform(m_pAudioNumUniform.get());
-
-	// galaxy shader ɫ·
-	std::string strGalaxyShaderPath = "Shaders/GalaxyShader/";
-	std::string strCompPath = m_pConfigData->strCorePath + strGalaxyShaderPath + "NearMap.comp";
-	CGMKit::LoadComputeShader(pNearSS.get(), strCompPath, "CloudShadowCS");
-
-	m_pReadPixelCam = new osg::Camera;
-	m_pReadPixelCam->setName("ReadPixelCamera");
-	m_pReadPixelCam->setReferenceFrame(osg::Transform::ABSOLUTE_RF_INHERIT_VIEWPOINT);
-	m_pReadPixelCam->setClearMask(GL_COLOR_BUFFER_BIT);
-	m_pReadPixelCam->setClearColor(osg::Vec4(0.0f, 0.0f, 0.0f, 0.0f));
-	m_pReadPixelCam->setViewport(0, 0, iSize, iSize);
-	m_pReadPixelCam->setRenderOrder(osg::Camera::POST_RENDER);
-	m_pReadPixelCam->setRenderTargetImplementation(osg::Camera::FRAME_BUFFER_OBJECT);
-	m_pReadPixelCam->attach(osg::Camera::COLOR_BUFFER, m_pNearUIDImage.get());
-	m_pReadPixelCam->setAllowEventFocus(false);
-	m_pReadPixelCam->setComputeNearFarMode(osg::CullSettings::DO_NOT_COMPUTE_NEAR_FAR);
-	m_pReadPixelCam->setViewMatrix(osg::Matrix::identity());
-	m_pReadPixelCam->setProjectionMatrixAsOrtho2D(0, iSize, 0, iSize);
-	m_pReadPixelCam->setProjectionResizePolicy(osg::Camera::FIXED);
-
-	m_pReadPixelFinishCallback = new CReadPixelFinishCallback(m_pNearUIDImage.get());
-
-	m_pReadPixelFinishCallback->SetPath(strImgPath);
-	m_pReadPixelCam->setFinalDrawCallback(m_pReadPixelFinishCallback);
-
-	osg::ref_ptr<osg::Geode> pGeode = new osg::Geode();
-	pGeode->addDrawable(_CreateScreenTriangle(iSize, iSize));
-	m_pReadPixelCam->addChild(pGeode.get());
-
-	osg::ref_ptr<osg::StateSet> pStateset = pGeode->getOrCreateStateSet();
-	pStateset->setMode(GL_LIGHTING, osg::StateAttribute::OFF);
-	pStateset->setMode(GL_DEPTH_TEST, osg::StateAttribute::OFF);
-
-	int iReadPixelUnit = 0;
-	CGMKit::AddTexture(pStateset.get(), m_pNearUIDTex.get(), "inputTex", iReadPixelUnit++);
-
-	std::string strVertPath = m_pConfigData->strCorePath + strGalaxyShaderPath + "ReadPixel.vert";
-	std::string strFragPath = m_pConfigData->strCorePath + strGalaxyShaderPath + "ReadPixel.frag";
-	CGMKit::LoadShader(pStateset.get(), strVertPath, strFragPath, "ReadPixel");
-}
-
-osg::Geometry* CGMDataManager::_CreateScreenTriangle(const int width, const int height)
-{
-	osg::Geometry* pGeometry = new osg::Geometry();
-
-	osg::ref_ptr<osg::Vec3Array> verArray = new osg::Vec3Array;
-	verArray->push_back(osg::Vec3(0, 0, 0));
-	verArray->push_back(osg::Vec3(2 * width, 0, 0));
-	verArray->push_back(osg::Vec3(0, 2 * height, 0));
-	pGeometry->setVertexArray(verArray);
-
-	osg::ref_ptr<osg::Vec2Array> textArray = new osg::Vec2Array;
-	textArray->push_back(osg::Vec2(0, 0));
-	textArray->push_back(osg::Vec2(2, 0));
-	textArray->push_back(osg::Vec2(0, 2));
-	pGeometry->setTexCoordArray(0, textArray);
-
-	osg::ref_ptr <osg::Vec3Array> normal = new osg::Vec3Array;
-	normal->push_back(osg::Vec3(0, 1, 0));
-	pGeometry->setNormalArray(normal);
-	pGeometry->setNormalBinding(osg::Geometry::BIND_OVERALL);
-
-	pGeometry->addPrimitiveSet(new osg::DrawArrays(osg::PrimitiveSet::TRIANGLES, 0, 3));
-
-	pGeometry->setUseVertexBufferObjects(true);
-	pGeometry->setUseDisplayList(false);
-	pGeometry->setDataVariance(osg::Object::DYNAMIC);
-
-	return pGeometry;
+void CGMDataManager::_ReleaseCoord(const SGMAudioData& sData)
+{
+	auto audioItr = m_audioCoordSet.find(sData.audioCoord);
+	if (audioItr != m_audioCoordSet.end()) m_audioCoordSet.erase(audioItr);
+	auto galaxyItr = m_galaxyCoordSet.find(sData.galaxyCoord);
+	if (galaxyItr != m_galaxyCoordSet.end()) m_galaxyCoordSet.erase(galaxyItr);
 }
\ No newline at end of file
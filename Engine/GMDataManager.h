@@ -14,8 +14,14 @@
 #include "GMCommon.h"
 #include "GMKernel.h"
 #include "GMDispatchCompute.h"
+#include "GMAudioIndex.h"
+#include "GMAudioKdTree.h"
+#include "GMAudioScanner.h"
+#include "GMAudioAnalyzer.h"
+#include "GMPlayOrder.h"
 
 #include <osg/Texture2D>
+#include <set>
 
 namespace GM
 {
@@ -70,6 +76,47 @@ namespace GM
 		*/
 		bool GetAudioDataMap(std::map<unsigned int, SGMAudioData>& dataMap);
 
+		/**
+		* GetAudioDataMap const
+		* ȡƵmapֻãݣֻҪʱӦʹ
+		* Ƶ޸ĺȻЧݻ仯GetGenerationжǷҪ¶ȡ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return const std::map<unsigned int, SGMAudioData>& Ƶmap
+		*/
+		inline const std::map<unsigned int, SGMAudioData>& GetAudioDataMap() const
+		{
+			return m_audioDataMap;
+		}
+
+		/**
+		* GetGeneration
+		* ȡƵİ汾ţƵÿӡ޸ġɾʹ汾
+		* ߿Ի汾ţ汾ŲҪ¶ȡƵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return unsigned int Ƶ汾
+		*/
+		inline unsigned int GetGeneration() const { return m_iGeneration; }
+
+		/**
+		* RescanAudioFiles
+		* ں̨ɨƵļУֻɾ޸Ĺļᱻ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool ɹtrueһɨ軹ûн򷵻false
+		*/
+		bool RescanAudioFiles();
+
+		/**
+		* IsScanning
+		* ǷɨƵļУ߻ɨδ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool ɨtruefalse
+		*/
+		inline bool IsScanning() const { return m_audioScanner.IsScanning(); }
+
 		/**
 		* FindAudio(std::wstring& strName)
 		* ѯƵļ
@@ -81,7 +128,7 @@ namespace GM
 
 		/**
 		* FindAudio(double& fX, double& fY, double& fZ, std::wstring& strName)
-		* ѯƵļ
+		* ѯƵļƣk-dȷѯƵ
 		* @author LiuTao
 		* @since 2021.06.22
 		* @param fX,fY,fZ:	Ҫѯ[-1,1]ѯ޸ΪƵ
@@ -100,6 +147,27 @@ namespace GM
 		*/
 		std::wstring FindAudio(const unsigned int iUID);
 
+		/**
+		* GetNextAudio(const EGMPLAY_ORDER eOrder)
+		* ˳лһƵ²˳бʷ¼
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param eOrder:	˳˳ѭ
+		* @return wstring ڷƵļƣûƵ򷵻ؿַ L""
+		*/
+		std::wstring GetNextAudio(const EGMPLAY_ORDER eOrder);
+
+		/**
+		* PeekNextAudio(const EGMPLAY_ORDER eOrder)
+		* ѯ˳һƵ޸ĵǰƵʷ¼ԤԼһ
+		* ᱻס֮GetNextAudioͬһ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param eOrder:	˳˳ѭ
+		* @return wstring ڷƵļƣûƵ򷵻ؿַ L""
+		*/
+		std::wstring PeekNextAudio(const EGMPLAY_ORDER eOrder);
+
 		/**
 		* GetLastAudio()
 		* ѯһƵļƣдۣصȥ۲ʷϢδı
@@ -267,19 +335,77 @@ namespace GM
 		*/
 		bool _SaveAudioCoordinates()const;
 
+		/**
+		* _SaveAudioData
+		* AudioData.xmlд뻺棬ǰ汾żΪѱ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool ɹtrueXMLдʧfalse汾Ų䣬֮ٴγ
+		*/
+		bool _SaveAudioData();
+
 		/**
 		* _RefreshAudioFiles
-		* ɨData/Media/Music·ֵ֧Ƶļļm_audioDataMap
+		* ̨ɨData/Media/Music·ֵ֧ƵļɨUpdate
 		* @author LiuTao
 		* @since 2021.06.14
+		* @return bool ɹtrueһɨ軹ûн򷵻false
+		*/
+		bool _RefreshAudioFiles();
+
+		/**
+		* _AddAudioFile
+		* ɨ赽Ƶļm_audioDataMapѾڵƵļ޸
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strFileName	Ƶļƣ·
 		* @return void
 		*/
-		void _RefreshAudioFiles();
+		void _AddAudioFile(const std::wstring& strFileName);
+
+		/**
+		* _RemoveAudioFile
+		* ѾɾƵļm_audioDataMapɾļmap
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strFileName	Ƶļƣ·
+		* @return void
+		*/
+		void _RemoveAudioFile(const std::wstring& strFileName);
+
+		/**
+		* _EraseAudioData
+		* m_audioDataMap˳k-dռüɾһƵ޸İ汾
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param itr			m_audioDataMapҪɾƵ
+		* @return void
+		*/
+		void _EraseAudioData(std::map<unsigned int, SGMAudioData>::iterator itr);
+
+		/**
+		* _AnalyzeAudios
+		* ں̨лûBPMƵBPMUpdateзд
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool ɹtrueһûн򷵻false
+		*/
+		bool _AnalyzeAudios();
+
+		/**
+		* _ApplyAudioAnalysis
+		* õBPMǶдƵݣ¼
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param sResult		Ƶ
+		* @return bool		ɹtrueƵڻ߷ʧfalse
+		*/
+		bool _ApplyAudioAnalysis(const SGMAudioAnalysis& sResult);
 
 		/**
 		* _DeleteOverdueAudios
-		* ɾڵļбָļûиø
-		* úܺʱ
+		* ɾڵļбָļûиøÿɨȫһ
+		* ɨ¼ļбйڵƵͳһɾٶȡļУk-dͰ汾ֻһ
 		* @author LiuTao
 		* @since 2022.04.23
 		* @return void
@@ -306,6 +432,27 @@ namespace GM
 		*/ 
 		void _LoadPlayingOrder();
 
+		/**
+		* _LoadAudioCache
+		* Data/Core/Users/AudioData.cacheȡƵݺͲ˳
+		* AudioData.xmlAudioPlayingOrder.xmlһ޸Ĺ涼Ϊ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param void			
+		* @return bool		ЧȡɹtruefalseҪ˵XML
+		*/
+		bool _LoadAudioCache();
+
+		/**
+		* _SaveAudioCache const
+		* m_audioDataMapͲ˳дData/Core/Users/AudioData.cache
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param void			
+		* @return bool		ɹtrueʧfalse
+		*/
+		bool _SaveAudioCache() const;
+
 		/**
 		* @brief Ϻ,ο glsl е mix(a,b,x)
 		* @author LiuTao
@@ -320,30 +467,46 @@ namespace GM
 		}
 
 		/**
-		* @brief AudioDatamapm_audioDataMapӺ޸Ķʹ
+		* @brief AudioDataӵmapm_audioDataMapӶʹ޸ʹ_UpdateAudioData
 			͸FreeUID֤FreeUIDһֱпõ
 		* @author LiuTao
 		* @since 2022.08.21
 		* @param sData:				AudioData
-		* @return bool:				ӣtrue޸ģfalse
+		* @return bool:				ӳɹtrueUIDѱռκ޸ģfalse
 		*/
 		bool _AddAudioData2Map(SGMAudioData& sData);
 
 		/**
-		* ʼʹcompute shaderĿɲƵ洢ͼƬ
+		* @brief ޸ƵݣǷϷEditAudioData
+			λ֪ƵغϣԶǨƵλã޸sData
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param sData:				ƵݣƲƵ
+		* @return bool:				ɹtrueƵfalse
+		*/
+		bool _UpdateAudioData(SGMAudioData& sData);
+
+		/**
+		* @brief ƵǷƵغϣغϾ޸ĵغϵλ
+			޸ĻӰ죬Ըռüвҵһλüɣ
+			롰ȽϡغϺصʼ¼顱ȫһ£ÿβֻO(logN)
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param vAudioCoord:		Ƶռ꣬غϣ޸rank
+		* @param vGalaxyCoord:		꣬غϣ޸z
+		* @return void
 		*/
-		void _InitComputeNearUID();
+		void _ResolveCoordCollision(SGMAudioCoord& vAudioCoord, SGMGalaxyCoord& vGalaxyCoord) const;
 
 		/**
-		* Ⱦ
-		* @brief ĻС棬ȾЧҪһЩ
+		* @brief ռüеǼǻעһƵ꣬m_audioDataMapһ
 		* @author LiuTao
-		* @since 2020.09.01
-		* @param width: ЧεĿ
-		* @param height: Чεĸ߶
-		* @return osg::Geometry* ؼνڵָ
+		* @since 2026.10.17
+		* @param sData:				Ƶ
+		* @return void
 		*/
-		osg::Geometry* _CreateScreenTriangle(const int width, const int height);
+		void _OccupyCoord(const SGMAudioData& sData);
+		void _ReleaseCoord(const SGMAudioData& sData);
 
 		// 
 	private:
@@ -355,25 +518,20 @@ namespace GM
 		std::vector<std::wstring>					m_formatVector;					//!< ֵ֧ļͣmp3
 		std::vector<std::wstring>					m_playingOrder;					//!< ϵƵ˳򣨲
 		std::map<unsigned int, SGMAudioData>		m_audioDataMap;					//!< AudioData.xmlеmap
-		std::list<std::wstring>						m_historyList;					//!< Ƶʷб
+		CGMAudioIndex								m_audioIndex;					//!< m_audioDataMapmapһ
+		std::multiset<SGMAudioCoord>				m_audioCoordSet;				//!< ռõƵռ꣬ڼغ
+		std::multiset<SGMGalaxyCoord>				m_galaxyCoordSet;				//!< ռõ꣬ڼغ
+		CGMAudioKdTree								m_nearTree;						//!< Ƶk-dڲѯƵ
+		CGMPlayOrder								m_playOrder;					//!< ˳˳ѭźͲʷ
 		unsigned int								m_iFreeUID;						//!< ǰõUIDʱ
-
-		osg::ref_ptr<osg::Uniform>					m_pAudioNumUniform;				//!< ƵUniform
-
-		/** m_pGalaxyCoordImage 洢ƵͼƬ
-		** m_pGalaxyCoordTex 洢Ƶ
-		** ΪR32F		ƵλãرʾһƵ
-		 */
-		osg::ref_ptr<osg::Image>					m_pGalaxyCoordImage;
-		osg::ref_ptr<osg::Texture2D>				m_pGalaxyCoordTex;
-		/** m_pNearUIDImage 洢ƵλϢͼƬ
-		** m_pNearUIDTex Ӧ
-		** RGB8		ƵUID24λϿԱ16777216һǧ򣩸Ƶ
-		** A8		Ϣ */
-		osg::ref_ptr<osg::Image>					m_pNearUIDImage;
-		osg::ref_ptr<osg::Texture2D>				m_pNearUIDTex;
-		osg::ref_ptr<CGMDispatchCompute>			m_pNearComputeNode;				//!< UIDCSڵ
-		osg::ref_ptr<osg::Camera>					m_pReadPixelCam;				//!< ڶȡص
-		CReadPixelFinishCallback*					m_pReadPixelFinishCallback;
+		unsigned int								m_iGeneration;					//!< Ƶ汾ţƵÿ޸Ķ
+		unsigned int								m_iSavedGeneration;				//!< һдAudioData.xmlʱİ汾ţm_iGenerationͬҪ
+		unsigned int								m_iIdleGeneration;				//!< ڼƵֹͣ仯ʱ
+		double										m_fIdleTime;					//!< Ƶֹͣ仯ʱ䣬λs
+		CGMAudioScanner								m_audioScanner;					//!< ̨Ƶļɨ
+		CGMAudioAnalyzer							m_audioAnalyzer;				//!< ̨ƵBPM
+		std::vector<std::wstring>					m_changedVector;				//!< ɨ赽ļݱ޸ĹƵɨ·
+		bool										m_bScanPending;					//!< ɨûȫʼƵ
+		double										m_fAnalysisApplyTime;			//!< һдƵʱ䣬λs
 	};
 }	// GM
\ No newline at end of file
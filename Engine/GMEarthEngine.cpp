@@ -24,6 +24,7 @@
 #include <osg/CullFace>
 #include <osgDB/ReadFile>
 #include <osgDB/WriteFile>
+#include <random>
 
 using namespace GM;
 
@@ -21,6 +21,7 @@
 #include <osg/Texture3D>
 #include <osg/PositionAttitudeTransform>
 #include <osgDB/ReadFile>
+#include <random>
 
 using namespace GM;
 
@@ -101,8 +101,6 @@ bool CGMEngine::Init()
 {
 	if (m_bInit) return true;
 
-	m_iRandom.seed(time(0));
-
 	//!< 配置数据
 	_LoadConfig();
 
@@ -241,6 +239,7 @@ bool CGMEngine::Update()
 		{
 			// 更新涟漪效果
 			m_pCommonUniform->SetAudioLevel(m_pAudio->GetLevel());
+			m_pCommonUniform->SetAudioSpectrum(m_pAudio->GetSpectrum());
 
 			GM_Viewer->advance(deltaTime);
 			GM_Viewer->eventTraversal();
@@ -279,6 +278,12 @@ bool CGMEngine::SaveSolarData()
 	return true;
 }
 
+bool CGMEngine::RescanAudio()
+{
+	if (!m_bInit) return false;
+	return m_pDataManager->RescanAudioFiles();
+}
+
 void CGMEngine::ResizeScreen(const int iW, const int iH)
 {
 	osg::ref_ptr<osg::Camera> pMainCam = GM_View->getCamera();
@@ -435,6 +440,8 @@ float CGMEngine::GetVolume() const
 bool CGMEngine::SetPlayMode(EGMA_MODE eMode)
 {
 	m_ePlayMode = eMode;
+	// 下一首按新的播放模式重新选择
+	m_pAudio->PreloadAudio(L"");
 	return true;
 }
 
@@ -738,8 +745,11 @@ bool CGMEngine::_LoadConfig()
 	m_pConfigData->eRenderQuality = EGMRENDER_QUALITY(sNode.GetPropInt("renderQuality", m_pConfigData->eRenderQuality));
 	m_pConfigData->bPhoto = sNode.GetPropBool("photo", m_pConfigData->bPhoto);
 	m_pConfigData->bWanderingEarth = sNode.GetPropBool("wanderingEarth", m_pConfigData->bWanderingEarth);
+	m_pConfigData->bAsteroidCPU = sNode.GetPropBool("asteroidCPU", m_pConfigData->bAsteroidCPU);
+	m_pConfigData->bAsteroidKepler = sNode.GetPropBool("asteroidKepler", m_pConfigData->bAsteroidKepler);
 	m_pConfigData->fFovy = sNode.GetPropFloat("fovy", m_pConfigData->fFovy);
 	m_pConfigData->fVolume = sNode.GetPropFloat("volume", m_pConfigData->fVolume);
+	m_pConfigData->fCrossfade = sNode.GetPropFloat("crossfade", m_pConfigData->fCrossfade);
 	m_pConfigData->fMinBPM = sNode.GetPropDouble("minBPM", m_pConfigData->fMinBPM);
 
 	return true;
@@ -823,35 +833,23 @@ void CGMEngine::_Next(const EGMA_MODE eMode)
 	}
 	break;
 	case EGMA_MOD_CIRCLE:
-	{
-		m_pAudio->AudioControl(EGMA_CMD_CLOSE);
-
-		int iMaxNum = m_pDataManager->GetAudioNum();
-		unsigned int iNext = (m_pDataManager->GetUID() + 1) % iMaxNum;// wrong to do
-		wstrCurrentFile = m_pDataManager->FindAudio(iNext);
-
-		m_pAudio->SetCurrentAudio(wstrCurrentFile);
-		m_pAudio->AudioControl(EGMA_CMD_OPEN);
-		m_pAudio->AudioControl(EGMA_CMD_PLAY);
-
-		SGMGalaxyCoord vGC = m_pDataManager->GetGalaxyCoord(wstrCurrentFile);
-		double fWorldX, fWorldY;
-		_GalaxyCoord2World(vGC.x, vGC.y, fWorldX, fWorldY);
-		m_pGalaxy->SetCurrentStar(osg::Vec3f(fWorldX, fWorldY, 0.0f), wstrCurrentFile);
-	}
-	break;
 	case EGMA_MOD_RANDOM:
 	{
+		// 列表循环按UID升序，随机播放每一轮每首只播放一次
+		const EGMPLAY_ORDER eOrder = (EGMA_MOD_RANDOM == eMode) ? EGMORDER_SHUFFLE : EGMORDER_SEQUENCE;
+
+		// 优先播放已经预约的下一首
+		wstrCurrentFile = m_pAudio->GetNextAudio();
 		m_pAudio->AudioControl(EGMA_CMD_CLOSE);
 
-		int iMaxNum = m_pDataManager->GetAudioNum();
-		std::uniform_int_distribution<> iPseudoNoise(0, iMaxNum-1);
-		int iNext = iPseudoNoise(m_iRandom);
-		wstrCurrentFile = m_pDataManager->FindAudio(iNext);
-		while (L"" == wstrCurrentFile)
+		if (L"" == wstrCurrentFile)
+		{
+			wstrCurrentFile = m_pDataManager->GetNextAudio(eOrder);
+			if (L"" == wstrCurrentFile) break;
+		}
+		else
 		{
-			iNext = iPseudoNoise(m_iRandom);
-			wstrCurrentFile = m_pDataManager->FindAudio(iNext);
+			m_pDataManager->FindAudio(m_pDataManager->GetUID(wstrCurrentFile));
 		}
 		m_pAudio->SetCurrentAudio(wstrCurrentFile);
 		m_pAudio->AudioControl(EGMA_CMD_OPEN);
@@ -876,18 +874,48 @@ void CGMEngine::_Next(const EGMA_MODE eMode)
 	}
 }
 
+void CGMEngine::_PreloadNext()
+{
+	// 编辑模式下单曲循环，不衔接其他音频
+	if (m_pGalaxy->GetEditMode() || (EGMA_MOD_CIRCLE != m_ePlayMode && EGMA_MOD_RANDOM != m_ePlayMode))
+	{
+		if (L"" != m_pAudio->GetNextAudio()) m_pAudio->PreloadAudio(L"");
+		return;
+	}
+	if (L"" != m_pAudio->GetNextAudio() || L"" == m_pAudio->GetCurrentAudio()) return;
+
+	// 只查询名称，当前音频和历史记录在真正切换时再更新
+	const EGMPLAY_ORDER eOrder = (EGMA_MOD_RANDOM == m_ePlayMode) ? EGMORDER_SHUFFLE : EGMORDER_SEQUENCE;
+	m_pAudio->PreloadAudio(m_pDataManager->PeekNextAudio(eOrder));
+}
+
 void CGMEngine::_InnerUpdate(const float updateStep)
 {
-	if (m_pAudio->IsWelcomeFinished() && m_pAudio->IsAudioOver())
+	if (m_pAudio->IsWelcomeFinished())
 	{
-		if (m_pGalaxy->GetEditMode())
+		const std::wstring wstrCurrentFile = m_pAudio->GetCurrentAudio();
+		if (m_pAudio->IsAudioOver())
 		{
-			_Next(EGMA_MOD_SINGLE);
+			if (m_pGalaxy->GetEditMode())
+			{
+				_Next(EGMA_MOD_SINGLE);
+			}
+			else
+			{
+				_Next(m_ePlayMode);
+			}
 		}
-		else
+		else if (L"" != wstrCurrentFile && wstrCurrentFile != m_pDataManager->GetCurrentAudio())
 		{
-			_Next(m_ePlayMode);
+			// 音频已经衔接到预约的下一首，同步播放列表和当前星辰
+			m_pDataManager->FindAudio(m_pDataManager->GetUID(wstrCurrentFile));
+
+			SGMGalaxyCoord vGC = m_pDataManager->GetGalaxyCoord(wstrCurrentFile);
+			double fWorldX, fWorldY;
+			_GalaxyCoord2World(vGC.x, vGC.y, fWorldX, fWorldY);
+			m_pGalaxy->SetCurrentStar(osg::Vec3f(fWorldX, fWorldY, 0.0f), wstrCurrentFile);
 		}
+		_PreloadNext();
 	}
 
 	if (3 == m_pKernelData->iHierarchy || 2 == m_pKernelData->iHierarchy)
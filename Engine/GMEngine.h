@@ -13,7 +13,6 @@
 #pragma once
 #include "GMCommon.h"
 #include "GMKernel.h"
-#include <random>
 
 /*************************************************************************
 Class
@@ -86,6 +85,11 @@ namespace GM
 		/** @brief ̫ϵ˿̵Ϣ */
 		bool SaveSolarData();
 		/**
+		* @brief ں̨ɨƵļУɾ޸ĹƵ֮Update
+		* @return bool: ɹtrueһɨ軹ûнfalse
+		*/
+		bool RescanAudio();
+		/**
 		* ޸Ļߴʱô˺
 		* @param iW: Ļ
 		* @param iH: Ļ߶
@@ -432,6 +436,10 @@ namespace GM
 		*/
 		void _Next(const EGMA_MODE eMode);
 		/**
+		* @brief ģʽѡһףƵԤԼŵβʱ޷ν
+		*/
+		void _PreloadNext();
+		/**
 		* @brief £һӸ10
 		* @param updateStep μµʱλs
 		*/
@@ -512,7 +520,6 @@ namespace GM
 		CGMPost*							m_pPost;					//!< ģ
 
 		EGMA_MODE							m_ePlayMode;				//!< ǰģʽ
-		std::default_random_engine			m_iRandom;
 
 		osg::ref_ptr<osg::Texture2D>		m_pSceneTex;				//!< ɫͼ
 		osg::ref_ptr<osg::Texture2D>		m_pBackgroundTex;			//!< ɫͼ
@@ -17,6 +17,8 @@
 #include "GMCommonUniform.h"
 #include "GMDataManager.h"
 #include "GMKit.h"
+#include "GMThreadPool.h"
+#include "GMPointCache.h"
 #include <osg/PointSprite>
 #include <osg/LineWidth>
 #include <osg/Texture2D>
@@ -25,6 +27,7 @@
 #include <osg/PositionAttitudeTransform>
 #include <osg/PolygonOffset>
 #include <osgDB/ReadFile>
+#include <sstream>
 
 #include <ppl.h>
 using namespace concurrency;
@@ -39,6 +42,8 @@ Macro Defines
 #define ID_HANDLE_HOVER			(1)				// 把手hover状态下在switch中的索引号
 #define ID_ARROW				(2) 			// 箭头在switch中的索引号
 #define MAX_BPM_RATIO			(25) 			// 最大周期/最小周期
+#define GM_GALAXY_STAR_SEED		(0)				// 星系点采样的随机数种子
+#define GM_GALAXY_STAR_BLOCK	(4096)			// 星系点采样时每个任务的候选点数量
 
 /*************************************************************************
 Class
@@ -54,7 +59,7 @@ CGMGalaxy::CGMGalaxy() :
 	m_fGalaxyRadius(5e20),
 	m_strGalaxyShaderPath("Shaders/GalaxyShader/"), m_strGalaxyTexPath("Textures/Galaxy/"), 
 	m_strCoreModelPath("Models/"), m_strPlayingStarName(L""),
-	m_iPlayingAudioUID(0),m_vPlayingAudioCoord(SGMAudioCoord(0.5, 0.0)),
+	m_iPlayingAudioUID(0), m_iAudioGeneration(0), m_vPlayingAudioCoord(SGMAudioCoord(0.5, 0.0)),
 	m_vPlayingStarWorld4Pos(0.0, 0.0, 0.0), m_vNearStarWorld4Pos(0, 0, 0),
 	m_vMouseWorldPos(0.0, 0.0, 0.0), m_vMouseLastWorldPos(0.0, 0.0, 0.0), m_mLastVP(osg::Matrixf()),
 	m_pMousePosUniform(new osg::Uniform("mouseWorldPos", osg::Vec3f(0.0f, 0.0f, 0.0f))),
@@ -161,29 +166,58 @@ bool CGMGalaxy::Init(SGMKernelData * pKernelData, SGMConfigData * pConfigData,
 	std::uniform_int_distribution<> iPseudoNoise(0, 9999);
 
 	float fMinAlpha = 0.25f;
-	int x = 0;
-	while (x < iMaxNum)
-	{
-		float fU = iPseudoNoise(m_iRandom)*1e-4f;
-		float fV = iPseudoNoise(m_iRandom)*1e-4f;
-		float fW = iPseudoNoise(m_iRandom)*1e-4f;
-		float fAlpha = 1.0f - _Get3DValue(fU*4.0f, fV*4.0f, fW*4.0f);
-		fAlpha *= fAlpha;
-		if (fAlpha > fMinAlpha)
+	// 立方体恒星只取决于三维噪声图、数量和随机数引擎的状态，命中缓存时直接读取
+	_LoadShapeImage();
+	CGMPointCache aCubeCache(m_pConfigData->strCorePath + "Users/", "StarCube");
+	aCubeCache.AddKey(_GetRandomState());
+	aCubeCache.AddKey(m_shapeImg.get());
+	aCubeCache.AddKey(double(iMaxNum));
+	aCubeCache.AddKey(double(fMinAlpha));
+	std::string strRandomState;
+	bool bCached = aCubeCache.Load()
+		&& aCubeCache.PopArray(*m_pCubeVertArray)
+		&& aCubeCache.PopArray(*m_pCubeColorArray)
+		&& aCubeCache.PopArray(*m_pCubeElement)
+		&& aCubeCache.PopString(strRandomState)
+		&& iMaxNum == m_pCubeVertArray->size()
+		&& iMaxNum == m_pCubeColorArray->size()
+		&& _SetRandomState(strRandomState);
+	if (!bCached)
+	{
+		m_pCubeVertArray->clear();
+		m_pCubeColorArray->clear();
+		m_pCubeElement->clear();
+
+		int x = 0;
+		while (x < iMaxNum)
 		{
-			float fRandomX = fU - 0.5f;
-			float fRandomY = fV - 0.5f;
-			float fRandomZ = fW - 0.5f;
-			float fX = fRandomX;
-			float fY = fRandomY;
-			float fZ = fRandomZ;
-			osg::Vec3f vColor = _GetRandomStarColor();
-
-			m_pCubeVertArray->push_back(osg::Vec4(fX, fY, fZ, 1.0f));
-			m_pCubeColorArray->push_back(osg::Vec4(vColor, (fAlpha - fMinAlpha) / (1.0f - fMinAlpha)));
-			m_pCubeElement->push_back(x);
-			x++;
+			float fU = iPseudoNoise(m_iRandom)*1e-4f;
+			float fV = iPseudoNoise(m_iRandom)*1e-4f;
+			float fW = iPseudoNoise(m_iRandom)*1e-4f;
+			float fAlpha = 1.0f - _Get3DValue(fU*4.0f, fV*4.0f, fW*4.0f);
+			fAlpha *= fAlpha;
+			if (fAlpha > fMinAlpha)
+			{
+				float fRandomX = fU - 0.5f;
+				float fRandomY = fV - 0.5f;
+				float fRandomZ = fW - 0.5f;
+				float fX = fRandomX;
+				float fY = fRandomY;
+				float fZ = fRandomZ;
+				osg::Vec3f vColor = _GetRandomStarColor();
+
+				m_pCubeVertArray->push_back(osg::Vec4(fX, fY, fZ, 1.0f));
+				m_pCubeColorArray->push_back(osg::Vec4(vColor, (fAlpha - fMinAlpha) / (1.0f - fMinAlpha)));
+				m_pCubeElement->push_back(x);
+				x++;
+			}
 		}
+
+		aCubeCache.PushArray(*m_pCubeVertArray);
+		aCubeCache.PushArray(*m_pCubeColorArray);
+		aCubeCache.PushArray(*m_pCubeElement);
+		aCubeCache.PushString(_GetRandomState());
+		aCubeCache.Save();
 	}
 
 	// 初始化球面恒星数组
@@ -431,6 +465,14 @@ bool CGMGalaxy::Update(double dDeltaTime)
 		m_vMouseLastWorldPos = m_vMouseWorldPos;
 	}
 
+	// 音频库发生变化（例如后台扫描到新的音频文件），且扫描结果已经全部处理后，更新发生变化的音频星
+	if (!m_bEdit && m_pGeodeAudio.valid()
+		&& m_iAudioGeneration != m_pDataManager->GetGeneration()
+		&& !m_pDataManager->IsScanning())
+	{
+		_RefreshAudioPoints();
+	}
+
 	m_pMilkyWay->Update(dDeltaTime);
 	m_pSolarSystem->Update(dDeltaTime);
 
@@ -1261,18 +1303,12 @@ bool CGMGalaxy::_CreateStarCube()
 	std::string strStarFragPath = m_pConfigData->strCorePath + m_strGalaxyShaderPath + "StarCube_Frag.glsl";
 	CGMKit::LoadShader(pSS.get(), strStarVertPath, strStarFragPath, "StarCube");
 
+	// 直接使用边长为1的m_pCubeVertArray，在vertex shader中缩放到cubeSize
 	float fCubeSize = GM_MIN_STARS_CUBE / m_pKernelData->fUnitArray->at(3);
-	size_t iNum = m_pCubeVertArray->size();
-	osg::ref_ptr<osg::Vec4Array> vertArray = new osg::Vec4Array;
-	vertArray->reserve(iNum);
-	for (size_t i = 0; i < iNum; i++)
-	{
-		osg::Vec4 vert = m_pCubeVertArray->at(i);
-		vertArray->push_back(vert*fCubeSize);
-	}
+	pSS->addUniform(new osg::Uniform("cubeSize", fCubeSize));
 
 	osg::ref_ptr<osg::Geometry> pGeometry = new osg::Geometry();
-	pGeometry->setVertexArray(vertArray.get());
+	pGeometry->setVertexArray(m_pCubeVertArray.get());
 	pGeometry->setColorArray(m_pCubeColorArray.get());
 	pGeometry->setColorBinding(osg::Geometry::BIND_PER_VERTEX);
 
@@ -1344,14 +1380,9 @@ bool CGMGalaxy::_CreateAudioPoints()
 	m_pGeodeAudio = new osg::Geode();
 	m_pHierarchyRootVector.at(4)->addChild(m_pGeodeAudio.get());
 
-	// 音频数据
-	std::map<unsigned int, SGMAudioData> audioDataMap;
-	m_pDataManager->GetAudioDataMap(audioDataMap);
-
 	// 从数据管理模块读取数据，创建未激活状态的音频星几何体
-	osg::ref_ptr<osg::Geometry> pGeomAudio = _CreateAudioGeometry(audioDataMap);
-	if (!pGeomAudio.valid()) return false;
-	m_pGeodeAudio->addDrawable(pGeomAudio.get());
+	// 音频库可能还是空的，后台扫描到音频文件后再由_RefreshAudioPoints添加
+	_RefreshAudioPoints();
 
 	osg::ref_ptr<osg::StateSet> pStateSetAudio = m_pGeodeAudio->getOrCreateStateSet();
 	pStateSetAudio->setTextureAttributeAndModes(0, new osg::PointSprite(), osg::StateAttribute::ON);
@@ -1367,6 +1398,8 @@ bool CGMGalaxy::_CreateAudioPoints()
 	pStateSetAudio->addUniform(m_pMousePosUniform.get());
 	pStateSetAudio->addUniform(m_pCommonUniform->GetStarHiePos());
 	pStateSetAudio->addUniform(m_pCommonUniform->GetLevelArray());
+	pStateSetAudio->addUniform(m_pCommonUniform->GetLevelHead());
+	pStateSetAudio->addUniform(m_pCommonUniform->GetSpectrumArray());
 	pStateSetAudio->addUniform(m_fStarAlphaUniform.get());
 
 	// 添加shader
@@ -1401,48 +1434,130 @@ bool CGMGalaxy::_CreateGalaxyPoints()
 		m_pGalaxyHeightImage = osgDB::readImageFile(strFile);
 	}
 
-	std::uniform_int_distribution<> iPseudoNoise(0, 10000);
+	// 点阵只取决于星系图片、高度图、半径和随机数种子，命中缓存时直接读取
+	CGMPointCache aCache(m_pConfigData->strCorePath + "Users/", "GalaxyPoints");
+	aCache.AddKey(m_pGalaxyImage.get());
+	aCache.AddKey(m_pGalaxyHeightImage.get());
+	aCache.AddKey(fGalaxyRadius4);
+	aCache.AddKey(double(iNum));
+	aCache.AddKey(double(GM_GALAXY_STAR_SEED));
+	bool bCached = aCache.Load()
+		&& aCache.PopArray(*vertArray)
+		&& aCache.PopArray(*texcoordArray)
+		&& aCache.PopArray(*colorArray)
+		&& aCache.PopArray(*el)
+		&& iNum == vertArray->size()
+		&& iNum == texcoordArray->size()
+		&& iNum == colorArray->size()
+		&& iNum == el->size();
+	if (!bCached)
+	{
+		vertArray->clear();
+		texcoordArray->clear();
+		colorArray->clear();
+		el->clear();
+
+		// 图片只解码一次，之后所有线程直接读取浮点数组
+		SGMFloatImage sGalaxyImage, sHeightImage;
+		CGMKit::DecodeImage(m_pGalaxyImage.get(), sGalaxyImage);
+		CGMKit::DecodeImage(m_pGalaxyHeightImage.get(), sHeightImage);
+
+		/**
+		* 拒绝采样：第k个候选点只使用计数器 k*8+0 ~ k*8+5 的随机数，与哪个线程计算无关
+		* 每个任务计算一段连续的候选点，按候选点的顺序合并，取前iNum个被接受的点，
+		* 所以无论线程数是多少，结果都完全相同
+		*/
+		struct SGMStarBlock
+		{
+			std::vector<osg::Vec3> vertVector;
+			std::vector<osg::Vec2> texcoordVector;
+			std::vector<osg::Vec4> colorVector;
+		};
+		auto RandomValue = [](const unsigned long long iCounter)
+		{
+			return int(CGMKit::CounterRandom(GM_GALAXY_STAR_SEED, iCounter) % 10001);
+		};
 
-	int x = 0;
-	while (x < iNum)
-	{
-		float fRandomX = iPseudoNoise(m_iRandom)*1e-4f - 0.5f;
-		float fRandomY = iPseudoNoise(m_iRandom)*1e-4f - 0.5f;
-		float fRandomAlpha = iPseudoNoise(m_iRandom)*1e-4f;
-		float fX = fGalaxyRadius4 * 2.0f * fRandomX;
-		float fY = fGalaxyRadius4 * 2.0f * fRandomY;
-		float fU = fRandomX + 0.5f;
-		float fV = fRandomY + 0.5f;
+		CGMThreadPool aThreadPool;
+		const int iBlockNum = int(aThreadPool.GetThreadNum()) * 2;
+		std::vector<SGMStarBlock> blockVector(iBlockNum);
+		unsigned long long iFirstBlock = 0;
 
-		float fA = CGMKit::GetImageColor(m_pGalaxyImage.get(), fU, fV).a();
-		if (fRandomAlpha < fA)
+		int x = 0;
+		while (x < iNum)
 		{
-			float fRandomR = iPseudoNoise(m_iRandom)*1e-4f - 0.5f;
-			float fR = max(0.0f, CGMKit::GetImageColor(m_pGalaxyImage.get(), fU, fV).r() + fRandomR * fRandomR * fRandomR);
-			float fG = CGMKit::GetImageColor(m_pGalaxyImage.get(), fU, fV).g();
-			float fB = CGMKit::GetImageColor(m_pGalaxyImage.get(), fU, fV).b();
-
-			float fRGBMax = max(max(max(fR, fG), fB), 1e-5);
-			fR /= fRGBMax;
-			fG /= fRGBMax;
-			fB /= fRGBMax;
-
-			float fRandomZ = iPseudoNoise(m_iRandom)*2e-4f - 1.0f;
-			float fSignZ = (fRandomZ > 0) ? 1.0f : -1.0f;
-			float fSmooth = fSignZ * (3 * fRandomZ*fRandomZ - 2 * abs(fRandomZ*fRandomZ*fRandomZ));
-			float fZ = (fRandomAlpha + 0.2f)*0.05f*fGalaxyRadius4*fSmooth;
-			float fRandomRadius = iPseudoNoise(m_iRandom)*1e-4f;
-			fRandomRadius = (fA + CGMKit::GetImageColor(m_pGalaxyHeightImage.get(), fU, fV, true).z())
-				* fRandomRadius * fRandomRadius;
-			float fRadiusNow = osg::Vec2(fRandomX, fRandomY).length();
-			float fTmp = pow(min(1.0f, 1.03f*(1.0f - fRadiusNow)), 11);
-			fZ *= 0.5 + 3 * fTmp*fTmp - 2 * fTmp*fTmp*fTmp;
-			vertArray->push_back(osg::Vec3(fX, fY, fZ));
-			texcoordArray->push_back(osg::Vec2(fU, fV));
-			colorArray->push_back(osg::Vec4(fR, fG, fB, fRandomRadius));
-			el->push_back(x);
-			x++;
+			aThreadPool.ParallelFor(0, iBlockNum, [&](int b)
+			{
+				SGMStarBlock& sBlock = blockVector[b];
+				sBlock.vertVector.clear();
+				sBlock.texcoordVector.clear();
+				sBlock.colorVector.clear();
+
+				const unsigned long long iFirst = (iFirstBlock + b) * GM_GALAXY_STAR_BLOCK;
+				for (unsigned long long k = iFirst; k < iFirst + GM_GALAXY_STAR_BLOCK; k++)
+				{
+					const unsigned long long iCounter = k * 8;
+					float fRandomX = RandomValue(iCounter + 0)*1e-4f - 0.5f;
+					float fRandomY = RandomValue(iCounter + 1)*1e-4f - 0.5f;
+					float fRandomAlpha = RandomValue(iCounter + 2)*1e-4f;
+					float fX = fGalaxyRadius4 * 2.0f * fRandomX;
+					float fY = fGalaxyRadius4 * 2.0f * fRandomY;
+					float fU = fRandomX + 0.5f;
+					float fV = fRandomY + 0.5f;
+
+					osg::Vec4f vGalaxyColor = CGMKit::GetImageColor(sGalaxyImage, fU, fV);
+					float fA = vGalaxyColor.a();
+					if (fRandomAlpha < fA)
+					{
+						float fRandomR = RandomValue(iCounter + 3)*1e-4f - 0.5f;
+						float fR = max(0.0f, vGalaxyColor.r() + fRandomR * fRandomR * fRandomR);
+						float fG = vGalaxyColor.g();
+						float fB = vGalaxyColor.b();
+
+						float fRGBMax = max(max(max(fR, fG), fB), 1e-5);
+						fR /= fRGBMax;
+						fG /= fRGBMax;
+						fB /= fRGBMax;
+
+						float fRandomZ = RandomValue(iCounter + 4)*2e-4f - 1.0f;
+						float fSignZ = (fRandomZ > 0) ? 1.0f : -1.0f;
+						float fSmooth = fSignZ * (3 * fRandomZ*fRandomZ - 2 * abs(fRandomZ*fRandomZ*fRandomZ));
+						float fZ = (fRandomAlpha + 0.2f)*0.05f*fGalaxyRadius4*fSmooth;
+						float fRandomRadius = RandomValue(iCounter + 5)*1e-4f;
+						fRandomRadius = (fA + CGMKit::GetImageColor(sHeightImage, fU, fV, true).z())
+							* fRandomRadius * fRandomRadius;
+						float fRadiusNow = osg::Vec2(fRandomX, fRandomY).length();
+						float fTmp = pow(min(1.0f, 1.03f*(1.0f - fRadiusNow)), 11);
+						fZ *= 0.5 + 3 * fTmp*fTmp - 2 * fTmp*fTmp*fTmp;
+						sBlock.vertVector.push_back(osg::Vec3(fX, fY, fZ));
+						sBlock.texcoordVector.push_back(osg::Vec2(fU, fV));
+						sBlock.colorVector.push_back(osg::Vec4(fR, fG, fB, fRandomRadius));
+					}
+				}
+			}
+			); // end ParallelFor
+
+			// 按候选点的顺序合并
+			for (int b = 0; b < iBlockNum && x < iNum; b++)
+			{
+				const SGMStarBlock& sBlock = blockVector[b];
+				for (size_t i = 0; i < sBlock.vertVector.size() && x < iNum; i++)
+				{
+					vertArray->push_back(sBlock.vertVector[i]);
+					texcoordArray->push_back(sBlock.texcoordVector[i]);
+					colorArray->push_back(sBlock.colorVector[i]);
+					el->push_back(x);
+					x++;
+				}
+			}
+			iFirstBlock += iBlockNum;
 		}
+
+		aCache.PushArray(*vertArray);
+		aCache.PushArray(*texcoordArray);
+		aCache.PushArray(*colorArray);
+		aCache.PushArray(*el);
+		aCache.Save();
 	}
 
 	pGeometry->setVertexArray(vertArray.get());
@@ -1484,6 +1599,7 @@ bool CGMGalaxy::_CreateGalaxyPoints()
 
 	m_pStateSetGalaxy->addUniform(m_pCommonUniform->GetStarHiePos());
 	m_pStateSetGalaxy->addUniform(m_pCommonUniform->GetLevelArray());
+	m_pStateSetGalaxy->addUniform(m_pCommonUniform->GetLevelHead());
 	m_pStateSetGalaxy->addUniform(m_pCommonUniform->GetStarColor());
 	m_pStateSetGalaxy->addUniform(m_fStarAlphaUniform.get());
 
@@ -1529,22 +1645,16 @@ bool CGMGalaxy::_CreateStarCube_4()
 		CGMKit::LoadShader(pSS_4.get(), strStarVertPath, strStarFragPath, "StarCube_4");
 	}
 
-	size_t iNum = m_pCubeVertArray->size();
+	// 4个层级共用边长为1的m_pCubeVertArray，只上传一份顶点数据
+	// 每个层级的边长由各自的cubeSize传入，在vertex shader中缩放，结果与在CPU上缩放后的拷贝相同
 	for (int i = 0; i < 4; i++)
 	{
 		float fCubeSize = fCubeMinSize * std::pow(2, float(i));
 
-		osg::ref_ptr<osg::Vec4Array> vertArray = new osg::Vec4Array;
-		vertArray->reserve(iNum);
-		for (size_t j = 0; j < iNum; j++)
-		{
-			osg::Vec4 vert = m_pCubeVertArray->at(j);
-			vertArray->push_back(vert*fCubeSize);
-		}
-
 		osg::ref_ptr<osg::Geometry> pGeometry = new osg::Geometry();
 		pGeometry->setNodeMask(0);
-		pGeometry->setVertexArray(vertArray.get());
+		pGeometry->setVertexArray(m_pCubeVertArray.get());
+		pGeometry->getOrCreateStateSet()->addUniform(new osg::Uniform("cubeSize", fCubeSize));
 		pGeometry->setColorArray(m_pCubeColorArray.get());
 		pGeometry->setColorBinding(osg::Geometry::BIND_PER_VERTEX);
 
@@ -1600,6 +1710,7 @@ bool CGMGalaxy::_CreateGalaxyPointsN_4(int iDens)
 
 		pSSN->addUniform(m_pCommonUniform->GetStarHiePos());
 		pSSN->addUniform(m_pCommonUniform->GetLevelArray());
+		pSSN->addUniform(m_pCommonUniform->GetLevelHead());
 		pSSN->addUniform(m_pCommonUniform->GetStarColor());
 		pSSN->addUniform(m_pGalaxyRadiusUniform.get());
 		pSSN->addUniform(m_fStarAlphaUniform.get());
@@ -1628,32 +1739,91 @@ bool CGMGalaxy::_CreateGalaxyPointsN_4(int iDens)
 	std::uniform_int_distribution<> iPseudoNoise(0, 10000);
 
 	float fMinAlpha = 0.25f;
-	int x = 0;
-	while (x < iNum)
-	{
-		float fU = iPseudoNoise(m_iRandom)*1e-4f;
-		float fV = iPseudoNoise(m_iRandom)*1e-4f;
-		float fW = iPseudoNoise(m_iRandom)*1e-4f;
-		float fDiameter = fGalaxyRadius4 * 2.0f;
-		float fUScale = fDiameter * vUVW.x() / fDens;
-		float fVScale = fDiameter * vUVW.y() / fDens;
-		float fAlpha = 1.0f - _Get3DValue(fU * fUScale, fV * fVScale, fW);
-		fAlpha *= fAlpha;
-		if (fAlpha > fMinAlpha)
+	float fDiameter = fGalaxyRadius4 * 2.0f;
+	float fUScale = fDiameter * vUVW.x() / fDens;
+	float fVScale = fDiameter * vUVW.y() / fDens;
+
+	// 点阵取决于三维噪声图、各项参数和随机数引擎的状态，命中缓存时直接读取，并恢复随机数引擎的状态
+	_LoadShapeImage();
+	CGMPointCache aCache(m_pConfigData->strCorePath + "Users/", "GalaxyPointsN_4_" + std::to_string(iDens));
+	aCache.AddKey(_GetRandomState());
+	aCache.AddKey(m_shapeImg.get());
+	aCache.AddKey(&vUVW, sizeof(vUVW));
+	aCache.AddKey(double(fDens));
+	aCache.AddKey(fGalaxyRadius4);
+	aCache.AddKey(double(iNum));
+	aCache.AddKey(double(fMinAlpha));
+	std::string strRandomState;
+	bool bCached = aCache.Load()
+		&& aCache.PopArray(*vertArray)
+		&& aCache.PopArray(*texcoordArray)
+		&& aCache.PopArray(*el)
+		&& aCache.PopString(strRandomState)
+		&& iNum == vertArray->size()
+		&& iNum == texcoordArray->size()
+		&& iNum == el->size()
+		&& _SetRandomState(strRandomState);
+	if (!bCached)
+	{
+		vertArray->clear();
+		texcoordArray->clear();
+		el->clear();
+		_LoadShapeSampler();
+
+		// 候选点按批生成、按批采样三维噪声，再按候选顺序筛选
+		// 每批不超过还需要的点数，所以随机数的消耗顺序和数量都与逐个采样时相同
+		std::vector<float> fUVector, fVVector, fWVector;
+		std::vector<float> fSampleX, fSampleY, fNoiseVector;
+		int x = 0;
+		while (x < iNum)
 		{
-			float fRandomX = fU - 0.5f;
-			float fRandomY = fV - 0.5f;
-			float fRandomZ = fW - 0.5f;
-			float fX = fDiameter * fRandomX;
-			float fY = fDiameter * fRandomY;
-			float fZ = fRandomZ / vUVW.z();
-
-			vertArray->push_back(osg::Vec3(fX, fY, fZ));
-			// fU、fV不需要传入，所以在UV的位置上存放缩放系数
-			texcoordArray->push_back(osg::Vec4(fDens, fDens, fW, (fAlpha - fMinAlpha) / (1.0f - fMinAlpha)));
-			el->push_back(x);
-			x++;
+			size_t iBatch = (std::min)(size_t(GM_VOLUME_BATCH), iNum - x);
+			fUVector.resize(iBatch);
+			fVVector.resize(iBatch);
+			fWVector.resize(iBatch);
+			fSampleX.resize(iBatch);
+			fSampleY.resize(iBatch);
+			fNoiseVector.resize(iBatch);
+			for (size_t i = 0; i < iBatch; i++)
+			{
+				fUVector[i] = iPseudoNoise(m_iRandom)*1e-4f;
+				fVVector[i] = iPseudoNoise(m_iRandom)*1e-4f;
+				fWVector[i] = iPseudoNoise(m_iRandom)*1e-4f;
+				fSampleX[i] = fUVector[i] * fUScale;
+				fSampleY[i] = fVVector[i] * fVScale;
+			}
+			m_shapeSampler.Sample(fSampleX.data(), fSampleY.data(), fWVector.data(), fNoiseVector.data(), iBatch);
+
+			for (size_t i = 0; i < iBatch; i++)
+			{
+				float fU = fUVector[i];
+				float fV = fVVector[i];
+				float fW = fWVector[i];
+				float fAlpha = 1.0f - fNoiseVector[i];
+				fAlpha *= fAlpha;
+				if (fAlpha > fMinAlpha)
+				{
+					float fRandomX = fU - 0.5f;
+					float fRandomY = fV - 0.5f;
+					float fRandomZ = fW - 0.5f;
+					float fX = fDiameter * fRandomX;
+					float fY = fDiameter * fRandomY;
+					float fZ = fRandomZ / vUVW.z();
+
+					vertArray->push_back(osg::Vec3(fX, fY, fZ));
+					// fU、fV不需要传入，所以在UV的位置上存放缩放系数
+					texcoordArray->push_back(osg::Vec4(fDens, fDens, fW, (fAlpha - fMinAlpha) / (1.0f - fMinAlpha)));
+					el->push_back(x);
+					x++;
+				}
+			}
 		}
+
+		aCache.PushArray(*vertArray);
+		aCache.PushArray(*texcoordArray);
+		aCache.PushArray(*el);
+		aCache.PushString(_GetRandomState());
+		aCache.Save();
 	}
 
 	pGeometry->setVertexArray(vertArray.get());
@@ -1723,6 +1893,7 @@ bool CGMGalaxy::_CreateGalaxyPlane_4()
 	CGMKit::AddTexture(m_pStateSetPlane.get(), m_pGalaxyColorTex.get(), "galaxyTex", iUnit++);
 
 	m_pStateSetPlane->addUniform(m_pCommonUniform->GetLevelArray());
+	m_pStateSetPlane->addUniform(m_pCommonUniform->GetLevelHead());
 	m_pStateSetPlane->addUniform(m_pMousePosUniform.get());
 
 	// 添加shader
@@ -2300,19 +2471,16 @@ bool CGMGalaxy::_DetachAudioPoints()
 	m_vPlayingAudioCoord = m_pDataManager->GetAudioCoord(m_strPlayingStarName);
 	m_iPlayingAudioUID = m_pDataManager->GetUID(m_strPlayingStarName);
 
-	// 音频数据
-	std::map<unsigned int, SGMAudioData> audioDataMap;
-	m_pDataManager->GetAudioDataMap(audioDataMap);
-
-	osg::Geometry* pGeometry = dynamic_cast<osg::Geometry*>(m_pGeodeAudio->getDrawable(0));
-	if (pGeometry)
+	if (m_iAudioGeneration == m_pDataManager->GetGeneration())
+	{
+		// 音频库没有变化，只需要删除激活的音频星
+		_RemoveAudioPoint(m_iPlayingAudioUID);
+		_FlushAudioPoints();
+	}
+	else
 	{
-		m_pGeodeAudio->removeChild(pGeometry);
+		_RefreshAudioPoints(m_iPlayingAudioUID);
 	}
-	// 从修改过的数据管理模块读取数据，重新创建未激活状态的音频星几何体
-	osg::ref_ptr<osg::Geometry> pGeomAudio = _CreateAudioGeometry(audioDataMap, m_iPlayingAudioUID);
-	if (!pGeomAudio.valid()) return false;
-	m_pGeodeAudio->addDrawable(pGeomAudio.get());
 
 	// 创建激活的音频星
 	if (!m_pStarInfoTransform.valid())
@@ -2380,6 +2548,9 @@ bool CGMGalaxy::_DetachAudioPoints()
 
 bool CGMGalaxy::_AttachAudioPoints()
 {
+	// 编辑期间音频库是否有其他变化
+	const bool bSynced = (m_iAudioGeneration == m_pDataManager->GetGeneration());
+
 	SGMAudioData sData;
 	sData.UID = m_iPlayingAudioUID;
 	sData.name = m_strPlayingStarName;
@@ -2390,18 +2561,22 @@ bool CGMGalaxy::_AttachAudioPoints()
 	// 位置迁移后再回传给本模块的音频坐标
 	m_vPlayingAudioCoord = sData.audioCoord;
 
-	// 音频数据
-	std::map<unsigned int, SGMAudioData> audioDataMap;
-	m_pDataManager->GetAudioDataMap(audioDataMap);
-	osg::Geometry* pGeometry = dynamic_cast<osg::Geometry*>(m_pGeodeAudio->getDrawable(0));
-	if (pGeometry)
+	if (bSynced)
 	{
-		m_pGeodeAudio->removeChild(pGeometry);
+		// 只有编辑的音频发生了变化，只需要写回这一颗音频星
+		const std::map<unsigned int, SGMAudioData>& audioDataMap = m_pDataManager->GetAudioDataMap();
+		auto itr = audioDataMap.find(m_iPlayingAudioUID);
+		if (itr != audioDataMap.end())
+		{
+			_SetAudioPoint(itr->second);
+		}
+		m_iAudioGeneration = m_pDataManager->GetGeneration();
+		_FlushAudioPoints();
+	}
+	else
+	{
+		_RefreshAudioPoints();
 	}
-	// 从修改过的数据管理模块读取数据，重新创建未激活状态的音频星几何体
-	osg::ref_ptr<osg::Geometry> pGeomAudio = _CreateAudioGeometry(audioDataMap);
-	if (!pGeomAudio.valid()) return false;
-	m_pGeodeAudio->addDrawable(pGeomAudio.get());
 
 	// 隐藏激活的音频星
 	if (m_pStarInfoTransform.valid())
@@ -2415,6 +2590,35 @@ bool CGMGalaxy::_AttachAudioPoints()
 	return true;
 }
 
+bool CGMGalaxy::_RefreshAudioPoints(const unsigned int iDiscardUID)
+{
+	// 音频数据
+	const std::map<unsigned int, SGMAudioData>& audioDataMap = m_pDataManager->GetAudioDataMap();
+	m_iAudioGeneration = m_pDataManager->GetGeneration();
+
+	// 写入新增或者变化的音频星，并记录仍然存在的槽位
+	std::vector<char> liveVector(m_audioSlots.GetCapacity() + audioDataMap.size(), 0);
+	for (auto& itr : audioDataMap)
+	{
+		if (iDiscardUID == itr.first) continue;
+
+		_SetAudioPoint(itr.second);
+		liveVector[m_audioSlots.GetSlot(itr.first)] = 1;
+	}
+	// 删除音频库中已经不存在的音频星
+	for (size_t i = 0; i < m_audioSlots.GetCapacity(); i++)
+	{
+		unsigned int iUID = m_audioSlots.GetUID(i);
+		if (0 != iUID && !liveVector[i])
+		{
+			_RemoveAudioPoint(iUID);
+		}
+	}
+
+	_FlushAudioPoints();
+	return true;
+}
+
 bool CGMGalaxy::_UpdatePlayingStarInformation(const SGMAudioCoord& sAudioCoord)
 {
 	if (sAudioCoord.angle < 0.0 ||
@@ -2444,46 +2648,87 @@ bool CGMGalaxy::_UpdatePlayingStarInformation(const SGMAudioCoord& sAudioCoord)
 	return true;
 }
 
-osg::Geometry* CGMGalaxy::_CreateAudioGeometry(
-	std::map<unsigned int, SGMAudioData>& audioMap,
-	const unsigned int iDiscardUID)
+void CGMGalaxy::_SetAudioPoint(const SGMAudioData& sData)
 {
 	// 4级空间下的星系半径
 	double fGalaxyRadius4 = m_fGalaxyRadius / m_pKernelData->fUnitArray->at(4);
+	osg::Vec3f vPos(
+		sData.galaxyCoord.x * fGalaxyRadius4,
+		sData.galaxyCoord.y * fGalaxyRadius4,
+		sData.galaxyCoord.z * (0.001f * fGalaxyRadius4));
+	osg::Vec4f vColor = m_pDataManager->GetAudioColor(sData.audioCoord);
 
-	osg::Geometry* pGeomAudio = new osg::Geometry();
+	int iSlot = m_audioSlots.GetSlot(sData.UID);
+	bool bNew = (-1 == iSlot);
+	if (bNew)
+	{
+		iSlot = m_audioSlots.Acquire(sData.UID);
+		if (-1 == iSlot) return;
+	}
 
-	size_t iNum = audioMap.size();
-	if (0 != iDiscardUID) iNum--;
-	if (0 >= iNum) return nullptr;
+	const size_t iPage = size_t(iSlot) / m_audioSlots.GetPageSize();
+	const size_t iIndex = size_t(iSlot) % m_audioSlots.GetPageSize();
+	while (m_pAudioPageVector.size() <= iPage)
+	{
+		osg::ref_ptr<osg::Geometry> pPageGeom = _CreateAudioPageGeometry();
+		m_pAudioPageVector.push_back(pPageGeom);
+		m_pGeodeAudio->addDrawable(pPageGeom.get());
+	}
 
-	osg::ref_ptr<osg::Vec3Array> vertArray = new osg::Vec3Array;
-	osg::ref_ptr<osg::Vec4Array> colorArray = new osg::Vec4Array();
-	osg::ref_ptr<osg::DrawElementsUShort> el = new osg::DrawElementsUShort(GL_POINTS);
-	vertArray->reserve(iNum);
-	colorArray->reserve(iNum);
-	el->reserve(iNum);
+	osg::Geometry* pGeom = m_pAudioPageVector.at(iPage).get();
+	osg::Vec3Array* pVertArray = static_cast<osg::Vec3Array*>(pGeom->getVertexArray());
+	osg::Vec4Array* pColorArray = static_cast<osg::Vec4Array*>(pGeom->getColorArray());
 
-	int x = 0;
-	for (auto& itr : audioMap)
-	{
-		if (iDiscardUID == itr.first) continue;
+	// 数据未变化时不需要重新上传
+	if (!bNew && vPos == pVertArray->at(iIndex) && vColor == pColorArray->at(iIndex)) return;
 
-		float fX = itr.second.galaxyCoord.x;
-		float fY = itr.second.galaxyCoord.y;
-		float fZ = itr.second.galaxyCoord.z;
+	pVertArray->at(iIndex) = vPos;
+	pColorArray->at(iIndex) = vColor;
+	if (!bNew) m_audioSlots.Touch(sData.UID);
+}
 
-		osg::Vec4f vColor = m_pDataManager->GetAudioColor(itr.first);
+void CGMGalaxy::_RemoveAudioPoint(const unsigned int iUID)
+{
+	m_audioSlots.Release(iUID);
+}
+
+void CGMGalaxy::_FlushAudioPoints()
+{
+	std::vector<SGMSlotRange> rangeVector;
+	m_audioSlots.PopDirtyRanges(rangeVector);
 
-		fX *= fGalaxyRadius4;
-		fY *= fGalaxyRadius4;
-		fZ *= 0.001f * fGalaxyRadius4;
+	const size_t iPageSize = m_audioSlots.GetPageSize();
+	for (auto& itr : rangeVector)
+	{
+		if (itr.iPage >= m_pAudioPageVector.size()) continue;
+
+		// 重新收集这一页中被占用的槽位，空闲的槽位不绘制
+		osg::Geometry* pGeom = m_pAudioPageVector.at(itr.iPage).get();
+		osg::DrawElementsUInt* el = static_cast<osg::DrawElementsUInt*>(pGeom->getPrimitiveSet(0));
+		el->clear();
+		const size_t iFirst = itr.iPage * iPageSize;
+		for (size_t i = 0; i < iPageSize; i++)
+		{
+			if (0 != m_audioSlots.GetUID(iFirst + i)) el->push_back(GLuint(i));
+		}
 
-		vertArray->push_back(osg::Vec3f(fX, fY, fZ));
-		colorArray->push_back(vColor);
-		el->push_back(x);
-		x++;
+		// osg按数组整体上传，所以上传的粒度是一页
+		el->dirty();
+		pGeom->getVertexArray()->dirty();
+		pGeom->getColorArray()->dirty();
+		pGeom->dirtyBound();
 	}
+}
+
+osg::Geometry* CGMGalaxy::_CreateAudioPageGeometry()
+{
+	const size_t iPageSize = m_audioSlots.GetPageSize();
+	osg::Geometry* pGeomAudio = new osg::Geometry();
+
+	osg::ref_ptr<osg::Vec3Array> vertArray = new osg::Vec3Array(iPageSize);
+	osg::ref_ptr<osg::Vec4Array> colorArray = new osg::Vec4Array(iPageSize);
+	osg::ref_ptr<osg::DrawElementsUInt> el = new osg::DrawElementsUInt(GL_POINTS);
+	el->reserve(iPageSize);
 
 	pGeomAudio->setVertexArray(vertArray.get());
 	pGeomAudio->setColorArray(colorArray.get());
@@ -2875,89 +3120,43 @@ osg::Geometry* CGMGalaxy::_MakeBoxGeometry(
 	return geom;
 }
 
-float CGMGalaxy::_Get3DValue(float fX, float fY, float fZ)
+bool CGMGalaxy::_LoadShapeImage()
 {
 	if (!m_shapeImg.valid())
 	{
 		std::string strTexturePath = m_pConfigData->strCorePath + m_strGalaxyTexPath + "noiseShape128.tga";
 		m_shapeImg = osgDB::readImageFile(strTexturePath);
 	}
-	if (m_shapeImg.valid())
-	{
-		unsigned int iWidth = 128;
-		unsigned int iHeight = 128;
-		unsigned int iDepth = 128;
-
-		float fS = std::fmodf(fX, 1.0f) * iWidth;
-		float fT = std::fmodf(fY, 1.0f) * iHeight;
-		float fR = std::fmodf(fZ, 1.0f) * iDepth;
-
-		float fDeltaS = fS - (int)fS;
-		float fDeltaT = fT - (int)fT;
-		float fDeltaR = fR - (int)fR;
-		unsigned int s = (unsigned int)fS;
-		unsigned int t = (unsigned int)fT;
-		unsigned int r = (unsigned int)fR;
-		unsigned int s_next = (s == iWidth - 1) ? 0 : (s + 1);
-		unsigned int t_next = (t == iHeight - 1) ? 0 : (t + 1);
-		unsigned int r_next = (r == iDepth - 1) ? 0 : (r + 1);
-
-		float fValue_000 = _Get3DValue(s, t, r);
-		float fValue_100 = _Get3DValue(s_next, t, r);
-		float fValue_010 = _Get3DValue(s, t_next, r);
-		float fValue_110 = _Get3DValue(s_next, t_next, r);
-		float fValue_001 = _Get3DValue(s, t, r_next);
-		float fValue_101 = _Get3DValue(s_next, t, r_next);
-		float fValue_011 = _Get3DValue(s, t_next, r_next);
-		float fValue_111 = _Get3DValue(s_next, t_next, r_next);
-
-		float fValue =
-			(fValue_000 * (1 - fDeltaS) * (1 - fDeltaT)
-				+ fValue_100 * fDeltaS * (1 - fDeltaT)
-				+ fValue_010 * (1 - fDeltaS) * fDeltaT
-				+ fValue_110 * fDeltaS * fDeltaT) * (1 - fDeltaR)
-			+ (fValue_001 * (1 - fDeltaS) * (1 - fDeltaT)
-				+ fValue_101 * fDeltaS * (1 - fDeltaT)
-				+ fValue_011 * (1 - fDeltaS) * fDeltaT
-				+ fValue_111 * fDeltaS * fDeltaT) * fDeltaR;
-		return fValue;
-	}
-	return 0.0f;
-}
-
-float CGMGalaxy::_Get3DValue(unsigned int iX, unsigned int iY, unsigned int iZ)
-{
-	if (m_shapeImg.valid())
-	{
-		unsigned int iChannel = iZ / 32;
-		unsigned int iSubLayer = iZ % 32;
-		switch (iChannel)
-		{
-		case 0:
-		{
-			return m_shapeImg->getColor(iX, iY + iSubLayer * 128).r();
-		}
-		break;
-		case 1:
-		{
-			return m_shapeImg->getColor(iX, iY + iSubLayer * 128).g();
-		}
-		break;
-		case 2:
-		{
-			return m_shapeImg->getColor(iX, iY + iSubLayer * 128).b();
-		}
-		break;
-		case 3:
-		{
-			return m_shapeImg->getColor(iX, iY + iSubLayer * 128).a();
-		}
-		break;
-		default:
-			break;
-		}
-	}
-	return 0.0f;
+	return m_shapeImg.valid();
+}
+
+bool CGMGalaxy::_LoadShapeSampler()
+{
+	if (m_shapeSampler.IsValid()) return true;
+	// 只解码一次，之后的采样不再经过osg::Image::getColor
+	return _LoadShapeImage() && m_shapeSampler.DecodePacked(m_shapeImg.get(), 128);
+}
+
+float CGMGalaxy::_Get3DValue(float fX, float fY, float fZ)
+{
+	if (!_LoadShapeSampler()) return 0.0f;
+	return m_shapeSampler.Sample(fX, fY, fZ);
+}
+
+std::string CGMGalaxy::_GetRandomState() const
+{
+	std::ostringstream ss;
+	ss << m_iRandom;
+	return ss.str();
+}
+
+bool CGMGalaxy::_SetRandomState(const std::string& strState)
+{
+	std::istringstream ss(strState);
+	std::default_random_engine iRandom;
+	if (!(ss >> iRandom)) return false;
+	m_iRandom = iRandom;
+	return true;
 }
 
 osg::Vec2f CGMGalaxy::_AudioCoord2UV(const SGMAudioCoord & sAudioCoord) const
@@ -13,6 +13,8 @@
 
 #include "GMCommon.h"
 #include "GMKernel.h"
+#include "GMAudioSlots.h"
+#include "GMVolumeSampler.h"
 
 #include <random>
 #include <osg/Node>
@@ -421,6 +423,13 @@ namespace GM
 		*/
 		bool _AttachAudioPoints();
 
+		/**
+		* ƵԱȣֻ·仯δ״̬Ƶ
+		* @param iDiscardUID:		ΪҪ޳ƵUIDĬ0ʾû޳Ƶ
+		* @return bool:				ɹtrueʧfalse
+		*/
+		bool _RefreshAudioPoints(const unsigned int iDiscardUID = 0);
+
 		/**
 		* @brief Ƶռ꣬µǰŵƵϢ
 		* @param sAudioCoord:		Ƶռ
@@ -429,14 +438,30 @@ namespace GM
 		bool _UpdatePlayingStarInformation(const SGMAudioCoord& sAudioCoord);
 
 		/**
-		* ȡݲƵǼ
-		* @param audioMap			Ƶmap
-		* @param iDiscardUID:		ΪҪ޳ƵUIDĬ0ʾû޳Ƶ
-		* @return Geometry*:		ļڵָ룬δɹ򷵻nullptr
+		* дһƵǵĶɫûвλʱλδ仯ʱΪ޸
+		* @param sData			Ƶ
+		* @return void
+		*/
+		void _SetAudioPoint(const SGMAudioData& sData);
+
+		/**
+		* ɾһƵǣͷĲλ
+		* @param iUID				ƵUID
+		* @return void
+		*/
+		void _RemoveAudioPoint(const unsigned int iUID);
+
+		/**
+		* ޸ĵƵҳύȾֻб޸ĵҳϴ
+		* @return void
 		*/
-		osg::Geometry* _CreateAudioGeometry(
-			std::map<unsigned int, SGMAudioData>& audioMap,
-			const unsigned int iDiscardUID = 0);
+		void _FlushAudioPoints();
+
+		/**
+		* һҳƵǼ壬ɫԤȷһҳĴС
+		* @return Geometry*:		ļڵָ
+		*/
+		osg::Geometry* _CreateAudioPageGeometry();
 
 		/**
 		* Բ׶
@@ -500,7 +525,21 @@ namespace GM
 			const float fHeight = 2.0f) const;
 
 		/**
-		* @brief ȡάͼƬĳλõԲֵֵrepeatģʽ
+		* @brief ءnoiseShape128.tgam_shapeImgѾֱӷ
+		* @return bool	ɹtrueͼƬfalse
+		*/
+		bool _LoadShapeImage();
+
+		/**
+		* @brief ءnoiseShape128.tga뵽m_shapeSamplerѾֱӷ
+		* ͼƬΪ128*4096rgbaֱʾ4άֵȱÿһ㣬ٱÿͨ
+		* @return bool	ɹtrueͼƬfalse
+		*/
+		bool _LoadShapeSampler();
+
+		/**
+		* @brief ȡάͼĳλõԲֵֵrepeatģʽ
+		* ֱӵm_shapeSampler.Sample
 		* @param fX:		ͼx,
 		* @param fY:		ͼy,
 		* @param fZ:		ͼz,
@@ -509,14 +548,17 @@ namespace GM
 		float _Get3DValue(float fX, float fY, float fZ);
 
 		/**
-		* @brief ȡάͼƬĳunsigned intλõֵֻܻȡnoiseShape128.tgaάͼ
-		* ͼƬΪ128*4096rgbaֱʾ4άֵȱÿһ㣬ٱÿͨ
-		* @param iX:		ͼx,[0,127]
-		* @param iY:		ͼy,[0,127]
-		* @param iZ:		ͼz,[0,127]
-		* @return float	[0.0,1.0]
+		* @brief ȡm_iRandom״̬ڵ󻺴ļͻָ
+		* @return std::string	л״̬
+		*/
+		std::string _GetRandomState() const;
+
+		/**
+		* @brief ָm_iRandom״̬ʹе󻺴ʱͬ
+		* @param strState:		_GetRandomState()ķֵ
+		* @return bool	ɹtrue״̬Ƿʱ޸m_iRandomfalse
 		*/
-		float _Get3DValue(unsigned int iX, unsigned int iY, unsigned int iZ);
+		bool _SetRandomState(const std::string& strState);
 
 		/**
 		* @brief ƵռתƵUV
@@ -635,6 +677,8 @@ namespace GM
 		** άöάͼƬ4ͨ洢
 		*/
 		osg::ref_ptr<osg::Image>						m_shapeImg;
+		/** m_shapeImgάCPUʱʹ */
+		CGMVolumeSampler								m_shapeSampler;
 		/** ƬͼƬ
 		** RGBͨ		ɫ
 		** Alphaͨ	
@@ -657,6 +701,7 @@ namespace GM
 		osg::ref_ptr<osg::Switch>						m_pHandleSwitch;				//!< ֵĿؽ
 
 		unsigned int									m_iPlayingAudioUID;				//!< ƵǵUID
+		unsigned int									m_iAudioGeneration;				//!< ƵʱƵİ汾
 		SGMAudioCoord									m_vPlayingAudioCoord;			//!< ƵǵƵռ
 		osg::Vec3d										m_vPlayingStarWorld4Pos;		//!< Ƶ4ռ
 		osg::Vec3d										m_vNearStarWorld4Pos;			//!< 4ռλ
@@ -666,6 +711,8 @@ namespace GM
 
 		osg::ref_ptr<osg::Geode>						m_pGeodeRegion;					//!< ƵGeode	
 		osg::ref_ptr<osg::Geode>						m_pGeodeAudio;					//!< δƵGeode
+		CGMAudioSlots									m_audioSlots;					//!< δƵǵĲλ
+		std::vector<osg::ref_ptr<osg::Geometry>>		m_pAudioPageVector;				//!< δƵǼ壬ÿҳһ
 		osg::ref_ptr<osg::Geode>						m_pGeodePointsN_4;				//!< 4㼶NǵGeode
 		osg::ref_ptr<osg::Geode>						m_pGeodeStarCube_4;				//!< 4㼶ǺеGeode
 		osg::ref_ptr<osg::Geode>						m_pGeodeGalaxyGroup_4;			//!< 4㼶ϵȺGeode
@@ -12,9 +12,63 @@
 
 #include "GMKit.h"
 #include <osgDB/ReadFile>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <unordered_map>
+#include <cstring>
+#include <cmath>
 
 using namespace GM;
 
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* ֵİλϣڲظ
+* +0-0Ϊͬosg::Vec4==һ
+*/
+struct SGMColorKey
+{
+	SGMColorKey(const osg::Vec4f& vValue)
+	{
+		for (int i = 0; i < 4; i++)
+		{
+			const float fValue = (0.0f == vValue[i]) ? 0.0f : vValue[i];
+			memcpy(&iBits[i], &fValue, sizeof(float));
+		}
+	}
+
+	bool operator == (const SGMColorKey& sKey) const
+	{
+		return 0 == memcmp(iBits, sKey.iBits, sizeof(iBits));
+	}
+
+	unsigned int iBits[4];
+};
+
+/** @brief SGMColorKeyĹϣ */
+struct SGMColorKeyHash
+{
+	size_t operator()(const SGMColorKey& sKey) const
+	{
+		unsigned long long iHash = 14695981039346656037ULL;
+		for (int i = 0; i < 4; i++)
+		{
+			iHash ^= sKey.iBits[i];
+			iHash *= 1099511628211ULL;
+		}
+		return size_t(iHash ^ (iHash >> 32));
+	}
+};
+
+/*************************************************************************
+CGMKit Methods
+*************************************************************************/
+
 bool CGMKit::LoadShader(
 	osg::StateSet* pStateSet,
 	const std::string& vertFilePath,
@@ -197,6 +251,148 @@ osg::Vec4f CGMKit::GetImageColor(const osg::Image* pImg, const float fX, const f
 	return vValue;
 }
 
+bool CGMKit::DecodeImage(const osg::Image* pImg, SGMFloatImage& sImage)
+{
+	sImage.iWidth = 0;
+	sImage.iHeight = 0;
+	sImage.texelVector.clear();
+	if (!pImg || 0 >= pImg->s() || 0 >= pImg->t()) return false;
+
+	sImage.iWidth = pImg->s();
+	sImage.iHeight = pImg->t();
+	sImage.texelVector.resize(size_t(sImage.iWidth) * sImage.iHeight);
+
+	// 8λRGBA/BGRAֱӶȡ㷽ʽosg::Image::getColorͬ
+	const GLenum ePixelFormat = pImg->getPixelFormat();
+	if (GL_UNSIGNED_BYTE == pImg->getDataType() && !pImg->isCompressed()
+		&& (GL_RGBA == ePixelFormat || GL_BGRA == ePixelFormat))
+	{
+		const float fScale = 1.0f / 255.0f;
+		const bool bBGRA = (GL_BGRA == ePixelFormat);
+		for (unsigned int t = 0; t < sImage.iHeight; t++)
+		{
+			const unsigned char* pData = pImg->data(0, t);
+			osg::Vec4f* pTexel = &sImage.texelVector[size_t(t) * sImage.iWidth];
+			for (unsigned int s = 0; s < sImage.iWidth; s++, pData += 4)
+			{
+				float fR = float(pData[bBGRA ? 2 : 0]) * fScale;
+				float fG = float(pData[1]) * fScale;
+				float fB = float(pData[bBGRA ? 0 : 2]) * fScale;
+				float fA = float(pData[3]) * fScale;
+				pTexel[s] = osg::Vec4f(fR, fG, fB, fA);
+			}
+		}
+		return true;
+	}
+
+	for (unsigned int t = 0; t < sImage.iHeight; t++)
+	{
+		for (unsigned int s = 0; s < sImage.iWidth; s++)
+		{
+			sImage.texelVector[size_t(t) * sImage.iWidth + s] = pImg->getColor(s, t);
+		}
+	}
+	return true;
+}
+
+osg::Vec4f CGMKit::GetImageColor(const SGMFloatImage& sImage, const float fX, const float fY, const bool bLinear)
+{
+	// osg::Image汾ļȫһ£֤ͬ
+	if (fX < 0 || fX > 1 || fY < 0 || fY > 1 || sImage.texelVector.empty())
+	{
+		return osg::Vec4f(0, 0, 0, 0);
+	}
+
+	unsigned int iWidth = sImage.iWidth;
+	unsigned int iHeight = sImage.iHeight;
+
+	float fS = fX * (iWidth - 1) + 0.5f;
+	float fT = fY * (iHeight - 1) + 0.5f;
+
+	float fDeltaS = fS - (int)fS;
+	float fDeltaT = fT - (int)fT;
+	unsigned int s = (unsigned int)fS;
+	unsigned int t = (unsigned int)fT;
+	const osg::Vec4f* pRow = &sImage.texelVector[size_t(t) * iWidth];
+	osg::Vec4f vValue = pRow[s];
+	if (bLinear)
+	{
+		unsigned int s_next = (s == iWidth - 1) ? (iWidth - 1) : (s + 1);
+		const osg::Vec4f* pRowNext = (t == iHeight - 1) ? pRow : (pRow + iWidth);
+
+		osg::Vec4f vValue_01 = pRow[s_next];
+		osg::Vec4f vValue_10 = pRowNext[s];
+		osg::Vec4f vValue_11 = pRowNext[s_next];
+
+		vValue = Mix(Mix(vValue, vValue_01, fDeltaS), Mix(vValue_10, vValue_11, fDeltaS), fDeltaT);
+	}
+	return vValue;
+}
+
+void CGMKit::FindRepeatedColor(const osg::Image* pImg, std::vector<bool>& repeatVector)
+{
+	repeatVector.clear();
+	if (!pImg || 0 >= pImg->s() || 0 >= pImg->t()) return;
+
+	const unsigned int iWidth = pImg->s();
+	const unsigned int iHeight = pImg->t();
+	repeatVector.assign(size_t(iWidth) * iHeight, false);
+
+	/**
+	* кС˳ʱк<=sк<=tضѾкҲһ<=s
+	* ֻҪ¼ÿֵֹСкţСк<=tظ
+	*/
+	std::unordered_map<SGMColorKey, unsigned int, SGMColorKeyHash> minRowMap;
+	minRowMap.reserve(size_t(iWidth) * iHeight);
+	for (unsigned int s = 0; s < iWidth; s++)
+	{
+		for (unsigned int t = 0; t < iHeight; t++)
+		{
+			const osg::Vec4f vValue = pImg->getColor(s, t);
+			if (std::isnan(vValue.x()) || std::isnan(vValue.y())
+				|| std::isnan(vValue.z()) || std::isnan(vValue.w())) continue;
+
+			auto itr = minRowMap.emplace(SGMColorKey(vValue), t);
+			if (!itr.second)
+			{
+				repeatVector[size_t(t) * iWidth + s] = (itr.first->second <= t);
+				itr.first->second = (std::min)(itr.first->second, t);
+			}
+		}
+	}
+}
+
+unsigned long long CGMKit::CounterRandom(const unsigned long long iSeed, const unsigned long long iCounter)
+{
+	// SplitMix64(, )һλϣ֮以
+	unsigned long long z = iSeed * 0xD1B54A32D192ED03ULL + (iCounter + 1) * 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+bool CGMKit::HasAVX2()
+{
+	static const bool bHasAVX2 = []()
+	{
+#ifdef _MSC_VER
+		int iInfo[4] = { 0 };
+		__cpuid(iInfo, 0);
+		if (iInfo[0] < 7) return false;
+		__cpuid(iInfo, 1);
+		// OSXSAVEAVXҲϵͳYMMĴ
+		if ((iInfo[2] & (1 << 27)) == 0 || (iInfo[2] & (1 << 28)) == 0) return false;
+		if ((_xgetbv(0) & 6) != 6) return false;
+		__cpuidex(iInfo, 7, 0);
+		return (iInfo[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}();
+	return bHasAVX2;
+}
+
 float CGMKit::Half_2_Float(const unsigned short x)
 { // IEEE-754 16-bit floating-point format (without infinity): 1-5-10, exp-15, +-131008.0, +-6.1035156E-5, +-5.9604645E-8, 3.311 digits
 	const unsigned int e = (x & 0x7C00) >> 10; // exponent
@@ -16,6 +16,27 @@
 
 namespace GM
 {
+	/*************************************************************************
+	Structs
+	*************************************************************************/
+
+	/**
+	* ΪRGBAͼƬCPU˵Ķ̲߳ʱپosg::Image
+	* @author LiuTao
+	* @since 2026.10.17
+	* @param iWidth:		
+	* @param iHeight:		߶
+	* @param texelVector:	д洢RGBAosg::Image::getColor(s, t)Ľͬ
+	*/
+	struct SGMFloatImage
+	{
+		SGMFloatImage() : iWidth(0), iHeight(0), texelVector() {}
+
+		unsigned int iWidth;
+		unsigned int iHeight;
+		std::vector<osg::Vec4f> texelVector;
+	};
+
 	/*************************************************************************
 	Class
 	*************************************************************************/
@@ -122,6 +143,49 @@ namespace GM
 			const float fX, const float fY,
 			const bool bLinear = false);
 
+		/**
+		* @brief ͼƬΪRGBAֻҪһΣ֮ڶ߳ͬʱ
+		* @param pImg:		ͼƬָ
+		* @param sImage:	ĸͼƬͼƬΪʱ
+		* @return bool	ɹtrueͼƬΪfalse
+		*/
+		static bool DecodeImage(const osg::Image* pImg, SGMFloatImage& sImage);
+
+		/**
+		* @brief ȡͼƬRGBAֵͨȡԭͼƬͬ
+		* @param sImage:	ͼƬ
+		* @param fX:		ͼx,[0,1]
+		* @param fY:		ͼy,[0,1]
+		* @param bLinear:	Ƿ˫Բֵtrue = ˫ԣfalse = ٽֵ
+		* @return Vec4f	RGBAֵͨ,[0.0,1.0]
+		*/
+		static osg::Vec4f GetImageColor(
+			const SGMFloatImage& sImage,
+			const float fX, const float fY,
+			const bool bLinear = false);
+
+		/**
+		* @brief ظأĳк<=sк<=tȫȣosg::Vec4==(s,t)
+		* ϴСǴݣÿֻҪһιϣңNaNκض
+		* @param pImg:				ͼƬָ
+		* @param repeatVector:		д洢±Ϊt *  + sͼƬΪʱ
+		*/
+		static void FindRepeatedColor(const osg::Image* pImg, std::vector<bool>& repeatVector);
+
+		/**
+		* @brief ͬӺͼǵõͬĽ˳߳޹
+		* @param iSeed:					
+		* @param iCounter:				
+		* @return unsigned long long	64λ
+		*/
+		static unsigned long long CounterRandom(const unsigned long long iSeed, const unsigned long long iCounter);
+
+		/**
+		* @brief CPUͲϵͳǷ֧AVX2ֻһ
+		* @return bool				֧truefalse
+		*/
+		static bool HasAVX2();
+
 		/**
 		* @brief 16F ת 32F
 		* @param x:			16F
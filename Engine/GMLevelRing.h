@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMLevelRing.h
+/// @brief		Galaxy-Music Engine - GMLevelRing
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_LEVEL_NUM				(128)		// ʷĳȣ2ݣshaderеlevel鳤һ
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMLevelRing
+	*  @brief ʷλ±㣬OSG
+	*	headÿ֡һֵдhead֮ǰiֵ֡Զɵi+1֡Ҫƶ
+	*	shaderlevel[(levelHead + i) & 127]ȡi֮֡ǰֵ
+	*/
+	class CGMLevelRing
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMLevelRing() : m_iHead(0) {}
+
+		/**
+		* Push
+		* headһ
+		* @author LiuTao
+		* @since 2026.10.18
+		* @return int:			ֵҪдλãҲµhead
+		*/
+		inline int Push()
+		{
+			m_iHead = (m_iHead + GM_LEVEL_NUM - 1) & (GM_LEVEL_NUM - 1);
+			return m_iHead;
+		}
+
+		/** @brief ֵλ */
+		inline int GetHead() const
+		{
+			return m_iHead;
+		}
+
+		/**
+		* Index
+		* shaderе±ͬ
+		* @param iHead:			ֵλ
+		* @param iAge:			ڵ֡[0, GM_LEVEL_NUM)
+		* @return int:			iAge֮֡ǰֵеλ
+		*/
+		inline static int Index(const int iHead, const int iAge)
+		{
+			return (iHead + iAge) & (GM_LEVEL_NUM - 1);
+		}
+
+		// 
+	private:
+		int				m_iHead;			//!< ֵλ
+	};
+}	// GM
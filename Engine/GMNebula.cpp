@@ -679,6 +679,7 @@ bool CGMNebula::_InitOortStateSet(osg::StateSet * pSS, const std::string strShad
 	pSS->setAttributeAndModes(new osg::CullFace(osg::CullFace::BACK));
 
 	pSS->addUniform(m_pCommonUniform->GetLevelArray());
+	pSS->addUniform(m_pCommonUniform->GetLevelHead());
 	pSS->addUniform(m_pCommonUniform->GetTime());
 	pSS->addUniform(m_fPixelLengthUniform.get());
 	pSS->addUniform(m_fOortVisibleUniform.get());
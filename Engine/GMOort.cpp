@@ -475,6 +475,7 @@ bool CGMOort::_InitOortStateSet(osg::StateSet * pSS, const std::string strShader
 	pSS->addUniform(m_vDeltaShakeUniform.get());
 	pSS->addUniform(m_mAttitudeUniform.get());
 	pSS->addUniform(m_pCommonUniform->GetLevelArray());
+	pSS->addUniform(m_pCommonUniform->GetLevelHead());
 	pSS->addUniform(m_pCommonUniform->GetTime());
 	pSS->addUniform(m_pCommonUniform->GetScreenSize());
 	pSS->addUniform(m_pCommonUniform->GetEyeFrontDir());
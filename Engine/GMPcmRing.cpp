@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMPcmRing.cpp
+/// @brief		Galaxy-Music Engine - GMPcmRing
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMPcmRing.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace GM;
+
+/*************************************************************************
+CGMPcmRing Methods
+*************************************************************************/
+
+/** @brief  */
+CGMPcmRing::CGMPcmRing() : m_iMask(0), m_iWritePos(0), m_iReadPos(0)
+{
+}
+
+/** @brief  */
+CGMPcmRing::~CGMPcmRing()
+{
+}
+
+void CGMPcmRing::Init(const size_t iCapacity)
+{
+	size_t iSize = 1;
+	while (iSize < iCapacity) iSize <<= 1;
+	m_buffer.assign(iSize, 0.0f);
+	m_iMask = iSize - 1;
+	Reset();
+}
+
+void CGMPcmRing::Reset()
+{
+	m_iWritePos.store(0, std::memory_order_relaxed);
+	m_iReadPos.store(0, std::memory_order_relaxed);
+}
+
+size_t CGMPcmRing::Write(const float* pData, const size_t iNum)
+{
+	const size_t iWritePos = m_iWritePos.load(std::memory_order_relaxed);
+	const size_t iReadPos = m_iReadPos.load(std::memory_order_acquire);
+	const size_t iCount = std::min(iNum, m_buffer.size() - (iWritePos - iReadPos));
+	if (0 == iCount) return 0;
+
+	// ο
+	const size_t iStart = iWritePos & m_iMask;
+	const size_t iFirst = std::min(iCount, m_buffer.size() - iStart);
+	memcpy(m_buffer.data() + iStart, pData, iFirst * sizeof(float));
+	memcpy(m_buffer.data(), pData + iFirst, (iCount - iFirst) * sizeof(float));
+
+	m_iWritePos.store(iWritePos + iCount, std::memory_order_release);
+	return iCount;
+}
+
+size_t CGMPcmRing::Read(float* pData, const size_t iNum)
+{
+	const size_t iReadPos = m_iReadPos.load(std::memory_order_relaxed);
+	const size_t iWritePos = m_iWritePos.load(std::memory_order_acquire);
+	const size_t iCount = std::min(iNum, iWritePos - iReadPos);
+	if (0 == iCount) return 0;
+
+	const size_t iStart = iReadPos & m_iMask;
+	const size_t iFirst = std::min(iCount, m_buffer.size() - iStart);
+	memcpy(pData, m_buffer.data() + iStart, iFirst * sizeof(float));
+	memcpy(pData + iFirst, m_buffer.data(), (iCount - iFirst) * sizeof(float));
+
+	m_iReadPos.store(iReadPos + iCount, std::memory_order_release);
+	return iCount;
+}
+
+size_t CGMPcmRing::GetReadable() const
+{
+	return m_iWritePos.load(std::memory_order_acquire) - m_iReadPos.load(std::memory_order_acquire);
+}
+
+size_t CGMPcmRing::GetWritable() const
+{
+	return m_buffer.size() - GetReadable();
+}
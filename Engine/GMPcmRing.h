@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMPcmRing.h
+/// @brief		Galaxy-Music Engine - GMPcmRing
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+namespace GM
+{
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMPcmRing
+	*  @brief /ߵPCMλ潻еfloat
+	*	ߣֻ̣߳WriteߣBASṢֻ߳Read߲Ҫ
+	*/
+	class CGMPcmRing
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMPcmRing();
+		/** @brief  */
+		~CGMPcmRing();
+
+		/**
+		* Init
+		* 仺ȡΪ2ݣ̰߳ȫ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iCapacity:		ܱĲ
+		* @return void
+		*/
+		void Init(const size_t iCapacity);
+
+		/**
+		* Reset
+		* ջֻߺ߶ûзʻʱ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Reset();
+
+		/**
+		* Write
+		* дռ䲻ʱֻдһ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pData:			
+		* @param iNum:			
+		* @return size_t:		ʵдĲ
+		*/
+		size_t Write(const float* pData, const size_t iNum);
+
+		/**
+		* Read
+		* ߶ȡݲʱֻȡһ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pData:			Ĳ
+		* @param iNum:			ȡĲ
+		* @return size_t:		ʵʶȡĲ
+		*/
+		size_t Read(float* pData, const size_t iNum);
+
+		/** @brief ɶȡĲ */
+		size_t GetReadable() const;
+		/** @brief дĲ */
+		size_t GetWritable() const;
+		/** @brief  */
+		inline size_t GetCapacity() const { return m_buffer.size(); }
+
+		// 
+	private:
+		std::vector<float>					m_buffer;						//!< С2
+		size_t								m_iMask;						//!<  - 1
+		alignas(64) std::atomic<size_t>		m_iWritePos;					//!< дĲֻ޸
+		alignas(64) std::atomic<size_t>		m_iReadPos;						//!< ѶȡĲֻ޸
+	};
+}	// GM
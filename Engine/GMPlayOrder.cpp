@@ -0,0 +1,426 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMPlayOrder.cpp
+/// @brief		Galaxy-Music Engine - GMPlayOrder
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMPlayOrder.h"
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ߵķλţiWordΪ0 */
+static inline unsigned int _HighestBit(const unsigned long long iWord)
+{
+#ifdef _MSC_VER
+	unsigned long iIndex = 0;
+	_BitScanReverse64(&iIndex, iWord);
+	return (unsigned int)(iIndex);
+#else
+	return 63u - (unsigned int)(__builtin_clzll(iWord));
+#endif
+}
+
+/*************************************************************************
+CGMPlayOrder Methods
+*************************************************************************/
+
+/** @brief  */
+CGMPlayOrder::CGMPlayOrder() : m_iHead(0), m_iRemaining(0), m_iCurrent(0),
+	m_iHistoryHead(0), m_iHistorySize(0), m_iLookaheadSize(0), m_eLookaheadOrder(EGMORDER_SEQUENCE),
+	m_random(std::random_device()())
+{
+}
+
+/** @brief  */
+CGMPlayOrder::~CGMPlayOrder()
+{
+	Clear();
+}
+
+void CGMPlayOrder::Clear()
+{
+	m_liveVector.clear();
+	m_posVector.clear();
+	m_nextVector.clear();
+	m_prevVector.clear();
+	m_bitLevels.clear();
+	m_iHead = 0;
+	m_iRemaining = 0;
+	m_iCurrent = 0;
+	m_iHistoryHead = 0;
+	m_iHistorySize = 0;
+	m_iLookaheadSize = 0;
+}
+
+void CGMPlayOrder::Seed(const unsigned int iSeed)
+{
+	m_random.seed(iSeed);
+}
+
+bool CGMPlayOrder::Insert(const unsigned int iUID)
+{
+	if (0 == iUID || Contains(iUID)) return false;
+
+	if (iUID >= m_posVector.size())
+	{
+		size_t iNewSize = (std::max)(size_t(iUID) + 1, m_posVector.size() * 2);
+		m_posVector.resize(iNewSize, -1);
+		m_nextVector.resize(iNewSize, 0);
+		m_prevVector.resize(iNewSize, 0);
+		_RebuildBits();
+	}
+
+	// ӵĩβٻֻûвŵĲ
+	// ѾʱҪµһȻ
+	m_liveVector.push_back(iUID);
+	m_posVector[iUID] = int(m_liveVector.size() - 1);
+	_SetBit(iUID);
+	if (0 != m_iRemaining)
+	{
+		_Swap(m_iRemaining, m_liveVector.size() - 1);
+		m_iRemaining++;
+	}
+
+	// ѭ
+	if (0 == m_iHead)
+	{
+		m_iHead = iUID;
+		m_nextVector[iUID] = iUID;
+		m_prevVector[iUID] = iUID;
+	}
+	else
+	{
+		unsigned int iTail = m_prevVector[m_iHead];
+		unsigned int iPrev = iTail;
+		if (iUID < m_iHead)
+		{
+			m_iHead = iUID;
+		}
+		else if (iUID < iTail)
+		{
+			// ƵUIDͨģ߲λͼвǰһUID
+			iPrev = _Predecessor(iUID);
+		}
+		unsigned int iNext = m_nextVector[iPrev];
+		m_nextVector[iPrev] = iUID;
+		m_prevVector[iUID] = iPrev;
+		m_nextVector[iUID] = iNext;
+		m_prevVector[iNext] = iUID;
+	}
+
+	// ˳ѭ¼׿˸ı
+	if (EGMORDER_SEQUENCE == m_eLookaheadOrder) m_iLookaheadSize = 0;
+	return true;
+}
+
+bool CGMPlayOrder::Erase(const unsigned int iUID)
+{
+	if (!Contains(iUID)) return false;
+
+	// ȻѲŲֵĿͷٺĩβɾֵĻ
+	size_t iPos = size_t(m_posVector[iUID]);
+	if (iPos < m_iRemaining)
+	{
+		_Swap(iPos, m_iRemaining - 1);
+		iPos = m_iRemaining - 1;
+		m_iRemaining--;
+	}
+	_Swap(iPos, m_liveVector.size() - 1);
+	m_liveVector.pop_back();
+	m_posVector[iUID] = -1;
+	_ClearBit(iUID);
+
+	// ѭɾ
+	unsigned int iPrev = m_prevVector[iUID];
+	unsigned int iNext = m_nextVector[iUID];
+	if (iNext == iUID)
+	{
+		m_iHead = 0;
+		iPrev = 0;
+	}
+	else
+	{
+		m_nextVector[iPrev] = iNext;
+		m_prevVector[iNext] = iPrev;
+		if (m_iHead == iUID) m_iHead = iNext;
+	}
+	m_nextVector[iUID] = 0;
+	m_prevVector[iUID] = 0;
+
+	// ǰƵɾʱǰһΪǰ˳ѭŲĺһ
+	if (m_iCurrent == iUID) m_iCurrent = iPrev;
+
+	// ʷɾ˳
+	size_t iKeep = 0;
+	for (size_t i = 0; i < m_iHistorySize; i++)
+	{
+		unsigned int iValue = m_historyRing[(m_iHistoryHead + i) % GM_PLAYORDER_HISTORY];
+		if (iValue == iUID) continue;
+		if (iKeep > 0 && iValue == m_historyRing[(m_iHistoryHead + iKeep - 1) % GM_PLAYORDER_HISTORY]) continue;
+		m_historyRing[(m_iHistoryHead + iKeep) % GM_PLAYORDER_HISTORY] = iValue;
+		iKeep++;
+	}
+	m_iHistorySize = iKeep;
+
+	// Ԥźõ¼ɾ˳ѭ¼Ҫ¼
+	if (EGMORDER_SEQUENCE == m_eLookaheadOrder)
+	{
+		m_iLookaheadSize = 0;
+	}
+	else
+	{
+		size_t iKeepAhead = 0;
+		for (size_t i = 0; i < m_iLookaheadSize; i++)
+		{
+			if (m_lookahead[i] != iUID) m_lookahead[iKeepAhead++] = m_lookahead[i];
+		}
+		m_iLookaheadSize = iKeepAhead;
+	}
+	return true;
+}
+
+bool CGMPlayOrder::Contains(const unsigned int iUID) const
+{
+	return iUID < m_posVector.size() && -1 != m_posVector[iUID];
+}
+
+void CGMPlayOrder::SetCurrent(const unsigned int iUID)
+{
+	if (!Contains(iUID)) return;
+
+	if (m_iLookaheadSize > 0 && m_lookahead[0] == iUID)
+	{
+		// Ԥźõ˳򲥷ţȡһ
+		for (size_t i = 1; i < m_iLookaheadSize; i++)
+		{
+			m_lookahead[i - 1] = m_lookahead[i];
+		}
+		m_iLookaheadSize--;
+	}
+	else if (iUID != m_iCurrent)
+	{
+		// ѾǵǰƵʱԤźõ¼
+		_ClearLookahead();
+	}
+
+	_MarkPlayed(iUID);
+	m_iCurrent = iUID;
+	_PushHistory(iUID);
+}
+
+unsigned int CGMPlayOrder::Peek(const EGMPLAY_ORDER eOrder, const size_t iIndex)
+{
+	if (m_liveVector.empty() || iIndex >= GM_PLAYORDER_LOOKAHEAD) return 0;
+
+	if (eOrder != m_eLookaheadOrder)
+	{
+		_ClearLookahead();
+		m_eLookaheadOrder = eOrder;
+	}
+
+	while (m_iLookaheadSize <= iIndex)
+	{
+		unsigned int iLast = (m_iLookaheadSize > 0) ? m_lookahead[m_iLookaheadSize - 1] : m_iCurrent;
+		unsigned int iNext = (EGMORDER_SHUFFLE == eOrder) ? _Draw(iLast) : _Successor(iLast);
+		m_lookahead[m_iLookaheadSize++] = iNext;
+	}
+	return m_lookahead[iIndex];
+}
+
+unsigned int CGMPlayOrder::Next(const EGMPLAY_ORDER eOrder)
+{
+	unsigned int iUID = Peek(eOrder);
+	SetCurrent(iUID);
+	return iUID;
+}
+
+unsigned int CGMPlayOrder::Previous()
+{
+	if (m_iHistorySize < 2) return 0;
+
+	m_iHistorySize--;
+	m_iCurrent = m_historyRing[(m_iHistoryHead + m_iHistorySize - 1) % GM_PLAYORDER_HISTORY];
+	_ClearLookahead();
+	_MarkPlayed(m_iCurrent);
+	return m_iCurrent;
+}
+
+void CGMPlayOrder::GetHistory(std::vector<unsigned int>& historyVector) const
+{
+	historyVector.clear();
+	for (size_t i = 0; i < m_iHistorySize; i++)
+	{
+		historyVector.push_back(m_historyRing[(m_iHistoryHead + i) % GM_PLAYORDER_HISTORY]);
+	}
+}
+
+void CGMPlayOrder::_Swap(const size_t i, const size_t j)
+{
+	if (i == j) return;
+	std::swap(m_liveVector[i], m_liveVector[j]);
+	m_posVector[m_liveVector[i]] = int(i);
+	m_posVector[m_liveVector[j]] = int(j);
+}
+
+unsigned int CGMPlayOrder::_Draw(const unsigned int iAvoid)
+{
+	const size_t iNum = m_liveVector.size();
+	if (0 == m_iRemaining)
+	{
+		// ʼµһ֣һֵĵһײһͬ
+		m_iRemaining = iNum;
+		if (iNum > 1 && Contains(iAvoid))
+		{
+			_Swap(size_t(m_posVector[iAvoid]), iNum - 1);
+			size_t iPick = std::uniform_int_distribution<size_t>(0, iNum - 2)(m_random);
+			_Swap(iPick, iNum - 1);
+			m_iRemaining = iNum - 1;
+			return m_liveVector[iNum - 1];
+		}
+	}
+
+	size_t iPick = std::uniform_int_distribution<size_t>(0, m_iRemaining - 1)(m_random);
+	_Swap(iPick, m_iRemaining - 1);
+	m_iRemaining--;
+	return m_liveVector[m_iRemaining];
+}
+
+unsigned int CGMPlayOrder::_Successor(const unsigned int iUID) const
+{
+	return Contains(iUID) ? m_nextVector[iUID] : m_iHead;
+}
+
+void CGMPlayOrder::_MarkPlayed(const unsigned int iUID)
+{
+	size_t iPos = size_t(m_posVector[iUID]);
+	if (iPos < m_iRemaining)
+	{
+		_Swap(iPos, m_iRemaining - 1);
+		m_iRemaining--;
+	}
+}
+
+void CGMPlayOrder::_MarkUnplayed(const unsigned int iUID)
+{
+	size_t iPos = size_t(m_posVector[iUID]);
+	if (iPos >= m_iRemaining)
+	{
+		_Swap(iPos, m_iRemaining);
+		m_iRemaining++;
+	}
+}
+
+void CGMPlayOrder::_ClearLookahead()
+{
+	if (EGMORDER_SHUFFLE == m_eLookaheadOrder)
+	{
+		// ûвŵģŻر֣ӺǰŻرֳȡǰ״̬
+		for (size_t i = m_iLookaheadSize; i > 0; i--)
+		{
+			if (Contains(m_lookahead[i - 1])) _MarkUnplayed(m_lookahead[i - 1]);
+		}
+	}
+	m_iLookaheadSize = 0;
+}
+
+void CGMPlayOrder::_PushHistory(const unsigned int iUID)
+{
+	if (m_iHistorySize > 0 && iUID == m_historyRing[(m_iHistoryHead + m_iHistorySize - 1) % GM_PLAYORDER_HISTORY]) return;
+
+	if (m_iHistorySize < GM_PLAYORDER_HISTORY)
+	{
+		m_historyRing[(m_iHistoryHead + m_iHistorySize) % GM_PLAYORDER_HISTORY] = iUID;
+		m_iHistorySize++;
+	}
+	else
+	{
+		// ɵ
+		m_historyRing[m_iHistoryHead] = iUID;
+		m_iHistoryHead = (m_iHistoryHead + 1) % GM_PLAYORDER_HISTORY;
+	}
+}
+
+void CGMPlayOrder::_RebuildBits()
+{
+	m_bitLevels.clear();
+	size_t iBitNum = m_posVector.size();
+	do
+	{
+		iBitNum = (iBitNum + 63) / 64;
+		m_bitLevels.push_back(std::vector<unsigned long long>(iBitNum, 0));
+	} while (iBitNum > 1);
+
+	for (size_t i = 0; i < m_posVector.size(); i++)
+	{
+		if (-1 != m_posVector[i]) _SetBit((unsigned int)(i));
+	}
+}
+
+void CGMPlayOrder::_SetBit(const unsigned int iUID)
+{
+	size_t iBit = iUID;
+	for (auto& itr : m_bitLevels)
+	{
+		unsigned long long& iWord = itr[iBit / 64];
+		const bool bWasEmpty = (0 == iWord);
+		iWord |= 1ULL << (iBit % 64);
+		// ԭʱһѾǼǹ
+		if (!bWasEmpty) break;
+		iBit /= 64;
+	}
+}
+
+void CGMPlayOrder::_ClearBit(const unsigned int iUID)
+{
+	size_t iBit = iUID;
+	for (auto& itr : m_bitLevels)
+	{
+		unsigned long long& iWord = itr[iBit / 64];
+		iWord &= ~(1ULL << (iBit % 64));
+		// Ȼʱһ㲻Ҫ޸
+		if (0 != iWord) break;
+		iBit /= 64;
+	}
+}
+
+unsigned int CGMPlayOrder::_Predecessor(const unsigned int iUID) const
+{
+	// ӵ0ϣҵһiUIDзλ
+	size_t iBit = iUID;
+	size_t iLevel = 0;
+	for (; iLevel < m_bitLevels.size(); iLevel++)
+	{
+		const size_t iWord = iBit / 64;
+		const unsigned long long iMask = m_bitLevels[iLevel][iWord] & ((1ULL << (iBit % 64)) - 1);
+		if (0 != iMask)
+		{
+			iBit = iWord * 64 + _HighestBit(iMask);
+			break;
+		}
+		if (0 == iWord) return 0;
+		iBit = iWord;
+	}
+	if (iLevel == m_bitLevels.size()) return 0;
+
+	// £ÿȡߵķλ
+	while (iLevel > 0)
+	{
+		iLevel--;
+		iBit = iBit * 64 + _HighestBit(m_bitLevels[iLevel][iBit]);
+	}
+	return (unsigned int)(iBit);
+}
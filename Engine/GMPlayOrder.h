@@ -0,0 +1,206 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMPlayOrder.h
+/// @brief		Galaxy-Music Engine - GMPlayOrder
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <random>
+#include <cstddef>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_PLAYORDER_HISTORY		(100)			// ʷ󳤶
+	#define GM_PLAYORDER_LOOKAHEAD		(4)				// Ԥźõ¼׵
+
+	/*************************************************************************
+	Enums
+	*************************************************************************/
+
+	// ˳
+	enum EGMPLAY_ORDER
+	{
+		EGMORDER_SEQUENCE,			// UIDѭ
+		EGMORDER_SHUFFLE			// ÿһÿֻһ
+	};
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMPlayOrder
+	*  @brief ƵĲ˳˳ѭšʷԤźõ¼
+	*	ǶԵFisher-YatesϴƣUIDǰǱֻûвŵģ
+	*	ÿһǰһΣǰΪʱʼµһ֣ÿһO(1)
+	*	˳ѭʹðUIDѭ˫O(1)
+	*	ʱ÷ֲλͼÿ64·ǰһUIDΪlog64(UID)655363
+	*	ɾƵʷԤźõ¼вѾɾUIDƵ뱾
+	*/
+	class CGMPlayOrder
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMPlayOrder();
+		/** @brief  */
+		~CGMPlayOrder();
+
+		/**
+		* Clear
+		* ƵʷԤźõ¼
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Clear();
+
+		/**
+		* Seed
+		* ӣͬӺͲеõͬ˳
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iSeed:		
+		* @return void
+		*/
+		void Seed(const unsigned int iSeed);
+
+		/**
+		* Insert
+		* һƵƵ뱾
+		* UIDڻСUIDʱO(1)ǰһUIDҪO(log64(UID))
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:		ƵUID0ΪǷ
+		* @return bool:		ɹtrueUIDǷѴfalse
+		*/
+		bool Insert(const unsigned int iUID);
+
+		/**
+		* Erase
+		* ɾһƵͬʱʷԤźõ¼ɾ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:		ƵUID
+		* @return bool:		ڲɾtruefalse
+		*/
+		bool Erase(const unsigned int iUID);
+
+		/** @brief ƵǷ */
+		bool Contains(const unsigned int iUID) const;
+
+		/** @brief Ƶ */
+		inline size_t GetSize() const
+		{
+			return m_liveVector.size();
+		}
+
+		/**
+		* SetCurrent
+		* õǰƵʼţʷڱбΪѲ
+		* ԤźõĵһʱȡԤźõ¼ϣѾǵǰƵʱ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iUID:		ƵUIDʱ
+		* @return void
+		*/
+		void SetCurrent(const unsigned int iUID);
+
+		/** @brief ǰƵUIDûʱΪ0 */
+		inline unsigned int GetCurrent() const
+		{
+			return m_iCurrent;
+		}
+
+		/**
+		* Peek
+		* ѯǰƵ֮ĵiIndex + 1ףı䵱ǰƵᱻס֮Nextͬ˳򷵻
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param eOrder:			˳֮ǰĲͬʱԤźõ¼
+		* @param iIndex:			0ʼСGM_PLAYORDER_LOOKAHEAD
+		* @return unsigned int:		ƵUIDûƵʱΪ0
+		*/
+		unsigned int Peek(const EGMPLAY_ORDER eOrder, const size_t iIndex = 0);
+
+		/**
+		* Next
+		* лһףȼSetCurrent(Peek(eOrder))
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param eOrder:			˳
+		* @return unsigned int:		ƵUIDûƵʱΪ0
+		*/
+		unsigned int Next(const EGMPLAY_ORDER eOrder);
+
+		/**
+		* Previous
+		* صʷеһףǰƵʷɾԤźõ¼
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return unsigned int:		һ׵UIDʷûһʱΪ0Ҳκ޸
+		*/
+		unsigned int Previous();
+
+		/**
+		* GetHistory
+		* ȡʷӾɵ£һǵǰƵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param historyVector:		UID
+		* @return void
+		*/
+		void GetHistory(std::vector<unsigned int>& historyVector) const;
+
+	private:
+		/** @brief m_liveVectorеλãλ */
+		void _Swap(const size_t i, const size_t j);
+		/** @brief ȡֻûвŵһףֽʱʼµһ֣һֵĵһײiAvoid */
+		unsigned int _Draw(const unsigned int iAvoid);
+		/** @brief ˳ѭiUIDһףiUIDʱUIDС */
+		unsigned int _Successor(const unsigned int iUID) const;
+		/** @brief ڱбΪѲ */
+		void _MarkPlayed(const unsigned int iUID);
+		/** @brief ڱбΪδ */
+		void _MarkUnplayed(const unsigned int iUID);
+		/** @brief Ԥźõ¼ϣķŻر */
+		void _ClearLookahead();
+		/** @brief ʷһͬʱԣʱɵ */
+		void _PushHistory(const unsigned int iUID);
+		/** @brief m_posVectorĴСؽֲλͼ */
+		void _RebuildBits();
+		/** @brief ڷֲλͼеǼǻעһUID */
+		void _SetBit(const unsigned int iUID);
+		void _ClearBit(const unsigned int iUID);
+		/** @brief СiUIDUIDʱ0 */
+		unsigned int _Predecessor(const unsigned int iUID) const;
+
+		// 
+	private:
+		std::vector<unsigned int>			m_liveVector;					//!< UID[0, m_iRemaining)Ǳֻûвŵ
+		std::vector<int>					m_posVector;					//!< UID -> m_liveVectorеλã-1ʾ
+		std::vector<unsigned int>			m_nextVector;					//!< UID -> ѭеһUID
+		std::vector<unsigned int>			m_prevVector;					//!< UID -> ѭеһUID
+		std::vector<std::vector<unsigned long long>>	m_bitLevels;		//!< UIDķֲλͼ0ÿλһUIDһÿλӦһһ
+		unsigned int						m_iHead;						//!< СUIDûƵʱΪ0
+		size_t								m_iRemaining;					//!< ֻûвŵ
+		unsigned int						m_iCurrent;						//!< ǰƵUID
+		unsigned int						m_historyRing[GM_PLAYORDER_HISTORY];		//!< ʷ
+		size_t								m_iHistoryHead;					//!< ɵʷڻеλ
+		size_t								m_iHistorySize;					//!< ʷ
+		unsigned int						m_lookahead[GM_PLAYORDER_LOOKAHEAD];		//!< Ԥźõ¼
+		size_t								m_iLookaheadSize;				//!< Ԥźõ
+		EGMPLAY_ORDER						m_eLookaheadOrder;				//!< Ԥźõ¼õ˳
+		std::mt19937						m_random;						//!< 
+	};
+}	// GM
@@ -0,0 +1,274 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMPointCache.cpp
+/// @brief		Galaxy-Music Engine - GMPointCache
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMPointCache.h"
+#include <filesystem>
+#include <fstream>
+#include <cstdio>
+
+using namespace GM;
+namespace fs = std::filesystem;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+#define GM_POINT_CACHE_MAGIC		(0x43504D47)	// "GMPC"
+#define GM_POINT_CACHE_VERSION		(1)				// ʽ㷨޸ĺ
+#define GM_POINT_CACHE_BLOCK_MAX	(64)			// ݿ
+#define GM_POINT_CACHE_BYTES_MAX	(1ULL << 30)	// ݿֽ
+
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* 󻺴ļͷ֮iBlockNum {ֽ(unsigned long long), }
+* @param iKey:				Ĺϣֵļеļͬ
+* @param iChecksum:			ļͷ֮ݵУ
+*/
+struct SGMPointCacheHeader
+{
+	unsigned int		iMagic;
+	unsigned int		iVersion;
+	unsigned long long	iKey;
+	unsigned long long	iBlockNum;
+	unsigned long long	iChecksum;
+};
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* 8ֽΪλFNV-1aϣֽڿ죬ڹϣͼƬ
+* 8ֽڵβֽڴ
+*/
+static unsigned long long _Hash(unsigned long long iHash, const unsigned char* pData, const size_t iBytes)
+{
+	const size_t iWordNum = iBytes / 8;
+	for (size_t i = 0; i < iWordNum; i++)
+	{
+		unsigned long long iWord;
+		memcpy(&iWord, pData + i * 8, 8);
+		iHash ^= iWord;
+		iHash *= 1099511628211ULL;
+	}
+	for (size_t i = iWordNum * 8; i < iBytes; i++)
+	{
+		iHash ^= pData[i];
+		iHash *= 1099511628211ULL;
+	}
+	return iHash;
+}
+
+/*************************************************************************
+CGMPointCache Methods
+*************************************************************************/
+
+/** @brief  */
+CGMPointCache::CGMPointCache(const std::string& strCacheDir, const std::string& strName) :
+	m_strCacheDir(strCacheDir), m_strName(strName), m_iKey(14695981039346656037ULL), m_iPopIndex(0)
+{
+	const unsigned int iVersion = GM_POINT_CACHE_VERSION;
+	AddKey(&iVersion, sizeof(iVersion));
+	AddKey(strName);
+}
+
+/** @brief  */
+CGMPointCache::~CGMPointCache()
+{
+}
+
+void CGMPointCache::AddKey(const void* pData, const size_t iBytes)
+{
+	// Ȼ볤ȣⲻͬƴӺͬ
+	const unsigned long long iLength = iBytes;
+	m_iKey = _Hash(m_iKey, (const unsigned char*)&iLength, sizeof(iLength));
+	m_iKey = _Hash(m_iKey, (const unsigned char*)pData, iBytes);
+}
+
+void CGMPointCache::AddKey(const osg::Image* pImg)
+{
+	if (!pImg || !pImg->data())
+	{
+		AddKey(nullptr, 0);
+		return;
+	}
+
+	const int iFormat[6] = { pImg->s(), pImg->t(), pImg->r(),
+		int(pImg->getPixelFormat()), int(pImg->getDataType()), int(pImg->getPacking()) };
+	AddKey(iFormat, sizeof(iFormat));
+	AddKey(pImg->data(), pImg->getTotalSizeInBytes());
+}
+
+void CGMPointCache::AddKey(const std::string& strValue)
+{
+	AddKey(strValue.data(), strValue.size());
+}
+
+void CGMPointCache::AddKey(const double fValue)
+{
+	AddKey(&fValue, sizeof(fValue));
+}
+
+std::string CGMPointCache::GetFileName() const
+{
+	char strKey[17];
+	snprintf(strKey, sizeof(strKey), "%016llX", m_iKey);
+	return m_strCacheDir + m_strName + "_" + strKey + ".cache";
+}
+
+bool CGMPointCache::Load()
+{
+	m_blockVector.clear();
+	m_iPopIndex = 0;
+
+	std::ifstream file(GetFileName(), std::ios::binary);
+	if (!file) return false;
+
+	SGMPointCacheHeader sHeader;
+	if (!file.read((char*)&sHeader, sizeof(SGMPointCacheHeader))
+		|| GM_POINT_CACHE_MAGIC != sHeader.iMagic
+		|| GM_POINT_CACHE_VERSION != sHeader.iVersion
+		|| m_iKey != sHeader.iKey
+		|| sHeader.iBlockNum > GM_POINT_CACHE_BLOCK_MAX)
+	{
+		return false;
+	}
+
+	unsigned long long iChecksum = 14695981039346656037ULL;
+	m_blockVector.resize(size_t(sHeader.iBlockNum));
+	for (auto& itr : m_blockVector)
+	{
+		unsigned long long iBytes = 0;
+		if (!file.read((char*)&iBytes, sizeof(iBytes)) || iBytes > GM_POINT_CACHE_BYTES_MAX)
+		{
+			m_blockVector.clear();
+			return false;
+		}
+		itr.resize(size_t(iBytes));
+		if (iBytes && !file.read((char*)itr.data(), std::streamsize(iBytes)))
+		{
+			m_blockVector.clear();
+			return false;
+		}
+		iChecksum = _Hash(iChecksum, (const unsigned char*)&iBytes, sizeof(iBytes));
+		iChecksum = _Hash(iChecksum, itr.data(), itr.size());
+	}
+
+	// ļĩβӦû
+	if (iChecksum != sHeader.iChecksum || file.peek() != std::ifstream::traits_type::eof())
+	{
+		m_blockVector.clear();
+		return false;
+	}
+	return true;
+}
+
+bool CGMPointCache::Save() const
+{
+	SGMPointCacheHeader sHeader;
+	memset(&sHeader, 0, sizeof(SGMPointCacheHeader));
+	sHeader.iMagic = GM_POINT_CACHE_MAGIC;
+	sHeader.iVersion = GM_POINT_CACHE_VERSION;
+	sHeader.iKey = m_iKey;
+	sHeader.iBlockNum = m_blockVector.size();
+	sHeader.iChecksum = 14695981039346656037ULL;
+	for (auto& itr : m_blockVector)
+	{
+		const unsigned long long iBytes = itr.size();
+		sHeader.iChecksum = _Hash(sHeader.iChecksum, (const unsigned char*)&iBytes, sizeof(iBytes));
+		sHeader.iChecksum = _Hash(sHeader.iChecksum, itr.data(), itr.size());
+	}
+
+	std::error_code ec;
+	fs::create_directories(fs::path(m_strCacheDir), ec);
+
+	// дʱļɹ滻²Ļ
+	const std::string strCacheFile = GetFileName();
+	const std::string strTempFile = strCacheFile + ".tmp";
+	bool bOK = false;
+	{
+		std::ofstream file(strTempFile, std::ios::binary | std::ios::trunc);
+		if (file)
+		{
+			file.write((const char*)&sHeader, sizeof(SGMPointCacheHeader));
+			for (auto& itr : m_blockVector)
+			{
+				const unsigned long long iBytes = itr.size();
+				file.write((const char*)&iBytes, sizeof(iBytes));
+				file.write((const char*)itr.data(), std::streamsize(itr.size()));
+			}
+			bOK = file.good();
+		}
+	}
+	if (bOK)
+	{
+		fs::rename(fs::path(strTempFile), fs::path(strCacheFile), ec);
+		bOK = !ec;
+	}
+	if (!bOK)
+	{
+		fs::remove(fs::path(strTempFile), ec);
+		return false;
+	}
+
+	// ͬƵļѾڣɾ
+	const std::string strPrefix = m_strName + "_";
+	const std::string strCurrent = fs::path(strCacheFile).filename().string();
+	std::vector<fs::path> staleVector;
+	for (fs::directory_iterator itr(fs::path(m_strCacheDir), ec), end; !ec && itr != end; itr.increment(ec))
+	{
+		const std::string strFile = itr->path().filename().string();
+		if (strFile != strCurrent
+			&& strFile.size() == strCurrent.size()
+			&& 0 == strFile.compare(0, strPrefix.size(), strPrefix)
+			&& itr->path().extension() == ".cache")
+		{
+			staleVector.push_back(itr->path());
+		}
+	}
+	for (auto& itr : staleVector)
+	{
+		fs::remove(itr, ec);
+	}
+	return true;
+}
+
+void CGMPointCache::PushString(const std::string& strValue)
+{
+	_Push(strValue.data(), strValue.size());
+}
+
+bool CGMPointCache::PopString(std::string& strValue)
+{
+	const void* pData = nullptr;
+	size_t iBytes = 0;
+	if (!_Pop(pData, iBytes)) return false;
+	strValue.assign((const char*)pData, iBytes);
+	return true;
+}
+
+void CGMPointCache::_Push(const void* pData, const size_t iBytes)
+{
+	const unsigned char* pByte = (const unsigned char*)pData;
+	m_blockVector.emplace_back(pByte, pByte + iBytes);
+}
+
+bool CGMPointCache::_Pop(const void*& pData, size_t& iBytes)
+{
+	if (m_iPopIndex >= m_blockVector.size()) return false;
+	const std::vector<unsigned char>& block = m_blockVector[m_iPopIndex++];
+	pData = block.data();
+	iBytes = block.size();
+	return true;
+}
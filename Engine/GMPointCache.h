@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMPointCache.h
+/// @brief		Galaxy-Music Engine - GMPointCache
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <osg/Image>
+
+namespace GM
+{
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMPointCache
+	*  @brief ɵĵݵĴ̻棬Ѱַ
+	*	ɵ루ͼƬݡ״̬ͨAddKey64λļ
+	*	ļΪ_.cacheκα仯õµļļڱļʱɾ
+	*	ļǰ˳򱣴ݿ飬ȡʱд˳ȡ
+	*/
+	class CGMPointCache
+	{
+		// 
+	public:
+		/**
+		* @brief 
+		* @param strCacheDir:		Ŀ¼ԡ/βʱڱʱ
+		* @param strName:			ƣͬһֻµһļ
+		*/
+		CGMPointCache(const std::string& strCacheDir, const std::string& strName);
+		/** @brief  */
+		~CGMPointCache();
+
+		/**
+		* AddKey
+		* һݼ뻺ļLoadSave֮ǰ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pData:				
+		* @param iBytes:			ֽ
+		* @return void
+		*/
+		void AddKey(const void* pData, const size_t iBytes);
+		/** @brief ͼƬĳߴ硢ʽݼͼƬҲı */
+		void AddKey(const osg::Image* pImg);
+		/** @brief ַ */
+		void AddKey(const std::string& strValue);
+		/** @brief ֵ */
+		void AddKey(const double fValue);
+
+		/**
+		* GetFileName
+		* @return std::string:		ǰӦĻļ·
+		*/
+		std::string GetFileName() const;
+
+		/**
+		* Load
+		* ȡǰӦĻļ汾У
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:				Чtrue֮Popϵкȡ
+		*/
+		bool Load();
+
+		/**
+		* Save
+		* Pushݿд뵱ǰӦĻļдʱļ滻
+		* ɹɾͬƵѹڵģļ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return bool:				ɹtrueʧfalse
+		*/
+		bool Save() const;
+
+		/**
+		* PushArray
+		* ׷һݿ飬TΪԪPOD͵飬osg::Vec4Arrayosg::DrawElementsUShort
+		* @param array:				
+		*/
+		template<class T>
+		void PushArray(const T& array)
+		{
+			const size_t iBytes = array.size() * sizeof(typename T::value_type);
+			_Push(iBytes ? (const void*)&array[0] : nullptr, iBytes);
+		}
+
+		/**
+		* PopArray
+		* д˳ȡһݿ
+		* @param array:				飬ԭݻᱻ滻
+		* @return bool:				ɹtrueûиݿСƥfalse
+		*/
+		template<class T>
+		bool PopArray(T& array)
+		{
+			const void* pData = nullptr;
+			size_t iBytes = 0;
+			if (!_Pop(pData, iBytes) || 0 != iBytes % sizeof(typename T::value_type)) return false;
+			array.resize(iBytes / sizeof(typename T::value_type));
+			if (iBytes) memcpy(&array[0], pData, iBytes);
+			return true;
+		}
+
+		/** @brief ׷һַݿ */
+		void PushString(const std::string& strValue);
+		/** @brief д˳ȡһַݿ */
+		bool PopString(std::string& strValue);
+
+	private:
+		/** @brief ׷һݿ */
+		void _Push(const void* pData, const size_t iBytes);
+		/** @brief ȡһݿ */
+		bool _Pop(const void*& pData, size_t& iBytes);
+
+		// 
+	private:
+		std::string									m_strCacheDir;			//!< Ŀ¼
+		std::string									m_strName;				//!< 
+		unsigned long long							m_iKey;					//!< Ĺϣֵ
+		std::vector<std::vector<unsigned char>>		m_blockVector;			//!< ݿ
+		size_t										m_iPopIndex;			//!< һҪȡݿ
+	};
+}	// GM
@@ -15,6 +15,7 @@
 #include "GMCommonUniform.h"
 #include "GMKernel.h"
 #include "GMDispatchCompute.h"
+#include "GMAsteroidSolver.h"
 
 #include <random>
 #include <osg/Node>
@@ -85,6 +86,7 @@ namespace GM
 	class CGMOort;
 	class CGMDataManager;
 	class CGMCelestialScaleVisitor;
+	class CGMAsteroidKepler;
 
 	/*!
 	*  @class CGMSolar
@@ -457,8 +459,8 @@ namespace GM
 		osg::ref_ptr<osg::Uniform>						m_mAtmosColorTransUniform;		//!< ɫת
 		osg::ref_ptr<osg::Uniform>						m_mWorld2ECEFUniform;			//!< 2ռ䡱ת ECEF ľ
 		osg::ref_ptr<osg::Uniform>						m_mView2ECEFUniform;			//!< viewռתECEFľ
-		osg::ref_ptr<osg::Uniform>						m_fStepTimeUniform;				//!< 沽ʵʱ䣬λ
-		osg::ref_ptr<osg::Uniform>						m_vJupiterPosUniform;			//!< ľ̫ϵµ꣬λ
+		osg::ref_ptr<osg::Uniform>						m_vAsteroidParamUniform;		//!< СǴĲ飬vec4[GM_ASTEROID_PARAM_NUM]
+		SGMAsteroidParam								m_sAsteroidParam;				//!< СǴĲ飬CPUshader
 		osg::ref_ptr<osg::Uniform>						m_vCoordScaleUniform;			//!< ͼ
 
 		osg::ref_ptr<osgDB::Options>					m_pDDSOptions;					//!< dds
@@ -498,6 +500,10 @@ namespace GM
 		osg::ref_ptr<CGMDispatchCompute>				m_pAsteroidComputeNode;			//!< СǴCSڵ
 		osg::ref_ptr<osg::Camera>						m_pReadAsteroidCam;				//!< ڶȡСǴ
 		CReadPixelFinishCallback*						m_pReadPixelFinishCallback;
+		CGMAsteroidSolver*								m_pAsteroidSolver;				//!< СǴCPUģ飬ֻCPUģʽ´
+		CGMAsteroidKepler*								m_pAsteroidKepler;				//!< СǴĽֵģ飬ֻڹģʽ´
+		double											m_fAsteroidTime;				//!< ģʽ¾Ԫʱ䣬λ
+		osg::ref_ptr<osg::Image>						m_pAsteroidImage;				//!< CPUģʽµСͼԭظ
 		CGMCelestialScaleVisitor*						m_pCelestialScaleVisitor;		//!< ڿС
 
 		CGMTerrain*										m_pTerrain;						//!< ģ
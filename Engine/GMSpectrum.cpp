@@ -0,0 +1,200 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMSpectrum.cpp
+/// @brief		Galaxy-Music Engine - GMSpectrum
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMSpectrum.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_SPECTRUM_MIN_FREQ		(40.0f)			// Ƶ±߽磬λHz
+#define GM_SPECTRUM_MAX_FREQ		(16000.0f)		// Ƶϱ߽磬λHz
+#define GM_SPECTRUM_MIN_DB			(-72.0f)		// ӳΪ0ķֱֵ
+#define GM_SPECTRUM_ATTACK			(0.015f)		// ʱ䳣λs
+#define GM_SPECTRUM_RELEASE			(0.25f)			// ʱ䳣λs
+#define GM_SPECTRUM_PI				(3.14159265358979)
+
+/*************************************************************************
+CGMSpectrum Methods
+*************************************************************************/
+
+/** @brief  */
+CGMSpectrum::CGMSpectrum(const size_t iFFTSize) : m_iFFTSize(iFFTSize), m_fSampleRate(0.0f), m_fPowerScale(1.0f)
+{
+	const size_t iN = m_iFFTSize;
+	const size_t iHalf = iN / 2;
+
+	// HannҲƵֵΪ sum(w)/2
+	m_windowVector.resize(iN);
+	double fWindowSum = 0.0;
+	for (size_t i = 0; i < iN; i++)
+	{
+		m_windowVector[i] = float(0.5 - 0.5 * cos(2.0 * GM_SPECTRUM_PI * i / iN));
+		fWindowSum += m_windowVector[i];
+	}
+	m_fPowerScale = float(4.0 / (fWindowSum * fWindowSum));
+
+	m_cosVector.resize(iHalf);
+	m_sinVector.resize(iHalf);
+	for (size_t k = 0; k < iHalf; k++)
+	{
+		m_cosVector[k] = float(cos(2.0 * GM_SPECTRUM_PI * k / iN));
+		m_sinVector[k] = float(sin(2.0 * GM_SPECTRUM_PI * k / iN));
+	}
+
+	unsigned int iBits = 0;
+	while ((size_t(1) << iBits) < iHalf) iBits++;
+	m_bitReverseVector.resize(iHalf);
+	for (unsigned int i = 0; i < iHalf; i++)
+	{
+		unsigned int iRev = 0;
+		for (unsigned int b = 0; b < iBits; b++)
+		{
+			iRev |= ((i >> b) & 1) << (iBits - 1 - b);
+		}
+		m_bitReverseVector[i] = iRev;
+	}
+
+	m_fftRe.resize(iHalf);
+	m_fftIm.resize(iHalf);
+	m_powerVector.resize(iHalf + 1);
+	m_bandEdgeVector.resize(GM_SPECTRUM_BAND_NUM + 1);
+	m_bandVector.resize(GM_SPECTRUM_BAND_NUM, 0.0f);
+
+	Init(44100.0f);
+}
+
+/** @brief  */
+CGMSpectrum::~CGMSpectrum()
+{
+}
+
+void CGMSpectrum::Init(const float fSampleRate)
+{
+	m_fSampleRate = fSampleRate;
+
+	// Ƶ߽[MIN_FREQ, MAX_FREQ]ϰȷ֣
+	// ƵÿƵһƵ㣬߽絥
+	const unsigned int iHalf = (unsigned int)(m_iFFTSize / 2);
+	const float fBinHz = fSampleRate / m_iFFTSize;
+	const float fMaxFreq = std::min(GM_SPECTRUM_MAX_FREQ, fSampleRate * 0.5f);
+	const float fRatio = std::log(fMaxFreq / GM_SPECTRUM_MIN_FREQ);
+	unsigned int iLast = std::max(1u, (unsigned int)(GM_SPECTRUM_MIN_FREQ / fBinHz + 0.5f));
+	m_bandEdgeVector[0] = iLast;
+	for (int i = 1; i <= GM_SPECTRUM_BAND_NUM; i++)
+	{
+		const float fFreq = GM_SPECTRUM_MIN_FREQ * std::exp(fRatio * i / GM_SPECTRUM_BAND_NUM);
+		unsigned int iBin = (unsigned int)(fFreq / fBinHz + 0.5f);
+		iBin = std::min(iHalf + 1, std::max(iLast + 1, iBin));
+		m_bandEdgeVector[i] = iBin;
+		iLast = iBin;
+	}
+
+	Reset();
+}
+
+void CGMSpectrum::Reset()
+{
+	std::fill(m_bandVector.begin(), m_bandVector.end(), 0.0f);
+}
+
+void CGMSpectrum::Analyze(const float* pMono, const size_t iNum, const float fDeltaTime)
+{
+	const size_t iN = m_iFFTSize;
+	const size_t iHalf = iN / 2;
+
+	// żʵ鲿N/2㸴FFTNʵFFT
+	const size_t iCount = std::min(iNum, iN);
+	const size_t iPad = iN - iCount;
+	const float* pSrc = (iCount > 0) ? (pMono + iNum - iCount) : nullptr;
+	for (size_t i = 0; i < iHalf; i++)
+	{
+		const size_t i0 = 2 * i;
+		const size_t i1 = 2 * i + 1;
+		const float f0 = (i0 >= iPad) ? pSrc[i0 - iPad] * m_windowVector[i0] : 0.0f;
+		const float f1 = (i1 >= iPad) ? pSrc[i1 - iPad] * m_windowVector[i1] : 0.0f;
+		const unsigned int j = m_bitReverseVector[i];
+		m_fftRe[j] = f0;
+		m_fftIm[j] = f1;
+	}
+	_ComplexFFT();
+
+	// ֳʵеƵףX[k] = (Z[k] + Z*[N/2-k])/2 - i*W^k*(Z[k] - Z*[N/2-k])/2
+	m_powerVector[0] = (m_fftRe[0] + m_fftIm[0]) * (m_fftRe[0] + m_fftIm[0]);
+	m_powerVector[iHalf] = (m_fftRe[0] - m_fftIm[0]) * (m_fftRe[0] - m_fftIm[0]);
+	for (size_t k = 1; k < iHalf; k++)
+	{
+		const float fZr = m_fftRe[k];
+		const float fZi = m_fftIm[k];
+		const float fCr = m_fftRe[iHalf - k];
+		const float fCi = -m_fftIm[iHalf - k];
+		const float fEr = 0.5f * (fZr + fCr);
+		const float fEi = 0.5f * (fZi + fCi);
+		const float fOr = 0.5f * (fZi - fCi);
+		const float fOi = -0.5f * (fZr - fCr);
+		// W^k = exp(-2ik/N)
+		const float fWr = m_cosVector[k];
+		const float fWi = -m_sinVector[k];
+		const float fXr = fEr + fWr * fOr - fWi * fOi;
+		const float fXi = fEi + fWr * fOi + fWi * fOr;
+		m_powerVector[k] = fXr * fXr + fXi * fXi;
+	}
+
+	// ƵȡʣתΪֱһԳƽ
+	const float fAttack = 1.0f - std::exp(-std::max(0.0f, fDeltaTime) / GM_SPECTRUM_ATTACK);
+	const float fRelease = 1.0f - std::exp(-std::max(0.0f, fDeltaTime) / GM_SPECTRUM_RELEASE);
+	for (int b = 0; b < GM_SPECTRUM_BAND_NUM; b++)
+	{
+		const unsigned int iBegin = m_bandEdgeVector[b];
+		const unsigned int iEnd = m_bandEdgeVector[b + 1];
+		float fPower = 0.0f;
+		for (unsigned int k = iBegin; k < iEnd; k++)
+		{
+			fPower = std::max(fPower, m_powerVector[k]);
+		}
+		const float fDB = 10.0f * std::log10(fPower * m_fPowerScale + 1e-12f);
+		const float fTarget = std::min(1.0f, std::max(0.0f, 1.0f - fDB / GM_SPECTRUM_MIN_DB));
+		float& fBand = m_bandVector[b];
+		fBand += (fTarget - fBand) * ((fTarget > fBand) ? fAttack : fRelease);
+	}
+}
+
+void CGMSpectrum::_ComplexFFT()
+{
+	const size_t iHalf = m_iFFTSize / 2;
+	// ѾλתУĻ2
+	// N/2FFTת exp(-2ik/(N/2)) = W^(2k)
+	for (size_t iLen = 2; iLen <= iHalf; iLen <<= 1)
+	{
+		const size_t iStep = (2 * iHalf) / iLen;
+		const size_t iMid = iLen / 2;
+		for (size_t i = 0; i < iHalf; i += iLen)
+		{
+			for (size_t j = 0; j < iMid; j++)
+			{
+				const float fWr = m_cosVector[j * iStep];
+				const float fWi = -m_sinVector[j * iStep];
+				const size_t a = i + j;
+				const size_t b = a + iMid;
+				const float fTr = m_fftRe[b] * fWr - m_fftIm[b] * fWi;
+				const float fTi = m_fftRe[b] * fWi + m_fftIm[b] * fWr;
+				m_fftRe[b] = m_fftRe[a] - fTr;
+				m_fftIm[b] = m_fftIm[a] - fTi;
+				m_fftRe[a] += fTr;
+				m_fftIm[a] += fTi;
+			}
+		}
+	}
+}
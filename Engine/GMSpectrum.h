@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMSpectrum.h
+/// @brief		Galaxy-Music Engine - GMSpectrum
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_SPECTRUM_FFT_SIZE		(1024)			// FFT2
+	#define GM_SPECTRUM_BAND_NUM		(32)			// Ƶshaderеspectrum鳤һ
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMSpectrum
+	*  @brief ʵʱƵ׷
+	*	ԵPCMHannʵFFTƵʾۺϳɹ̶Ƶ
+	*	תΪֱһ[0,1]/ԳƵƽκε
+	*/
+	class CGMSpectrum
+	{
+		// 
+	public:
+		/**
+		* @brief 
+		* @param iFFTSize:		FFT2ݣ4
+		*/
+		CGMSpectrum(const size_t iFFTSize = GM_SPECTRUM_FFT_SIZE);
+		/** @brief  */
+		~CGMSpectrum();
+
+		/**
+		* Init
+		* ݲʼƵ߽磬Ƶ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fSampleRate:	ʣλHz
+		* @return void
+		*/
+		void Init(const float fSampleRate);
+
+		/**
+		* Analyze
+		* һ֡PCMƵ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pMono:			ȡFFTʱǰ油0
+		* @param iNum:			Ϊ0ʱΪ
+		* @param fDeltaTime:	ϴηʱ䣬λsƽ
+		* @return void
+		*/
+		void Analyze(const float* pMono, const size_t iNum, const float fDeltaTime);
+
+		/**
+		* Reset
+		* Ƶ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @return void
+		*/
+		void Reset();
+
+		/**
+		* GetBands
+		* @return std::vector<float>:	ƽƵGM_SPECTRUM_BAND_NUMΧ[0,1]Ƶǰ
+		*/
+		inline const std::vector<float>& GetBands() const
+		{
+			return m_bandVector;
+		}
+
+		/**
+		* GetBandEdges
+		* @return std::vector<unsigned int>:	ƵƵ߽磬GM_SPECTRUM_BAND_NUM+1
+		*										bƵ[edge[b], edge[b+1])Ƶ
+		*/
+		inline const std::vector<unsigned int>& GetBandEdges() const
+		{
+			return m_bandEdgeVector;
+		}
+
+		/** @brief ʣλHz */
+		inline float GetSampleRate() const { return m_fSampleRate; }
+
+		/** @brief FFT */
+		inline size_t GetFFTSize() const { return m_iFFTSize; }
+
+		/**
+		* GetPower
+		* @return std::vector<float>:	һAnalyzeĸƵ㹦ʣFFT/2+1
+		*								GetPowerScaleҲƵΪ1
+		*/
+		inline const std::vector<float>& GetPower() const
+		{
+			return m_powerVector;
+		}
+
+		/** @brief ʹһϵ */
+		inline float GetPowerScale() const { return m_fPowerScale; }
+
+	private:
+		/** @brief m_fftRe/m_fftImǰN/2ԭظFFT */
+		void _ComplexFFT();
+
+		// 
+	private:
+		size_t								m_iFFTSize;						//!< FFT
+		float								m_fSampleRate;					//!< ʣλHz
+		std::vector<float>					m_windowVector;					//!< Hann
+		std::vector<float>					m_cosVector;					//!< תcos(2k/N)k < N/2
+		std::vector<float>					m_sinVector;					//!< תsin(2k/N)k < N/2
+		std::vector<unsigned int>			m_bitReverseVector;				//!< N/2FFTλת
+		std::vector<float>					m_fftRe;						//!< FFTʵ
+		std::vector<float>					m_fftIm;						//!< FFT鲿
+		std::vector<float>					m_powerVector;					//!< Ƶ㹦ʣN/2+1
+		std::vector<unsigned int>			m_bandEdgeVector;				//!< ƵƵ߽磬GM_SPECTRUM_BAND_NUM+1
+		std::vector<float>					m_bandVector;					//!< ƽƵ
+		float								m_fPowerScale;					//!< ѹʹһҲΪ1
+	};
+}	// GM
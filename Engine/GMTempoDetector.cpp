@@ -0,0 +1,205 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTempoDetector.cpp
+/// @brief		Galaxy-Music Engine - GMTempoDetector
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTempoDetector.h"
+#include <cmath>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_TEMPO_ENV_RATE			(172.0)			// Ŀ֡ʣλHz
+#define GM_TEMPO_MEAN_SEC			(0.25)			// ƽĴڳȣλs
+#define GM_TEMPO_COMB_SEC			(4.0)			// ״˲ǵʱλs
+#define GM_TEMPO_BPM_STEP			(0.25)			// ѡBPMĲ
+#define GM_TEMPO_PRIOR_CENTER		(120.0)			// BPM
+#define GM_TEMPO_PRIOR_OCTAVE		(1.5)			// ı׼λƵ
+#define GM_TEMPO_MIN_CONFIDENCE		(0.08)			// ڴŶΪûԽ
+#define GM_TEMPO_MIN_ENERGY			(1e-6)			// С
+#define GM_TEMPO_MIN_ONSET			(0.02)			// ƽÿ֡
+#define GM_TEMPO_PI					(3.14159265358979)
+
+/*************************************************************************
+CGMTempoDetector Methods
+*************************************************************************/
+
+/** @brief  */
+CGMTempoDetector::CGMTempoDetector()
+{
+}
+
+/** @brief  */
+CGMTempoDetector::~CGMTempoDetector()
+{
+}
+
+double CGMTempoDetector::Detect(const float* pMono, const size_t iNum, const float fSampleRate, double* pConfidence)
+{
+	if (pConfidence) *pConfidence = 0.0;
+	if (nullptr == pMono || fSampleRate <= 0.0f) return 0.0;
+
+	// 1. 
+	const size_t iHop = std::max(size_t(1), size_t(fSampleRate / GM_TEMPO_ENV_RATE + 0.5));
+	const double fEnvRate = double(fSampleRate) / iHop;
+	const size_t iFrames = (iNum / iHop > 1) ? (iNum / iHop - 1) : 0;
+	const size_t iMaxLag = size_t(GM_TEMPO_COMB_SEC * fEnvRate) + 2;
+	if (iFrames < iMaxLag * 2) return 0.0;
+
+	// ÿ֡֡ƳHannȨδóг֮֡ԵΪ
+	const size_t iWindow = iHop * 2;
+	if (m_windowVector.size() != iWindow)
+	{
+		m_windowVector.resize(iWindow);
+		double fWindowSum = 0.0;
+		for (size_t i = 0; i < iWindow; i++)
+		{
+			m_windowVector[i] = float(0.5 - 0.5 * std::cos(2.0 * GM_TEMPO_PI * (i + 0.5) / iWindow));
+			fWindowSum += m_windowVector[i];
+		}
+		for (auto& itr : m_windowVector) itr = float(itr / fWindowSum);
+	}
+
+	m_onsetVector.assign(iFrames, 0.0f);
+	float fLastFull = 0.0f;
+	float fLastHigh = 0.0f;
+	for (size_t f = 0; f < iFrames; f++)
+	{
+		const float* pFrame = pMono + f * iHop;
+		float fLastSample = (f > 0) ? pFrame[-1] : pFrame[0];
+		double fFull = 0.0;
+		double fHigh = 0.0;
+		for (size_t i = 0; i < iWindow; i++)
+		{
+			const float fSample = pFrame[i];
+			const float fDiff = fSample - fLastSample;
+			fFull += m_windowVector[i] * fSample * fSample;
+			fHigh += m_windowVector[i] * fDiff * fDiff;
+			fLastSample = fSample;
+		}
+		const float fLogFull = float(std::log1p(1000.0 * fFull));
+		const float fLogHigh = float(std::log1p(1000.0 * fHigh));
+		if (f > 0)
+		{
+			m_onsetVector[f] = std::max(0.0f, fLogFull - fLastFull) + std::max(0.0f, fLogHigh - fLastHigh);
+		}
+		fLastFull = fLogFull;
+		fLastHigh = fLogHigh;
+	}
+
+	// ĵֻʣ·֡벨λɵ΢Сû
+	double fRawMean = 0.0;
+	for (size_t f = 0; f < iFrames; f++) fRawMean += m_onsetVector[f];
+	if (fRawMean < GM_TEMPO_MIN_ONSET * iFrames) return 0.0;
+
+	// 2. ȥƽȥȵĻ仯
+	const size_t iHalfWindow = std::max(size_t(1), size_t(GM_TEMPO_MEAN_SEC * fEnvRate * 0.5));
+	m_meanVector.resize(iFrames);
+	double fSum = 0.0;
+	size_t iBegin = 0;
+	size_t iEnd = 0;
+	for (size_t f = 0; f < iFrames; f++)
+	{
+		const size_t iNewBegin = (f > iHalfWindow) ? (f - iHalfWindow) : 0;
+		const size_t iNewEnd = std::min(iFrames, f + iHalfWindow + 1);
+		while (iEnd < iNewEnd) fSum += m_onsetVector[iEnd++];
+		while (iBegin < iNewBegin) fSum -= m_onsetVector[iBegin++];
+		m_meanVector[f] = float(fSum / double(iEnd - iBegin));
+	}
+	double fOnsetMean = 0.0;
+	for (size_t f = 0; f < iFrames; f++)
+	{
+		m_onsetVector[f] = std::max(0.0f, m_onsetVector[f] - m_meanVector[f]);
+		fOnsetMean += m_onsetVector[f];
+	}
+	// ȥֱûнźӳٴͬ
+	fOnsetMean /= double(iFrames);
+	for (size_t f = 0; f < iFrames; f++)
+	{
+		m_onsetVector[f] -= float(fOnsetMean);
+	}
+
+	// 3. أصȣⳤӳٱ͹
+	m_acfVector.assign(iMaxLag + 1, 0.0);
+	for (size_t iLag = 0; iLag <= iMaxLag; iLag++)
+	{
+		const float* pA = m_onsetVector.data();
+		const float* pB = m_onsetVector.data() + iLag;
+		const size_t iCount = iFrames - iLag;
+		double fAcc = 0.0;
+		for (size_t i = 0; i < iCount; i++)
+		{
+			fAcc += pA[i] * pB[i];
+		}
+		m_acfVector[iLag] = fAcc / double(iCount);
+	}
+	if (m_acfVector[0] <= GM_TEMPO_MIN_ENERGY) return 0.0;
+
+	// 4. ״˲ + 
+	// кѡBPMݸͬʱBPMֻ࣬ÿݶʱʤİ٣
+	// ÿĶźŲᱻΪ
+	const double fCombLength = GM_TEMPO_COMB_SEC * fEnvRate;
+	std::vector<double> scoreVector;
+	double fBestScore = -1.0;
+	double fBestMean = 0.0;
+	size_t iBest = 0;
+	for (double fBPM = GM_TEMPO_MIN_BPM; fBPM < GM_TEMPO_MAX_BPM; fBPM += GM_TEMPO_BPM_STEP)
+	{
+		const double fPeriod = 60.0 * fEnvRate / fBPM;
+		double fComb = 0.0;
+		int iTeeth = 0;
+		for (double fLag = fPeriod; fLag <= fCombLength; fLag += fPeriod)
+		{
+			fComb += _ACF(fLag);
+			iTeeth++;
+		}
+		const double fOctave = std::log2(fBPM / GM_TEMPO_PRIOR_CENTER) / GM_TEMPO_PRIOR_OCTAVE;
+		const double fScore = fComb / std::sqrt(double(std::max(1, iTeeth))) * std::exp(-0.5 * fOctave * fOctave);
+		if (fScore > fBestScore)
+		{
+			fBestScore = fScore;
+			fBestMean = fComb / std::max(1, iTeeth);
+			iBest = scoreVector.size();
+		}
+		scoreVector.push_back(fScore);
+	}
+
+	// ŶȣBPMÿݴƽһ
+	const double fConfidence = std::min(1.0, std::max(0.0, fBestMean / m_acfVector[0]));
+	if (pConfidence) *pConfidence = fConfidence;
+	if (fConfidence < GM_TEMPO_MIN_CONFIDENCE) return 0.0;
+
+	// ֵ߲õµľ
+	double fOffset = 0.0;
+	if (iBest > 0 && iBest + 1 < scoreVector.size())
+	{
+		const double fL = scoreVector[iBest - 1];
+		const double fC = scoreVector[iBest];
+		const double fR = scoreVector[iBest + 1];
+		const double fDenom = fL - 2.0 * fC + fR;
+		if (fDenom < 0.0)
+		{
+			fOffset = std::min(0.5, std::max(-0.5, 0.5 * (fL - fR) / fDenom));
+		}
+	}
+	const double fBPM = GM_TEMPO_MIN_BPM + (iBest + fOffset) * GM_TEMPO_BPM_STEP;
+	return std::round(fBPM * 10.0) / 10.0;
+}
+
+double CGMTempoDetector::_ACF(const double fLag) const
+{
+	const size_t i = size_t(fLag);
+	if (i + 1 >= m_acfVector.size()) return 0.0;
+	const double fT = fLag - i;
+	return m_acfVector[i] * (1.0 - fT) + m_acfVector[i + 1] * fT;
+}
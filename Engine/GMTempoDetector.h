@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTempoDetector.h
+/// @brief		Galaxy-Music Engine - GMTempoDetector
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_TEMPO_MIN_BPM			(60.0)			// СBPM
+	#define GM_TEMPO_MAX_BPM			(200.0)			// BPM
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMTempoDetector
+	*  @brief BPM
+	*	1. Լ172Hz֡ʼȫƵ͸Ƶһײ֣ļӴȡ仯Ϊ
+	*	2. ȥĻƽ
+	*	3. [GM_TEMPO_MIN_BPM, GM_TEMPO_MAX_BPM]ڵÿѡBPM״˲ۼ4sڴأ
+	*	   ٳ120BPMΪĵĶ˹飬ٱƵ/Ƶȡ÷ߵBPM
+	*	4. ĵûźŷ0
+	*	㣬BASS߳ʹãÿ߳ʹøԵʵ
+	*/
+	class CGMTempoDetector
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMTempoDetector();
+		/** @brief  */
+		~CGMTempoDetector();
+
+		/**
+		* Detect
+		* ⵥPCMBPM
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pMono:			
+		* @param iNum:			20s
+		* @param fSampleRate:	ʣλHz
+		* @param pConfidence:	Ŷ[0,1]Ϊnullptr
+		* @return double:		BPMһλСûԽʱ0
+		*/
+		double Detect(const float* pMono, const size_t iNum, const float fSampleRate, double* pConfidence = nullptr);
+
+	private:
+		/** @brief صԲֵ */
+		double _ACF(const double fLag) const;
+
+		// 
+	private:
+		std::vector<float>					m_windowVector;					//!< ֡Hannѹһ
+		std::vector<float>					m_onsetVector;					//!< 
+		std::vector<float>					m_meanVector;					//!< Ļƽ
+		std::vector<double>					m_acfVector;					//!< أѳص
+	};
+}	// GM
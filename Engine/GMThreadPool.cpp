@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMThreadPool.cpp
+/// @brief		Galaxy-Music Engine - GMThreadPool
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMThreadPool.h"
+
+using namespace GM;
+
+/*************************************************************************
+CGMThreadPool Methods
+*************************************************************************/
+
+/** @brief  */
+CGMThreadPool::CGMThreadPool(const unsigned int iThreadNum)
+	: m_pFunc(nullptr), m_iEnd(0), m_iNext(0), m_iBusy(0), m_iJob(0), m_bStop(false)
+{
+	unsigned int iNum = iThreadNum;
+	if (0 == iNum) iNum = std::thread::hardware_concurrency();
+	if (0 == iNum) iNum = 1;
+
+	// ߳Ҳ㣬ٴһ
+	for (unsigned int i = 1; i < iNum; i++)
+	{
+		m_threadVector.push_back(std::thread(&CGMThreadPool::_Work, this));
+	}
+}
+
+/** @brief  */
+CGMThreadPool::~CGMThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bStop = true;
+	}
+	m_wakeCondition.notify_all();
+	for (auto& itr : m_threadVector)
+	{
+		if (itr.joinable()) itr.join();
+	}
+	m_threadVector.clear();
+}
+
+void CGMThreadPool::ParallelFor(const int iBegin, const int iEnd, const std::function<void(int)>& func)
+{
+	if (iBegin >= iEnd) return;
+
+	if (m_threadVector.empty() || iEnd - iBegin == 1)
+	{
+		for (int i = iBegin; i < iEnd; i++) func(i);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_pFunc = &func;
+		m_iEnd = iEnd;
+		m_iNext.store(iBegin);
+		m_iBusy = int(m_threadVector.size());
+		m_iJob++;
+	}
+	m_wakeCondition.notify_all();
+
+	_Run();
+
+	// ȴй߳뿪ǰ֮funcſԱͷ
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCondition.wait(lock, [this] { return 0 == m_iBusy; });
+	m_pFunc = nullptr;
+}
+
+void CGMThreadPool::_Work()
+{
+	unsigned long long iLastJob = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wakeCondition.wait(lock, [&] { return m_bStop || m_iJob != iLastJob; });
+			if (m_bStop) return;
+			iLastJob = m_iJob;
+		}
+
+		_Run();
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_iBusy--;
+		}
+		m_doneCondition.notify_one();
+	}
+}
+
+void CGMThreadPool::_Run()
+{
+	int i = m_iNext.fetch_add(1);
+	while (i < m_iEnd)
+	{
+		(*m_pFunc)(i);
+		i = m_iNext.fetch_add(1);
+	}
+}
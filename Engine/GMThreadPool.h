@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMThreadPool.h
+/// @brief		Galaxy-Music Engine - GMThreadPool
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+namespace GM
+{
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMThreadPool
+	*  @brief ֲ̳߳أֻ׼
+	*	߳ڹʱʱParallelForĵ߳Ҳ㣬
+	*	ͨԭӼ䣬ԽȷԲĸִ߳
+	*/
+	class CGMThreadPool
+	{
+		// 
+	public:
+		/**
+		* 
+		* @param iThreadNum:	̣߳߳0ʾʹӲ߳
+		*/
+		CGMThreadPool(const unsigned int iThreadNum = 0);
+		/** @brief ȴ߳̽ */
+		~CGMThreadPool();
+
+		/**
+		* ParallelFor
+		* [iBegin, iEnd)еÿŵһfuncȫɺ󷵻
+		* ͬһ̳߳زfuncеݹParallelFor
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param iBegin:		ʼţ
+		* @param iEnd:			ţ
+		* @param func:			
+		* @return void
+		*/
+		void ParallelFor(const int iBegin, const int iEnd, const std::function<void(int)>& func);
+
+		/** @brief ̣߳߳ */
+		inline unsigned int GetThreadNum() const
+		{
+			return (unsigned int)(m_threadVector.size()) + 1;
+		}
+
+	private:
+		/** @brief ̺߳ */
+		void _Work();
+		/** @brief ȡִеǰţֱȫȡ */
+		void _Run();
+
+		// 
+	private:
+		std::vector<std::thread>			m_threadVector;					//!< ߳
+		std::mutex							m_mutex;						//!< ķͽ
+		std::condition_variable				m_wakeCondition;				//!< ֪ͨ߳
+		std::condition_variable				m_doneCondition;				//!< ֪ͨ߳
+		const std::function<void(int)>*		m_pFunc;						//!< ǰ
+		int									m_iEnd;							//!< ǰĽ
+		std::atomic<int>					m_iNext;						//!< һȡ
+		int									m_iBusy;						//!< ִеǰĹ߳
+		unsigned long long					m_iJob;							//!< ţÿParallelFor1
+		bool								m_bStop;						//!< ֪ͨ߳̽
+	};
+}	// GM
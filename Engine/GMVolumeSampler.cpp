@@ -0,0 +1,315 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMVolumeSampler.cpp
+/// @brief		Galaxy-Music Engine - GMVolumeSampler
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMVolumeSampler.h"
+#include "GMKit.h"
+#include <cmath>
+#include <immintrin.h>
+
+using namespace GM;
+
+/*************************************************************************
+ Macro Defines
+*************************************************************************/
+// MSVCֱʹAVX2úGCC/ClangҪΪָĿָ
+#ifdef _MSC_VER
+#define GM_TARGET_AVX2
+#else
+#define GM_TARGET_AVX2				__attribute__((target("avx2")))
+#endif
+#define GM_VOLUME_INT_LIMIT			(8388608.0f)	// 2^23ֵСfloat
+
+/*************************************************************************
+CGMVolumeSampler Methods
+*************************************************************************/
+
+/** @brief  */
+CGMVolumeSampler::CGMVolumeSampler() : m_iWidth(0), m_iHeight(0), m_iDepth(0), m_iSIMD(0)
+{
+	SetSIMD(2);
+}
+
+/** @brief  */
+CGMVolumeSampler::~CGMVolumeSampler()
+{
+}
+
+bool CGMVolumeSampler::Decode(const osg::Image* pImg, const int iChannel)
+{
+	m_valueVector.clear();
+	m_iWidth = m_iHeight = m_iDepth = 0;
+	if (!pImg || 0 >= pImg->s() || 0 >= pImg->t() || 0 >= pImg->r() || iChannel < 0 || iChannel > 3) return false;
+
+	m_iWidth = pImg->s();
+	m_iHeight = pImg->t();
+	m_iDepth = pImg->r();
+	m_valueVector.resize(size_t(m_iWidth) * m_iHeight * m_iDepth);
+	size_t i = 0;
+	for (int r = 0; r < m_iDepth; r++)
+	{
+		for (int t = 0; t < m_iHeight; t++)
+		{
+			for (int s = 0; s < m_iWidth; s++)
+			{
+				m_valueVector[i++] = pImg->getColor(s, t, r)[iChannel];
+			}
+		}
+	}
+	return true;
+}
+
+bool CGMVolumeSampler::DecodePacked(const osg::Image* pImg, const unsigned int iSize)
+{
+	m_valueVector.clear();
+	m_iWidth = m_iHeight = m_iDepth = 0;
+	if (!pImg || 0 == iSize || 0 != iSize % 4) return false;
+
+	const unsigned int iLayerNum = iSize / 4;
+	if (int(iSize) != pImg->s() || int(iSize * iLayerNum) != pImg->t()) return false;
+
+	m_iWidth = m_iHeight = m_iDepth = int(iSize);
+	m_valueVector.resize(size_t(iSize) * iSize * iSize);
+	for (unsigned int z = 0; z < iSize; z++)
+	{
+		const unsigned int iChannel = z / iLayerNum;
+		const unsigned int iSubLayer = z % iLayerNum;
+		float* pValue = &m_valueVector[size_t(z) * iSize * iSize];
+		for (unsigned int y = 0; y < iSize; y++)
+		{
+			for (unsigned int x = 0; x < iSize; x++)
+			{
+				*pValue++ = pImg->getColor(x, y + iSubLayer * iSize)[iChannel];
+			}
+		}
+	}
+	return true;
+}
+
+float CGMVolumeSampler::Sample(const float fX, const float fY, const float fZ) const
+{
+	float fValue = 0.0f;
+	_SampleScalar(&fX, &fY, &fZ, &fValue, 1);
+	return fValue;
+}
+
+void CGMVolumeSampler::Sample(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const
+{
+	size_t iDone = 0;
+	if (2 == m_iSIMD)
+	{
+		iDone = _SampleAVX2(pX, pY, pZ, pOut, iNum);
+	}
+	else if (1 == m_iSIMD)
+	{
+		iDone = _SampleSSE(pX, pY, pZ, pOut, iNum);
+	}
+	_SampleScalar(pX + iDone, pY + iDone, pZ + iDone, pOut + iDone, iNum - iDone);
+}
+
+void CGMVolumeSampler::SetSIMD(const int iLevel)
+{
+	m_iSIMD = (iLevel < 0) ? 0 : ((iLevel > 2) ? 2 : iLevel);
+	if (2 == m_iSIMD && !CGMKit::HasAVX2()) m_iSIMD = 1;
+}
+
+void CGMVolumeSampler::_SampleScalar(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const
+{
+	if (m_valueVector.empty())
+	{
+		for (size_t i = 0; i < iNum; i++) pOut[i] = 0.0f;
+		return;
+	}
+
+	const int iSize[3] = { m_iWidth, m_iHeight, m_iDepth };
+	for (size_t i = 0; i < iNum; i++)
+	{
+		const float fCoord[3] = { pX[i], pY[i], pZ[i] };
+		float fDelta[3];
+		int iIndex[3], iNext[3];
+		for (int c = 0; c < 3; c++)
+		{
+			// repeatȡС֣Ǹʱfmodf(x, 1.0f)ȫͬ
+			float fFract = (std::fabs(fCoord[c]) < GM_VOLUME_INT_LIMIT) ? (fCoord[c] - std::floor(fCoord[c])) : 0.0f;
+			float fS = fFract * float(iSize[c]);
+			int s = int(fS);
+			fDelta[c] = fS - float(s);
+			if (s >= iSize[c]) s -= iSize[c];
+			iIndex[c] = s;
+			iNext[c] = (s == iSize[c] - 1) ? 0 : (s + 1);
+		}
+
+		const float* pV = m_valueVector.data();
+		const size_t iRow = size_t(m_iWidth);
+		const size_t iLayer = iRow * m_iHeight;
+		const size_t iT0 = iIndex[1] * iRow, iT1 = iNext[1] * iRow;
+		const size_t iR0 = iIndex[2] * iLayer, iR1 = iNext[2] * iLayer;
+		const float fValue_000 = pV[iR0 + iT0 + iIndex[0]];
+		const float fValue_100 = pV[iR0 + iT0 + iNext[0]];
+		const float fValue_010 = pV[iR0 + iT1 + iIndex[0]];
+		const float fValue_110 = pV[iR0 + iT1 + iNext[0]];
+		const float fValue_001 = pV[iR1 + iT0 + iIndex[0]];
+		const float fValue_101 = pV[iR1 + iT0 + iNext[0]];
+		const float fValue_011 = pV[iR1 + iT1 + iIndex[0]];
+		const float fValue_111 = pV[iR1 + iT1 + iNext[0]];
+
+		const float fDeltaS = fDelta[0], fDeltaT = fDelta[1], fDeltaR = fDelta[2];
+		pOut[i] =
+			(fValue_000 * (1 - fDeltaS) * (1 - fDeltaT)
+				+ fValue_100 * fDeltaS * (1 - fDeltaT)
+				+ fValue_010 * (1 - fDeltaS) * fDeltaT
+				+ fValue_110 * fDeltaS * fDeltaT) * (1 - fDeltaR)
+			+ (fValue_001 * (1 - fDeltaS) * (1 - fDeltaT)
+				+ fValue_101 * fDeltaS * (1 - fDeltaT)
+				+ fValue_011 * (1 - fDeltaS) * fDeltaT
+				+ fValue_111 * fDeltaS * fDeltaT) * fDeltaR;
+	}
+}
+
+size_t CGMVolumeSampler::_SampleSSE(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const
+{
+	if (m_valueVector.empty()) return 0;
+
+	const __m128 vOne = _mm_set1_ps(1.0f);
+	const __m128 vAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	const __m128 vIntLimit = _mm_set1_ps(GM_VOLUME_INT_LIMIT);
+	const int iSize[3] = { m_iWidth, m_iHeight, m_iDepth };
+	const float* pCoord[3] = { pX, pY, pZ };
+	const float* pV = m_valueVector.data();
+	const int iRow = m_iWidth;
+	const int iLayer = m_iWidth * m_iHeight;
+
+	size_t i = 0;
+	for (; i + 4 <= iNum; i += 4)
+	{
+		__m128 vDelta[3];
+		alignas(16) int iIndex[3][4], iNext[3][4];
+		for (int c = 0; c < 3; c++)
+		{
+			const __m128 vCoord = _mm_loadu_ps(pCoord[c] + i);
+			// SSE2ûfloorȽضϣٶԴԭֵļ1
+			const __m128 vTrunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(vCoord));
+			const __m128 vFloor = _mm_sub_ps(vTrunc, _mm_and_ps(_mm_cmpgt_ps(vTrunc, vCoord), vOne));
+			const __m128 vSmall = _mm_cmplt_ps(_mm_and_ps(vCoord, vAbsMask), vIntLimit);
+			const __m128 vFract = _mm_and_ps(_mm_sub_ps(vCoord, vFloor), vSmall);
+			const __m128 vS = _mm_mul_ps(vFract, _mm_set1_ps(float(iSize[c])));
+			__m128i s = _mm_cvttps_epi32(vS);
+			vDelta[c] = _mm_sub_ps(vS, _mm_cvtepi32_ps(s));
+			const __m128i vSize = _mm_set1_epi32(iSize[c]);
+			s = _mm_sub_epi32(s, _mm_andnot_si128(_mm_cmplt_epi32(s, vSize), vSize));
+			const __m128i vLast = _mm_cmpeq_epi32(s, _mm_set1_epi32(iSize[c] - 1));
+			const __m128i sNext = _mm_andnot_si128(vLast, _mm_add_epi32(s, _mm_set1_epi32(1)));
+			_mm_store_si128((__m128i*)iIndex[c], s);
+			_mm_store_si128((__m128i*)iNext[c], sNext);
+		}
+
+		alignas(16) float fCorner[8][4];
+		for (int k = 0; k < 4; k++)
+		{
+			const int iT0 = iIndex[1][k] * iRow, iT1 = iNext[1][k] * iRow;
+			const int iR0 = iIndex[2][k] * iLayer, iR1 = iNext[2][k] * iLayer;
+			fCorner[0][k] = pV[iR0 + iT0 + iIndex[0][k]];
+			fCorner[1][k] = pV[iR0 + iT0 + iNext[0][k]];
+			fCorner[2][k] = pV[iR0 + iT1 + iIndex[0][k]];
+			fCorner[3][k] = pV[iR0 + iT1 + iNext[0][k]];
+			fCorner[4][k] = pV[iR1 + iT0 + iIndex[0][k]];
+			fCorner[5][k] = pV[iR1 + iT0 + iNext[0][k]];
+			fCorner[6][k] = pV[iR1 + iT1 + iIndex[0][k]];
+			fCorner[7][k] = pV[iR1 + iT1 + iNext[0][k]];
+		}
+
+		// ·˳ͬ
+		const __m128 vS1 = _mm_sub_ps(vOne, vDelta[0]);
+		const __m128 vT1 = _mm_sub_ps(vOne, vDelta[1]);
+		const __m128 vR1 = _mm_sub_ps(vOne, vDelta[2]);
+		__m128 vLow = _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[0]), vS1), vT1);
+		vLow = _mm_add_ps(vLow, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[1]), vDelta[0]), vT1));
+		vLow = _mm_add_ps(vLow, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[2]), vS1), vDelta[1]));
+		vLow = _mm_add_ps(vLow, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[3]), vDelta[0]), vDelta[1]));
+		__m128 vHigh = _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[4]), vS1), vT1);
+		vHigh = _mm_add_ps(vHigh, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[5]), vDelta[0]), vT1));
+		vHigh = _mm_add_ps(vHigh, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[6]), vS1), vDelta[1]));
+		vHigh = _mm_add_ps(vHigh, _mm_mul_ps(_mm_mul_ps(_mm_load_ps(fCorner[7]), vDelta[0]), vDelta[1]));
+		_mm_storeu_ps(pOut + i, _mm_add_ps(_mm_mul_ps(vLow, vR1), _mm_mul_ps(vHigh, vDelta[2])));
+	}
+	return i;
+}
+
+GM_TARGET_AVX2
+size_t CGMVolumeSampler::_SampleAVX2(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const
+{
+	if (m_valueVector.empty()) return 0;
+
+	const __m256 vOne = _mm256_set1_ps(1.0f);
+	const __m256 vAbsMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+	const __m256 vIntLimit = _mm256_set1_ps(GM_VOLUME_INT_LIMIT);
+	const int iSize[3] = { m_iWidth, m_iHeight, m_iDepth };
+	const float* pCoord[3] = { pX, pY, pZ };
+	const float* pV = m_valueVector.data();
+	const __m256i vRow = _mm256_set1_epi32(m_iWidth);
+	const __m256i vLayer = _mm256_set1_epi32(m_iWidth * m_iHeight);
+
+	size_t i = 0;
+	for (; i + 8 <= iNum; i += 8)
+	{
+		__m256 vDelta[3];
+		__m256i vIndex[3], vNext[3];
+		for (int c = 0; c < 3; c++)
+		{
+			const __m256 vCoord = _mm256_loadu_ps(pCoord[c] + i);
+			// SSE·ͬýضʵfloor֤·һ
+			const __m256 vTrunc = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(vCoord));
+			const __m256 vFloor = _mm256_sub_ps(vTrunc, _mm256_and_ps(_mm256_cmp_ps(vTrunc, vCoord, _CMP_GT_OQ), vOne));
+			const __m256 vSmall = _mm256_cmp_ps(_mm256_and_ps(vCoord, vAbsMask), vIntLimit, _CMP_LT_OQ);
+			const __m256 vFract = _mm256_and_ps(_mm256_sub_ps(vCoord, vFloor), vSmall);
+			const __m256 vS = _mm256_mul_ps(vFract, _mm256_set1_ps(float(iSize[c])));
+			__m256i s = _mm256_cvttps_epi32(vS);
+			vDelta[c] = _mm256_sub_ps(vS, _mm256_cvtepi32_ps(s));
+			const __m256i vSize = _mm256_set1_epi32(iSize[c]);
+			s = _mm256_sub_epi32(s, _mm256_andnot_si256(_mm256_cmpgt_epi32(vSize, s), vSize));
+			const __m256i vLast = _mm256_cmpeq_epi32(s, _mm256_set1_epi32(iSize[c] - 1));
+			vIndex[c] = s;
+			vNext[c] = _mm256_andnot_si256(vLast, _mm256_add_epi32(s, _mm256_set1_epi32(1)));
+		}
+
+		const __m256i vT0 = _mm256_mullo_epi32(vIndex[1], vRow);
+		const __m256i vT1 = _mm256_mullo_epi32(vNext[1], vRow);
+		const __m256i vR0 = _mm256_mullo_epi32(vIndex[2], vLayer);
+		const __m256i vR1 = _mm256_mullo_epi32(vNext[2], vLayer);
+		const __m256i vR0T0 = _mm256_add_epi32(vR0, vT0);
+		const __m256i vR0T1 = _mm256_add_epi32(vR0, vT1);
+		const __m256i vR1T0 = _mm256_add_epi32(vR1, vT0);
+		const __m256i vR1T1 = _mm256_add_epi32(vR1, vT1);
+		const __m256 vValue_000 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR0T0, vIndex[0]), 4);
+		const __m256 vValue_100 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR0T0, vNext[0]), 4);
+		const __m256 vValue_010 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR0T1, vIndex[0]), 4);
+		const __m256 vValue_110 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR0T1, vNext[0]), 4);
+		const __m256 vValue_001 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR1T0, vIndex[0]), 4);
+		const __m256 vValue_101 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR1T0, vNext[0]), 4);
+		const __m256 vValue_011 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR1T1, vIndex[0]), 4);
+		const __m256 vValue_111 = _mm256_i32gather_ps(pV, _mm256_add_epi32(vR1T1, vNext[0]), 4);
+
+		// ·˳ͬʹFMA
+		const __m256 vS1 = _mm256_sub_ps(vOne, vDelta[0]);
+		const __m256 vTT1 = _mm256_sub_ps(vOne, vDelta[1]);
+		const __m256 vRR1 = _mm256_sub_ps(vOne, vDelta[2]);
+		__m256 vLow = _mm256_mul_ps(_mm256_mul_ps(vValue_000, vS1), vTT1);
+		vLow = _mm256_add_ps(vLow, _mm256_mul_ps(_mm256_mul_ps(vValue_100, vDelta[0]), vTT1));
+		vLow = _mm256_add_ps(vLow, _mm256_mul_ps(_mm256_mul_ps(vValue_010, vS1), vDelta[1]));
+		vLow = _mm256_add_ps(vLow, _mm256_mul_ps(_mm256_mul_ps(vValue_110, vDelta[0]), vDelta[1]));
+		__m256 vHigh = _mm256_mul_ps(_mm256_mul_ps(vValue_001, vS1), vTT1);
+		vHigh = _mm256_add_ps(vHigh, _mm256_mul_ps(_mm256_mul_ps(vValue_101, vDelta[0]), vTT1));
+		vHigh = _mm256_add_ps(vHigh, _mm256_mul_ps(_mm256_mul_ps(vValue_011, vS1), vDelta[1]));
+		vHigh = _mm256_add_ps(vHigh, _mm256_mul_ps(_mm256_mul_ps(vValue_111, vDelta[0]), vDelta[1]));
+		_mm256_storeu_ps(pOut + i, _mm256_add_ps(_mm256_mul_ps(vLow, vRR1), _mm256_mul_ps(vHigh, vDelta[2])));
+	}
+	return i;
+}
@@ -0,0 +1,125 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMVolumeSampler.h
+/// @brief		Galaxy-Music Engine - GMVolumeSampler
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <osg/Image>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+	#define GM_VOLUME_BATCH				(1024)			// ʱÿ
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMVolumeSampler
+	*  @brief CPU˵άͼƬrepeatģʽԲֵ
+	*	ͼƬֻһΣΪĵͨfloatݣ z-y-x ˳洢
+	*	ʱAVX2ÿ8SSEÿ4·ʱCPUѡಿñ㣬
+	*	·˳ͬλһ
+	*/
+	class CGMVolumeSampler
+	{
+		// 
+	public:
+		/** @brief  */
+		CGMVolumeSampler();
+		/** @brief  */
+		~CGMVolumeSampler();
+
+		/**
+		* Decode
+		* һͨάͼƬr() > 1еһͨ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pImg:			άͼƬ
+		* @param iChannel:		ͨ0~3ֱΪRGBA
+		* @return bool:			ɹtrueͼƬΪջͨǷfalse
+		*/
+		bool Decode(const osg::Image* pImg, const int iChannel = 0);
+
+		/**
+		* DecodePacked
+		* 롰noiseShape128.tgaάͼiSizeiSize*iSize/4
+		* rgbaֱʾ4άֵȱÿһ㣬ٱÿͨzͨz/(iSize/4)ĵz%(iSize/4)
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pImg:			άͼƬ
+		* @param iSize:			άı߳4ı
+		* @return bool:			ɹtrueͼƬΪջߴ粻false
+		*/
+		bool DecodePacked(const osg::Image* pImg, const unsigned int iSize);
+
+		/** @brief ǷѾ */
+		inline bool IsValid() const
+		{
+			return !m_valueVector.empty();
+		}
+
+		/**
+		* Sample
+		* Բrepeatģʽ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param fX, fY, fZ:	꣬ƣ1.0Ϊһ
+		* @return float:		[0.0,1.0]δʱ0
+		*/
+		float Sample(const float fX, const float fY, const float fZ) const;
+
+		/**
+		* Sample
+		* Բrepeatģʽõλһ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param pX, pY, pZ:	
+		* @param pOut:			
+		* @param iNum:			
+		* @return void
+		*/
+		void Sample(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const;
+
+		/**
+		* SetSIMD
+		* ʹõָڲԺͶԱȣĬʹCPUֵ֧·
+		* @param iLevel:		0 = 1 = SSE2 = AVX2CPU֧ʱԶ
+		*/
+		void SetSIMD(const int iLevel);
+
+		/** @brief ǰʹõָ0 = 1 = SSE2 = AVX2 */
+		inline int GetSIMD() const
+		{
+			return m_iSIMD;
+		}
+
+	private:
+		/** @brief ı· */
+		void _SampleScalar(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const;
+		/** @brief SSE·ÿ4Ѿ */
+		size_t _SampleSSE(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const;
+		/** @brief AVX2·ÿ8Ѿ */
+		size_t _SampleAVX2(const float* pX, const float* pY, const float* pZ, float* pOut, const size_t iNum) const;
+
+		// 
+	private:
+		std::vector<float>					m_valueVector;					//!< ݣ± = (z * iHeight + y) * iWidth + x
+		int									m_iWidth;						//!< xĳߴ
+		int									m_iHeight;						//!< yĳߴ
+		int									m_iDepth;						//!< zĳߴ
+		int									m_iSIMD;						//!< ʹõָ
+	};
+}	// GM
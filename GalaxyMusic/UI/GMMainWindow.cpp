@@ -188,10 +188,14 @@ void CGMMainWindow::UpdateAudioInfo()
 		qApp->processEvents();
 		m_pListWidget->EnsureLastAudioVisible();
 
-		m_iAudioDuration = GM_ENGINE.GetAudioDuration();
-
 		// /ͣťóɲ״̬
 		ui.playBtn->setChecked(true);
+	}
+	// Ƶں̨򿪣ʱҪԤϺܻȡÿζ
+	const int iAudioDuration = GM_ENGINE.GetAudioDuration();
+	if (m_iAudioDuration != iAudioDuration)
+	{
+		m_iAudioDuration = iAudioDuration;
 
 		// 㲢ʾǰƵʱ
 		int iMinutesAll = 0;
@@ -206,7 +210,7 @@ void CGMMainWindow::UpdateAudioInfo()
 	}
 	// ȡǰƵλãλms
 	int iCurrentTime = GM_ENGINE.GetAudioCurrentTime();
-	float fTimeRatio = 400 * float(iCurrentTime) / float(m_iAudioDuration);
+	float fTimeRatio = (0 < m_iAudioDuration) ? (400 * float(iCurrentTime) / float(m_iAudioDuration)) : 0.0f;
 	// ѭ޸ʱ
 	int iTimeLast = ui.timeSlider->value();
 	if(abs(fTimeRatio - iTimeLast) > 0.5f)
@@ -526,6 +530,12 @@ void CGMMainWindow::keyPressEvent(QKeyEvent* event)
 		GM_ENGINE.Next();
 	}
 	break;
+	case Qt::Key_F5:
+	{
+		// ļб޸ĺֶˢƵ
+		GM_ENGINE.RescanAudio();
+	}
+	break;
 	case Qt::Key_F11:
 	{
 		GM_UI_MANAGER_PTR->SetFullScreen(!GM_UI_MANAGER_PTR->GetFullScreen());
@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTest.cpp
+/// @brief		Galaxy-Music Engine - GMTest
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include <vector>
+#include <cstdio>
+#include <cmath>
+#include <filesystem>
+
+using namespace GM;
+
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* עĲ
+*/
+struct SGMTestCase
+{
+	const char*			strName;
+	CGMTest::TestFunc	func;
+	bool				bBench;
+};
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief עĲԣڵľ̬⾲̬ʼ˳ */
+static std::vector<SGMTestCase>& _TestCases()
+{
+	static std::vector<SGMTestCase> s_caseVector;
+	return s_caseVector;
+}
+
+/** @brief ǰʧܵļ */
+static int s_iFailNum = 0;
+/** @brief · */
+static std::string s_strDataPath = "../../tests/Data/";
+
+/*************************************************************************
+CGMTest Methods
+*************************************************************************/
+
+void CGMTest::Register(const char* strName, TestFunc func, const bool bBench)
+{
+	_TestCases().push_back({ strName, func, bBench });
+}
+
+int CGMTest::Run(const std::string& strFilter, const bool bBench)
+{
+	int iFailTotal = 0;
+	int iRunNum = 0;
+	for (auto& itr : _TestCases())
+	{
+		if (itr.bBench != bBench) continue;
+		if (!strFilter.empty() && std::string::npos == std::string(itr.strName).find(strFilter)) continue;
+
+		printf("[ RUN  ] %s\n", itr.strName);
+		fflush(stdout);
+		s_iFailNum = 0;
+		const double fSeconds = Seconds(itr.func);
+		printf("[ %s ] %s (%.3f s)\n", (0 == s_iFailNum) ? " OK " : "FAIL", itr.strName, fSeconds);
+		iFailTotal += s_iFailNum;
+		iRunNum++;
+	}
+	printf("%d %s, %d failed checks\n", iRunNum, bBench ? "benchmarks" : "tests", iFailTotal);
+	return iFailTotal;
+}
+
+bool CGMTest::Check(const bool bOK, const char* strExpr, const char* strFile, const int iLine)
+{
+	if (!bOK)
+	{
+		printf("  %s(%d): check failed: %s\n", strFile, iLine, strExpr);
+		s_iFailNum++;
+	}
+	return bOK;
+}
+
+bool CGMTest::CheckNear(const double fA, const double fB, const double fEps,
+	const char* strExpr, const char* strFile, const int iLine)
+{
+	const bool bOK = std::abs(fA - fB) <= fEps;
+	if (!bOK)
+	{
+		printf("  %s(%d): check failed: %s (%g vs %g, eps %g)\n", strFile, iLine, strExpr, fA, fB, fEps);
+		s_iFailNum++;
+	}
+	return bOK;
+}
+
+const std::string& CGMTest::GetDataPath()
+{
+	return s_strDataPath;
+}
+
+void CGMTest::SetDataPath(const std::string& strPath)
+{
+	s_strDataPath = strPath;
+	if (!s_strDataPath.empty() && '/' != s_strDataPath.back() && '\\' != s_strDataPath.back())
+		s_strDataPath += "/";
+}
+
+std::string CGMTest::GetTempPath()
+{
+	std::error_code ec;
+	std::filesystem::path tempPath = std::filesystem::temp_directory_path(ec) / "GMTests";
+	std::filesystem::create_directories(tempPath, ec);
+	return tempPath.generic_string() + "/";
+}
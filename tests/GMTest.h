@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTest.h
+/// @brief		Galaxy-Music Engine - GMTest
+///				ģĵԪԺͻ׼ԣκβԿ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <string>
+#include <chrono>
+
+namespace GM
+{
+	/*************************************************************************
+	Macro Defines
+	*************************************************************************/
+
+	// һԪԣĬִ
+	#define GM_TEST(NAME) \
+		static void NAME(); \
+		static const GM::CGMTestRegistrar NAME##_Registrar(#NAME, &NAME, false); \
+		static void NAME()
+
+	// һ׼ԣָֻ -bench ʱִ
+	#define GM_BENCH(NAME) \
+		static void NAME(); \
+		static const GM::CGMTestRegistrar NAME##_Registrar(#NAME, &NAME, true); \
+		static void NAME()
+
+	// ʧʱӡʽļкţȻִ
+	#define GM_CHECK(EXPR) \
+		GM::CGMTest::Check(!!(EXPR), #EXPR, __FILE__, __LINE__)
+
+	// ĲľֵfEps
+	#define GM_CHECK_NEAR(A, B, EPS) \
+		GM::CGMTest::CheckNear(double(A), double(B), double(EPS), #A " ~ " #B, __FILE__, __LINE__)
+
+	/*************************************************************************
+	Class
+	*************************************************************************/
+
+	/*!
+	*  @class CGMTest
+	*  @brief Եעᡢִкͼ
+	*	ÿļGM_TESTGM_BENCHԣ̬עᣬmainаƹ˺ִ
+	*/
+	class CGMTest
+	{
+	public:
+		typedef void(*TestFunc)();
+
+		/**
+		* Register
+		* עһԣGM_TESTGM_BENCH
+		* @param strName:		
+		* @param func:			Ժ
+		* @param bBench:		Ƿǻ׼
+		*/
+		static void Register(const char* strName, TestFunc func, const bool bBench);
+
+		/**
+		* Run
+		* ִưstrFilterĲ
+		* @author LiuTao
+		* @since 2026.10.17
+		* @param strFilter:		ƹˣַʾȫ
+		* @param bBench:		trueִֻл׼ԣfalseִֻеԪ
+		* @return int:			ʧܵļ
+		*/
+		static int Run(const std::string& strFilter, const bool bBench);
+
+		/** @brief ʧʱӡ */
+		static bool Check(const bool bOK, const char* strExpr, const char* strFile, const int iLine);
+		/** @brief |fA - fB| <= fEps */
+		static bool CheckNear(const double fA, const double fB, const double fEps,
+			const char* strExpr, const char* strFile, const int iLine);
+
+		/** @brief ·tests/Data/'/'β */
+		static const std::string& GetDataPath();
+		static void SetDataPath(const std::string& strPath);
+
+		/**
+		* GetTempPath
+		* õʱļУÿԿнԼļ
+		* @return std::string:	'/'β·ļѾ
+		*/
+		static std::string GetTempPath();
+
+		/**
+		* Seconds
+		* ִһfuncغʱ
+		* @param func:			Ҫʱĺ
+		* @return double:		ʱλ
+		*/
+		template<typename Func>
+		static double Seconds(Func func)
+		{
+			const auto tStart = std::chrono::steady_clock::now();
+			func();
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+		}
+	};
+
+	/*!
+	*  @class CGMTestRegistrar
+	*  @brief ̬󣬹ʱע
+	*/
+	class CGMTestRegistrar
+	{
+	public:
+		CGMTestRegistrar(const char* strName, CGMTest::TestFunc func, const bool bBench)
+		{
+			CGMTest::Register(strName, func, bBench);
+		}
+	};
+}	// GM
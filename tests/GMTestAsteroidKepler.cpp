@@ -0,0 +1,448 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAsteroidKepler.cpp
+/// @brief		Galaxy-Music Engine - GMTestAsteroidKepler
+///				СǴģʽĲԣշ߾ȽеȽϣ
+///				ֵlong doubleĶȽϣյSun+ľǵֱֵȽ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMAsteroidKepler.h"
+#include <osg/Math>
+#include <random>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_TEST_AU				(1.495978707e11)				// ĵλλ
+#define GM_TEST_YEAR			(31558150.0)					// һ꣬λ
+#define GM_TEST_JUPITER_R		(GM_TEST_AU * 5.20)				// ľǹ뾶λ
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief գlong doubleţٷ⿪շ̣ٱ仯 */
+static long double _ReferenceKepler(const long double fMean, const long double fEcc)
+{
+	long double fE = (fEcc < 0.8L) ? fMean : ((fMean < 0) ? -3.14159265358979323846L : 3.14159265358979323846L);
+	for (int i = 0; i < 100; i++)
+	{
+		const long double fDelta = (fE - fEcc * std::sin(fE) - fMean) / (1 - fEcc * std::cos(fE));
+		fE -= fDelta;
+		if (std::fabs(fDelta) < 1e-18L) break;
+	}
+	return fE;
+}
+
+/**
+* СǴݣ2.1~3.3AUٶΪԲٶȵ0.85~1.15ƫת
+* @param iNum:			
+* @param iSeed:			
+* @param fGM:			̫GM
+* @return ݣ		RG = λãBA = ٶ
+*/
+static std::vector<float> _MakeBelt(const size_t iNum, const unsigned int iSeed, const double fGM)
+{
+	std::mt19937 rng(iSeed);
+	std::uniform_real_distribution<double> fRandom(0.0, 1.0);
+	std::vector<float> dataVector(4 * iNum);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		const double fR = GM_TEST_AU * (2.1 + 1.2 * fRandom(rng));
+		const double fAngle = fRandom(rng) * 2 * osg::PI;
+		const double fV = std::sqrt(fGM / fR) * (0.85 + 0.3 * fRandom(rng));
+		const double fTilt = (fRandom(rng) - 0.5) * 0.6;
+		dataVector[4 * i + 0] = float(fR * std::cos(fAngle));
+		dataVector[4 * i + 1] = float(fR * std::sin(fAngle));
+		dataVector[4 * i + 2] = float(-fV * std::sin(fAngle + fTilt));
+		dataVector[4 * i + 3] = float(fV * std::cos(fAngle + fTilt));
+	}
+	return dataVector;
+}
+
+/**
+* գlong doubleµĶ⣬ɳʼ״ֱ̬ƵfTimeʱ
+* @param pState:		ʼ״̬RG = λãBA = ٶ
+* @param fGM:			̫GM
+* @param fTime:			ʱ䣬λ
+* @param fOut:			λúٶ
+*/
+static void _ReferenceTwoBody(const float* pState, const long double fGM, const long double fTime, long double fOut[4])
+{
+	const long double fX = pState[0], fY = pState[1], fVX = pState[2], fVY = pState[3];
+	const long double fR = std::sqrt(fX * fX + fY * fY);
+	const long double fV2 = fVX * fVX + fVY * fVY;
+	const long double fH = fX * fVY - fY * fVX;
+	const long double fSign = (fH < 0) ? -1.0L : 1.0L;
+	const long double fA = -0.5L * fGM / (0.5L * fV2 - fGM / fR);
+	const long double fRV = fX * fVX + fY * fVY;
+	const long double fEccX = ((fV2 - fGM / fR) * fX - fRV * fVX) / fGM;
+	const long double fEccY = ((fV2 - fGM / fR) * fY - fRV * fVY) / fGM;
+	const long double fEcc = std::sqrt(fEccX * fEccX + fEccY * fEccY);
+	const long double fCosPeri = fEccX / fEcc;
+	const long double fSinPeri = fEccY / fEcc;
+	const long double fB = fSign * fA * std::sqrt(1 - fEcc * fEcc);
+	// ԪʱƫǺƽ
+	const long double fPX = fCosPeri * fX + fSinPeri * fY;
+	const long double fPY = -fSinPeri * fX + fCosPeri * fY;
+	const long double fE0 = std::atan2(fPY / fB * fA, fPX + fA * fEcc);
+	const long double fMeanMotion = std::sqrt(fGM / (fA * fA * fA));
+	long double fMean = std::fmod(fE0 - fEcc * std::sin(fE0) + fMeanMotion * fTime, 2 * 3.14159265358979323846L);
+	if (fMean > 3.14159265358979323846L) fMean -= 2 * 3.14159265358979323846L;
+	if (fMean < -3.14159265358979323846L) fMean += 2 * 3.14159265358979323846L;
+
+	const long double fE = _ReferenceKepler(fMean, fEcc);
+	const long double fCosE = std::cos(fE);
+	const long double fSinE = std::sin(fE);
+	const long double fEDot = fMeanMotion / (1 - fEcc * fCosE);
+	const long double fQX = fA * (fCosE - fEcc);
+	const long double fQY = fB * fSinE;
+	const long double fQVX = -fA * fSinE * fEDot;
+	const long double fQVY = fB * fCosE * fEDot;
+	fOut[0] = fCosPeri * fQX - fSinPeri * fQY;
+	fOut[1] = fSinPeri * fQX + fCosPeri * fQY;
+	fOut[2] = fCosPeri * fQVX - fSinPeri * fQVY;
+	fOut[3] = fSinPeri * fQVX + fCosPeri * fQVY;
+}
+
+/** @brief λúٶյ㾭ȣλ */
+static double _Perihelion(const double fX, const double fY, const double fVX, const double fVY, const double fGM)
+{
+	const double fR = std::sqrt(fX * fX + fY * fY);
+	const double fV2 = fVX * fVX + fVY * fVY;
+	const double fRV = fX * fVX + fY * fVY;
+	return std::atan2((fV2 - fGM / fR) * fY - fRV * fVY, (fV2 - fGM / fR) * fX - fRV * fVX);
+}
+
+/**
+* գSun + Բľǵ˫RK4֣ؽյ㾭ȵƽٶȣϣ
+* @param pState:		ʼ״̬
+* @param sParam:		飬õ̫ľǵGMԼľǹ뾶
+* @param fTotalTime:	ʱλ
+* @return double:		յٶȣλ/
+*/
+static double _ReferencePrecession(const float* pState, const SGMAsteroidParam& sParam, const double fTotalTime)
+{
+	const double fGMSun = sParam.vGravity.x();
+	const double fGMJupiter = sParam.vGravity.y();
+	const double fJupiterR = sParam.vJupiter.x();
+	const double fJupiterOmega = std::sqrt((fGMSun + fGMJupiter) / (fJupiterR * fJupiterR * fJupiterR));
+	auto fDerivative = [&](const double* pIn, const double fT, double* pOut)
+	{
+		const double fJX = fJupiterR * std::cos(fJupiterOmega * fT);
+		const double fJY = fJupiterR * std::sin(fJupiterOmega * fT);
+		const double fR2 = pIn[0] * pIn[0] + pIn[1] * pIn[1];
+		const double fR3 = fR2 * std::sqrt(fR2);
+		const double fDX = fJX - pIn[0];
+		const double fDY = fJY - pIn[1];
+		const double fD2 = fDX * fDX + fDY * fDY;
+		const double fD3 = fD2 * std::sqrt(fD2);
+		const double fJ3 = fJupiterR * fJupiterR * fJupiterR;
+		// ϵľǶ̫ļٶΪ
+		pOut[0] = pIn[2];
+		pOut[1] = pIn[3];
+		pOut[2] = -fGMSun * pIn[0] / fR3 + fGMJupiter * (fDX / fD3 - fJX / fJ3);
+		pOut[3] = -fGMSun * pIn[1] / fR3 + fGMJupiter * (fDY / fD3 - fJY / fJ3);
+	};
+
+	double vState[4] = { pState[0], pState[1], pState[2], pState[3] };
+	const double fStep = 2e5;
+	const long long iStepNum = (long long)(fTotalTime / fStep);
+	const int iSampleEvery = 20;
+	double fLastPeri = _Perihelion(vState[0], vState[1], vState[2], vState[3], fGMSun);
+	double fUnwrap = 0.0;
+	// С peri = k * t + c
+	double fSumT = 0.0, fSumP = 0.0, fSumTT = 0.0, fSumTP = 0.0;
+	int iSampleNum = 0;
+	for (long long k = 0; k <= iStepNum; k++)
+	{
+		const double fT = k * fStep;
+		if (0 == k % iSampleEvery)
+		{
+			const double fPeri = _Perihelion(vState[0], vState[1], vState[2], vState[3], fGMSun);
+			double fDelta = fPeri - fLastPeri;
+			if (fDelta > osg::PI) fDelta -= 2 * osg::PI;
+			if (fDelta < -osg::PI) fDelta += 2 * osg::PI;
+			fUnwrap += fDelta;
+			fLastPeri = fPeri;
+			fSumT += fT;
+			fSumP += fUnwrap;
+			fSumTT += fT * fT;
+			fSumTP += fT * fUnwrap;
+			iSampleNum++;
+		}
+		double vK1[4], vK2[4], vK3[4], vK4[4], vTemp[4];
+		fDerivative(vState, fT, vK1);
+		for (int c = 0; c < 4; c++) vTemp[c] = vState[c] + vK1[c] * fStep * 0.5;
+		fDerivative(vTemp, fT + fStep * 0.5, vK2);
+		for (int c = 0; c < 4; c++) vTemp[c] = vState[c] + vK2[c] * fStep * 0.5;
+		fDerivative(vTemp, fT + fStep * 0.5, vK3);
+		for (int c = 0; c < 4; c++) vTemp[c] = vState[c] + vK3[c] * fStep;
+		fDerivative(vTemp, fT + fStep, vK4);
+		for (int c = 0; c < 4; c++) vState[c] += fStep / 6 * (vK1[c] + 2 * vK2[c] + 2 * vK3[c] + vK4[c]);
+	}
+	return (iSampleNum * fSumTP - fSumT * fSumP) / (iSampleNum * fSumTT - fSumT * fSumT);
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AsteroidKepler_SolveKepler)
+{
+	// long doubleţٷȽϣe[0, GM_KEPLER_ECC_MAX]M[-PI, PI]
+	double fMaxError = 0.0;
+	for (int i = 0; i <= 90; i++)
+	{
+		const float fEcc = (std::min)(float(GM_KEPLER_ECC_MAX), i * 0.01f);
+		for (int j = -2000; j <= 2000; j++)
+		{
+			const float fMean = float(osg::PI) * j / 2000.0f;
+			const float fE = CGMAsteroidKepler::SolveKepler(fMean, fEcc);
+			const long double fRef = _ReferenceKepler(fMean, fEcc);
+			fMaxError = (std::max)(fMaxError, double(std::fabs(fE - fRef)));
+		}
+	}
+	printf("  SolveKepler, 364k cases: max |dE| %.2e rad\n", fMaxError);
+	GM_CHECK(fMaxError < 1e-6);
+
+	// Vallado, Fundamentals of Astrodynamics, 2-1M = 235.4, e = 0.4, E = 220.512074767522
+	const double fDegree = osg::PI / 180.0;
+	GM_CHECK_NEAR(220.512074767522 - 360.0, CGMAsteroidKepler::SolveKepler(float((235.4 - 360.0) * fDegree), 0.4f) / fDegree, 1e-4);
+	// Meeus, Astronomical Algorithms, 30.aM = 5, e = 0.1, E = 5.554589
+	GM_CHECK_NEAR(5.554589, CGMAsteroidKepler::SolveKepler(float(5.0 * fDegree), 0.1f) / fDegree, 1e-5);
+	// Բ߽
+	GM_CHECK(0.0f == CGMAsteroidKepler::SolveKepler(0.0f, 0.5f));
+	GM_CHECK_NEAR(0.7, CGMAsteroidKepler::SolveKepler(0.7f, 0.0f), 1e-7);
+	GM_CHECK_NEAR(osg::PI, CGMAsteroidKepler::SolveKepler(float(osg::PI), float(GM_KEPLER_ECC_MAX)), 1e-6);
+}
+
+GM_TEST(AsteroidKepler_AgainstTwoBody)
+{
+	// رճ㶯ʱǶ⣬long doubleĽȽϣԼΪfloat洢ļ
+	const size_t iNum = 4096;
+	SGMAsteroidParam sParam;
+	const double fGM = sParam.vGravity.x();
+	std::vector<float> stateVector = _MakeBelt(iNum, 1, fGM);
+	// еС
+	for (size_t i = 0; i < iNum; i += 9)
+	{
+		stateVector[4 * i + 2] = -stateVector[4 * i + 2];
+		stateVector[4 * i + 3] = -stateVector[4 * i + 3];
+	}
+
+	CGMAsteroidKepler kepler;
+	std::vector<float> outVector(4 * iNum);
+	GM_CHECK(!kepler.Evaluate(0.0, outVector.data()));
+	GM_CHECK(kepler.SetOrbits(stateVector.data(), iNum, sParam));
+	kepler.SetSecular(false);
+	GM_CHECK(iNum == kepler.GetNum());
+
+	for (const double fYear : { -57.0, 0.0, 311.0 })
+	{
+		GM_CHECK(kepler.Evaluate(fYear * GM_TEST_YEAR, outVector.data()));
+		std::vector<double> posVector(iNum), velVector(iNum);
+		for (size_t i = 0; i < iNum; i++)
+		{
+			long double vRef[4];
+			_ReferenceTwoBody(&stateVector[4 * i], fGM, fYear * GM_TEST_YEAR, vRef);
+			const long double fR = std::hypot(vRef[0], vRef[1]);
+			const long double fV = std::hypot(vRef[2], vRef[3]);
+			posVector[i] = double(std::hypot(outVector[4 * i] - vRef[0], outVector[4 * i + 1] - vRef[1]) / fR);
+			velVector[i] = double(std::hypot(outVector[4 * i + 2] - vRef[2], outVector[4 * i + 3] - vRef[3]) / fV);
+		}
+		std::sort(posVector.begin(), posVector.end());
+		std::sort(velVector.begin(), velVector.end());
+		printf("  %6.0f yr: |dr|/r median %.2e, max %.2e; |dv|/v median %.2e, max %.2e\n",
+			fYear, posVector[iNum / 2], posVector.back(), velVector[iNum / 2], velVector.back());
+		GM_CHECK(posVector[iNum / 2] < 3e-7);
+		GM_CHECK(posVector.back() < 2e-6);
+		GM_CHECK(velVector.back() < 2e-6);
+	}
+}
+
+GM_TEST(AsteroidKepler_PathsAndThreads)
+{
+	// 8ı·14̣߳㶯ʱλһ
+	const size_t iNum = 3 * GM_ASTEROID_BLOCK + 5;
+	SGMAsteroidParam sParam;
+	std::vector<float> stateVector = _MakeBelt(iNum, 2, sParam.vGravity.x());
+	CGMAsteroidKepler kepler_1(1);
+	CGMAsteroidKepler kepler_4(4);
+	GM_CHECK(kepler_1.GetSecular());
+	GM_CHECK(kepler_1.SetOrbits(stateVector.data(), iNum, sParam));
+	GM_CHECK(kepler_4.SetOrbits(stateVector.data(), iNum, sParam));
+
+	int iDiff = 0;
+	std::vector<float> refVector(4 * iNum), outVector(4 * iNum);
+	for (const double fTime : { -3.3e8, 0.0, 877.0, 1.7e9, 9.9e9 })
+	{
+		kepler_1.SetSIMD(0);
+		kepler_1.Evaluate(fTime, refVector.data());
+		for (int iLevel = 0; iLevel < 3; iLevel++)
+		{
+			for (CGMAsteroidKepler* pKepler : { &kepler_1, &kepler_4 })
+			{
+				pKepler->SetSIMD(iLevel);
+				std::fill(outVector.begin(), outVector.end(), -1.0f);
+				pKepler->Evaluate(fTime, outVector.data());
+				if (0 != std::memcmp(refVector.data(), outVector.data(), outVector.size() * sizeof(float))) iDiff++;
+			}
+		}
+	}
+	GM_CHECK(0 == iDiff);
+
+	// osg::ImageӿڣRGBA32Fͬ
+	osg::ref_ptr<osg::Image> pImage = new osg::Image();
+	float* pImageData = new float[4 * iNum];
+	std::memcpy(pImageData, stateVector.data(), 4 * iNum * sizeof(float));
+	pImage->setImage(int(iNum), 1, 1, GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)pImageData, osg::Image::USE_NEW_DELETE);
+	GM_CHECK(kepler_1.SetOrbits(pImage.get(), sParam));
+	GM_CHECK(kepler_1.Evaluate(1.7e9, pImage.get()));
+	kepler_4.Evaluate(1.7e9, outVector.data());
+	GM_CHECK(0 == std::memcmp(pImageData, outVector.data(), outVector.size() * sizeof(float)));
+	osg::ref_ptr<osg::Image> pSmallImage = new osg::Image();
+	pSmallImage->setImage(8, 1, 1, GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)(new float[32]), osg::Image::USE_NEW_DELETE);
+	GM_CHECK(!kepler_1.Evaluate(0.0, pSmallImage.get()));
+	GM_CHECK(!kepler_1.SetOrbits(nullptr, 0, sParam));
+}
+
+GM_TEST(AsteroidKepler_Fallbacks)
+{
+	// ݡ̫⡢NaN̫ϵСǻԲ֮뾶
+	SGMAsteroidParam sParam;
+	const double fGM = sParam.vGravity.x();
+	const float fR = float(2.5 * GM_TEST_AU);
+	const float fVCircle = float(std::sqrt(fGM / fR));
+	const float vState[6][4] = {
+		{ fR, 0.0f, 0.0f, 2.0f * fVCircle },		// 
+		{ 0.0f, fR, -0.2f * fVCircle, 0.0f },		// e = 0.96
+		{ NAN, 0.0f, 0.0f, fVCircle },				// 
+		{ 0.0f, 0.0f, 0.0f, 0.0f },					// ̫
+		{ fR, 0.0f, 0.0f, -fVCircle },				// еԲ
+		{ -fR, 0.0f, 0.0f, -1.1f * fVCircle },		// Բ
+	};
+	CGMAsteroidKepler kepler;
+	kepler.SetSecular(false);
+	GM_CHECK(kepler.SetOrbits(&vState[0][0], 6, sParam));
+	float vOut[6][4];
+	kepler.Evaluate(0.0, &vOut[0][0]);
+	// Ԫʱλò
+	for (const int i : { 0, 1, 4, 5 })
+	{
+		GM_CHECK(std::hypot(vOut[i][0] - vState[i][0], vOut[i][1] - vState[i][1]) / fR < 1e-6);
+	}
+	GM_CHECK_NEAR(1.0, std::hypot(vOut[2][0], vOut[2][1]) / sParam.vJupiter.x(), 1e-6);
+	GM_CHECK_NEAR(1.0, std::hypot(vOut[3][0], vOut[3][1]) / sParam.vJupiter.x(), 1e-6);
+
+	const float vRadius[5] = { fR, fR, sParam.vJupiter.x(), sParam.vJupiter.x(), fR };
+	double fLastAngle = std::atan2(vOut[4][1], vOut[4][0]);
+	int iWrong = 0;
+	for (int k = 1; k <= 20; k++)
+	{
+		kepler.Evaluate(k * 1e7, &vOut[0][0]);
+		for (int i = 0; i < 5; i++)
+		{
+			const double fRadius = std::hypot(vOut[i][0], vOut[i][1]);
+			const double fSpeed = std::hypot(vOut[i][2], vOut[i][3]);
+			if (std::fabs(fRadius / vRadius[i] - 1.0) > 1e-6) iWrong++;
+			if (std::fabs(fSpeed / std::sqrt(fGM / vRadius[i]) - 1.0) > 1e-6) iWrong++;
+		}
+		// й˳ʱ
+		const double fAngle = std::atan2(vOut[4][1], vOut[4][0]);
+		double fDelta = fAngle - fLastAngle;
+		if (fDelta > osg::PI) fDelta -= 2 * osg::PI;
+		if (fDelta < -osg::PI) fDelta += 2 * osg::PI;
+		if (!(fDelta < 0.0)) iWrong++;
+		if (!(vOut[4][0] * vOut[4][3] - vOut[4][1] * vOut[4][2] < 0.0f)) iWrong++;
+		fLastAngle = fAngle;
+	}
+	GM_CHECK(0 == iWrong);
+}
+
+GM_TEST(AsteroidKepler_Secular)
+{
+	// յٶSun + ľǵRK4֣6000꣬ϣȽ
+	SGMAsteroidParam sParam;
+	const double fGM = sParam.vGravity.x();
+	CGMAsteroidKepler kepler;
+	printf("  perihelion precession, Laplace-Lagrange / RK4 over 6000 yr:\n");
+	for (const double fAU : { 2.3, 2.65, 3.0 })
+	{
+		// 볤fAUƫ0.1ӽյ
+		const double fA = fAU * GM_TEST_AU;
+		const double fEcc = 0.1;
+		const double fR = fA * (1 - fEcc);
+		const double fV = std::sqrt(fGM / fA * (1 + fEcc) / (1 - fEcc));
+		const float vState[4] = { float(fR), 0.0f, 0.0f, float(fV) };
+		GM_CHECK(kepler.SetOrbits(vState, 1, sParam));
+
+		// ģʽĽʱ̵Ľյ㾭֮
+		const double fTime = 1000.0 * GM_TEST_YEAR;
+		float vStart[4], vEnd[4];
+		kepler.Evaluate(0.0, vStart);
+		kepler.Evaluate(fTime, vEnd);
+		double fDelta = _Perihelion(vEnd[0], vEnd[1], vEnd[2], vEnd[3], fGM) - _Perihelion(vStart[0], vStart[1], vStart[2], vStart[3], fGM);
+		while (fDelta < 0.0) fDelta += 2 * osg::PI;
+		const double fRate = fDelta / fTime;
+
+		const double fRefRate = _ReferencePrecession(vState, sParam, 6000.0 * GM_TEST_YEAR);
+		const double fYearPerArcsec = 180.0 * 3600.0 / osg::PI * GM_TEST_YEAR;
+		printf("    %.2f AU: %.1f\"/yr vs %.1f\"/yr, ratio %.3f\n", fAU, fRate * fYearPerArcsec, fRefRate * fYearPerArcsec, fRate / fRefRate);
+		// һ2:13.28AU
+		if (fAU < 2.5) GM_CHECK_NEAR(1.0, fRate / fRefRate, 0.03);
+		else GM_CHECK_NEAR(1.0, fRate / fRefRate, 0.2);
+	}
+
+	// رպ󲻽
+	kepler.SetSecular(false);
+	float vStart[4], vEnd[4];
+	kepler.Evaluate(0.0, vStart);
+	kepler.Evaluate(1000.0 * GM_TEST_YEAR, vEnd);
+	GM_CHECK_NEAR(0.0, _Perihelion(vEnd[0], vEnd[1], vEnd[2], vEnd[3], fGM) - _Perihelion(vStart[0], vStart[1], vStart[2], vStart[3], fGM), 1e-4);
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AsteroidKepler_Evaluate)
+{
+	// 512kСǣÿ·ֱ1̺߳ȫ߳
+	const size_t iNum = 512 * 1024;
+	SGMAsteroidParam sParam;
+	std::vector<float> stateVector = _MakeBelt(iNum, 3, sParam.vGravity.x());
+	std::vector<float> outVector(4 * iNum);
+	const char* vName[3] = { "scalar", "SSE", "AVX2" };
+	for (const unsigned int iThreads : { 1u, 0u })
+	{
+		CGMAsteroidKepler kepler(iThreads);
+		if (0 == iThreads && 1 == kepler.GetThreadNum()) continue;
+		const double fSetTime = CGMTest::Seconds([&]() { kepler.SetOrbits(stateVector.data(), iNum, sParam); });
+		printf("  %u thread(s): SetOrbits %.1f ms\n", kepler.GetThreadNum(), fSetTime * 1e3);
+		for (int iLevel = 0; iLevel < 3; iLevel++)
+		{
+			kepler.SetSIMD(iLevel);
+			if (kepler.GetSIMD() != iLevel) continue;
+			const int iFrameNum = 20;
+			const double fTime = CGMTest::Seconds([&]() {
+				for (int k = 0; k < iFrameNum; k++) kepler.Evaluate(k * 1e6, outVector.data());
+			});
+			printf("    %-6s %6.1f M evaluations/s, %.2f ms per frame\n",
+				vName[iLevel], iFrameNum * double(iNum) / fTime * 1e-6, fTime / iFrameNum * 1e3);
+		}
+	}
+}
@@ -0,0 +1,588 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAsteroidSolver.cpp
+/// @brief		Galaxy-Music Engine - GMTestAsteroidSolver
+///				СǴCPUĲԣSIMD·Ͳͬ߳λһ£
+///				롰AsteroidData.comp䷭һ£ʱĹƯ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMAsteroidSolver.h"
+#include <osg/Math>
+#include <random>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_TEST_AU				(1.495978707e11)				// ĵλλ
+#define GM_TEST_YEAR			(31558150.0)					// һ꣬λ
+#define GM_TEST_JUPITER_R		(GM_TEST_AU * 5.20)				// ľǹ뾶λ
+#define GM_TEST_JUPITER_OMEGA	(2 * osg::PI / (11.86 * GM_TEST_YEAR))	// ľǹתٶȣλ/
+#define GM_TEST_FRAME_STEP		(877.0f)						// 60֡/ʱÿ֡ķ沽λ
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* СǴݣһ2.1~5.2AU֮һľǹϣٶΪԲٶȵ0.9~1.1
+* @param iNum:			
+* @param iSeed:			
+* @return ݣ		RGBA32FRG = λãBA = ٶ
+*/
+static std::vector<float> _MakeBelt(const size_t iNum, const unsigned int iSeed)
+{
+	std::mt19937 rng(iSeed);
+	std::uniform_int_distribution<> iPseudoNoise(0, 1000000);
+	const double fGM = double(SGMAsteroidParam().vGravity.x());
+	std::vector<float> dataVector(4 * iNum);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		const double fR = (i % 2) ? GM_TEST_JUPITER_R : GM_TEST_AU * (2.1 + 3.1 * iPseudoNoise(rng) * 1e-6);
+		const double fAngle = iPseudoNoise(rng) * 1e-6 * osg::PI * 2;
+		const double fV = std::sqrt(fGM / fR) * (0.9 + 0.2 * iPseudoNoise(rng) * 1e-6);
+		dataVector[4 * i + 0] = float(fR * std::cos(fAngle));
+		dataVector[4 * i + 1] = float(fR * std::sin(fAngle));
+		dataVector[4 * i + 2] = float(-fV * std::sin(fAngle));
+		dataVector[4 * i + 3] = float(fV * std::cos(fAngle));
+	}
+	return dataVector;
+}
+
+/** @brief СǵıȻеܣֻ̫double */
+static double _Energy(const float* pPixel, const double fGM)
+{
+	const double fX = pPixel[0];
+	const double fY = pPixel[1];
+	const double fVX = pPixel[2];
+	const double fVY = pPixel[3];
+	return 0.5 * (fVX * fVX + fVY * fVY) - fGM / std::sqrt(fX * fX + fY * fY);
+}
+
+/**
+* գAsteroidData.comp䷭룬GLSLʵnormalizestepmixmat2
+* @param pLast, pTarget:	һһݣͬһڴ
+* @param iWidth, iHeight:	ͼĳߴ
+* @param sParam:			飬asteroidParam[3]
+*/
+static void _ShaderReference(const float* pLast, float* pTarget, const unsigned int iWidth, const unsigned int iHeight,
+	const SGMAsteroidParam& sParam)
+{
+	const float M_PI_GLSL = 3.141592657f;
+	auto fract = [](const float x) { return x - std::floor(x); };
+	auto Random = [&](const float fX, const float fY) { return fract(std::sin(fX * 12.9898f + fY * 78.233f) * 43758.5453123f); };
+	auto step = [](const float fEdge, const float x) { return (x < fEdge) ? 0.0f : 1.0f; };
+
+	for (unsigned int y = 0; y < iHeight; y++)
+	{
+		for (unsigned int x = 0; x < iWidth; x++)
+		{
+			const float* pData = pLast + 4 * (size_t(y) * iWidth + x);
+			float fPX = pData[0], fPY = pData[1], fVX = pData[2], fVY = pData[3];
+
+			const int subStepNum = int(sParam.vStep.y());
+			const float subStep = sParam.vStep.z();
+			const float halfStep = subStep * 0.5f;
+			const float jupiterR = sParam.vJupiter.x();
+			const float jupiterAngle = sParam.vJupiter.y();
+			const float jupiterOmega = sParam.vJupiter.z();
+			const float gmSun = sParam.vGravity.x();
+			const float gmJupiter = sParam.vGravity.y();
+			const float magicNum = 1;
+
+			for (int i = 0; i < subStepNum; i++)
+			{
+				fPX += fVX * halfStep;
+				fPY += fVY * halfStep;
+
+				const float angle = jupiterAngle + jupiterOmega * ((float(i) + 0.5f) * subStep);
+				const float fJX = jupiterR * std::cos(angle);
+				const float fJY = jupiterR * std::sin(angle);
+				const float fLen = std::sqrt(fPX * fPX + fPY * fPY);
+				const float fOutX = fPX / fLen, fOutY = fPY / fLen;
+				const float fA2JX = fJX - fPX, fA2JY = fJY - fPY;
+				const float fLenJ = std::sqrt(fA2JX * fA2JX + fA2JY * fA2JY);
+				const float fDirJX = fA2JX / fLenJ, fDirJY = fA2JY / fLenJ;
+				const float disS2A2 = fPX * fPX + fPY * fPY;
+				const float disJ2A2 = fA2JX * fA2JX + fA2JY * fA2JY;
+
+				const float gravitySun = magicNum * gmSun / disS2A2;
+				const float gravityJupiter = gmJupiter / disJ2A2;
+				const float fFieldX = -fOutX * gravitySun + fDirJX * gravityJupiter;
+				const float fFieldY = -fOutY * gravitySun + fDirJY * gravityJupiter;
+
+				fVX += fFieldX * subStep;
+				fVY += fFieldY * subStep;
+				fPX += fVX * halfStep;
+				fPY += fVY * halfStep;
+			}
+
+			const float endAngle = jupiterAngle + jupiterOmega * sParam.vStep.x();
+			const float fJX = jupiterR * std::cos(endAngle);
+			const float fJY = jupiterR * std::sin(endAngle);
+			const float fFrontX = -std::sin(endAngle);
+			const float fFrontY = std::cos(endAngle);
+			const float newAsteroid2Sun = std::sqrt(fPX * fPX + fPY * fPY);
+			const float isTooFar = step(sParam.vGravity.z(), newAsteroid2Sun);
+			const float isTooNear = 1 - step(sParam.vGravity.w(), newAsteroid2Sun);
+			const float isDead = (std::max)(isTooFar, isTooNear);
+			const unsigned int iLocal = x % GM_ASTEROID_GROUP;
+			const float noise_0 = std::sin(Random(fPX, fPY) + float(iLocal));
+			const float noise_1 = std::sin(Random(fVX, fVY) + 2.03f * float(iLocal));
+
+			const float cosTheta = std::cos(noise_0 * M_PI_GLSL);
+			const float sinTheta = std::sin(noise_0 * M_PI_GLSL);
+			// mat2й죺һ(cos, -sin)ڶ(sin, cos)
+			const float fRotJX = cosTheta * fJX + sinTheta * fJY;
+			const float fRotJY = -sinTheta * fJX + cosTheta * fJY;
+			const float fRotFX = cosTheta * fFrontX + sinTheta * fFrontY;
+			const float fRotFY = -sinTheta * fFrontX + cosTheta * fFrontY;
+			const float fScale = -(0.7f + 0.2f * noise_1);
+
+			// mix(a, b, 1)GPUϵbmix(a, b, 0)aaΪNaNʱΪNaN
+			float* pOut = pTarget + 4 * (size_t(y) * iWidth + x);
+			pOut[0] = (isDead > 0.5f) ? fScale * fRotJX : fPX;
+			pOut[1] = (isDead > 0.5f) ? fScale * fRotJY : fPY;
+			pOut[2] = (isDead > 0.5f) ? -16000.0f * fRotFX : fVX;
+			pOut[3] = (isDead > 0.5f) ? -16000.0f * fRotFY : fVY;
+		}
+	}
+}
+
+/** @brief ˫ȵС״̬ڲս */
+struct SGMTestOrbit
+{
+	double fX, fY, fVX, fVY;
+};
+
+/** @brief ̫ľǵٶȣľԲϣdouble */
+static SGMTestOrbit _Derivative(const SGMTestOrbit& sOrbit, const double fTime, const SGMAsteroidParam& sParam)
+{
+	const double fGMSun = sParam.vGravity.x();
+	const double fGMJupiter = sParam.vGravity.y();
+	const double fJX = GM_TEST_JUPITER_R * std::cos(GM_TEST_JUPITER_OMEGA * fTime);
+	const double fJY = GM_TEST_JUPITER_R * std::sin(GM_TEST_JUPITER_OMEGA * fTime);
+	const double fDisS2A2 = sOrbit.fX * sOrbit.fX + sOrbit.fY * sOrbit.fY;
+	const double fDisS2A = std::sqrt(fDisS2A2);
+	const double fA2JX = fJX - sOrbit.fX;
+	const double fA2JY = fJY - sOrbit.fY;
+	const double fDisJ2A2 = fA2JX * fA2JX + fA2JY * fA2JY;
+	const double fDisJ2A = std::sqrt(fDisJ2A2);
+	SGMTestOrbit sOut;
+	sOut.fX = sOrbit.fVX;
+	sOut.fY = sOrbit.fVY;
+	sOut.fVX = -(sOrbit.fX / fDisS2A) * fGMSun / fDisS2A2 + (fA2JX / fDisJ2A) * fGMJupiter / fDisJ2A2;
+	sOut.fVY = -(sOrbit.fY / fDisS2A) * fGMSun / fDisS2A2 + (fA2JY / fDisJ2A) * fGMJupiter / fDisJ2A2;
+	return sOut;
+}
+
+/**
+* ս⣺˫ȵĽ-СԶСڱĻ
+* @param sOrbit:		С״̬ᱻд
+* @param fTime:			ʱλ
+* @param fStep:			λ
+* @param sParam:		飬ֻõ
+*/
+static void _ReferenceRK4(SGMTestOrbit& sOrbit, const double fTime, const double fStep, const SGMAsteroidParam& sParam)
+{
+	auto fAdd = [](const SGMTestOrbit& sA, const SGMTestOrbit& sB, const double fK)
+	{
+		return SGMTestOrbit{ sA.fX + sB.fX * fK, sA.fY + sB.fY * fK, sA.fVX + sB.fVX * fK, sA.fVY + sB.fVY * fK };
+	};
+	const long long iStepNum = (long long)(fTime / fStep + 0.5);
+	for (long long k = 0; k < iStepNum; k++)
+	{
+		const double fT = k * fStep;
+		const SGMTestOrbit sK1 = _Derivative(sOrbit, fT, sParam);
+		const SGMTestOrbit sK2 = _Derivative(fAdd(sOrbit, sK1, fStep * 0.5), fT + fStep * 0.5, sParam);
+		const SGMTestOrbit sK3 = _Derivative(fAdd(sOrbit, sK2, fStep * 0.5), fT + fStep * 0.5, sParam);
+		const SGMTestOrbit sK4 = _Derivative(fAdd(sOrbit, sK3, fStep), fT + fStep, sParam);
+		sOrbit.fX += fStep / 6 * (sK1.fX + 2 * sK2.fX + 2 * sK3.fX + sK4.fX);
+		sOrbit.fY += fStep / 6 * (sK1.fY + 2 * sK2.fY + 2 * sK3.fY + sK4.fY);
+		sOrbit.fVX += fStep / 6 * (sK1.fVX + 2 * sK2.fVX + 2 * sK3.fVX + sK4.fVX);
+		sOrbit.fVY += fStep / 6 * (sK1.fVY + 2 * sK2.fVY + 2 * sK3.fVY + sK4.fVY);
+	}
+}
+
+/**
+* գԭAsteroidData.compеʽŷÿ֡8Ӳľǹ̶һ֡ʱλ
+* @param pData:			Сݣᱻд
+* @param iNum:			С
+* @param fStepTime:		λ
+* @param fJupiterAngle:	һʱľǵǣλ
+* @param sParam:		飬ֻõ
+*/
+static void _LegacyEuler(float* pData, const size_t iNum, const float fStepTime, const double fJupiterAngle,
+	const SGMAsteroidParam& sParam)
+{
+	const float fJX = float(GM_TEST_JUPITER_R * std::cos(fJupiterAngle));
+	const float fJY = float(GM_TEST_JUPITER_R * std::sin(fJupiterAngle));
+	const float fGMSun = sParam.vGravity.x();
+	const float fGMJupiter = sParam.vGravity.y();
+	const float fSubStep = fStepTime / 8.0f;
+	for (size_t i = 0; i < iNum; i++)
+	{
+		float* pPixel = pData + 4 * i;
+		for (int k = 0; k < 8; k++)
+		{
+			const float fDisS2A2 = pPixel[0] * pPixel[0] + pPixel[1] * pPixel[1];
+			const float fDisS2A = std::sqrt(fDisS2A2);
+			const float fA2JX = fJX - pPixel[0];
+			const float fA2JY = fJY - pPixel[1];
+			const float fDisJ2A2 = fA2JX * fA2JX + fA2JY * fA2JY;
+			const float fDisJ2A = std::sqrt(fDisJ2A2);
+			const float fAX = -(pPixel[0] / fDisS2A) * fGMSun / fDisS2A2 + (fA2JX / fDisJ2A) * fGMJupiter / fDisJ2A2;
+			const float fAY = -(pPixel[1] / fDisS2A) * fGMSun / fDisS2A2 + (fA2JY / fDisJ2A) * fGMJupiter / fDisJ2A2;
+			pPixel[0] += pPixel[2] * fSubStep;
+			pPixel[1] += pPixel[3] * fSubStep;
+			pPixel[2] += fAX * fSubStep;
+			pPixel[3] += fAY * fSubStep;
+		}
+	}
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AsteroidSolver_PathsAndThreads)
+{
+	const unsigned int iWidth = 2816;
+	const unsigned int iHeight = 3;
+	const size_t iNum = size_t(iWidth) * iHeight;
+	std::vector<float> startVector = _MakeBelt(iNum, 1);
+	// һʼ̫̫ԶNaNСǣ֤ÿ·϶ᷢ
+	for (size_t i = 0; i < iNum; i += 97)
+	{
+		startVector[4 * i + 0] = (i % 3) ? 1e10f : ((i % 2) ? 2e12f : NAN);
+	}
+
+	CGMAsteroidSolver solver_1(1);
+	CGMAsteroidSolver solver_4(4);
+	GM_CHECK(1 == solver_1.GetThreadNum());
+	GM_CHECK(4 == solver_4.GetThreadNum());
+
+	// 0~2߳ԭ㣻3~54̣߳ڴ潻
+	std::vector<float> dataVector[6];
+	for (auto& itr : dataVector) itr = startVector;
+	std::vector<float> pingVector(startVector.size());
+	int iReborn = 0;
+	SGMAsteroidParam sParam;
+	double fAngle = 0.0;
+	for (int k = 0; k < 300; k++)
+	{
+		// 1~5Ӳ֮仯ľǼӿ400Ӵ
+		const float fStepTime = GM_TEST_FRAME_STEP * float(1 + (k % 7) * 80);
+		const double fOmega = GM_TEST_JUPITER_OMEGA * 400;
+		sParam.SetStep(fStepTime, GM_TEST_JUPITER_R, fAngle, fOmega);
+		fAngle = std::fmod(fAngle + fOmega * fStepTime, 2 * osg::PI);
+
+		const std::vector<float> lastVector = dataVector[0];
+		for (int iLevel = 0; iLevel < 3; iLevel++)
+		{
+			solver_1.SetSIMD(iLevel);
+			GM_CHECK(solver_1.Step(dataVector[iLevel].data(), dataVector[iLevel].data(), iWidth, iHeight, sParam));
+			solver_4.SetSIMD(iLevel);
+			GM_CHECK(solver_4.Step(dataVector[3 + iLevel].data(), pingVector.data(), iWidth, iHeight, sParam));
+			dataVector[3 + iLevel].swap(pingVector);
+		}
+		for (size_t i = 0; i < iNum; i++)
+		{
+			const float fDX = dataVector[0][4 * i] - lastVector[4 * i];
+			const float fDY = dataVector[0][4 * i + 1] - lastVector[4 * i + 1];
+			if (!(fDX * fDX + fDY * fDY < 1e22f)) iReborn++;
+		}
+	}
+
+	int iDiff = 0;
+	for (int i = 1; i < 6; i++)
+	{
+		if (0 != std::memcmp(dataVector[0].data(), dataVector[i].data(), dataVector[0].size() * sizeof(float))) iDiff++;
+	}
+	GM_CHECK(0 == iDiff);
+	GM_CHECK(iReborn > 100);
+
+	// ȱǹȵıosg::ImageRGBA32F
+	GM_CHECK(!solver_1.Step(startVector.data(), pingVector.data(), 100, 1, sParam));
+	GM_CHECK(!solver_1.Step(nullptr, pingVector.data(), iWidth, 1, sParam));
+	osg::ref_ptr<osg::Image> pImage = new osg::Image();
+	float* pImageData = new float[iWidth * 4];
+	std::memcpy(pImageData, startVector.data(), iWidth * 4 * sizeof(float));
+	pImage->setImage(iWidth, 1, 1, GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)pImageData, osg::Image::USE_NEW_DELETE);
+	GM_CHECK(solver_1.Step(pImage.get(), pImage.get(), sParam));
+	GM_CHECK(solver_4.Step(startVector.data(), pingVector.data(), iWidth, 1, sParam));
+	GM_CHECK(0 == std::memcmp(pImageData, pingVector.data(), iWidth * 4 * sizeof(float)));
+	osg::ref_ptr<osg::Image> pByteImage = new osg::Image();
+	pByteImage->setImage(iWidth, 1, 1, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, new unsigned char[iWidth * 4], osg::Image::USE_NEW_DELETE);
+	GM_CHECK(!solver_1.Step(pByteImage.get(), pByteImage.get(), sParam));
+}
+
+GM_TEST(AsteroidSolver_ShaderReference)
+{
+	// ÿһͬһݳȽshader䷭Ľ
+	const unsigned int iWidth = 4096;
+	const unsigned int iHeight = 2;
+	const size_t iNum = size_t(iWidth) * iHeight;
+	std::vector<float> dataVector = _MakeBelt(iNum, 2);
+	std::vector<float> solverVector(dataVector.size());
+	std::vector<float> shaderVector(dataVector.size());
+	CGMAsteroidSolver solver;
+	SGMAsteroidParam sParam;
+	size_t iDiff = 0;
+	double fAngle = 1.0;
+	for (int k = 0; k < 200; k++)
+	{
+		const float fStepTime = GM_TEST_FRAME_STEP * float(1 + (k % 5) * 150);
+		const double fOmega = GM_TEST_JUPITER_OMEGA * 400;
+		sParam.SetStep(fStepTime, GM_TEST_JUPITER_R, fAngle, fOmega);
+		fAngle = std::fmod(fAngle + fOmega * fStepTime, 2 * osg::PI);
+
+		solver.Step(dataVector.data(), solverVector.data(), iWidth, iHeight, sParam);
+		_ShaderReference(dataVector.data(), shaderVector.data(), iWidth, iHeight, sParam);
+		for (size_t i = 0; i < iNum; i++)
+		{
+			if (0 != std::memcmp(&solverVector[4 * i], &shaderVector[4 * i], 4 * sizeof(float))) iDiff++;
+		}
+		dataVector.swap(solverVector);
+	}
+	GM_CHECK(0 == iDiff);
+}
+
+GM_TEST(AsteroidSolver_EnergyDrift)
+{
+	// ֻ̫ʱȻеӦغ㣻н磬ʱ
+	const unsigned int iWidth = 8192;
+	const size_t iNum = iWidth;
+	std::vector<float> dataVector = _MakeBelt(iNum, 3);
+	SGMAsteroidParam sParam;
+	sParam.vGravity = osg::Vec4f(sParam.vGravity.x(), 0.0f, sParam.vGravity.z(), sParam.vGravity.w());
+	const double fGM = double(sParam.vGravity.x());
+	std::vector<double> startVector(iNum);
+	// Զյ㳬СǻᱻŻСǴͳ
+	std::vector<bool> keepVector(iNum);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		const float* pPixel = &dataVector[4 * i];
+		startVector[i] = _Energy(pPixel, fGM);
+		const double fA = -fGM / (2 * startVector[i]);
+		const double fH = double(pPixel[0]) * pPixel[3] - double(pPixel[1]) * pPixel[2];
+		const double fE = std::sqrt((std::max)(0.0, 1 - fH * fH / (fGM * fA)));
+		keepVector[i] = (fA * (1 + fE) < 0.99 * sParam.vGravity.z()) && (fA * (1 - fE) > 1.01 * sParam.vGravity.w());
+	}
+
+	// |dE/E|λֵ
+	auto fDrift = [&](double& fMax)
+	{
+		std::vector<double> driftVector;
+		for (size_t i = 0; i < iNum; i++)
+		{
+			if (!keepVector[i]) continue;
+			driftVector.push_back(std::fabs((_Energy(&dataVector[4 * i], fGM) - startVector[i]) / startVector[i]));
+		}
+		std::sort(driftVector.begin(), driftVector.end());
+		fMax = driftVector.back();
+		return driftVector[driftVector.size() / 2];
+	};
+
+	CGMAsteroidSolver solver;
+	double fMax = 0.0;
+	printf("  energy drift, Sun only:\n");
+
+	// ÿ֡ĲԼ1.1
+	sParam.SetStep(GM_TEST_FRAME_STEP, GM_TEST_JUPITER_R, 0.0, 0.0);
+	double fMedianEarly = 0.0, fMedianLate = 0.0;
+	int iStep = 0;
+	for (const int iTotal : { 4000, 40000 })
+	{
+		for (; iStep < iTotal; iStep++) solver.Step(dataVector.data(), dataVector.data(), iWidth, 1, sParam);
+		const double fMedian = fDrift(fMax);
+		printf("    %6d frames of %.0f s (%5.2f yr): median %.2e, max %.2e\n",
+			iTotal, GM_TEST_FRAME_STEP, iTotal * GM_TEST_FRAME_STEP / GM_TEST_YEAR, fMedian, fMax);
+		((4000 == iTotal) ? fMedianEarly : fMedianLate) = fMedian;
+	}
+	GM_CHECK(fMedianLate < 1e-4);
+	GM_CHECK(fMax < 1e-3);
+	GM_CHECK(fMedianLate < 4 * fMedianEarly + 1e-6);
+
+	// ʱӲԼ300
+	sParam.SetStep(GM_ASTEROID_SUBSTEP_MAX, GM_TEST_JUPITER_R, 0.0, 0.0);
+	GM_CHECK(1 == int(sParam.vStep.y()));
+	iStep = 0;
+	for (const int iTotal : { 10000, 100000 })
+	{
+		for (; iStep < iTotal; iStep++) solver.Step(dataVector.data(), dataVector.data(), iWidth, 1, sParam);
+		const double fMedian = fDrift(fMax);
+		printf("    %6d steps of %.0f s (%5.1f yr): median %.2e, max %.2e\n",
+			iTotal, GM_ASTEROID_SUBSTEP_MAX, iTotal * GM_ASTEROID_SUBSTEP_MAX / GM_TEST_YEAR, fMedian, fMax);
+		((10000 == iTotal) ? fMedianEarly : fMedianLate) = fMedian;
+	}
+	GM_CHECK(fMedianLate < 1e-4);
+	GM_CHECK(fMax < 1e-3);
+	GM_CHECK(fMedianLate < 4 * fMedianEarly + 1e-6);
+}
+
+GM_TEST(AsteroidParam_SetStep)
+{
+	// Ӳ = ceil( / Ӳ)1~GM_ASTEROID_SUBSTEP_NUM_MAX
+	SGMAsteroidParam sParam;
+	const float vStepTime[6] = { 0.0f, GM_TEST_FRAME_STEP, GM_ASTEROID_SUBSTEP_MAX, GM_ASTEROID_SUBSTEP_MAX * 1.5f, 6.4e6f, 1e8f };
+	const int vSubStepNum[6] = { 1, 1, 1, 2, 64, 64 };
+	for (int i = 0; i < 6; i++)
+	{
+		sParam.SetStep(vStepTime[i], GM_TEST_JUPITER_R, 1.5, GM_TEST_JUPITER_OMEGA);
+		GM_CHECK(vStepTime[i] == sParam.vStep.x());
+		GM_CHECK(vSubStepNum[i] == int(sParam.vStep.y()));
+		GM_CHECK(vStepTime[i] / float(vSubStepNum[i]) == sParam.vStep.z());
+	}
+	GM_CHECK(float(GM_TEST_JUPITER_R) == sParam.vJupiter.x());
+	GM_CHECK(1.5f == sParam.vJupiter.y());
+	GM_CHECK(float(GM_TEST_JUPITER_OMEGA) == sParam.vJupiter.z());
+}
+
+GM_TEST(AsteroidSolver_AgainstRK4)
+{
+	// ľ㶯2꣬˫RK44֡λλAU
+	const unsigned int iWidth = GM_ASTEROID_GROUP;
+	const size_t iNum = iWidth;
+	const double fTotalTime = GM_TEST_FRAME_STEP * 72000.0;
+	SGMAsteroidParam sParam;
+	std::vector<float> startVector(4 * iNum);
+	{
+		std::mt19937 rng(5);
+		std::uniform_real_distribution<double> fRandom(0.0, 1.0);
+		for (size_t i = 0; i < iNum; i++)
+		{
+			const double fR = GM_TEST_AU * (2.1 + 1.2 * fRandom(rng));
+			const double fAngle = fRandom(rng) * 2 * osg::PI;
+			const double fV = std::sqrt(double(sParam.vGravity.x()) / fR) * (0.95 + 0.1 * fRandom(rng));
+			startVector[4 * i + 0] = float(fR * std::cos(fAngle));
+			startVector[4 * i + 1] = float(fR * std::sin(fAngle));
+			startVector[4 * i + 2] = float(-fV * std::sin(fAngle));
+			startVector[4 * i + 3] = float(fV * std::cos(fAngle));
+		}
+	}
+	std::vector<SGMTestOrbit> refVector(iNum);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		refVector[i] = SGMTestOrbit{ startVector[4 * i], startVector[4 * i + 1], startVector[4 * i + 2], startVector[4 * i + 3] };
+		_ReferenceRK4(refVector[i], fTotalTime, GM_TEST_FRAME_STEP * 4, sParam);
+	}
+
+	// λλ
+	auto fError = [&](const std::vector<float>& dataVector)
+	{
+		std::vector<double> errorVector(iNum);
+		for (size_t i = 0; i < iNum; i++)
+		{
+			errorVector[i] = std::hypot(dataVector[4 * i] - refVector[i].fX, dataVector[4 * i + 1] - refVector[i].fY) / GM_TEST_AU;
+		}
+		std::sort(errorVector.begin(), errorVector.end());
+		return errorVector[iNum / 2];
+	};
+
+	// ԭÿ֡8Ӳŷ
+	std::vector<float> eulerVector = startVector;
+	const long long iFrameNum = (long long)(fTotalTime / GM_TEST_FRAME_STEP + 0.5);
+	for (long long k = 0; k < iFrameNum; k++)
+	{
+		const double fEndAngle = std::fmod(GM_TEST_JUPITER_OMEGA * GM_TEST_FRAME_STEP * (k + 1), 2 * osg::PI);
+		_LegacyEuler(eulerVector.data(), iNum, GM_TEST_FRAME_STEP, fEndAngle, sParam);
+	}
+	const double fEulerError = fError(eulerVector);
+	printf("  median position error after 2 yr, against RK4 at 3508 s:\n");
+	printf("    Euler, 8 substeps per 877 s frame: %.2e AU\n", fEulerError);
+
+	// ÿ֡һԼ96480Ŀ
+	CGMAsteroidSolver solver;
+	double vErrorDKD[3] = { 0.0, 0.0, 0.0 };
+	const float vStepTime[3] = { GM_TEST_FRAME_STEP, GM_TEST_FRAME_STEP * 96, GM_TEST_FRAME_STEP * 480 };
+	for (int s = 0; s < 3; s++)
+	{
+		std::vector<float> dataVector = startVector;
+		const long long iStepNum = (long long)(fTotalTime / vStepTime[s] + 0.5);
+		for (long long k = 0; k < iStepNum; k++)
+		{
+			const double fAngle = std::fmod(GM_TEST_JUPITER_OMEGA * vStepTime[s] * k, 2 * osg::PI);
+			sParam.SetStep(vStepTime[s], GM_TEST_JUPITER_R, fAngle, GM_TEST_JUPITER_OMEGA);
+			solver.Step(dataVector.data(), dataVector.data(), iWidth, 1, sParam);
+		}
+		vErrorDKD[s] = fError(dataVector);
+		printf("    DKD, %6.0f s steps x %d substeps: %.2e AU\n", vStepTime[s], int(sParam.vStep.y()), vErrorDKD[s]);
+	}
+
+	// ͬĲȸߵö࣬Ӵ480Աԭŷ׼ȷ
+	GM_CHECK(vErrorDKD[0] * 10 < fEulerError);
+	GM_CHECK(vErrorDKD[2] < fEulerError);
+	GM_CHECK(vErrorDKD[2] < 1e-4);
+	// ľÿӲе㣬ԷֳɶӲĴ󲽳뵥Ӳľ൱
+	GM_CHECK(vErrorDKD[2] < 1.2 * vErrorDKD[1]);
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AsteroidSolver_Steps)
+{
+	// 16k512kСǣÿ֡һÿ·ֱ1̺߳ȫ߳
+	const unsigned int iWidth = 8192;
+	SGMAsteroidParam sParam;
+	sParam.SetStep(GM_TEST_FRAME_STEP, GM_TEST_JUPITER_R, 0.0, GM_TEST_JUPITER_OMEGA);
+	const char* vName[3] = { "scalar", "SSE", "AVX2" };
+	for (const unsigned int iHeight : { 2u, 64u })
+	{
+		const size_t iNum = size_t(iWidth) * iHeight;
+		std::vector<float> dataVector = _MakeBelt(iNum, 4);
+		const int iStepNum = (2 == iHeight) ? 2000 : 100;
+		for (const unsigned int iThreads : { 1u, 0u })
+		{
+			CGMAsteroidSolver solver(iThreads);
+			// ֻһӲ߳ʱظ
+			if (0 == iThreads && 1 == solver.GetThreadNum()) continue;
+			for (int iLevel = 0; iLevel < 3; iLevel++)
+			{
+				solver.SetSIMD(iLevel);
+				if (solver.GetSIMD() != iLevel) continue;
+				const double fTime = CGMTest::Seconds([&]() {
+					for (int k = 0; k < iStepNum; k++) solver.Step(dataVector.data(), dataVector.data(), iWidth, iHeight, sParam);
+				});
+				printf("  %6zu asteroids, %-6s, %2u thread(s): %8.1f steps/s, %6.1f M asteroid-steps/s\n",
+					iNum, vName[iLevel], solver.GetThreadNum(), iStepNum / fTime, iStepNum * double(iNum) / fTime * 1e-6);
+			}
+		}
+	}
+}
+
+GM_BENCH(AsteroidSolver_CostPerYear)
+{
+	// 16kСǣֲÿһĺʱ
+	const unsigned int iWidth = 8192;
+	const unsigned int iHeight = 2;
+	const size_t iNum = size_t(iWidth) * iHeight;
+	std::vector<float> dataVector = _MakeBelt(iNum, 6);
+	CGMAsteroidSolver solver;
+	SGMAsteroidParam sParam;
+	for (const float fStepTime : { GM_TEST_FRAME_STEP, 1e5f, 4.2096e5f, 1.6e6f, 6.4e6f })
+	{
+		sParam.SetStep(fStepTime, GM_TEST_JUPITER_R, 0.0, GM_TEST_JUPITER_OMEGA);
+		const int iStepNum = (std::max)(20, int(0.2 * GM_TEST_YEAR / fStepTime));
+		const double fTime = CGMTest::Seconds([&]() {
+			for (int k = 0; k < iStepNum; k++) solver.Step(dataVector.data(), dataVector.data(), iWidth, iHeight, sParam);
+		});
+		const double fYears = iStepNum * double(fStepTime) / GM_TEST_YEAR;
+		printf("  %5zu asteroids, %9.0f s steps x %2d substeps: %8.2f ms per simulated year, %7.1f years/s\n",
+			iNum, fStepTime, int(sParam.vStep.y()), fTime / fYears * 1e3, fYears / fTime);
+	}
+}
@@ -0,0 +1,227 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAtmosPrecompute.cpp
+/// @brief		Galaxy-Music Engine - GMTestAtmosPrecompute
+///				ұԤĲԣСֱԭĴдɵĲοȽϣ
+///				鲻ͬ߳ĽλͬԼ1~N̵߳ļٱ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMAtmosPrecompute.h"
+#include <osgDB/ReadFile>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* Сֱʣtests/Data/Atmos/µĲοͬ
+* οԭCGMAtmosphereеPPLĳɴкͬķֱɵġ16_800һ
+*/
+static SGMAtmosResolution _SmallResolution()
+{
+	SGMAtmosResolution sRes;
+	sRes.iAtmosNum = 1;
+	sRes.iRadiusNum = 1;
+	sRes.iTransAltNum = 16;
+	sRes.iTransPitchNum = 32;
+	sRes.iIrraAltNum = 16;
+	sRes.iIrraUpNum = 16;
+	sRes.iScatPitchNum = 16;
+	sRes.iScatLightNum = 8;
+	sRes.iScatCosNum = 4;
+	sRes.iScatAltNum = 8;
+	return sRes;
+}
+
+/** @brief ½һյĺԴ·òұĿ¼ */
+static std::string _MakeCorePath(const std::string& strName)
+{
+	const std::string strCorePath = CGMTest::GetTempPath() + strName + "/";
+	std::error_code ec;
+	std::filesystem::remove_all(strCorePath, ec);
+	for (const char* strTable : { "Transmittance", "Irradiance", "Inscattering" })
+		std::filesystem::create_directories(strCorePath + "Textures/Sphere/" + strTable, ec);
+	return strCorePath;
+}
+
+/** @brief ȡļͷfloatݣʧ򷵻ؿ */
+static std::vector<float> _ReadRaw(const std::string& strFile)
+{
+	std::vector<float> dataVector;
+	std::ifstream file(strFile, std::ios::binary | std::ios::ate);
+	if (!file) return dataVector;
+	dataVector.resize(size_t(file.tellg()) / sizeof(float));
+	file.seekg(0);
+	file.read((char*)dataVector.data(), dataVector.size() * sizeof(float));
+	if (!file) dataVector.clear();
+	return dataVector;
+}
+
+/** @brief ȡɵĲұstrTable_16_800.tifʧ򷵻ؿ */
+static std::vector<float> _ReadTable(const std::string& strCorePath, const std::string& strTable)
+{
+	std::vector<float> dataVector;
+	osg::ref_ptr<osg::Image> pImg = osgDB::readImageFile(
+		strCorePath + "Textures/Sphere/" + strTable + "/" + strTable + "_16_800.tif");
+	if (!pImg.valid() || GL_FLOAT != pImg->getDataType()) return dataVector;
+	const float* pData = (const float*)pImg->data();
+	dataVector.assign(pData, pData + size_t(pImg->s()) * pImg->t() * osg::Image::computeNumComponents(pImg->getPixelFormat()));
+	return dataVector;
+}
+
+/** @brief ָ߳ȫСֱʲұű */
+static bool _MakeTables(const std::string& strCorePath, const unsigned int iThreadNum, std::vector<float> vTable[3])
+{
+	CGMAtmosPrecompute atmos(strCorePath, iThreadNum);
+	atmos.SetResolution(_SmallResolution());
+	const bool bOK = atmos.MakeAll();
+	const char* vName[3] = { "Transmittance", "Irradiance", "Inscattering" };
+	for (int i = 0; i < 3; i++) vTable[i] = _ReadTable(strCorePath, vName[i]);
+	return bOK;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AtmosPrecompute_AgainstSerial)
+{
+	const std::string strCorePath = _MakeCorePath("AtmosPrecompute");
+	const SGMAtmosResolution sRes = _SmallResolution();
+	const char* vName[3] = { "Transmittance", "Irradiance", "Inscattering" };
+	const size_t vSize[3] = {
+		size_t(3) * sRes.iTransAltNum * sRes.iTransPitchNum,
+		size_t(3) * sRes.iIrraAltNum * sRes.iIrraUpNum,
+		size_t(4) * sRes.iScatPitchNum * sRes.iScatLightNum * sRes.iScatCosNum * sRes.iScatAltNum };
+	const int vRows[3] = { sRes.iTransAltNum, sRes.iIrraUpNum, sRes.iScatPitchNum };
+
+	// ̣߳ͬʱȣÿű1ʼм1
+	CGMAtmosPrecompute atmos(strCorePath, 1);
+	atmos.SetResolution(sRes);
+	int vCalls[3] = { 0, 0, 0 };
+	int iWrongProgress = 0;
+	atmos.SetProgress([&](const std::string& strTable, const int iDone, const int iTotal)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			if (strTable != vName[i]) continue;
+			vCalls[i]++;
+			if (iDone != vCalls[i] || iTotal != vRows[i]) iWrongProgress++;
+		}
+	});
+	GM_CHECK(atmos.MakeAll());
+	GM_CHECK(0 == iWrongProgress);
+	for (int i = 0; i < 3; i++) GM_CHECK(vRows[i] == vCalls[i]);
+
+	// 봮вοȽϣ߶floatֻĩλ
+	std::vector<float> vSerial[3];
+	for (int i = 0; i < 3; i++)
+	{
+		const std::vector<float> refVector = _ReadRaw(CGMTest::GetDataPath() + "Atmos/" + vName[i] + "_16_800.raw");
+		vSerial[i] = _ReadTable(strCorePath, vName[i]);
+		GM_CHECK(vSize[i] == refVector.size());
+		GM_CHECK(vSize[i] == vSerial[i].size());
+		if (vSize[i] != refVector.size() || vSize[i] != vSerial[i].size()) continue;
+
+		float fMaxRef = 0.0f;
+		for (const float fRef : refVector) fMaxRef = (std::max)(fMaxRef, std::fabs(fRef));
+		double fMaxAbs = 0.0;
+		double fMaxRel = 0.0;
+		int iNaN = 0;
+		for (size_t k = 0; k < vSize[i]; k++)
+		{
+			if (std::isnan(vSerial[i][k]) || std::isinf(vSerial[i][k])) iNaN++;
+			const double fAbs = std::fabs(double(vSerial[i][k]) - double(refVector[k]));
+			fMaxAbs = (std::max)(fMaxAbs, fAbs);
+			// ӽ0ֵֻ
+			if (std::fabs(refVector[k]) > 1e-6f * fMaxRef)
+				fMaxRel = (std::max)(fMaxRel, fAbs / std::fabs(double(refVector[k])));
+		}
+		printf("  %-13s %5zu floats, max |ref| %.4g, max abs error %.3g, max rel error %.3g\n",
+			vName[i], vSize[i], fMaxRef, fMaxAbs, fMaxRel);
+		GM_CHECK(0 == iNaN);
+		GM_CHECK(fMaxRef > 0.0f);
+		GM_CHECK(fMaxRel < 1e-4);
+		GM_CHECK(fMaxAbs <= 1e-4 * fMaxRef);
+	}
+
+	// ʱȡ.raw.tifͬ
+	const std::vector<float> rawVector = _ReadRaw(strCorePath + "Textures/Sphere/Inscattering/Inscattering_16_800.raw");
+	GM_CHECK(rawVector == vSerial[2]);
+
+	// ߳뵥߳λͬ߳ʱҲһ
+	const unsigned int iHardware = CGMAtmosPrecompute(strCorePath).GetThreadNum();
+	for (const unsigned int iThreads : { 3u, 32u, iHardware })
+	{
+		if (1 == iThreads) continue;
+		std::vector<float> vTable[3];
+		GM_CHECK(_MakeTables(_MakeCorePath("AtmosPrecompute_Threads"), iThreads, vTable));
+		int iDiff = 0;
+		for (int i = 0; i < 3; i++)
+		{
+			if (vTable[i].size() != vSerial[i].size()
+				|| 0 != memcmp(vTable[i].data(), vSerial[i].data(), vSerial[i].size() * sizeof(float)))
+				iDiff++;
+		}
+		GM_CHECK(0 == iDiff);
+	}
+}
+
+GM_TEST(AtmosPrecompute_MissingInput)
+{
+	// û͸ʾͲնȣûзնȾͲɢ䣬ʧʱȡдļ
+	const std::string strCorePath = _MakeCorePath("AtmosPrecompute_Missing");
+	CGMAtmosPrecompute atmos(strCorePath, 2);
+	atmos.SetResolution(_SmallResolution());
+	int iCalls = 0;
+	atmos.SetProgress([&](const std::string&, const int, const int) { iCalls++; });
+	GM_CHECK(!atmos.MakeIrradiance());
+	GM_CHECK(!atmos.MakeInscattering());
+	GM_CHECK(0 == iCalls);
+	GM_CHECK(_ReadTable(strCorePath, "Irradiance").empty());
+	GM_CHECK(_ReadTable(strCorePath, "Inscattering").empty());
+	GM_CHECK(!std::filesystem::exists(strCorePath + "Textures/Sphere/Inscattering/Inscattering_16_800.raw"));
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AtmosPrecompute_ThreadScaling)
+{
+	// Сֱʵȫұ߳1Ӳ߳
+	const std::string strCorePath = _MakeCorePath("AtmosPrecompute_Bench");
+	const unsigned int iHardware = CGMAtmosPrecompute(strCorePath).GetThreadNum();
+	const char* vName[3] = { "Transmittance", "Irradiance", "Inscattering" };
+	double fSerial = 0.0;
+	for (unsigned int iThreads = 1; iThreads <= iHardware; iThreads++)
+	{
+		CGMAtmosPrecompute atmos(strCorePath, iThreads);
+		atmos.SetResolution(_SmallResolution());
+		double vTime[3] = { 0.0, 0.0, 0.0 };
+		bool bOK = true;
+		vTime[0] = CGMTest::Seconds([&]() { bOK = atmos.MakeTransmittance() && bOK; });
+		vTime[1] = CGMTest::Seconds([&]() { bOK = atmos.MakeIrradiance() && bOK; });
+		vTime[2] = CGMTest::Seconds([&]() { bOK = atmos.MakeInscattering() && bOK; });
+		GM_CHECK(bOK);
+		const double fTotal = vTime[0] + vTime[1] + vTime[2];
+		if (1 == iThreads) fSerial = fTotal;
+		printf("  %2u thread(s): %s %.3f s, %s %.3f s, %s %.3f s, total %.3f s, speedup %.2fx\n", iThreads,
+			vName[0], vTime[0], vName[1], vTime[1], vName[2], vTime[2], fTotal, fSerial / fTotal);
+	}
+}
@@ -0,0 +1,183 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioCache.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioCache
+///				ƵƻAudioData.xmlӳдĲԣԼ뻺ĶԱ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMDataManager.h"
+#include "GMAudioCache.h"
+#include <filesystem>
+#include <cstdio>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief iNumBPMǶȸͬƵ */
+static std::vector<SGMAudioData> _MakeLibrary(const int iNum)
+{
+	std::vector<SGMAudioData> dataVector;
+	dataVector.reserve(iNum);
+	for (int i = 0; i < iNum; i++)
+	{
+		SGMAudioCoord vAudioCoord(60.0 + (i % 120), 0.001 * (i % 6000), 0);
+		dataVector.emplace_back(i + 1, L"Artist " + std::to_wstring(i % 300) + L" - " + std::to_wstring(i) + L".mp3",
+			vAudioCoord, SGMGalaxyCoord());
+	}
+	return dataVector;
+}
+
+/** @brief ƵUIDƺȫͬ */
+static bool _SameLibrary(const std::map<unsigned int, SGMAudioData>& mapA, const std::map<unsigned int, SGMAudioData>& mapB)
+{
+	if (mapA.size() != mapB.size()) return false;
+	for (auto itrA = mapA.begin(), itrB = mapB.begin(); itrA != mapA.end(); itrA++, itrB++)
+	{
+		if (itrA->first != itrB->first
+			|| itrA->second.UID != itrB->second.UID
+			|| itrA->second.name != itrB->second.name
+			|| itrA->second.audioCoord != itrB->second.audioCoord
+			|| itrA->second.galaxyCoord != itrB->second.galaxyCoord)
+			return false;
+	}
+	return true;
+}
+
+/** @brief ûԴļ򿪻 */
+static bool _OpenCache(CGMTestLibrary& library, CGMAudioCache& aCache)
+{
+	const std::string strUsers = library.GetConfig()->strCorePath + "Users/";
+	return aCache.Open(strUsers + "AudioData.cache",
+		{ strUsers + "AudioData.xml", strUsers + "AudioPlayingOrder.xml" }, library.GetConfig()->fMinBPM);
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioCache_RoundTrip)
+{
+	CGMTestLibrary library("AudioCache_RoundTrip");
+	GM_CHECK(library.WriteAudioData(_MakeLibrary(2000)));
+	const std::string strCache = library.GetConfig()->strCorePath + "Users/AudioData.cache";
+
+	// һδXMLȡSave֮л
+	std::map<unsigned int, SGMAudioData> xmlMap;
+	{
+		CGMDataManager dataManager;
+		GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+		xmlMap = dataManager.GetAudioDataMap();
+		GM_CHECK(2000 == xmlMap.size());
+		GM_CHECK(!std::filesystem::exists(strCache));
+		GM_CHECK(dataManager.Save());
+		GM_CHECK(std::filesystem::exists(strCache));
+	}
+
+	CGMAudioCache aCache;
+	GM_CHECK(_OpenCache(library, aCache));
+	GM_CHECK(2000 == aCache.GetAudioNum());
+	aCache.Close();
+
+	// ڶδӻȡXMLͬ
+	{
+		CGMDataManager dataManager;
+		GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+		GM_CHECK(_SameLibrary(xmlMap, dataManager.GetAudioDataMap()));
+	}
+
+	// XMLⲿ޸ĺ󻺴ڣ˵XML
+	GM_CHECK(library.WriteAudioData(_MakeLibrary(1000)));
+	GM_CHECK(!_OpenCache(library, aCache));
+	{
+		CGMDataManager dataManager;
+		GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+		GM_CHECK(1000 == dataManager.GetAudioDataMap().size());
+		GM_CHECK(dataManager.Save());
+	}
+
+	// ļʱͬ˵XML
+	GM_CHECK(_OpenCache(library, aCache));
+	aCache.Close();
+	std::filesystem::resize_file(strCache, std::filesystem::file_size(strCache) / 2);
+	GM_CHECK(!_OpenCache(library, aCache));
+	{
+		CGMDataManager dataManager;
+		GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+		GM_CHECK(1000 == dataManager.GetAudioDataMap().size());
+	}
+}
+
+GM_TEST(AudioCache_LazySave)
+{
+	CGMTestLibrary library("AudioCache_LazySave");
+	GM_CHECK(library.AddFile(L"a.mp3"));
+	GM_CHECK(library.AddFile(L"b.mp3"));
+	const std::string strXML = library.GetConfig()->strCorePath + "Users/AudioData.xml";
+
+	CGMDataManager dataManager;
+	GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return 2 == dataManager.GetAudioDataMap().size(); }));
+
+	// Ƶոձ仯в10ʱд
+	for (int i = 0; i < 5; i++) dataManager.Update(1.0);
+	GM_CHECK(!std::filesystem::exists(strXML));
+
+	// ɨ10룬XML
+	for (int i = 0; i < 1000 && !std::filesystem::exists(strXML); i++) dataManager.Update(1.0);
+	GM_CHECK(std::filesystem::exists(strXML));
+
+	// û޸ʱSaveֻд벥˳ͻ棬XML
+	std::filesystem::remove(strXML);
+	GM_CHECK(dataManager.Save());
+	GM_CHECK(!std::filesystem::exists(strXML));
+
+	// ޸ʱSaveд
+	SGMAudioCoord vAudioCoord(128.0, 2.0, 0);
+	SGMAudioData sData(0, L"a.mp3", vAudioCoord, dataManager.AudioCoord2GalaxyCoord(vAudioCoord));
+	GM_CHECK(dataManager.EditAudioData(sData));
+	GM_CHECK(dataManager.Save());
+	GM_CHECK(std::filesystem::exists(strXML));
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioCache_ColdVsCached)
+{
+	for (const int iNum : { 10000, 60000 })
+	{
+		CGMTestLibrary library("AudioCache_Bench");
+		library.WriteAudioData(_MakeLibrary(iNum));
+
+		std::map<unsigned int, SGMAudioData> xmlMap;
+		double fCold = 0.0;
+		{
+			CGMDataManager dataManager;
+			fCold = CGMTest::Seconds([&]() { dataManager.Init(nullptr, library.GetConfig()); });
+			xmlMap = dataManager.GetAudioDataMap();
+			dataManager.Save();
+		}
+		double fCached = 0.0;
+		{
+			CGMDataManager dataManager;
+			fCached = CGMTest::Seconds([&]() { dataManager.Init(nullptr, library.GetConfig()); });
+			GM_CHECK(_SameLibrary(xmlMap, dataManager.GetAudioDataMap()));
+		}
+
+		printf("  %6d audios: AudioData.xml %8.1f ms, AudioData.cache %7.1f ms, %.1fx\n",
+			iNum, fCold * 1e3, fCached * 1e3, fCold / (std::max)(fCached, 1e-9));
+	}
+}
@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioCoord.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioCoord
+///				ƵغϼĲԣԭغϺصʼ¼顱ѭΪ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMDataManager.h"
+#include <set>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* غƵݣBPMȡ4ֵǶȡiAngleNumֵÿͬƽiNum/(4*iAngleNum)
+* Ƕת3λСٶأ֤дXMLٶȡȫͬ
+*/
+static std::vector<SGMAudioData> _MakeAudioData(const int iNum, const int iAngleNum)
+{
+	const double fBPMArray[] = { 0.0, 90.0, 120.0, 150.0 };
+	std::vector<SGMAudioData> dataVector;
+	dataVector.reserve(iNum);
+	for (int i = 0; i < iNum; i++)
+	{
+		char strAngle[16];
+		snprintf(strAngle, sizeof(strAngle), "%.3f", 0.001 * ((i / 4) % iAngleNum));
+		SGMAudioCoord vAudioCoord(fBPMArray[i % 4], atof(strAngle), (i / (4 * iAngleNum)) % 3);
+		dataVector.emplace_back(i + 1, L"Song " + std::to_wstring(i) + L".mp3", vAudioCoord, SGMGalaxyCoord());
+	}
+	return dataVector;
+}
+
+/**
+* ޸ǰغϼ飺ȽϣغϾ޸꣬Ȼصʼ¼
+*/
+static void _OldResolve(const std::vector<SGMAudioData>& placedVector,
+	SGMAudioCoord& vAudioCoord, SGMGalaxyCoord& vGalaxyCoord)
+{
+	size_t i = 0;
+	while (i < placedVector.size())
+	{
+		if ((vGalaxyCoord == placedVector[i].galaxyCoord) || (vAudioCoord == placedVector[i].audioCoord))
+		{
+			if (vGalaxyCoord == placedVector[i].galaxyCoord)
+			{
+				vGalaxyCoord.z += fmod(vGalaxyCoord.z + 1.011f, 2.0f) - 1.0f;
+			}
+			if (vAudioCoord == placedVector[i].audioCoord)
+			{
+				vAudioCoord.rank += 1;
+			}
+			i = 0;
+		}
+		else
+		{
+			i++;
+		}
+	}
+}
+
+/** @brief ޸ǰķʽηXMLеƵ */
+static std::vector<SGMAudioData> _OldLoad(const CGMDataManager& dataManager, const std::vector<SGMAudioData>& dataVector)
+{
+	std::vector<SGMAudioData> placedVector;
+	placedVector.reserve(dataVector.size());
+	for (auto sData : dataVector)
+	{
+		sData.galaxyCoord = dataManager.AudioCoord2GalaxyCoord(sData.audioCoord);
+		_OldResolve(placedVector, sData.audioCoord, sData.galaxyCoord);
+		placedVector.push_back(sData);
+	}
+	return placedVector;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioCoord_LoadMatchesOldLoop)
+{
+	CGMTestLibrary library("AudioCoord_Load");
+	const std::vector<SGMAudioData> dataVector = _MakeAudioData(1500, 100);
+	GM_CHECK(library.WriteAudioData(dataVector));
+
+	// ֻInitȡXMLĽUpdateɨ費ɾЩûļƵ
+	CGMDataManager dataManager;
+	GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+	const auto& dataMap = dataManager.GetAudioDataMap();
+	GM_CHECK(dataVector.size() == dataMap.size());
+
+	int iMismatch = 0;
+	for (auto& itr : _OldLoad(dataManager, dataVector))
+	{
+		auto dataItr = dataMap.find(itr.UID);
+		if (dataItr == dataMap.end()
+			|| dataItr->second.name != itr.name
+			|| dataItr->second.audioCoord != itr.audioCoord
+			|| dataItr->second.galaxyCoord != itr.galaxyCoord)
+		{
+			iMismatch++;
+		}
+	}
+	GM_CHECK(0 == iMismatch);
+
+	// ֮ûκƵغ
+	std::set<SGMAudioCoord> audioSet;
+	std::set<SGMGalaxyCoord> galaxySet;
+	for (auto& itr : dataMap)
+	{
+		audioSet.insert(itr.second.audioCoord);
+		galaxySet.insert(itr.second.galaxyCoord);
+	}
+	GM_CHECK(dataMap.size() == audioSet.size());
+	GM_CHECK(dataMap.size() == galaxySet.size());
+}
+
+GM_TEST(AudioCoord_EditCollision)
+{
+	CGMTestLibrary library("AudioCoord_Edit");
+	GM_CHECK(library.AddFile(L"a.mp3"));
+	GM_CHECK(library.AddFile(L"b.mp3"));
+
+	CGMDataManager dataManager;
+	GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return 2 == dataManager.GetAudioDataMap().size(); }));
+	// ļBPMͣǶȴ
+	GM_CHECK(dataManager.GetAudioCoord(L"a.mp3") != dataManager.GetAudioCoord(L"b.mp3"));
+
+	SGMAudioCoord vAudioCoord(120.0, 1.0, 0);
+	SGMGalaxyCoord vGalaxyCoord = dataManager.AudioCoord2GalaxyCoord(vAudioCoord);
+	SGMAudioData sDataA(0, L"a.mp3", vAudioCoord, vGalaxyCoord);
+	GM_CHECK(dataManager.EditAudioData(sDataA));
+	GM_CHECK(vAudioCoord == dataManager.GetAudioCoord(L"a.mp3"));
+	GM_CHECK(vGalaxyCoord == dataManager.GetGalaxyCoord(L"a.mp3"));
+
+	// bƵaλãrankzҪ
+	SGMAudioData sDataB(0, L"B.MP3", vAudioCoord, vGalaxyCoord);
+	GM_CHECK(dataManager.EditAudioData(sDataB));
+	GM_CHECK(L"b.mp3" == sDataB.name);
+	GM_CHECK(dataManager.GetUID(L"b.mp3") == sDataB.UID);
+	const SGMAudioCoord vAudioB = dataManager.GetAudioCoord(L"b.mp3");
+	const SGMGalaxyCoord vGalaxyB = dataManager.GetGalaxyCoord(L"b.mp3");
+	GM_CHECK(vAudioB.BPM == vAudioCoord.BPM && vAudioB.angle == vAudioCoord.angle && 1 == vAudioB.rank);
+	GM_CHECK(vGalaxyB.x == vGalaxyCoord.x && vGalaxyB.y == vGalaxyCoord.y && vGalaxyB.z != vGalaxyCoord.z);
+
+	// ΧͲڵƵ޸
+	SGMAudioData sBad(0, L"a.mp3", SGMAudioCoord(700.0, 1.0, 0), vGalaxyCoord);
+	GM_CHECK(!dataManager.EditAudioData(sBad));
+	SGMAudioData sMissing(0, L"c.mp3", SGMAudioCoord(100.0, 2.0, 0), SGMGalaxyCoord(0.1f, 0.1f, 0.0f));
+	GM_CHECK(!dataManager.EditAudioData(sMissing));
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioCoord_LoadVsOldLoop)
+{
+	for (const int iNum : { 5000, 20000 })
+	{
+		CGMTestLibrary library("AudioCoord_Bench");
+		const std::vector<SGMAudioData> dataVector = _MakeAudioData(iNum, 600);
+		library.WriteAudioData(dataVector);
+
+		// InitлXMLͽ
+		CGMDataManager dataManager;
+		const double fInit = CGMTest::Seconds([&]() { dataManager.Init(nullptr, library.GetConfig()); });
+		GM_CHECK(size_t(iNum) == dataManager.GetAudioDataMap().size());
+
+		// ֻԭغϼ鱾
+		std::vector<SGMAudioData> oldVector;
+		const double fOld = CGMTest::Seconds([&]() { oldVector = _OldLoad(dataManager, dataVector); });
+		GM_CHECK(size_t(iNum) == oldVector.size());
+
+		printf("  %6d audios with duplicate coordinates: old collision loop %8.1f ms, whole Init %7.1f ms\n",
+			iNum, fOld * 1e3, fInit * 1e3);
+	}
+}
@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioDataMap.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioDataMap
+///				Ƶmapֻ뿽ĶԱȣֻҪƵʱĿ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMDataManager.h"
+#include <map>
+#include <cstdio>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief iNumͬƵݣBPMȡ120ֵǶȡ6000ֵrankȡ3ֵ */
+static std::vector<SGMAudioData> _MakeLibrary(const int iNum)
+{
+	std::vector<SGMAudioData> dataVector;
+	dataVector.reserve(iNum);
+	for (int i = 0; i < iNum; i++)
+	{
+		SGMAudioCoord vAudioCoord(60.0 + (i % 120), 0.001 * ((i / 120) % 6000), (i / 720000) % 3);
+		dataVector.emplace_back(i + 1, L"Artist " + std::to_wstring(i % 300) + L" - " + std::to_wstring(i) + L".mp3",
+			vAudioCoord, SGMGalaxyCoord());
+	}
+	return dataVector;
+}
+
+/** @brief CGMGalaxyƵǵıͬȡÿƵϵƵ */
+static double _Visit(const std::map<unsigned int, SGMAudioData>& dataMap)
+{
+	double fSum = 0.0;
+	for (const auto& itr : dataMap)
+	{
+		fSum += itr.second.galaxyCoord.x + itr.second.galaxyCoord.y + itr.second.audioCoord.BPM;
+	}
+	return fSum;
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioDataMap_CopyVsView)
+{
+	for (const int iNum : { 10000, 100000, 1000000 })
+	{
+		CGMTestLibrary library("AudioDataMap_Bench");
+		library.WriteAudioData(_MakeLibrary(iNum));
+		CGMDataManager dataManager;
+		dataManager.Init(nullptr, library.GetConfig());
+		GM_CHECK(size_t(iNum) == dataManager.GetAudioDataMap().size());
+
+		// ԭĵ÷ʽÿȿmapٱ
+		const int iRepeat = (std::max)(1, 1000000 / iNum);
+		double fCopySum = 0.0;
+		const double fCopy = CGMTest::Seconds([&]() {
+			for (int r = 0; r < iRepeat; r++)
+			{
+				std::map<unsigned int, SGMAudioData> dataMap;
+				dataManager.GetAudioDataMap(dataMap);
+				fCopySum += _Visit(dataMap);
+			}
+		});
+		// ֻãֱӱݹеmap
+		double fViewSum = 0.0;
+		const double fView = CGMTest::Seconds([&]() {
+			for (int r = 0; r < iRepeat; r++)
+			{
+				fViewSum += _Visit(dataManager.GetAudioDataMap());
+			}
+		});
+		GM_CHECK(fCopySum == fViewSum);
+
+		printf("  %7d audios: copy and visit %8.2f ms, visit the view %7.2f ms, %.1fx\n",
+			iNum, fCopy / iRepeat * 1e3, fView / iRepeat * 1e3, fCopy / (std::max)(fView, 1e-9));
+	}
+}
@@ -0,0 +1,602 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioDecoder.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioDecoder
+///				PCMλ̨ͽ浭ĲԣʹñɵWAVļ
+///				BASSʹ"no sound"豸ɲֱ߳ӵMixҪƵ豸
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMAudioDecoder.h"
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_TEST_MIX_FRAMES			(441)			// ÿλ֡
+#define GM_TEST_MIX_SLEEP_US		(1000)			// ÿλĵȴʱ䣬ԼΪ10ʵʱٶ
+#define GM_TEST_HALF_PI				(1.5707963267948966)	// /2
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ʼBASS"no sound"豸ֻڵһεʱʼ */
+static void _InitBass()
+{
+	static bool s_bInit = false;
+	if (s_bInit) return;
+	BASS_Init(0, 44100, 0, nullptr, nullptr);
+	s_bInit = true;
+}
+
+/** @brief õʱļУ'/'β */
+static std::string _WavPath()
+{
+	const std::string strPath = CGMTest::GetTempPath() + "AudioDecoder/";
+	std::filesystem::create_directories(strPath);
+	return strPath;
+}
+
+/**
+* ɽе16λPCMҲiSeedΪ0߰
+* @param iFrames:		֡
+* @param iChans:		
+* @param fFreq:			ҲƵʣԲ
+* @param iSeed:			ӣ0ʾҲ
+*/
+static std::vector<int16_t> _MakePcm(const size_t iFrames, const int iChans, const double fFreq, const unsigned int iSeed = 0)
+{
+	std::vector<int16_t> pcmVector(iFrames * iChans);
+	std::mt19937 rng(iSeed);
+	for (size_t i = 0; i < iFrames; i++)
+	{
+		for (int c = 0; c < iChans; c++)
+		{
+			const double fValue = (0 == iSeed) ? 0.5 * std::sin(6.283185307179586 * fFreq * double(i) + 0.3 * c)
+				: (double(rng() % 20001) / 10000.0 - 1.0) * 0.3;
+			pcmVector[i * iChans + c] = int16_t(std::lround(fValue * 32767.0));
+		}
+	}
+	return pcmVector;
+}
+
+/** @brief ʱļд16λPCMWAVļļ· */
+static std::wstring _WriteWav(const std::string& strName, const unsigned int iFreq, const int iChans,
+	const std::vector<int16_t>& pcmVector)
+{
+	const std::wstring strFile = std::filesystem::path(_WavPath() + strName).wstring();
+	CGMTestLibrary::WriteWav(strFile, iFreq, iChans, pcmVector);
+	return strFile;
+}
+
+/** @brief ȴ۽򿪻Ԥ */
+static EGMDECODE_STATE _WaitSlot(const CGMAudioDecoder& decoder, const int iSlot)
+{
+	const auto tStart = std::chrono::steady_clock::now();
+	while (EGMDECODE_OPENING == decoder.GetState(iSlot)
+		&& std::chrono::steady_clock::now() - tStart < std::chrono::seconds(10))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return decoder.GetState(iSlot);
+}
+
+/** @brief ΪԼ10ʵʱٶȻֱpMixedΪʱʵʱѻ֡ */
+static std::vector<float> _MixAll(CGMAudioDecoder& decoder, const size_t iChans,
+	std::atomic<unsigned long long>* pMixed = nullptr)
+{
+	std::vector<float> outVector;
+	std::vector<float> bufferVector(GM_TEST_MIX_FRAMES * iChans);
+	while (true)
+	{
+		const size_t iFrames = decoder.Mix(bufferVector.data(), GM_TEST_MIX_FRAMES);
+		outVector.insert(outVector.end(), bufferVector.begin(), bufferVector.begin() + iFrames * iChans);
+		if (pMixed) pMixed->fetch_add(iFrames);
+		if (iFrames < GM_TEST_MIX_FRAMES) break;
+		std::this_thread::sleep_for(std::chrono::microseconds(GM_TEST_MIX_SLEEP_US));
+	}
+	return outVector;
+}
+
+/** @brief PCMļȫһ */
+static bool _SamePcm(const std::vector<float>& outVector, const std::vector<int16_t>& pcmVector, const size_t iOffset = 0)
+{
+	if (iOffset + outVector.size() > pcmVector.size()) return false;
+	for (size_t i = 0; i < outVector.size(); i++)
+	{
+		if (outVector[i] != pcmVector[iOffset + i] / 32768.0f) return false;
+	}
+	return true;
+}
+
+/**
+* ڵĻ߳аԼ10ʵʱٶȻֱ
+* ͬʱ̲߳ϵfOnBlockģȾ߳ڲŹŶӻȡһ
+* @param decoder:		Ѿ
+* @param iChans:		
+* @param fOnBlock:		̵߳ĻصΪѾ֡
+*/
+static std::vector<float> _MixWhile(CGMAudioDecoder& decoder, const size_t iChans,
+	const std::function<void(unsigned long long)>& fOnBlock)
+{
+	std::vector<float> outVector;
+	std::atomic<unsigned long long> iMixed(0);
+	std::atomic<bool> bDone(false);
+	std::thread mixer([&]() {
+		outVector = _MixAll(decoder, iChans, &iMixed);
+		bDone.store(true);
+	});
+	while (!bDone.load())
+	{
+		fOnBlock(iMixed.load());
+		std::this_thread::sleep_for(std::chrono::microseconds(300));
+	}
+	mixer.join();
+	return outVector;
+}
+
+/**
+* л֡ʵȲʱ1
+* л֡һ׵Ľβʱʣ֡õȹߵڽβʱмǾ
+* @param outVector:		ʵ
+* @param pcmA:			һ׵PCM
+* @param pcmB:			һ׵PCM
+* @param iChans:		
+* @param iSwitch:		л֡һ׵ĵһ֡еλ
+*/
+static double _CrossfadeError(const std::vector<float>& outVector, const std::vector<int16_t>& pcmA,
+	const std::vector<int16_t>& pcmB, const size_t iChans, const size_t iSwitch)
+{
+	const size_t iFramesA = pcmA.size() / iChans;
+	const size_t iFramesB = pcmB.size() / iChans;
+	if (outVector.size() != (iSwitch + iFramesB) * iChans) return 1.0;
+
+	const size_t iFadeLength = (iSwitch < iFramesA) ? iFramesA - iSwitch : 0;
+	double fMaxError = 0.0;
+	for (size_t i = 0; i < iSwitch + iFramesB; i++)
+	{
+		for (size_t c = 0; c < iChans; c++)
+		{
+			float fExpect = 0.0f;
+			if (i < iSwitch)
+			{
+				if (i < iFramesA) fExpect = pcmA[i * iChans + c] / 32768.0f;
+			}
+			else if (i < iFramesA)
+			{
+				const size_t k = i - iSwitch;
+				const double fAngle = (double(k) + 0.5) * (GM_TEST_HALF_PI / double(iFadeLength));
+				fExpect = pcmA[i * iChans + c] / 32768.0f * float(std::cos(fAngle))
+					+ pcmB[k * iChans + c] / 32768.0f * float(std::sin(fAngle));
+			}
+			else
+			{
+				fExpect = pcmB[(i - iSwitch) * iChans + c] / 32768.0f;
+			}
+			fMaxError = (std::max)(fMaxError, double(std::fabs(fExpect - outVector[i * iChans + c])));
+		}
+	}
+	return fMaxError;
+}
+
+/** @brief ֮֡ͬһ */
+static double _MaxJump(const std::vector<float>& outVector, const size_t iChans)
+{
+	double fMaxJump = 0.0;
+	for (size_t i = iChans; i < outVector.size(); i++)
+	{
+		fMaxJump = (std::max)(fMaxJump, double(std::fabs(outVector[i] - outVector[i - iChans])));
+	}
+	return fMaxJump;
+}
+
+/** @brief ĳ[iBegin, iEnd)֡ϵľ */
+static double _Rms(const std::vector<float>& outVector, const size_t iChans, const size_t iBegin, const size_t iEnd)
+{
+	double fSum = 0.0;
+	for (size_t i = iBegin; i < iEnd; i++) fSum += double(outVector[i * iChans]) * outVector[i * iChans];
+	return std::sqrt(fSum / double(iEnd - iBegin));
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(PcmRing_Basic)
+{
+	CGMPcmRing ring;
+	ring.Init(1000);
+	GM_CHECK(1024 == ring.GetCapacity());
+	GM_CHECK(0 == ring.GetReadable());
+	GM_CHECK(1024 == ring.GetWritable());
+
+	// ռ䲻ʱֻдһ
+	std::vector<float> inVector(1500);
+	for (size_t i = 0; i < inVector.size(); i++) inVector[i] = float(i);
+	GM_CHECK(1024 == ring.Write(inVector.data(), inVector.size()));
+	GM_CHECK(0 == ring.GetWritable());
+
+	// ĩβĶд
+	std::vector<float> outVector(1500);
+	GM_CHECK(1000 == ring.Read(outVector.data(), 1000));
+	GM_CHECK(476 == ring.Write(inVector.data() + 1024, 476));
+	GM_CHECK(500 == ring.Read(outVector.data() + 1000, 600));
+	GM_CHECK(outVector == inVector);
+	GM_CHECK(0 == ring.Read(outVector.data(), 1));
+
+	ring.Write(inVector.data(), 10);
+	ring.Reset();
+	GM_CHECK(0 == ring.GetReadable());
+	GM_CHECK(1024 == ring.GetWritable());
+}
+
+GM_TEST(PcmRing_SpscStress)
+{
+	// ߺòͬĿСд߼ÿһ˳
+	// ʱóʱƬ˻Ҳܺܿ
+	const size_t iNum = 2000000;
+	CGMPcmRing ring;
+	ring.Init(1000);
+	std::thread producer([&]() {
+		float vBuffer[333];
+		size_t iWritten = 0;
+		while (iWritten < iNum)
+		{
+			const size_t iChunk = (std::min)(size_t(333), iNum - iWritten);
+			for (size_t i = 0; i < iChunk; i++) vBuffer[i] = float((iWritten + i) % 16777216);
+			size_t iDone = 0;
+			while (iDone < iChunk)
+			{
+				const size_t iWrite = ring.Write(vBuffer + iDone, iChunk - iDone);
+				if (0 == iWrite) std::this_thread::yield();
+				iDone += iWrite;
+			}
+			iWritten += iChunk;
+		}
+	});
+
+	float vBuffer[257];
+	size_t iRead = 0;
+	size_t iWrong = 0;
+	while (iRead < iNum)
+	{
+		const size_t iChunk = ring.Read(vBuffer, 257);
+		if (0 == iChunk) std::this_thread::yield();
+		for (size_t i = 0; i < iChunk; i++)
+		{
+			if (vBuffer[i] != float((iRead + i) % 16777216)) iWrong++;
+		}
+		iRead += iChunk;
+	}
+	producer.join();
+	GM_CHECK(0 == iWrong);
+	GM_CHECK(0 == ring.GetReadable());
+}
+
+GM_TEST(AudioDecoder_Playback)
+{
+	_InitBass();
+	const std::vector<int16_t> pcmA = _MakePcm(3 * 44100, 2, 440.0 / 44100.0);
+	const std::vector<int16_t> pcmB = _MakePcm(2 * 22050, 2, 660.0 / 22050.0);
+	const std::wstring strA = _WriteWav("a.wav", 44100, 2, pcmA);
+	const std::wstring strB = _WriteWav("b.wav", 22050, 2, pcmB);
+
+	CGMAudioDecoder decoder;
+	GM_CHECK(decoder.Start());
+	decoder.Open(0, strA);
+	decoder.Open(1, strB);
+	GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+	GM_CHECK_NEAR(3.0, decoder.GetDuration(0), 1e-6);
+
+	// ţļһ£֡ȷ
+	GM_CHECK(0 != decoder.CreateOutput(0));
+	std::vector<float> outVector = _MixAll(decoder, 2);
+	GM_CHECK(pcmA.size() == outVector.size());
+	GM_CHECK(_SamePcm(outVector, pcmA));
+	GM_CHECK(3 * 44100 == decoder.GetEndFrame());
+	GM_CHECK(decoder.IsEnded(0));
+
+	// תͷתԤ
+	decoder.FreeOutput();
+	decoder.Seek(0, 1.5);
+	GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+	GM_CHECK(1.5 == decoder.GetStartTime(0));
+	GM_CHECK(0 != decoder.CreateOutput(0));
+	outVector = _MixAll(decoder, 2);
+	GM_CHECK(pcmA.size() - 66150 * 2 == outVector.size());
+	GM_CHECK(_SamePcm(outVector, pcmA, 66150 * 2));
+	decoder.FreeOutput();
+	decoder.Close(0);
+
+	// ԤصĲۣͬĲʣ򿪺һֱں̨
+	GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 1));
+	GM_CHECK_NEAR(2.0, decoder.GetDuration(1), 1e-6);
+	GM_CHECK(0 != decoder.CreateOutput(1));
+	outVector = _MixAll(decoder, 2);
+	GM_CHECK(pcmB.size() == outVector.size());
+	GM_CHECK(_SamePcm(outVector, pcmB));
+	decoder.FreeOutput();
+
+	// ʧ
+	decoder.Open(0, std::filesystem::path(_WavPath() + "missing.wav").wstring());
+	GM_CHECK(EGMDECODE_FAILED == _WaitSlot(decoder, 0));
+	GM_CHECK(0 == decoder.CreateOutput(0));
+
+	// ´򿪺תľ״̬ܱĽ
+	int iStale = 0;
+	for (int k = 0; k < 200; k++)
+	{
+		decoder.Open(0, strA);
+		decoder.Seek(0, 0.1 * (k % 20));
+		_WaitSlot(decoder, 0);
+		if (0.1 * (k % 20) != decoder.GetStartTime(0)) iStale++;
+	}
+	GM_CHECK(0 == iStale);
+	decoder.Stop();
+	GM_CHECK(EGMDECODE_EMPTY == decoder.GetState(0));
+}
+
+GM_TEST(AudioDecoder_Gapless)
+{
+	// ͬһҲгļʱԭʼһ
+	_InitBass();
+	const std::vector<int16_t> pcmVector = _MakePcm(170000, 2, 440.0 / 44100.0);
+	const std::wstring strA = _WriteWav("gapless_a.wav", 44100, 2,
+		std::vector<int16_t>(pcmVector.begin(), pcmVector.begin() + 100000 * 2));
+	const std::wstring strB = _WriteWav("gapless_b.wav", 44100, 2,
+		std::vector<int16_t>(pcmVector.begin() + 100000 * 2, pcmVector.end()));
+
+	CGMAudioDecoder decoder;
+	GM_CHECK(decoder.Start());
+	decoder.SetCrossfade(0.0);
+	decoder.Open(0, strA);
+	GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+	GM_CHECK(0 != decoder.CreateOutput(0));
+	bool bQueued = false;
+	const std::vector<float> outVector = _MixWhile(decoder, 2, [&](unsigned long long) {
+		if (bQueued) return;
+		decoder.Open(1, strB);
+		decoder.Queue(1);
+		bQueued = true;
+	});
+	GM_CHECK(pcmVector.size() == outVector.size());
+	GM_CHECK(_SamePcm(outVector, pcmVector));
+	GM_CHECK(1 == decoder.GetSwitchCount());
+	GM_CHECK(100000 == decoder.GetSwitchFrame());
+	GM_CHECK(170000 == decoder.GetEndFrame());
+	GM_CHECK(1 == decoder.GetMixSlot());
+	decoder.Stop();
+}
+
+GM_TEST(AudioDecoder_Crossfade)
+{
+	_InitBass();
+	CGMAudioDecoder decoder;
+	GM_CHECK(decoder.Start());
+
+	// 2Ҳȹʹʽһ£û
+	{
+		const std::vector<int16_t> pcmA = _MakePcm(300000, 2, 440.0 / 44100.0);
+		const std::vector<int16_t> pcmB = _MakePcm(200000, 2, 660.0 / 44100.0);
+		const std::wstring strB = _WriteWav("fade_b.wav", 44100, 2, pcmB);
+		decoder.SetCrossfade(2.0);
+		decoder.Open(0, _WriteWav("fade_a.wav", 44100, 2, pcmA));
+		GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+		GM_CHECK(0 != decoder.CreateOutput(0));
+		bool bQueued = false;
+		const std::vector<float> outVector = _MixWhile(decoder, 2, [&](unsigned long long) {
+			if (bQueued) return;
+			decoder.Open(1, strB);
+			decoder.Queue(1);
+			bQueued = true;
+		});
+		GM_CHECK(300000 - 88200 == decoder.GetSwitchFrame());
+		GM_CHECK(500000 - 88200 == decoder.GetEndFrame());
+		GM_CHECK(_CrossfadeError(outVector, pcmA, pcmB, 2, 300000 - 88200) < 1e-6);
+		// 0.5660HzҲÿ֡仯ȹʵʱŴ2
+		GM_CHECK(_MaxJump(outVector, 2) < 6.283185307179586 * 660.0 / 44100.0 * 0.5 * 1.42);
+		decoder.FreeOutput();
+	}
+
+	// 3صźڵмȲ½
+	{
+		const std::vector<int16_t> pcmA = _MakePcm(400000, 2, 0.0, 1);
+		const std::vector<int16_t> pcmB = _MakePcm(400000, 2, 0.0, 2);
+		const std::wstring strB = _WriteWav("noise_b.wav", 44100, 2, pcmB);
+		decoder.SetCrossfade(3.0);
+		decoder.Open(0, _WriteWav("noise_a.wav", 44100, 2, pcmA));
+		GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+		GM_CHECK(0 != decoder.CreateOutput(0));
+		bool bQueued = false;
+		const std::vector<float> outVector = _MixWhile(decoder, 2, [&](unsigned long long) {
+			if (bQueued) return;
+			decoder.Open(1, strB);
+			decoder.Queue(1);
+			bQueued = true;
+		});
+		const size_t iFade = 400000 - 132300;
+		GM_CHECK(iFade == decoder.GetSwitchFrame());
+		GM_CHECK(_CrossfadeError(outVector, pcmA, pcmB, 2, iFade) < 1e-6);
+		const double fBefore = _Rms(outVector, 2, 0, iFade);
+		const double fMiddle = _Rms(outVector, 2, iFade + 44100, iFade + 88200);
+		printf("  noise rms before %.4f, middle of the fade %.4f\n", fBefore, fMiddle);
+		GM_CHECK_NEAR(1.0, fMiddle / fBefore, 0.03);
+		decoder.FreeOutput();
+	}
+	decoder.Stop();
+}
+
+GM_TEST(AudioDecoder_CrossfadeNoNext)
+{
+	// ûһסһ״ʧܡһײʲͬһ׵Ľβȷ
+	_InitBass();
+	const std::vector<int16_t> pcmA = _MakePcm(50000, 2, 440.0 / 44100.0);
+	const std::wstring strA = _WriteWav("end_a.wav", 44100, 2, pcmA);
+	const std::wstring strRate = _WriteWav("end_48k.wav", 48000, 2, _MakePcm(50000, 2, 440.0 / 48000.0));
+	const std::wstring strMissing = std::filesystem::path(_WavPath() + "missing.wav").wstring();
+	const std::wstring nextVector[] = { L"", strMissing, strRate };
+
+	CGMAudioDecoder decoder;
+	GM_CHECK(decoder.Start());
+	decoder.SetCrossfade(2.0);
+	for (const std::wstring& strNext : nextVector)
+	{
+		decoder.Open(0, strA);
+		GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+		GM_CHECK(0 != decoder.CreateOutput(0));
+		const unsigned int iSwitchCount = decoder.GetSwitchCount();
+		bool bQueued = strNext.empty();
+		const std::vector<float> outVector = _MixWhile(decoder, 2, [&](unsigned long long) {
+			if (bQueued) return;
+			decoder.Open(1, strNext);
+			decoder.Queue(1);
+			bQueued = true;
+		});
+		GM_CHECK(pcmA.size() == outVector.size());
+		GM_CHECK(_SamePcm(outVector, pcmA));
+		GM_CHECK(50000 == decoder.GetEndFrame());
+		GM_CHECK(iSwitchCount == decoder.GetSwitchCount());
+		decoder.FreeOutput();
+		decoder.Close(1);
+	}
+	decoder.Stop();
+}
+
+GM_TEST(AudioDecoder_CrossfadeLate)
+{
+	// ʣ֡ʱŶӣ̣һԤʱ֮޷ν
+	_InitBass();
+	const std::vector<int16_t> pcmA = _MakePcm(60000, 2, 440.0 / 44100.0);
+	const std::vector<int16_t> pcmB = _MakePcm(30000, 2, 660.0 / 44100.0);
+	const std::wstring strB = _WriteWav("late_b.wav", 44100, 2, pcmB);
+
+	CGMAudioDecoder decoder;
+	GM_CHECK(decoder.Start());
+	decoder.SetCrossfade(2.0);
+	decoder.Open(0, _WriteWav("late_a.wav", 44100, 2, pcmA));
+	GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+	GM_CHECK(0 != decoder.CreateOutput(0));
+	unsigned long long iQueuedAt = 0;
+	const std::vector<float> outVector = _MixWhile(decoder, 2, [&](unsigned long long iMixed) {
+		if (0 != iQueuedAt || iMixed < 50000) return;
+		decoder.Open(1, strB);
+		decoder.Queue(1);
+		iQueuedAt = iMixed;
+	});
+	const unsigned long long iSwitch = decoder.GetSwitchFrame();
+	printf("  queued at frame %llu, switched at frame %llu\n", iQueuedAt, iSwitch);
+	GM_CHECK(1 == decoder.GetSwitchCount());
+	GM_CHECK(iSwitch >= iQueuedAt);
+	GM_CHECK(_CrossfadeError(outVector, pcmA, pcmB, 2, size_t(iSwitch)) < 1e-6);
+	decoder.Stop();
+}
+
+GM_TEST(AudioDecoder_UnqueueRace)
+{
+	// ڵʼǰȡŶӲһף̺߳Ͳֻ߳һȡŶӵĲ
+	_InitBass();
+	const std::vector<int16_t> pcmA = _MakePcm(100000, 2, 440.0 / 44100.0);
+	const std::vector<int16_t> pcmB = _MakePcm(50000, 2, 660.0 / 44100.0);
+	const std::vector<int16_t> pcmC = _MakePcm(50000, 2, 880.0 / 44100.0);
+	const std::wstring strA = _WriteWav("race_a.wav", 44100, 2, pcmA);
+	const std::wstring strB = _WriteWav("race_b.wav", 44100, 2, pcmB);
+	const std::wstring strC = _WriteWav("race_c.wav", 44100, 2, pcmC);
+
+	CGMAudioDecoder decoder;
+	GM_CHECK(decoder.Start());
+	decoder.SetCrossfade(0.5);
+	int iTaken = 0;
+	int iReplaced = 0;
+	for (int r = 0; r < 20; r++)
+	{
+		decoder.Open(0, strA);
+		GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+		GM_CHECK(0 != decoder.CreateOutput(0));
+		const unsigned int iSwitchCount = decoder.GetSwitchCount();
+		const unsigned long long iWhen = 100000 - 22050 - 4000 + r * 400;
+		bool bQueued = false;
+		bool bUnqueued = false;
+		bool bReplaced = false;
+		const std::vector<float> outVector = _MixWhile(decoder, 2, [&](unsigned long long iMixed) {
+			if (!bQueued)
+			{
+				decoder.Open(1, strB);
+				decoder.Queue(1);
+				bQueued = true;
+			}
+			else if (!bUnqueued && iMixed >= iWhen)
+			{
+				bUnqueued = true;
+				if (decoder.Unqueue(1))
+				{
+					bReplaced = true;
+					decoder.Open(1, strC);
+					decoder.Queue(1);
+				}
+			}
+		});
+		(bReplaced ? iReplaced : iTaken)++;
+		GM_CHECK(iSwitchCount + 1 == decoder.GetSwitchCount());
+		GM_CHECK(_CrossfadeError(outVector, pcmA, bReplaced ? pcmC : pcmB, 2, size_t(decoder.GetSwitchFrame())) < 1e-6);
+		decoder.FreeOutput();
+		decoder.Close(1);
+	}
+	printf("  mixer took the queued slot %d times, replaced %d times\n", iTaken, iReplaced);
+	decoder.Stop();
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioDecoder_SwitchCost)
+{
+	// иʱȾ̵߳ĴۣǰȾ߳дļֻ
+	_InitBass();
+	const std::wstring strFile = _WriteWav("long.wav", 44100, 2, _MakePcm(60 * 44100, 2, 440.0 / 44100.0));
+	const int iRound = 20;
+
+	const double fOpen = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iRound; i++)
+		{
+			HSTREAM stream = BASS_StreamCreateFile(FALSE, strFile.c_str(), 0, 0,
+				BASS_STREAM_DECODE | BASS_SAMPLE_FLOAT | BASS_STREAM_PRESCAN);
+			GM_CHECK(0 != stream);
+			BASS_StreamFree(stream);
+		}
+	});
+
+	CGMAudioDecoder decoder;
+	decoder.Start();
+	decoder.Open(0, strFile);
+	GM_CHECK(EGMDECODE_READY == _WaitSlot(decoder, 0));
+	const double fSwap = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iRound; i++)
+		{
+			GM_CHECK(0 != decoder.CreateOutput(0));
+			decoder.FreeOutput();
+		}
+	});
+	decoder.Stop();
+
+	printf("  60 s WAV: open on render thread %.3f ms, swap output stream %.3f ms\n",
+		fOpen * 1e3 / iRound, fSwap * 1e3 / iRound);
+}
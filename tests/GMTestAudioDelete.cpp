@@ -0,0 +1,214 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioDelete.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioDelete
+///				ɾƵĲԣʱڵƵڼɾļƳ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMDataManager.h"
+#include <filesystem>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ԶƵݹ */
+static std::vector<SGMAudioData> _MakeAudioData()
+{
+	return {
+		SGMAudioData(1, L"a.mp3", SGMAudioCoord(80.0, 0.5), SGMGalaxyCoord()),
+		SGMAudioData(2, L"b.mp3", SGMAudioCoord(120.0, 2.5), SGMGalaxyCoord()),
+		SGMAudioData(3, L"c.mp3", SGMAudioCoord(160.0, 4.5), SGMGalaxyCoord()) };
+}
+
+/**
+* ֻͨӿڼƵѾȫɾ
+* @param dataManager:	ݹ
+* @param sRemoved:		ɾƵΪɾǰ
+* @param strOther:		һȻڵƵڼ鱻ɾѾͷ
+*/
+static void _CheckRemoved(CGMDataManager& dataManager, const SGMAudioData& sRemoved, const std::wstring& strOther)
+{
+	// 
+	GM_CHECK(!dataManager.FindAudio(sRemoved.name));
+	GM_CHECK(0 == dataManager.GetUID(sRemoved.name));
+
+	// Ƶmap
+	const std::map<unsigned int, SGMAudioData>& dataMap = dataManager.GetAudioDataMap();
+	GM_CHECK(dataMap.end() == dataMap.find(sRemoved.UID));
+	for (auto& itr : dataMap)
+	{
+		GM_CHECK(itr.second.name != sRemoved.name);
+	}
+	GM_CHECK(L"" == dataManager.FindAudio(sRemoved.UID));
+
+	// k-dԭλϲѯ
+	double fX = sRemoved.galaxyCoord.x;
+	double fY = sRemoved.galaxyCoord.y;
+	double fZ = sRemoved.galaxyCoord.z;
+	std::wstring strName = L"";
+	dataManager.FindAudio(fX, fY, fZ, strName);
+	GM_CHECK(strName != sRemoved.name);
+
+	// ˳˳ѭ֣ٲ
+	const int iNum = int(dataMap.size());
+	for (int i = 0; i < 2 * iNum; i++)
+	{
+		const std::wstring strSequence = dataManager.GetNextAudio(EGMORDER_SEQUENCE);
+		GM_CHECK(L"" != strSequence && strSequence != sRemoved.name);
+		const std::wstring strShuffle = dataManager.GetNextAudio(EGMORDER_SHUFFLE);
+		GM_CHECK(L"" != strShuffle && strShuffle != sRemoved.name);
+	}
+	// ʷ
+	for (int i = 0; i < 4 * iNum; i++)
+	{
+		GM_CHECK(sRemoved.name != dataManager.GetLastAudio());
+	}
+
+	// غϼ飺һƵԭƶɾϣᱻǨ
+	SGMAudioData sEdit(0, strOther, sRemoved.audioCoord, sRemoved.galaxyCoord);
+	GM_CHECK(dataManager.EditAudioData(sEdit));
+	GM_CHECK(sEdit.audioCoord == sRemoved.audioCoord);
+	GM_CHECK(sEdit.galaxyCoord == sRemoved.galaxyCoord);
+	GM_CHECK(sEdit.galaxyCoord == dataManager.GetGalaxyCoord(strOther));
+
+	// k-dвĵᵲסʵڵƵ԰һƵԱٲѯһ
+	sEdit.galaxyCoord.x += 0.01f;
+	GM_CHECK(dataManager.EditAudioData(sEdit));
+	fX = sRemoved.galaxyCoord.x;
+	fY = sRemoved.galaxyCoord.y;
+	fZ = sRemoved.galaxyCoord.z;
+	GM_CHECK(dataManager.FindAudio(fX, fY, fZ, strName));
+	GM_CHECK(strOther == strName);
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioDelete_Overdue)
+{
+	// AudioData.xmlb.mp3ļڹرڼ䱻ɾ
+	CGMTestLibrary library("AudioDelete_Overdue");
+	GM_CHECK(library.WriteAudioData(_MakeAudioData()));
+	GM_CHECK(library.AddFile(L"a.mp3"));
+	GM_CHECK(library.AddFile(L"c.mp3"));
+
+	CGMDataManager dataManager;
+	GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+	SGMAudioData sRemoved = _MakeAudioData()[1];
+	sRemoved.UID = dataManager.GetUID(sRemoved.name);
+	sRemoved.galaxyCoord = dataManager.GetGalaxyCoord(sRemoved.name);
+	GM_CHECK(0 != sRemoved.UID);
+
+	// һɨڵƵ
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return !dataManager.IsScanning(); }));
+	GM_CHECK(2 == dataManager.GetAudioNum());
+	_CheckRemoved(dataManager, sRemoved, L"a.mp3");
+}
+
+GM_TEST(AudioDelete_Rescan)
+{
+	CGMTestLibrary library("AudioDelete_Rescan");
+	GM_CHECK(library.WriteAudioData(_MakeAudioData()));
+	GM_CHECK(library.AddFile(L"a.mp3"));
+	GM_CHECK(library.AddFile(L"b.mp3"));
+	GM_CHECK(library.AddFile(L"c.mp3"));
+
+	CGMDataManager dataManager;
+	GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return !dataManager.IsScanning(); }));
+	GM_CHECK(3 == dataManager.GetAudioNum());
+
+	// ɾǰλϲѯʹΪǰƵ벥ʷ֤ļ鲻ǿյ
+	SGMAudioData sRemoved = _MakeAudioData()[2];
+	sRemoved.UID = dataManager.GetUID(sRemoved.name);
+	sRemoved.galaxyCoord = dataManager.GetGalaxyCoord(sRemoved.name);
+	double fX = sRemoved.galaxyCoord.x;
+	double fY = sRemoved.galaxyCoord.y;
+	double fZ = sRemoved.galaxyCoord.z;
+	std::wstring strName = L"";
+	GM_CHECK(dataManager.FindAudio(fX, fY, fZ, strName));
+	GM_CHECK(sRemoved.name == strName);
+	GM_CHECK(L"" != dataManager.GetNextAudio(EGMORDER_SEQUENCE));
+
+	GM_CHECK(library.RemoveFile(sRemoved.name));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return dataManager.RescanAudioFiles(); }));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return !dataManager.FindAudio(sRemoved.name); }));
+	GM_CHECK(2 == dataManager.GetAudioNum());
+	_CheckRemoved(dataManager, sRemoved, L"b.mp3");
+}
+
+GM_TEST(AudioDelete_FreeUID)
+{
+	// c.mp3ڹرڼ䱻ɾUIDΪ124¼غټףܸе4
+	CGMTestLibrary library("AudioDelete_FreeUID");
+	std::vector<SGMAudioData> dataVector = _MakeAudioData();
+	dataVector.push_back(SGMAudioData(4, L"d.mp3", SGMAudioCoord(200.0, 1.5), SGMGalaxyCoord()));
+	GM_CHECK(library.WriteAudioData(dataVector));
+	GM_CHECK(library.AddFile(L"a.mp3"));
+	GM_CHECK(library.AddFile(L"b.mp3"));
+	GM_CHECK(library.AddFile(L"d.mp3"));
+
+	std::map<unsigned int, SGMAudioData> savedMap;
+	{
+		CGMDataManager dataManager;
+		GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+		GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return !dataManager.IsScanning(); }));
+		GM_CHECK(3 == dataManager.GetAudioNum());
+		GM_CHECK(dataManager.Save());
+		savedMap = dataManager.GetAudioDataMap();
+	}
+	GM_CHECK(savedMap.end() == savedMap.find(3));
+	GM_CHECK(savedMap.end() != savedMap.find(4));
+
+	GM_CHECK(library.AddFile(L"e.mp3"));
+	GM_CHECK(library.AddFile(L"f.mp3"));
+	// ȴӻأɾAudioData.xmlأ·Ҫ
+	for (const bool bCache : { true, false })
+	{
+		if (!bCache)
+		{
+			std::error_code ec;
+			std::filesystem::remove(library.GetConfig()->strCorePath + "Users/AudioData.cache", ec);
+		}
+		CGMDataManager dataManager;
+		GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+		GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return !dataManager.IsScanning(); }));
+		GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return 5 == dataManager.GetAudioNum(); }));
+
+		// еƵһûб仯
+		const std::map<unsigned int, SGMAudioData>& dataMap = dataManager.GetAudioDataMap();
+		int iChanged = 0;
+		for (auto& itr : savedMap)
+		{
+			auto dataItr = dataMap.find(itr.first);
+			if (dataItr == dataMap.end()
+				|| dataItr->second.name != itr.second.name
+				|| !(dataItr->second.audioCoord == itr.second.audioCoord)
+				|| !(dataItr->second.galaxyCoord == itr.second.galaxyCoord)
+				|| dataManager.GetUID(itr.second.name) != itr.first)
+				iChanged++;
+		}
+		GM_CHECK(0 == iChanged);
+
+		// µƵʹÿеUID
+		const unsigned int iE = dataManager.GetUID(L"e.mp3");
+		const unsigned int iF = dataManager.GetUID(L"f.mp3");
+		GM_CHECK(0 != iE && 0 != iF && iE != iF);
+		GM_CHECK(savedMap.end() == savedMap.find(iE));
+		GM_CHECK(savedMap.end() == savedMap.find(iF));
+		GM_CHECK(L"e.mp3" == dataManager.FindAudio(iE));
+		GM_CHECK(L"f.mp3" == dataManager.FindAudio(iF));
+	}
+}
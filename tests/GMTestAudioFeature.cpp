@@ -0,0 +1,291 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioFeature.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioFeature
+///				ƵǶȵĲԣϳɵĴ/Сң棬ԼÿƵ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMAudioFeature.h"
+#include "GMAudioAnalyzer.h"
+#include "bass.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <map>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_TEST_FEATURE_RATE		(44100.0f)		// ϳźŵĲ
+#define GM_TEST_PI					(3.141592653589793)
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* ɺңÿ6г1/h˥λ
+* @param midiVector:	MIDI
+* @param fSec:			ʱλs
+* @param fBPM:			0ʱٶȼĵ
+* @param iSeed:			λ
+*/
+static std::vector<float> _MakeChord(const std::vector<int>& midiVector, const double fSec, const double fBPM,
+	const unsigned int iSeed)
+{
+	std::vector<float> chordVector(size_t(fSec * GM_TEST_FEATURE_RATE));
+	std::mt19937 rng(iSeed);
+	std::uniform_real_distribution<double> phase(0.0, 2.0 * GM_TEST_PI);
+	for (const int iMidi : midiVector)
+	{
+		const double fFreq = 440.0 * std::pow(2.0, (iMidi - 69) / 12.0);
+		for (int h = 1; h <= 6; h++)
+		{
+			const double fPhase = phase(rng);
+			const double fStep = 2.0 * GM_TEST_PI * fFreq * h / GM_TEST_FEATURE_RATE;
+			for (size_t i = 0; i < chordVector.size(); i++)
+			{
+				chordVector[i] += float(0.3 / h * std::sin(fStep * i + fPhase));
+			}
+		}
+	}
+	if (fBPM > 0.0)
+	{
+		const double fPeriod = 60.0 / fBPM;
+		for (size_t i = 0; i < chordVector.size(); i++)
+		{
+			const double t = std::fmod(i / double(GM_TEST_FEATURE_RATE), fPeriod);
+			chordVector[i] *= float(0.3 + 0.7 * std::exp(-t * 8.0));
+		}
+	}
+	return chordVector;
+}
+
+/** @brief floatת16λPCMֵС */
+static std::vector<int16_t> _ToPcm(const std::vector<float>& monoVector)
+{
+	std::vector<int16_t> pcmVector(monoVector.size());
+	for (size_t i = 0; i < monoVector.size(); i++)
+	{
+		pcmVector[i] = int16_t(std::lround((std::max)(-1.0f, (std::min)(1.0f, monoVector[i] * 0.4f)) * 32767.0f));
+	}
+	return pcmVector;
+}
+
+/** @brief ȡһȫ */
+static std::map<std::wstring, SGMAudioAnalysis> _Analyze(CGMAudioAnalyzer& analyzer, const std::wstring& strPath,
+	const std::vector<std::wstring>& nameVector, const std::string& strCache)
+{
+	std::map<std::wstring, SGMAudioAnalysis> resultMap;
+	std::vector<SGMAudioAnalysis> resultVector;
+	if (!analyzer.Start(strPath, nameVector, strCache)) return resultMap;
+
+	const auto tEnd = std::chrono::steady_clock::now() + std::chrono::seconds(120);
+	while (analyzer.IsRunning() && std::chrono::steady_clock::now() < tEnd)
+	{
+		analyzer.PopResults(resultVector, 16);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	for (auto& itr : resultVector) resultMap[itr.name] = itr;
+	return resultMap;
+}
+
+/** @brief ȫͬ */
+static bool _SameFeature(const SGMAudioFeature& sA, const SGMAudioFeature& sB)
+{
+	return 0 == memcmp(&sA, &sB, sizeof(SGMAudioFeature));
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioFeature_Sine)
+{
+	std::vector<float> sineVector(size_t(20 * GM_TEST_FEATURE_RATE));
+	for (size_t i = 0; i < sineVector.size(); i++)
+	{
+		sineVector[i] = 0.5f * float(std::sin(2.0 * GM_TEST_PI * 1000.0 * i / GM_TEST_FEATURE_RATE));
+	}
+	CGMAudioFeature feature;
+	SGMAudioFeature sFeature;
+	GM_CHECK(feature.Extract(sineVector.data(), sineVector.size(), GM_TEST_FEATURE_RATE, sFeature));
+	GM_CHECK_NEAR(1000.0, sFeature.fCentroid, 30.0);
+	GM_CHECK_NEAR(1000.0, sFeature.fRolloff, 30.0);
+	// 0.5ңRMSΪ-9dBFSûͽ
+	GM_CHECK_NEAR(-9.03, sFeature.fLoudness, 0.5);
+	GM_CHECK(sFeature.fDynamics < 0.5f);
+	GM_CHECK(0.0f == sFeature.fBPM);
+
+	// ̫̻߾
+	GM_CHECK(!feature.Extract(sineVector.data(), 100, GM_TEST_FEATURE_RATE, sFeature));
+	std::vector<float> silenceVector(sineVector.size(), 0.0f);
+	GM_CHECK(!feature.Extract(silenceVector.data(), silenceVector.size(), GM_TEST_FEATURE_RATE, sFeature));
+}
+
+GM_TEST(AudioFeature_MajorMinor)
+{
+	// C3B312ƫСƫСҴҵЧ۸
+	CGMAudioFeature feature;
+	for (int iRoot = 48; iRoot < 60; iRoot++)
+	{
+		const std::vector<float> majorVector = _MakeChord({ iRoot, iRoot + 4, iRoot + 7 }, 20.0, 100.0, iRoot);
+		const std::vector<float> minorVector = _MakeChord({ iRoot, iRoot + 3, iRoot + 7 }, 20.0, 100.0, iRoot);
+		SGMAudioFeature sMajor, sMinor;
+		GM_CHECK(feature.Extract(majorVector.data(), majorVector.size(), GM_TEST_FEATURE_RATE, sMajor));
+		GM_CHECK(feature.Extract(minorVector.data(), minorVector.size(), GM_TEST_FEATURE_RATE, sMinor));
+
+		double fValenceMajor, fArousalMajor, fValenceMinor, fArousalMinor;
+		CGMAudioFeature::Feature2Emotion(sMajor, fValenceMajor, fArousalMajor);
+		CGMAudioFeature::Feature2Emotion(sMinor, fValenceMinor, fArousalMinor);
+		printf("  root %d: major mode %+.3f clarity %.2f valence %+.2f | minor mode %+.3f clarity %.2f valence %+.2f\n",
+			iRoot, sMajor.fMode, sMajor.fKeyClarity, fValenceMajor, sMinor.fMode, sMinor.fKeyClarity, fValenceMinor);
+		GM_CHECK(sMajor.fMode > 0.0f);
+		GM_CHECK(sMinor.fMode < 0.0f);
+		GM_CHECK(fValenceMajor > fValenceMinor);
+	}
+}
+
+GM_TEST(AudioFeature_EmotionAngle)
+{
+	// ŭϲ֡ĸ
+	const double vEmotion[4][2] = { { -1.0, 1.0 }, { 1.0, 1.0 }, { 1.0, -1.0 }, { -1.0, -1.0 } };
+	for (int i = 0; i < 4; i++)
+	{
+		GM_CHECK_NEAR(i * GM_TEST_PI * 0.5, CGMAudioFeature::Emotion2Angle(vEmotion[i][0], vEmotion[i][1]), 1e-9);
+	}
+
+	// 붼[0,2*PI)ڣҽȷ
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<double> value(-1.0, 1.0);
+	for (int i = 0; i < 10000; i++)
+	{
+		const double fValence = value(rng);
+		const double fArousal = value(rng);
+		const double fAngle = CGMAudioFeature::Emotion2Angle(fValence, fArousal);
+		GM_CHECK(fAngle >= 0.0 && fAngle < 2.0 * GM_TEST_PI);
+		GM_CHECK(fAngle == CGMAudioFeature::Emotion2Angle(fValence, fArousal));
+	}
+	GM_CHECK(CGMAudioFeature::Emotion2Angle(0.0, 0.0) >= 0.0);
+}
+
+GM_TEST(AudioAnalyzer_FeatureCache)
+{
+	BASS_Init(0, 44100, 0, nullptr, nullptr);
+	CGMTestLibrary library("AudioAnalyzer_Cache");
+	const std::wstring strPath = library.GetMusicPath();
+	const std::string strCache = library.GetPath() + "Core/Users/AudioFeature.cache";
+	std::vector<std::wstring> nameVector = { L"major.wav", L"minor.wav" };
+	GM_CHECK(CGMTestLibrary::WriteWav(strPath + nameVector[0], 44100, 1, _ToPcm(_MakeChord({ 60, 64, 67 }, 30.0, 120.0, 1))));
+	GM_CHECK(CGMTestLibrary::WriteWav(strPath + nameVector[1], 44100, 1, _ToPcm(_MakeChord({ 57, 60, 64 }, 30.0, 90.0, 2))));
+
+	// ϣֻļСβ64KBйأһݲм64KBϣ䣬Ľ᲻ͬ
+	// ԭļȫͬ˵˻
+	std::filesystem::copy_file(std::filesystem::path(strPath + nameVector[0]), std::filesystem::path(strPath + L"renamed.wav"));
+	{
+		std::fstream file(std::filesystem::path(strPath + L"renamed.wav"), std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(std::filesystem::file_size(std::filesystem::path(strPath + L"renamed.wav")) / 2);
+		const std::vector<char> zeroVector(65536, 0);
+		file.write(zeroVector.data(), zeroVector.size());
+	}
+	unsigned long long iHashA = 0, iHashB = 0, iHashRenamed = 0;
+	GM_CHECK(CGMAudioAnalyzer::HashFile(strPath + nameVector[0], iHashA));
+	GM_CHECK(CGMAudioAnalyzer::HashFile(strPath + nameVector[1], iHashB));
+	GM_CHECK(CGMAudioAnalyzer::HashFile(strPath + L"renamed.wav", iHashRenamed));
+	GM_CHECK(iHashA == iHashRenamed);
+	GM_CHECK(iHashA != iHashB);
+	GM_CHECK(!CGMAudioAnalyzer::HashFile(strPath + L"missing.wav", iHashA));
+
+	std::map<std::wstring, SGMAudioAnalysis> coldMap;
+	{
+		CGMAudioAnalyzer analyzer;
+		coldMap = _Analyze(analyzer, strPath, nameVector, strCache);
+	}
+	GM_CHECK(2 == coldMap.size());
+	GM_CHECK(coldMap[L"major.wav"].bValid && coldMap[L"minor.wav"].bValid);
+	GM_CHECK(coldMap[L"major.wav"].sFeature.fMode > 0.0f);
+	GM_CHECK(coldMap[L"minor.wav"].sFeature.fMode < 0.0f);
+	GM_CHECK(std::filesystem::exists(strCache));
+
+	// µķȡ棺ļҲл棬һȫͬ
+	nameVector.push_back(L"renamed.wav");
+	std::map<std::wstring, SGMAudioAnalysis> warmMap;
+	{
+		CGMAudioAnalyzer analyzer;
+		warmMap = _Analyze(analyzer, strPath, nameVector, strCache);
+	}
+	GM_CHECK(3 == warmMap.size());
+	GM_CHECK(_SameFeature(coldMap[L"major.wav"].sFeature, warmMap[L"major.wav"].sFeature));
+	GM_CHECK(_SameFeature(coldMap[L"minor.wav"].sFeature, warmMap[L"minor.wav"].sFeature));
+	GM_CHECK(_SameFeature(coldMap[L"major.wav"].sFeature, warmMap[L"renamed.wav"].sFeature));
+
+	// 𻵵Ļ汻·Ľ
+	std::filesystem::resize_file(strCache, std::filesystem::file_size(strCache) - 1);
+	std::map<std::wstring, SGMAudioAnalysis> rebuiltMap;
+	{
+		CGMAudioAnalyzer analyzer;
+		rebuiltMap = _Analyze(analyzer, strPath, nameVector, strCache);
+	}
+	GM_CHECK(3 == rebuiltMap.size());
+	GM_CHECK(_SameFeature(coldMap[L"minor.wav"].sFeature, rebuiltMap[L"minor.wav"].sFeature));
+	// ûлʱĸȷʵͬ
+	GM_CHECK(!_SameFeature(coldMap[L"major.wav"].sFeature, rebuiltMap[L"renamed.wav"].sFeature));
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioFeature_Throughput)
+{
+	// ߳ȡһ90sȡĳͬ
+	CGMAudioFeature feature;
+	SGMAudioFeature sFeature;
+	const std::vector<float> chordVector = _MakeChord({ 60, 64, 67 }, 90.0, 120.0, 1);
+	const int iRound = 5;
+	const double fExtract = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iRound; i++) feature.Extract(chordVector.data(), chordVector.size(), GM_TEST_FEATURE_RATE, sFeature);
+	});
+	printf("  extract: %.1f ms per 90 s excerpt on one thread\n", fExtract * 1e3 / iRound);
+
+	// ûлʱ벢ȡлʱֻļϣ
+	BASS_Init(0, 44100, 0, nullptr, nullptr);
+	CGMTestLibrary library("AudioFeature_Bench");
+	const std::string strCache = library.GetPath() + "Core/Users/AudioFeature.cache";
+	std::vector<std::wstring> nameVector;
+	for (int i = 0; i < 16; i++)
+	{
+		const std::wstring strName = L"chord_" + std::to_wstring(i) + L".wav";
+		const int iRoot = 48 + i % 12;
+		CGMTestLibrary::WriteWav(library.GetMusicPath() + strName, 44100, 1,
+			_ToPcm(_MakeChord({ iRoot, iRoot + 3 + (i & 1), iRoot + 7 }, 60.0, 80.0 + 5.0 * i, i)));
+		nameVector.push_back(strName);
+	}
+
+	std::map<std::wstring, SGMAudioAnalysis> resultMap;
+	CGMAudioAnalyzer coldAnalyzer;
+	const double fCold = CGMTest::Seconds([&]() { resultMap = _Analyze(coldAnalyzer, library.GetMusicPath(), nameVector, strCache); });
+	GM_CHECK(nameVector.size() == resultMap.size());
+	CGMAudioAnalyzer warmAnalyzer;
+	const double fWarm = CGMTest::Seconds([&]() { resultMap = _Analyze(warmAnalyzer, library.GetMusicPath(), nameVector, strCache); });
+	GM_CHECK(nameVector.size() == resultMap.size());
+
+	const unsigned int iCores = std::thread::hardware_concurrency();
+	printf("  analyzer on %u threads: %.1f tracks/s without cache, %.0f tracks/s with cache\n",
+		(iCores > 1) ? iCores - 1 : 1, nameVector.size() / fCold, nameVector.size() / fWarm);
+}
@@ -0,0 +1,189 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioIndex.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioIndex
+///				ƵƹϣĲԣԼԲҵĶԱ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMAudioIndex.h"
+#include <map>
+#include <random>
+#include <cstdio>
+#include <algorithm>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief iײƵļ */
+static std::wstring _AudioName(const int i)
+{
+	return L"Artist " + std::to_wstring(i % 97) + L"/Album/" + std::to_wstring(i) + L" - Song.mp3";
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioIndex_Normalize)
+{
+	GM_CHECK(CGMAudioIndex::Normalize(L"A\\B/Song.MP3") == L"a/b/song.mp3");
+	GM_CHECK(CGMAudioIndex::Normalize(L"") == L"");
+
+	CGMAudioIndex index;
+	GM_CHECK(index.Insert(L"Music\\ABC.flac", 7));
+	GM_CHECK(7 == index.Find(L"music/abc.FLAC"));
+	GM_CHECK(0 == index.Find(L"music/abc.mp3"));
+}
+
+GM_TEST(AudioIndex_InsertErase)
+{
+	CGMAudioIndex index;
+	GM_CHECK(!index.Insert(L"zero.mp3", 0));
+	GM_CHECK(0 == index.GetSize());
+
+	GM_CHECK(index.Insert(L"a.mp3", 5));
+	GM_CHECK(index.Insert(L"b.mp3", 2));
+	GM_CHECK(index.Insert(L"c.mp3", 9));
+	GM_CHECK(3 == index.GetSize());
+	// ѱUIDռ
+	GM_CHECK(!index.Insert(L"A.MP3", 3));
+	GM_CHECK(!index.Contains(3));
+
+	GM_CHECK(0 == index.Rank(2));
+	GM_CHECK(1 == index.Rank(5));
+	GM_CHECK(2 == index.Rank(9));
+	GM_CHECK(-1 == index.Rank(4));
+
+	// ͬһUIDƣʧЧ
+	GM_CHECK(index.Insert(L"a2.mp3", 5));
+	GM_CHECK(0 == index.Find(L"a.mp3"));
+	GM_CHECK(5 == index.Find(L"a2.mp3"));
+	GM_CHECK(3 == index.GetSize());
+
+	GM_CHECK(index.Erase(2));
+	GM_CHECK(!index.Erase(2));
+	GM_CHECK(0 == index.Find(L"b.mp3"));
+	GM_CHECK(!index.Contains(2));
+	GM_CHECK(0 == index.Rank(5));
+	GM_CHECK(1 == index.Rank(9));
+	GM_CHECK(2 == index.GetSize());
+
+	index.Clear();
+	GM_CHECK(0 == index.GetSize());
+	GM_CHECK(0 == index.Find(L"c.mp3"));
+	GM_CHECK(!index.Contains(9));
+}
+
+GM_TEST(AudioIndex_RandomAgainstMap)
+{
+	// 롢ɾstd::mapĽȽϣĹؽϣ
+	const int iNameNum = 3000;
+	const unsigned int iMaxUID = 4000;
+	std::mt19937 rng(12345);
+	CGMAudioIndex index;
+	std::map<unsigned int, int> refMap;	// UID -> 
+	std::map<int, unsigned int> nameMap;	//  -> UID
+
+	for (int iStep = 0; iStep < 60000; iStep++)
+	{
+		const unsigned int iUID = 1 + rng() % iMaxUID;
+		const int iName = int(rng() % iNameNum);
+		if (rng() % 3)
+		{
+			const auto itrName = nameMap.find(iName);
+			const bool bExpect = (nameMap.end() == itrName) || (itrName->second == iUID);
+			GM_CHECK(bExpect == index.Insert(_AudioName(iName), iUID));
+			if (bExpect)
+			{
+				const auto itrOld = refMap.find(iUID);
+				if (refMap.end() != itrOld) nameMap.erase(itrOld->second);
+				refMap[iUID] = iName;
+				nameMap[iName] = iUID;
+			}
+		}
+		else
+		{
+			const auto itrOld = refMap.find(iUID);
+			GM_CHECK((refMap.end() != itrOld) == index.Erase(iUID));
+			if (refMap.end() != itrOld)
+			{
+				nameMap.erase(itrOld->second);
+				refMap.erase(itrOld);
+			}
+		}
+	}
+
+	GM_CHECK(refMap.size() == index.GetSize());
+	int iRank = 0;
+	for (auto& itr : refMap)
+	{
+		GM_CHECK(itr.first == index.Find(_AudioName(itr.second)));
+		GM_CHECK(iRank == index.Rank(itr.first));
+		iRank++;
+	}
+	for (int i = 0; i < iNameNum; i++)
+	{
+		const auto itrName = nameMap.find(i);
+		const unsigned int iExpect = (nameMap.end() == itrName) ? 0 : itrName->second;
+		GM_CHECK(iExpect == index.Find(_AudioName(i)));
+	}
+	for (unsigned int iUID = 1; iUID <= iMaxUID + 1; iUID++)
+	{
+		GM_CHECK((refMap.end() != refMap.find(iUID)) == index.Contains(iUID));
+	}
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioIndex_FindVsLinear)
+{
+	// عǰһԲȽϹ淶֮ǰ
+	for (const int iNum : { 1000, 10000, 50000 })
+	{
+		std::vector<std::wstring> nameVector;
+		nameVector.reserve(iNum);
+		CGMAudioIndex index;
+		index.Reserve(iNum);
+		for (int i = 0; i < iNum; i++)
+		{
+			nameVector.push_back(_AudioName(i));
+			index.Insert(nameVector.back(), (unsigned int)(i + 1));
+		}
+
+		const int iQueryNum = 2000;
+		std::mt19937 rng(7);
+		std::vector<int> queryVector(iQueryNum);
+		for (auto& q : queryVector) q = int(rng() % iNum);
+
+		unsigned long long iSumLinear = 0;
+		const double fLinear = CGMTest::Seconds([&]() {
+			for (const int q : queryVector)
+			{
+				for (int i = 0; i < iNum; i++)
+				{
+					if (nameVector[i] == nameVector[q]) { iSumLinear += i + 1; break; }
+				}
+			}
+		});
+		unsigned long long iSumIndex = 0;
+		const double fIndex = CGMTest::Seconds([&]() {
+			for (const int q : queryVector) iSumIndex += index.Find(nameVector[q]);
+		});
+		GM_CHECK(iSumLinear == iSumIndex);
+
+		printf("  %6d audios: linear %9.3f us/query, index %7.3f us/query, %.0fx\n",
+			iNum, fLinear * 1e6 / iQueryNum, fIndex * 1e6 / iQueryNum, fLinear / (std::max)(fIndex, 1e-9));
+	}
+}
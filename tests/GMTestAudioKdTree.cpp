@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioKdTree.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioKdTree
+///				Ƶk-dĲԣԱΪ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMAudioKdTree.h"
+#include <map>
+#include <random>
+#include <cstdio>
+#include <algorithm>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief 㣬CGMAudioKdTree::NearestͬUIDû򷵻0 */
+static unsigned int _BruteNearest(const std::map<unsigned int, SGMKdPoint>& pointMap,
+	const float fX, const float fY, const float fMaxDistance)
+{
+	float fBestDis2 = fMaxDistance * fMaxDistance;
+	unsigned int iBestUID = 0;
+	for (auto& itr : pointMap)
+	{
+		float fDX = itr.second.x - fX;
+		float fDY = itr.second.y - fY;
+		float fDis2 = fDX * fDX + fDY * fDY;
+		// mapUID򣬾ͬʱUIDС
+		if (fDis2 <= fBestDis2 && (0 == iBestUID || fDis2 < fBestDis2))
+		{
+			fBestDis2 = fDis2;
+			iBestUID = itr.first;
+		}
+	}
+	return iBestUID;
+}
+
+/** @brief k-dңUIDû򷵻0 */
+static unsigned int _TreeNearest(const CGMAudioKdTree& tree, const float fX, const float fY, const float fMaxDistance)
+{
+	SGMKdPoint sPoint;
+	return tree.Nearest(fX, fY, fMaxDistance, sPoint) ? sPoint.UID : 0;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioKdTree_Basic)
+{
+	CGMAudioKdTree tree;
+	SGMKdPoint sPoint;
+	GM_CHECK(!tree.Nearest(0.0f, 0.0f, 10.0f, sPoint));
+	GM_CHECK(!tree.Insert(0, 0.0f, 0.0f));
+
+	tree.Build({ { 0.5f, 0.5f, 3 }, { -0.5f, 0.5f, 1 }, { 0.5f, -0.5f, 2 }, { 0.9f, 0.9f, 3 } });
+	// UIDظʱԺΪ׼
+	GM_CHECK(3 == tree.GetSize());
+	GM_CHECK(3 == _TreeNearest(tree, 0.8f, 0.8f, 1.0f));
+	GM_CHECK(0 == _TreeNearest(tree, 0.5f, 0.5f, 0.1f));
+	// ͬʱȡUIDС
+	GM_CHECK(1 == _TreeNearest(tree, 0.0f, 0.0f, 1.0f));
+
+	GM_CHECK(tree.Erase(1));
+	GM_CHECK(!tree.Erase(1));
+	GM_CHECK(2 == _TreeNearest(tree, 0.0f, 0.0f, 1.0f));
+	GM_CHECK(tree.Insert(5, 0.01f, 0.0f));
+	GM_CHECK(5 == _TreeNearest(tree, 0.0f, 0.0f, 1.0f));
+	// ƶеĵ
+	GM_CHECK(tree.Insert(5, -0.9f, -0.9f));
+	GM_CHECK(2 == _TreeNearest(tree, 0.0f, 0.0f, 1.0f));
+	GM_CHECK(3 == tree.GetSize());
+	tree.Flush();
+	GM_CHECK(3 == tree.GetSize());
+	GM_CHECK(5 == _TreeNearest(tree, -1.0f, -1.0f, 1.0f));
+
+	tree.Clear();
+	GM_CHECK(0 == tree.GetSize());
+	GM_CHECK(!tree.Nearest(0.0f, 0.0f, 10.0f, sPoint));
+}
+
+GM_TEST(AudioKdTree_RandomAgainstBrute)
+{
+	// ɾģѯǴϲбɾǺؽ
+	std::mt19937 rng(2026);
+	std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+	const unsigned int iMaxUID = 3000;
+	CGMAudioKdTree tree;
+	std::map<unsigned int, SGMKdPoint> pointMap;
+
+	std::vector<SGMKdPoint> initVector;
+	for (unsigned int i = 1; i <= 1000; i++)
+	{
+		initVector.emplace_back(coord(rng), coord(rng), i);
+		pointMap[i] = initVector.back();
+	}
+	tree.Build(initVector);
+
+	int iMismatch = 0;
+	for (int iStep = 0; iStep < 20000; iStep++)
+	{
+		const unsigned int iUID = 1 + rng() % iMaxUID;
+		switch (rng() % 4)
+		{
+		case 0:
+		{
+			GM_CHECK((pointMap.count(iUID) > 0) == tree.Erase(iUID));
+			pointMap.erase(iUID);
+		}
+		break;
+		case 1:
+		{
+			// ϣȾ
+			const float fX = std::round(coord(rng) * 16.0f) / 16.0f;
+			const float fY = std::round(coord(rng) * 16.0f) / 16.0f;
+			tree.Insert(iUID, fX, fY);
+			pointMap[iUID] = SGMKdPoint(fX, fY, iUID);
+		}
+		break;
+		default:
+		{
+			const float fX = coord(rng);
+			const float fY = coord(rng);
+			const float fMaxDis = (rng() % 2) ? 0.05f : 3.0f;
+			if (_BruteNearest(pointMap, fX, fY, fMaxDis) != _TreeNearest(tree, fX, fY, fMaxDis)) iMismatch++;
+		}
+		break;
+		}
+		if (0 == iStep % 5000) tree.Flush();
+	}
+	GM_CHECK(0 == iMismatch);
+	GM_CHECK(pointMap.size() == tree.GetSize());
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioKdTree_NearestVsBrute)
+{
+	for (const int iNum : { 1000, 10000, 100000 })
+	{
+		std::mt19937 rng(11);
+		std::uniform_real_distribution<float> coord(-1.0f, 1.0f);
+		std::map<unsigned int, SGMKdPoint> pointMap;
+		std::vector<SGMKdPoint> pointVector;
+		for (int i = 1; i <= iNum; i++)
+		{
+			pointVector.emplace_back(coord(rng), coord(rng), (unsigned int)i);
+			pointMap[(unsigned int)i] = pointVector.back();
+		}
+		CGMAudioKdTree tree;
+		const double fBuild = CGMTest::Seconds([&]() { tree.Build(pointVector); });
+
+		const int iQueryNum = 1000;
+		std::vector<SGMKdPoint> queryVector;
+		for (int i = 0; i < iQueryNum; i++) queryVector.emplace_back(coord(rng), coord(rng), 0);
+
+		unsigned long long iSumBrute = 0;
+		const double fBrute = CGMTest::Seconds([&]() {
+			for (auto& q : queryVector) iSumBrute += _BruteNearest(pointMap, q.x, q.y, 0.1f);
+		});
+		unsigned long long iSumTree = 0;
+		const double fTree = CGMTest::Seconds([&]() {
+			for (auto& q : queryVector) iSumTree += _TreeNearest(tree, q.x, q.y, 0.1f);
+		});
+		GM_CHECK(iSumBrute == iSumTree);
+
+		printf("  %6d audios: build %7.2f ms, brute %9.3f us/query, kd-tree %6.3f us/query, %.0fx\n",
+			iNum, fBuild * 1e3, fBrute * 1e6 / iQueryNum, fTree * 1e6 / iQueryNum,
+			fBrute / (std::max)(fTree, 1e-9));
+	}
+}
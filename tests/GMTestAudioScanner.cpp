@@ -0,0 +1,236 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioScanner.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioScanner
+///				ƵļɨĲԣ;ֹͣĻعƵɨ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMAudioScanner.h"
+#include "GMAudioIndex.h"
+#include "GMDataManager.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <unordered_set>
+#include <cstdio>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ȡɨȫ */
+static std::vector<SGMScanEvent> _PopAll(CGMAudioScanner& scanner)
+{
+	std::vector<SGMScanEvent> eventVector;
+	while (scanner.IsScanning())
+	{
+		scanner.PopEvents(eventVector, 64);
+	}
+	return eventVector;
+}
+
+/** @brief :ļͳɨ */
+static std::map<std::wstring, int> _Count(const std::vector<SGMScanEvent>& eventVector)
+{
+	const wchar_t* strType[] = { L"add:", L"remove:", L"change:" };
+	std::map<std::wstring, int> countMap;
+	for (auto& itr : eventVector)
+	{
+		countMap[strType[itr.eType] + itr.name]++;
+	}
+	return countMap;
+}
+
+/** @brief дһļݾļС */
+static void _WriteFile(const std::string& strPath, const std::string& strContent)
+{
+	std::ofstream(strPath, std::ios::binary) << strContent;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioScanner_Incremental)
+{
+	const std::string strDir = CGMTest::GetTempPath() + "AudioScanner_Incremental/";
+	std::filesystem::remove_all(strDir);
+	std::filesystem::create_directories(strDir + "sub");
+	_WriteFile(strDir + "a.mp3", "a");
+	_WriteFile(strDir + "b.MP3", "b");
+	_WriteFile(strDir + "c.txt", "c");
+	_WriteFile(strDir + "d.wav", "d");
+	_WriteFile(strDir + "sub/e.mp3", "e");
+	const std::wstring strPath = std::filesystem::path(strDir).wstring();
+	const std::vector<std::wstring> formatVector = { L"mp3", L"wav" };
+
+	// һɨ裺ֵֻ֧ͣļ
+	CGMAudioScanner scanner;
+	GM_CHECK(scanner.Start(strPath, formatVector));
+	std::map<std::wstring, int> countMap = _Count(_PopAll(scanner));
+	GM_CHECK(3 == countMap.size());
+	GM_CHECK(1 == countMap[L"add:a.mp3"]);
+	GM_CHECK(1 == countMap[L"add:b.MP3"]);
+	GM_CHECK(1 == countMap[L"add:d.wav"]);
+
+	// ûб仯ʱ
+	GM_CHECK(scanner.Start(strPath, formatVector));
+	GM_CHECK(_PopAll(scanner).empty());
+
+	// ޸ġɾ
+	_WriteFile(strDir + "a.mp3", "a longer file");
+	std::filesystem::remove(strDir + "b.MP3");
+	_WriteFile(strDir + "f.ogg", "f");
+	_WriteFile(strDir + "g.Wav", "g");
+	GM_CHECK(scanner.Start(strPath, formatVector));
+	countMap = _Count(_PopAll(scanner));
+	GM_CHECK(3 == countMap.size());
+	GM_CHECK(1 == countMap[L"change:a.mp3"]);
+	GM_CHECK(1 == countMap[L"remove:b.MP3"]);
+	GM_CHECK(1 == countMap[L"add:g.Wav"]);
+
+	// ļ޷ȡʱΪļɾˣҲ޸еļ¼
+	GM_CHECK(scanner.Start(strPath + L"missing/", formatVector));
+	GM_CHECK(_PopAll(scanner).empty());
+	GM_CHECK(scanner.Start(strPath, formatVector));
+	GM_CHECK(_PopAll(scanner).empty());
+
+	std::filesystem::remove_all(strDir);
+}
+
+GM_TEST(AudioScanner_StopRollback)
+{
+	const std::string strDir = CGMTest::GetTempPath() + "AudioScanner_Stop/";
+	std::filesystem::remove_all(strDir);
+	std::filesystem::create_directories(strDir);
+	for (int i = 0; i < 1000; i++) _WriteFile(strDir + std::to_string(i) + ".mp3", std::to_string(i));
+	const std::wstring strPath = std::filesystem::path(strDir).wstring();
+
+	CGMAudioScanner scanner;
+	// ûȡʱܿʼµɨ
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	GM_CHECK(!scanner.Start(strPath, { L"mp3" }));
+
+	// ֻȡһ־ֹͣĽһɨ
+	std::vector<SGMScanEvent> eventVector;
+	while (eventVector.size() < 100 && scanner.IsScanning()) scanner.PopEvents(eventVector, 10);
+	scanner.Stop();
+	GM_CHECK(!scanner.IsScanning());
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	GM_CHECK(1000 == _Count(_PopAll(scanner)).size());
+
+	// ֹͣҲһ
+	std::filesystem::remove(strDir + "0.mp3");
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	scanner.Stop();
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	eventVector = _PopAll(scanner);
+	GM_CHECK(1 == eventVector.size() && EGMSCAN_REMOVE == eventVector[0].eType);
+
+	std::filesystem::remove_all(strDir);
+}
+
+GM_TEST(AudioScanner_ScannedNames)
+{
+	const std::string strDir = CGMTest::GetTempPath() + "AudioScanner_Names/";
+	std::filesystem::remove_all(strDir);
+	std::filesystem::create_directories(strDir);
+	_WriteFile(strDir + "a.mp3", "a");
+	_WriteFile(strDir + "B.Mp3", "b");
+	_WriteFile(strDir + "c.txt", "c");
+	const std::wstring strPath = std::filesystem::path(strDir).wstring();
+	std::unordered_set<std::wstring> nameSet = { L"stale" };
+
+	// ûɨ
+	CGMAudioScanner scanner;
+	GM_CHECK(!scanner.GetScannedNames(nameSet));
+	GM_CHECK(nameSet.empty());
+
+	// ûȡʱûбȫȡǹ淶ļֵ֧
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	GM_CHECK(!scanner.GetScannedNames(nameSet));
+	GM_CHECK(2 == _PopAll(scanner).size());
+	GM_CHECK(scanner.GetScannedNames(nameSet));
+	GM_CHECK(std::unordered_set<std::wstring>({ CGMAudioIndex::Normalize(L"a.mp3"), CGMAudioIndex::Normalize(L"B.Mp3") }) == nameSet);
+
+	// ɾļһɨб
+	std::filesystem::remove(strDir + "a.mp3");
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	_PopAll(scanner);
+	GM_CHECK(scanner.GetScannedNames(nameSet));
+	GM_CHECK(1 == nameSet.size() && 1 == nameSet.count(CGMAudioIndex::Normalize(L"B.Mp3")));
+
+	// ļ޷ȡɨ豻ֹͣʱΪļб
+	GM_CHECK(scanner.Start(strPath + L"missing/", { L"mp3" }));
+	_PopAll(scanner);
+	GM_CHECK(!scanner.GetScannedNames(nameSet));
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	scanner.Stop();
+	GM_CHECK(!scanner.GetScannedNames(nameSet));
+	GM_CHECK(scanner.Start(strPath, { L"mp3" }));
+	_PopAll(scanner);
+	GM_CHECK(scanner.GetScannedNames(nameSet));
+	GM_CHECK(1 == nameSet.size());
+
+	std::filesystem::remove_all(strDir);
+}
+
+GM_TEST(AudioScanner_LibraryRescan)
+{
+	CGMTestLibrary library("AudioScanner_Rescan");
+	GM_CHECK(library.AddFile(L"a.mp3"));
+
+	CGMDataManager dataManager;
+	GM_CHECK(dataManager.Init(nullptr, library.GetConfig()));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return dataManager.FindAudio(L"a.mp3"); }));
+
+	// ڼļɨƵ
+	GM_CHECK(library.AddFile(L"b.mp3"));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return dataManager.RescanAudioFiles(); }));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return dataManager.FindAudio(L"b.mp3"); }));
+	GM_CHECK(2 == dataManager.GetAudioDataMap().size());
+
+	// ڼɾļɨƵɾ
+	GM_CHECK(library.RemoveFile(L"a.mp3"));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return dataManager.RescanAudioFiles(); }));
+	GM_CHECK(CGMTestLibrary::WaitFor(dataManager, [&]() { return !dataManager.FindAudio(L"a.mp3"); }));
+	GM_CHECK(1 == dataManager.GetAudioDataMap().size());
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioScanner_FullVsIncremental)
+{
+	const int iNum = 20000;
+	const std::string strDir = CGMTest::GetTempPath() + "AudioScanner_Bench/";
+	std::filesystem::remove_all(strDir);
+	std::filesystem::create_directories(strDir);
+	for (int i = 0; i < iNum; i++) _WriteFile(strDir + "Song " + std::to_string(i) + ".mp3", std::to_string(i));
+	const std::wstring strPath = std::filesystem::path(strDir).wstring();
+
+	CGMAudioScanner scanner;
+	size_t iFirst = 0;
+	const double fFirst = CGMTest::Seconds([&]() { scanner.Start(strPath, { L"mp3" }); iFirst = _PopAll(scanner).size(); });
+	size_t iSecond = 0;
+	const double fSecond = CGMTest::Seconds([&]() { scanner.Start(strPath, { L"mp3" }); iSecond = _PopAll(scanner).size(); });
+	for (int i = 0; i < 100; i++) std::filesystem::remove(strDir + "Song " + std::to_string(i * 7) + ".mp3");
+	size_t iThird = 0;
+	const double fThird = CGMTest::Seconds([&]() { scanner.Start(strPath, { L"mp3" }); iThird = _PopAll(scanner).size(); });
+	GM_CHECK(size_t(iNum) == iFirst && 0 == iSecond && 100 == iThird);
+
+	printf("  %d files: first scan %.1f ms (%zu events), unchanged %.1f ms (%zu), 100 deleted %.1f ms (%zu)\n",
+		iNum, fFirst * 1e3, iFirst, fSecond * 1e3, iSecond, fThird * 1e3, iThird);
+	std::filesystem::remove_all(strDir);
+}
@@ -0,0 +1,300 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestAudioSlots.cpp
+/// @brief		Galaxy-Music Engine - GMTestAudioSlots
+///				ƵǲλĲԣstd::mapΪգģҳĶ㻺ƵƵһ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMAudioSlots.h"
+#include <map>
+#include <set>
+#include <random>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* ƵǵĶ㣬еĶɫСͬ
+* @author LiuTao
+* @since 2026.10.18
+*/
+struct SGMTestStarVertex
+{
+	float vPos[3];
+	float vColor[4];
+};
+
+/**
+* osgķҳ㻺壺ÿһҳһһ飬ֻϴ޸ĵҳ
+* Ƶǵķҳ߼ͬɾ֮Ƶ
+* @author LiuTao
+* @since 2026.10.18
+*/
+struct SGMTestStarPages
+{
+	SGMTestStarPages() : iUploaded(0) {}
+
+	/** @brief UIDƵɶ */
+	static SGMTestStarVertex MakeVertex(const unsigned int iUID, const float fRank)
+	{
+		SGMTestStarVertex sVertex;
+		const float fAngle = std::fmod(iUID * 0.37f + fRank, 6.28f);
+		const float fHue = std::fmod(fAngle / 6.28f, 1.0f);
+		sVertex.vPos[0] = fAngle;
+		sVertex.vPos[1] = fRank;
+		sVertex.vPos[2] = float(iUID);
+		sVertex.vColor[0] = std::fmin(std::fmax(std::fabs(4.0f * fHue - 2.5f) - 0.5f, 0.0f), 1.0f);
+		sVertex.vColor[1] = std::fmin(std::fmax(1.5f - std::fabs(4.0f * fHue - 1.5f), 0.0f), 1.0f);
+		sVertex.vColor[2] = 1.0f - std::fmin(std::fmax(std::fabs(4.0f * fHue - 3.0f), 0.0f), 1.0f);
+		sVertex.vColor[3] = 1.0f;
+		return sVertex;
+	}
+
+	/** @brief ޸һǣ㲻ʱΪ޸ */
+	void Set(const unsigned int iUID, const float fRank)
+	{
+		const SGMTestStarVertex sVertex = MakeVertex(iUID, fRank);
+		int iSlot = slots.GetSlot(iUID);
+		const bool bNew = (-1 == iSlot);
+		if (bNew) iSlot = slots.Acquire(iUID);
+
+		const size_t iPage = size_t(iSlot) / slots.GetPageSize();
+		while (vertexPages.size() <= iPage)
+		{
+			vertexPages.emplace_back(slots.GetPageSize());
+			elementPages.emplace_back();
+		}
+		SGMTestStarVertex& sOld = vertexPages[iPage][size_t(iSlot) % slots.GetPageSize()];
+		if (!bNew && 0 == std::memcmp(&sOld, &sVertex, sizeof(sVertex))) return;
+		sOld = sVertex;
+		if (!bNew) slots.Touch(iUID);
+	}
+
+	/** @brief ϴ޸ĵҳҳ㣬ֻռòλ */
+	void Flush()
+	{
+		std::vector<SGMSlotRange> rangeVector;
+		slots.PopDirtyRanges(rangeVector);
+		for (auto& itr : rangeVector)
+		{
+			std::vector<unsigned int>& elementVector = elementPages[itr.iPage];
+			elementVector.clear();
+			const size_t iFirst = itr.iPage * slots.GetPageSize();
+			for (size_t i = 0; i < slots.GetPageSize(); i++)
+			{
+				if (0 != slots.GetUID(iFirst + i)) elementVector.push_back((unsigned int)i);
+			}
+			iUploaded += slots.GetPageSize() * sizeof(SGMTestStarVertex) + elementVector.size() * sizeof(unsigned int);
+		}
+	}
+
+	CGMAudioSlots								slots;
+	std::vector<std::vector<SGMTestStarVertex>>	vertexPages;
+	std::vector<std::vector<unsigned int>>		elementPages;
+	size_t										iUploaded;
+};
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(AudioSlots_Basic)
+{
+	CGMAudioSlots slots(4);
+	std::vector<SGMSlotRange> rangeVector;
+	GM_CHECK(-1 == slots.Acquire(0));
+	for (unsigned int i = 1; i <= 10; i++) GM_CHECK(int(i - 1) == slots.Acquire(i * 10));
+	GM_CHECK(10 == slots.GetSize());
+	GM_CHECK(10 == slots.GetCapacity());
+	GM_CHECK(3 == slots.GetPageNum());
+
+	// ÿһҳһΧһҳֻΪֹ
+	GM_CHECK(3 == slots.PopDirtyRanges(rangeVector));
+	GM_CHECK(0 == rangeVector[0].iBegin && 4 == rangeVector[0].iEnd);
+	GM_CHECK(8 == rangeVector[2].iBegin && 10 == rangeVector[2].iEnd);
+	GM_CHECK(0 == slots.PopDirtyRanges(rangeVector));
+
+	// вλUIDԭĲλΪ޸
+	GM_CHECK(2 == slots.Acquire(30));
+	GM_CHECK(1 == slots.PopDirtyRanges(rangeVector));
+	GM_CHECK(0 == rangeVector[0].iPage && 2 == rangeVector[0].iBegin && 3 == rangeVector[0].iEnd);
+
+	GM_CHECK(slots.Release(50));
+	GM_CHECK(!slots.Release(50));
+	GM_CHECK(slots.Release(20));
+	GM_CHECK(0 == slots.GetUID(4));
+	GM_CHECK(-1 == slots.GetSlot(50));
+	GM_CHECK(2 == slots.PopDirtyRanges(rangeVector));
+	GM_CHECK(0 == rangeVector[0].iPage && 1 == rangeVector[0].iBegin && 2 == rangeVector[0].iEnd);
+	GM_CHECK(1 == rangeVector[1].iPage && 4 == rangeVector[1].iBegin && 5 == rangeVector[1].iEnd);
+
+	// вλȳظã
+	GM_CHECK(1 == slots.Acquire(7));
+	GM_CHECK(4 == slots.Acquire(8));
+	GM_CHECK(10 == slots.Acquire(9));
+	GM_CHECK(11 == slots.GetCapacity());
+	GM_CHECK(slots.Touch(100));
+	GM_CHECK(!slots.Touch(5));
+	slots.PopDirtyRanges(rangeVector);
+	GM_CHECK(2 == rangeVector.back().iPage && 9 == rangeVector.back().iBegin && 11 == rangeVector.back().iEnd);
+
+	// UIDĲλ
+	GM_CHECK(0 == slots.GetSlot(10));
+	GM_CHECK(3 == slots.GetSlot(40));
+	GM_CHECK(9 == slots.GetSlot(100));
+
+	slots.Clear();
+	GM_CHECK(0 == slots.GetSize());
+	GM_CHECK(0 == slots.GetCapacity());
+	GM_CHECK(-1 == slots.GetSlot(10));
+	GM_CHECK(0 == slots.PopDirtyRanges(rangeVector));
+}
+
+GM_TEST(AudioSlots_RandomAgainstMap)
+{
+	CGMAudioSlots slots(64);
+	std::map<unsigned int, int> slotMap;
+	std::mt19937 rng(1);
+	std::vector<SGMSlotRange> rangeVector;
+	int iWrong = 0;
+	for (int iStep = 0; iStep < 300000; iStep++)
+	{
+		const unsigned int iUID = 1 + rng() % 5000;
+		if (rng() % 3)
+		{
+			const int iOld = slots.GetSlot(iUID);
+			const int iSlot = slots.Acquire(iUID);
+			if (-1 != iOld && iOld != iSlot) iWrong++;
+			slotMap[iUID] = iSlot;
+		}
+		else
+		{
+			GM_CHECK((1 == slotMap.erase(iUID)) == slots.Release(iUID));
+		}
+
+		if (0 == iStep % 1000)
+		{
+			// λһһظͬʱ
+			GM_CHECK(slotMap.size() == slots.GetSize());
+			std::set<int> usedSet;
+			for (auto& itr : slotMap)
+			{
+				if (itr.second != slots.GetSlot(itr.first) || itr.first != slots.GetUID(size_t(itr.second))) iWrong++;
+				if (!usedSet.insert(itr.second).second) iWrong++;
+			}
+			GM_CHECK(slots.GetCapacity() <= 5000);
+			slots.PopDirtyRanges(rangeVector);
+			for (auto& itr : rangeVector)
+			{
+				if (itr.iBegin < itr.iPage * 64 || itr.iEnd > (itr.iPage + 1) * 64 || itr.iBegin >= itr.iEnd) iWrong++;
+			}
+		}
+	}
+	GM_CHECK(0 == iWrong);
+}
+
+GM_TEST(AudioSlots_PagesMatchLive)
+{
+	// ɾĲϴƵǴƵÿֻһ
+	SGMTestStarPages sPages;
+	std::set<unsigned int> liveSet;
+	std::mt19937 rng(2);
+	for (int iStep = 0; iStep < 50000; iStep++)
+	{
+		const unsigned int iUID = 1 + rng() % 20000;
+		if (rng() % 4)
+		{
+			sPages.Set(iUID, float(rng() % 3));
+			liveSet.insert(iUID);
+		}
+		else
+		{
+			sPages.slots.Release(iUID);
+			liveSet.erase(iUID);
+		}
+		if (0 == iStep % 97) sPages.Flush();
+	}
+	sPages.Flush();
+
+	std::set<unsigned int> drawnSet;
+	int iTwice = 0;
+	for (size_t iPage = 0; iPage < sPages.elementPages.size(); iPage++)
+	{
+		for (const unsigned int i : sPages.elementPages[iPage])
+		{
+			if (!drawnSet.insert(sPages.slots.GetUID(iPage * sPages.slots.GetPageSize() + i)).second) iTwice++;
+		}
+	}
+	GM_CHECK(0 == iTwice);
+	GM_CHECK(liveSet == drawnSet);
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(AudioSlots_EditCost)
+{
+	// 10ʱƶһƵƳټ룩ĴۣÿδmapؽȽ
+	const unsigned int iNum = 100000;
+	SGMTestStarPages sPages;
+	for (unsigned int i = 1; i <= iNum; i++) sPages.Set(i, 0.0f);
+	sPages.Flush();
+	sPages.iUploaded = 0;
+
+	std::mt19937 rng(3);
+	const int iEdits = 2000;
+	const double fIncremental = CGMTest::Seconds([&]() {
+		for (int e = 0; e < iEdits; e++)
+		{
+			const unsigned int iUID = 1 + rng() % iNum;
+			sPages.slots.Release(iUID);
+			sPages.Flush();
+			sPages.Set(iUID, float(e));
+			sPages.Flush();
+		}
+	});
+	const double fIncrementalBytes = double(sPages.iUploaded) / iEdits;
+
+	std::map<unsigned int, float> rankMap;
+	for (unsigned int i = 1; i <= iNum; i++) rankMap[i] = 0.0f;
+	std::vector<SGMTestStarVertex> vertexVector;
+	std::vector<unsigned int> elementVector;
+	const int iRebuilds = 50;
+	size_t iFullBytes = 0;
+	const double fFull = CGMTest::Seconds([&]() {
+		for (int e = 0; e < iRebuilds; e++)
+		{
+			for (int k = 0; k < 2; k++)
+			{
+				vertexVector.clear();
+				elementVector.clear();
+				vertexVector.reserve(iNum);
+				elementVector.reserve(iNum);
+				for (auto& itr : rankMap)
+				{
+					elementVector.push_back((unsigned int)vertexVector.size());
+					vertexVector.push_back(SGMTestStarPages::MakeVertex(itr.first, itr.second));
+				}
+				iFullBytes += vertexVector.size() * sizeof(SGMTestStarVertex) + elementVector.size() * sizeof(unsigned int);
+			}
+		}
+	});
+	GM_CHECK(iNum == sPages.slots.GetSize());
+	printf("  %u stars, remove + add one audio: pages %.1f us and %.0f KB uploaded, full rebuild %.1f us and %.0f KB\n",
+		iNum, fIncremental * 1e6 / iEdits, fIncrementalBytes / 1024.0,
+		fFull * 1e6 / iRebuilds, double(iFullBytes) / iRebuilds / 1024.0);
+}
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestLevelRing.cpp
+/// @brief		Galaxy-Music Engine - GMTestLevelRing
+///				ʷλĲԣÿһ֡ÿһ֡䣬shaderֵԭ֡ƶͬ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMLevelRing.h"
+#include <random>
+#include <cstdio>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ԭSetAudioLevelһֵдlevel[0] */
+static void _ShiftLevel(float* pLevel, const float fLevel)
+{
+	for (int i = GM_LEVEL_NUM - 1; i > 0; i--)
+	{
+		pLevel[i] = pLevel[i - 1];
+	}
+	pLevel[0] = fLevel;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(LevelRing_AgainstShift)
+{
+	// ܺܶȦÿ֡Ƚȫ֡
+	float vShift[GM_LEVEL_NUM] = {};
+	float vRing[GM_LEVEL_NUM] = {};
+	CGMLevelRing levelRing;
+	GM_CHECK(0 == levelRing.GetHead());
+
+	std::mt19937 rng(11);
+	std::uniform_real_distribution<float> level(0.0f, 1.0f);
+	const int iFrameNum = 100000;
+	int iWrong = 0;
+	int iWrongHead = 0;
+	for (int iFrame = 0; iFrame < iFrameNum; iFrame++)
+	{
+		const float fLevel = level(rng);
+		_ShiftLevel(vShift, fLevel);
+		const int iHead = levelRing.Push();
+		vRing[iHead] = fLevel;
+
+		if (iHead != levelRing.GetHead() || iHead < 0 || iHead >= GM_LEVEL_NUM) iWrongHead++;
+		for (int iAge = 0; iAge < GM_LEVEL_NUM; iAge++)
+		{
+			if (vRing[CGMLevelRing::Index(iHead, iAge)] != vShift[iAge]) iWrong++;
+		}
+	}
+	GM_CHECK(0 == iWrong);
+	GM_CHECK(0 == iWrongHead);
+
+	// headÿ֡һGM_LEVEL_NUM֡صԭ
+	CGMLevelRing cycleRing;
+	GM_CHECK(GM_LEVEL_NUM - 1 == cycleRing.Push());
+	for (int i = 1; i < GM_LEVEL_NUM; i++) cycleRing.Push();
+	GM_CHECK(0 == cycleRing.GetHead());
+	GM_CHECK(0 == CGMLevelRing::Index(GM_LEVEL_NUM - 1, 1));
+	GM_CHECK(GM_LEVEL_NUM - 1 == CGMLevelRing::Index(0, GM_LEVEL_NUM - 1));
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(LevelRing_ShiftVsRing)
+{
+	// ÿ֡һԭƶ飬ֻдһԪ
+	const int iFrameNum = 1000000;
+	float vShift[GM_LEVEL_NUM] = {};
+	float vRing[GM_LEVEL_NUM] = {};
+	CGMLevelRing levelRing;
+	const double fShift = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iFrameNum; i++) _ShiftLevel(vShift, float(i & 255));
+	});
+	const double fRing = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iFrameNum; i++) vRing[levelRing.Push()] = float(i & 255);
+	});
+	GM_CHECK(vRing[CGMLevelRing::Index(levelRing.GetHead(), 5)] == vShift[5]);
+	printf("  %d frames: shift %.1f ns per frame, ring %.2f ns per frame\n",
+		iFrameNum, fShift / iFrameNum * 1e9, fRing / iFrameNum * 1e9);
+}
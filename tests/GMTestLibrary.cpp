@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestLibrary.cpp
+/// @brief		Galaxy-Music Engine - GMTestLibrary
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTestLibrary.h"
+#include "GMTest.h"
+#include "GMDataManager.h"
+#include "GMXml.h"
+#include <filesystem>
+#include <fstream>
+#include <chrono>
+#include <thread>
+
+using namespace GM;
+
+/*************************************************************************
+CGMTestLibrary Methods
+*************************************************************************/
+
+CGMTestLibrary::CGMTestLibrary(const std::string& strName)
+{
+	m_strPath = CGMTest::GetTempPath() + strName + "/";
+
+	std::error_code ec;
+	std::filesystem::remove_all(m_strPath, ec);
+	std::filesystem::create_directories(m_strPath + "Core/Users", ec);
+	std::filesystem::create_directories(m_strPath + "Media/Music", ec);
+
+	m_sConfigData.strCorePath = m_strPath + "Core/";
+	m_sConfigData.strMediaPath = std::filesystem::path(m_strPath + "Media/").wstring();
+}
+
+CGMTestLibrary::~CGMTestLibrary()
+{
+	std::error_code ec;
+	std::filesystem::remove_all(m_strPath, ec);
+}
+
+bool CGMTestLibrary::AddFile(const std::wstring& strName)
+{
+	std::ofstream file(std::filesystem::path(m_sConfigData.strMediaPath + L"Music/" + strName));
+	return file.good();
+}
+
+bool CGMTestLibrary::RemoveFile(const std::wstring& strName)
+{
+	std::error_code ec;
+	return std::filesystem::remove(std::filesystem::path(m_sConfigData.strMediaPath + L"Music/" + strName), ec);
+}
+
+bool CGMTestLibrary::WriteAudioData(const std::vector<SGMAudioData>& dataVector) const
+{
+	CGMXml aXML;
+	aXML.Create(m_sConfigData.strCorePath + "Users/AudioData.xml", "Data");
+	for (auto& itr : dataVector)
+	{
+		CGMXmlNode sNode = aXML.AddChild("Audio");
+		sNode.SetPropUInt("UID", itr.UID);
+		sNode.SetPropWStr("name", itr.name.c_str());
+		sNode.SetPropDouble("BPM", itr.audioCoord.BPM);
+		sNode.SetPropDouble("angle", itr.audioCoord.angle);
+		sNode.SetPropDouble("rank", itr.audioCoord.rank);
+	}
+	return aXML.Save();
+}
+
+bool CGMTestLibrary::WaitFor(CGMDataManager& dataManager, const std::function<bool()>& condition, const double fTimeout)
+{
+	const auto tEnd = std::chrono::steady_clock::now() + std::chrono::duration<double>(fTimeout);
+	while (!condition())
+	{
+		if (std::chrono::steady_clock::now() > tEnd) return false;
+		dataManager.Update(0.0);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return true;
+}
+
+bool CGMTestLibrary::WriteWav(const std::wstring& strFile, const unsigned int iFreq, const int iChans,
+	const std::vector<int16_t>& pcmVector)
+{
+	const uint32_t iDataSize = uint32_t(pcmVector.size() * sizeof(int16_t));
+	const uint16_t iBlockAlign = uint16_t(iChans * sizeof(int16_t));
+	struct SGMWavHeader
+	{
+		char		riff[4];
+		uint32_t	iRiffSize;
+		char		wave[4];
+		char		fmt[4];
+		uint32_t	iFmtSize;
+		uint16_t	iFormat;
+		uint16_t	iChans;
+		uint32_t	iFreq;
+		uint32_t	iByteRate;
+		uint16_t	iBlockAlign;
+		uint16_t	iBits;
+		char		data[4];
+		uint32_t	iDataSize;
+	} sHeader = { {'R','I','F','F'}, 36 + iDataSize, {'W','A','V','E'}, {'f','m','t',' '}, 16, 1,
+		uint16_t(iChans), iFreq, iFreq * iBlockAlign, iBlockAlign, 16, {'d','a','t','a'}, iDataSize };
+	static_assert(44 == sizeof(SGMWavHeader), "WAV header must be 44 bytes");
+
+	std::ofstream file(std::filesystem::path(strFile), std::ios::binary);
+	file.write(reinterpret_cast<const char*>(&sHeader), sizeof(sHeader));
+	file.write(reinterpret_cast<const char*>(pcmVector.data()), iDataSize);
+	return file.good();
+}
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestLibrary.h
+/// @brief		Galaxy-Music Engine - GMTestLibrary
+///				ʱļдһƵ⣬ڲCGMDataManager
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "GMCommon.h"
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+namespace GM
+{
+	/*************************************************************************
+	Class
+	*************************************************************************/
+	class CGMDataManager;
+
+	/*!
+	*  @class CGMTestLibrary
+	*  @brief ʱƵ⣺Core/Users/µAudioData.xmlMedia/Music/µƵļ
+	*	ƵļǿļʧܣԺ̨޸κƵ
+	*/
+	class CGMTestLibrary
+	{
+		// 
+	public:
+		/**
+		* ʱղؽʱļ
+		* @param strName:		ʱļƣÿòͬ
+		*/
+		CGMTestLibrary(const std::string& strName);
+		/** @brief  */
+		~CGMTestLibrary();
+
+		/** @brief ½һյƵļ */
+		bool AddFile(const std::wstring& strName);
+		/** @brief ɾһƵļ */
+		bool RemoveFile(const std::wstring& strName);
+
+		/**
+		* WriteAudioData
+		* CGMDataManagerĸʽдUsers/AudioData.xml
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param dataVector:	Ƶݣ˳д
+		* @return bool:			ɹtrueʧfalse
+		*/
+		bool WriteAudioData(const std::vector<SGMAudioData>& dataVector) const;
+
+		/** @brief ƵļУ'/'β */
+		inline std::wstring GetMusicPath() const
+		{
+			return m_sConfigData.strMediaPath + L"Music/";
+		}
+		/** @brief CGMDataManager::Init */
+		inline SGMConfigData* GetConfig()
+		{
+			return &m_sConfigData;
+		}
+		/** @brief ʱļУ'/'β */
+		inline const std::string& GetPath() const
+		{
+			return m_strPath;
+		}
+
+		/**
+		* WaitFor
+		* CGMDataManager::Updateֱʱڵȴ̨ɨĽ
+		* Update֡Ϊ0Եȴڼ䲻дAudioData.xmlҲд
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param dataManager:	ݹ
+		* @param condition:		ȴ
+		* @param fTimeout:		ʱʱ䣬λ
+		* @return bool:			trueʱfalse
+		*/
+		static bool WaitFor(CGMDataManager& dataManager, const std::function<bool()>& condition,
+			const double fTimeout = 10.0);
+
+		/**
+		* WriteWav
+		* д16λPCMWAVļҪĲ
+		* @author LiuTao
+		* @since 2026.10.18
+		* @param strFile:		ļ·
+		* @param iFreq:			
+		* @param iChans:		
+		* @param pcmVector:		еĲ
+		* @return bool:			ɹtrueʧfalse
+		*/
+		static bool WriteWav(const std::wstring& strFile, const unsigned int iFreq, const int iChans,
+			const std::vector<int16_t>& pcmVector);
+
+		// 
+	private:
+		std::string							m_strPath;						//!< ʱļ
+		SGMConfigData						m_sConfigData;					//!< ָʱļе
+	};
+}	// GM
@@ -0,0 +1,365 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestPlayOrder.cpp
+/// @brief		Galaxy-Music Engine - GMTestPlayOrder
+///				˳Ĳԣ˳ѭstd::setΪգżÿһֵĸǺͲظ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMPlayOrder.h"
+#include <set>
+#include <random>
+#include <iterator>
+#include <algorithm>
+#include <cstdio>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief գѭiUIDһףiUIDʱСģûƵʱ0 */
+static unsigned int _RefSuccessor(const std::set<unsigned int>& uidSet, const unsigned int iUID)
+{
+	if (uidSet.empty()) return 0;
+	auto itr = uidSet.upper_bound(iUID);
+	if (0 == uidSet.count(iUID) || uidSet.end() == itr) return *uidSet.begin();
+	return *itr;
+}
+
+/** @brief գѭiUIDһףiUIDڼҲԣֻiUIDԼʱ0 */
+static unsigned int _RefPredecessor(const std::set<unsigned int>& uidSet, const unsigned int iUID)
+{
+	auto itr = uidSet.lower_bound(iUID);
+	const unsigned int iPrev = (uidSet.begin() == itr) ? *uidSet.rbegin() : *std::prev(itr);
+	return (iPrev == iUID) ? 0 : iPrev;
+}
+
+/** @brief ȡһUID */
+static unsigned int _RandomLive(const std::set<unsigned int>& uidSet, std::mt19937& rng)
+{
+	auto itr = uidSet.begin();
+	std::advance(itr, rng() % uidSet.size());
+	return *itr;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(PlayOrder_SequenceAgainstSet)
+{
+	// ϡĴUIDҪ4λͼɾСмĲ룬ԼɾǰƵ
+	std::mt19937 rng(2026);
+	CGMPlayOrder order;
+	std::set<unsigned int> uidSet;
+	int iMismatch = 0;
+	for (int iStep = 0; iStep < 20000; iStep++)
+	{
+		const unsigned int iOp = rng() % 10;
+		if (iOp < 5 || uidSet.size() < 3)
+		{
+			// һۼСΧڣһɢ30λͼдĿ
+			const unsigned int iUID = (0 == rng() % 2) ? 1 + rng() % 2000 : 1 + rng() % 300000;
+			GM_CHECK((0 == uidSet.count(iUID)) == order.Insert(iUID));
+			uidSet.insert(iUID);
+			// ²һǰһ׵ĺһףõֲλͼǰһ
+			const unsigned int iPrev = _RefPredecessor(uidSet, iUID);
+			if (0 != iPrev)
+			{
+				order.SetCurrent(iPrev);
+				if (iUID != order.Peek(EGMORDER_SEQUENCE)) iMismatch++;
+			}
+		}
+		else if (iOp < 8)
+		{
+			const unsigned int iUID = _RandomLive(uidSet, rng);
+			order.SetCurrent(iUID);
+			GM_CHECK(order.Erase(iUID));
+			GM_CHECK(!order.Erase(iUID));
+			// ǰƵɾʱǰһ׳Ϊǰ֮Ųĺһ
+			if (_RefPredecessor(uidSet, iUID) != order.GetCurrent()) iMismatch++;
+			uidSet.erase(iUID);
+		}
+		else
+		{
+			const unsigned int iUID = _RandomLive(uidSet, rng);
+			order.SetCurrent(iUID);
+			unsigned int iExpect = iUID;
+			for (size_t i = 0; i < GM_PLAYORDER_LOOKAHEAD; i++)
+			{
+				iExpect = _RefSuccessor(uidSet, iExpect);
+				if (iExpect != order.Peek(EGMORDER_SEQUENCE, i)) iMismatch++;
+			}
+			if (_RefSuccessor(uidSet, iUID) != order.Next(EGMORDER_SEQUENCE)) iMismatch++;
+		}
+		GM_CHECK(uidSet.size() == order.GetSize());
+	}
+	GM_CHECK(0 == iMismatch);
+
+	// һȦ
+	order.SetCurrent(*uidSet.rbegin());
+	for (const unsigned int iUID : uidSet)
+	{
+		if (iUID != order.Next(EGMORDER_SEQUENCE)) iMismatch++;
+	}
+	GM_CHECK(0 == iMismatch);
+}
+
+GM_TEST(PlayOrder_Sequence)
+{
+	CGMPlayOrder order;
+	GM_CHECK(0 == order.Next(EGMORDER_SEQUENCE));
+	GM_CHECK(!order.Insert(0));
+	for (const unsigned int iUID : { 5u, 2u, 9u, 7u }) GM_CHECK(order.Insert(iUID));
+	GM_CHECK(!order.Insert(5));
+
+	const unsigned int vExpect[8] = { 2, 5, 7, 9, 2, 5, 7, 9 };
+	for (const unsigned int iUID : vExpect) GM_CHECK(iUID == order.Next(EGMORDER_SEQUENCE));
+	GM_CHECK(2 == order.Peek(EGMORDER_SEQUENCE));
+	// µСUIDıԤźõһ
+	GM_CHECK(order.Insert(1));
+	GM_CHECK(1 == order.Peek(EGMORDER_SEQUENCE));
+	// ɾǰ98Ϊǰһ׻صͷ
+	GM_CHECK(order.Insert(8));
+	GM_CHECK(order.Erase(9));
+	GM_CHECK(8 == order.GetCurrent());
+	GM_CHECK(1 == order.Next(EGMORDER_SEQUENCE));
+	order.SetCurrent(5);
+	GM_CHECK(7 == order.Next(EGMORDER_SEQUENCE));
+	GM_CHECK(8 == order.Next(EGMORDER_SEQUENCE));
+
+	order.Clear();
+	GM_CHECK(0 == order.GetSize());
+	GM_CHECK(0 == order.GetCurrent());
+	GM_CHECK(0 == order.Next(EGMORDER_SEQUENCE));
+}
+
+GM_TEST(PlayOrder_ShuffleCycles)
+{
+	// ÿһÿֻһΣֽ紦ظ
+	for (const unsigned int iNum : { 1u, 2u, 3u, 7u, 100u })
+	{
+		CGMPlayOrder order;
+		order.Seed(iNum);
+		for (unsigned int i = 1; i <= iNum; i++) order.Insert(i * 3);
+		unsigned int iLast = 0;
+		int iWrong = 0;
+		for (int iCycle = 0; iCycle < 50; iCycle++)
+		{
+			std::set<unsigned int> playedSet;
+			for (unsigned int i = 0; i < iNum; i++)
+			{
+				const unsigned int iUID = order.Next(EGMORDER_SHUFFLE);
+				if (0 == iUID || playedSet.count(iUID) || (iNum > 1 && iUID == iLast)) iWrong++;
+				playedSet.insert(iUID);
+				iLast = iUID;
+			}
+			if (iNum != playedSet.size()) iWrong++;
+		}
+		GM_CHECK(0 == iWrong);
+	}
+
+	// ͬӵõͬ˳
+	CGMPlayOrder orderA;
+	CGMPlayOrder orderB;
+	orderA.Seed(9);
+	orderB.Seed(9);
+	for (unsigned int i = 1; i <= 50; i++)
+	{
+		orderA.Insert(i);
+		orderB.Insert(i);
+	}
+	int iDiff = 0;
+	for (int i = 0; i < 500; i++)
+	{
+		if (orderA.Next(EGMORDER_SHUFFLE) != orderB.Next(EGMORDER_SHUFFLE)) iDiff++;
+	}
+	GM_CHECK(0 == iDiff);
+}
+
+GM_TEST(PlayOrder_ShuffleWithEdits)
+{
+	// дɾһ֮ڲظһֿʼǰдƵŹ
+	std::mt19937 rng(3);
+	CGMPlayOrder order;
+	order.Seed(7);
+	std::set<unsigned int> uidSet;
+	unsigned int iNextUID = 1;
+	for (int i = 0; i < 200; i++)
+	{
+		order.Insert(iNextUID);
+		uidSet.insert(iNextUID++);
+	}
+
+	std::set<unsigned int> playedSet;
+	int iMissed = 0;
+	int iWrong = 0;
+	for (int iStep = 0; iStep < 100000; iStep++)
+	{
+		const unsigned int iOp = rng() % 10;
+		if (0 == iOp)
+		{
+			// ѾȫʱƵµһ
+			bool bRoundEnded = true;
+			for (const unsigned int iLive : uidSet)
+			{
+				if (0 == playedSet.count(iLive)) bRoundEnded = false;
+			}
+			if (bRoundEnded) playedSet.clear();
+			order.Insert(iNextUID);
+			uidSet.insert(iNextUID++);
+		}
+		else if (1 == iOp && uidSet.size() > 2)
+		{
+			const unsigned int iUID = _RandomLive(uidSet, rng);
+			GM_CHECK(order.Erase(iUID));
+			uidSet.erase(iUID);
+			playedSet.erase(iUID);
+		}
+		else
+		{
+			const unsigned int iUID = order.Next(EGMORDER_SHUFFLE);
+			if (0 == uidSet.count(iUID) || iUID != order.GetCurrent()) iWrong++;
+			if (playedSet.count(iUID))
+			{
+				// ظ˵ʼµһ
+				for (const unsigned int iLive : uidSet)
+				{
+					if (0 == playedSet.count(iLive)) iMissed++;
+				}
+				playedSet.clear();
+			}
+			playedSet.insert(iUID);
+		}
+
+		// ʷֻдƵڵĲظ
+		std::vector<unsigned int> historyVector;
+		order.GetHistory(historyVector);
+		if (historyVector.size() > GM_PLAYORDER_HISTORY) iWrong++;
+		for (size_t k = 0; k < historyVector.size(); k++)
+		{
+			if (0 == uidSet.count(historyVector[k])) iWrong++;
+			if (k > 0 && historyVector[k] == historyVector[k - 1]) iWrong++;
+		}
+	}
+	GM_CHECK(uidSet.size() == order.GetSize());
+	GM_CHECK(0 == iMissed);
+	GM_CHECK(0 == iWrong);
+}
+
+GM_TEST(PlayOrder_HistoryAndLookahead)
+{
+	CGMPlayOrder order;
+	for (unsigned int i = 1; i <= 10; i++) order.Insert(i);
+	order.SetCurrent(3);
+	order.SetCurrent(6);
+	order.SetCurrent(4);
+	order.SetCurrent(8);
+	// ɾƵʷȥһ
+	order.Erase(4);
+	GM_CHECK(6 == order.Previous());
+	GM_CHECK(3 == order.Previous());
+	GM_CHECK(0 == order.Previous());
+	GM_CHECK(3 == order.GetCurrent());
+	for (int i = 0; i < 1000; i++) order.Next(EGMORDER_SHUFFLE);
+	std::vector<unsigned int> historyVector;
+	order.GetHistory(historyVector);
+	GM_CHECK(GM_PLAYORDER_HISTORY == historyVector.size());
+	GM_CHECK(order.GetCurrent() == historyVector.back());
+
+	// Ȳѯлõͬ˳򣻲ѯıɾٳ
+	CGMPlayOrder orderPeek;
+	orderPeek.Seed(1);
+	for (unsigned int i = 1; i <= 50; i++) orderPeek.Insert(i);
+	int iWrong = 0;
+	for (unsigned int i = 0; i < 1000; i++)
+	{
+		const unsigned int iPeek = orderPeek.Peek(EGMORDER_SHUFFLE);
+		orderPeek.Peek(EGMORDER_SHUFFLE, GM_PLAYORDER_LOOKAHEAD - 1);
+		if (0 == i % 7)
+		{
+			orderPeek.Erase(iPeek);
+			orderPeek.Insert(1000 + i);
+			if (iPeek == orderPeek.Peek(EGMORDER_SHUFFLE)) iWrong++;
+		}
+		else if (iPeek != orderPeek.Next(EGMORDER_SHUFFLE))
+		{
+			iWrong++;
+		}
+	}
+	GM_CHECK(0 == iWrong);
+
+	// ѯ¼ףûÿζԼѡ裺ѯʱƵŻر֣һȻƵ
+	CGMPlayOrder orderPick;
+	orderPick.Seed(2);
+	for (unsigned int i = 1; i <= 20; i++) orderPick.Insert(i);
+	std::set<unsigned int> playedSet;
+	for (int i = 0; i < 20; i++)
+	{
+		orderPick.Peek(EGMORDER_SHUFFLE, 3);
+		playedSet.insert(orderPick.Next(EGMORDER_SHUFFLE));
+	}
+	GM_CHECK(20 == playedSet.size());
+
+	// лͬһΪǰԤźõ¼ױ
+	CGMPlayOrder orderKeep;
+	orderKeep.Seed(5);
+	for (unsigned int i = 1; i <= 30; i++) orderKeep.Insert(i);
+	const unsigned int iSecond = orderKeep.Peek(EGMORDER_SHUFFLE, 1);
+	orderKeep.SetCurrent(orderKeep.Next(EGMORDER_SHUFFLE));
+	GM_CHECK(iSecond == orderKeep.Next(EGMORDER_SHUFFLE));
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(PlayOrder_Steps)
+{
+	for (const unsigned int iNum : { 1000u, 100000u, 1000000u })
+	{
+		CGMPlayOrder order;
+		order.Seed(9);
+		for (unsigned int i = 1; i <= iNum; i++) order.Insert(i);
+		const int iSteps = 2000000;
+		unsigned long long iSum = 0;
+		const double fShuffle = CGMTest::Seconds([&]() {
+			for (int i = 0; i < iSteps; i++) iSum += order.Next(EGMORDER_SHUFFLE);
+		});
+		const double fSequence = CGMTest::Seconds([&]() {
+			for (int i = 0; i < iSteps; i++) iSum += order.Next(EGMORDER_SEQUENCE);
+		});
+		GM_CHECK(0 != iSum);
+		printf("  %7u audios: shuffle %5.1f ns/step, sequence %5.1f ns/step\n",
+			iNum, fShuffle * 1e9 / iSteps, fSequence * 1e9 / iSteps);
+	}
+}
+
+GM_BENCH(PlayOrder_InsertRandom)
+{
+	// ˳룬ÿζҪ÷ֲλͼǰһstd::setΪ
+	const unsigned int iNum = 1000000;
+	std::vector<unsigned int> uidVector(iNum);
+	for (unsigned int i = 0; i < iNum; i++) uidVector[i] = i + 1;
+	std::shuffle(uidVector.begin(), uidVector.end(), std::mt19937(4));
+
+	CGMPlayOrder order;
+	const double fOrder = CGMTest::Seconds([&]() {
+		for (const unsigned int iUID : uidVector) order.Insert(iUID);
+	});
+	std::set<unsigned int> uidSet;
+	const double fSet = CGMTest::Seconds([&]() {
+		for (const unsigned int iUID : uidVector) uidSet.insert(iUID);
+	});
+	GM_CHECK(iNum == order.GetSize());
+	printf("  %u random inserts: play order %.1f ns/insert, std::set %.1f ns/insert\n",
+		iNum, fOrder * 1e9 / iNum, fSet * 1e9 / iNum);
+}
@@ -0,0 +1,321 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestPointCache.cpp
+/// @brief		Galaxy-Music Engine - GMTestPointCache
+///				̻Ĳԣдԭأκ仯У
+///				ضϻĶһֽڵļᱻֻܾͬһļ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMPointCache.h"
+#include <osg/Array>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <vector>
+#include <iterator>
+#include <cstring>
+#include <cstdio>
+
+using namespace GM;
+namespace fs = std::filesystem;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ½һյĻĿ¼ */
+static std::string _MakeCacheDir(const std::string& strName)
+{
+	const std::string strCacheDir = CGMTest::GetTempPath() + strName + "/";
+	std::error_code ec;
+	fs::remove_all(strCacheDir, ec);
+	fs::create_directories(strCacheDir, ec);
+	return strCacheDir;
+}
+
+/** @brief 8x8RGBAͼϵάͼһΪ */
+static osg::ref_ptr<osg::Image> _MakeImage()
+{
+	osg::ref_ptr<osg::Image> pImg = new osg::Image;
+	pImg->allocateImage(8, 8, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+	for (unsigned int i = 0; i < pImg->getTotalSizeInBytes(); i++)
+	{
+		pImg->data()[i] = (unsigned char)(i * 37 + 11);
+	}
+	return pImg;
+}
+
+/** @brief CGMGalaxyǻļͬ״̬ͼ */
+static void _AddKeys(CGMPointCache& aCache, const osg::Image* pImg,
+	const std::string& strRandomState = "5489 1 2 3", const double fNum = 65536.0, const double fAlpha = 0.25)
+{
+	aCache.AddKey(strRandomState);
+	aCache.AddKey(pImg);
+	aCache.AddKey(fNum);
+	aCache.AddKey(fAlpha);
+}
+
+/** @brief дݿ飺顢顢顢ַ */
+static void _PushBlocks(CGMPointCache& aCache, const osg::Vec4Array& vertArray,
+	const std::vector<unsigned short>& elementVector)
+{
+	aCache.PushArray(vertArray);
+	aCache.PushArray(elementVector);
+	aCache.PushArray(std::vector<float>());
+	aCache.PushString("random state");
+}
+
+/** @brief Ŀ¼չΪstrExtļ */
+static int _CountFiles(const std::string& strCacheDir, const std::string& strExt)
+{
+	int iNum = 0;
+	std::error_code ec;
+	for (fs::directory_iterator itr(fs::path(strCacheDir), ec), end; !ec && itr != end; itr.increment(ec))
+	{
+		if (itr->path().extension() == strExt) iNum++;
+	}
+	return iNum;
+}
+
+/** @brief ȡļ */
+static std::vector<char> _ReadFile(const std::string& strFile)
+{
+	std::ifstream file(strFile, std::ios::binary);
+	return std::vector<char>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+/** @brief дļ */
+static bool _WriteFile(const std::string& strFile, const std::vector<char>& dataVector)
+{
+	std::ofstream file(strFile, std::ios::binary | std::ios::trunc);
+	file.write(dataVector.data(), std::streamsize(dataVector.size()));
+	return file.good();
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(PointCache_RoundTrip)
+{
+	const std::string strCacheDir = _MakeCacheDir("PointCache_RoundTrip");
+	osg::ref_ptr<osg::Image> pImg = _MakeImage();
+	osg::Vec4Array vertArray;
+	std::vector<unsigned short> elementVector;
+	for (int i = 0; i < 1000; i++)
+	{
+		vertArray.push_back(osg::Vec4f(i * 0.5f, -i * 0.25f, 1.0f / (i + 1), 1.0f));
+		elementVector.push_back((unsigned short)i);
+	}
+
+	CGMPointCache aSave(strCacheDir, "StarCube");
+	_AddKeys(aSave, pImg.get());
+	// ûб棬
+	GM_CHECK(!aSave.Load());
+	_PushBlocks(aSave, vertArray, elementVector);
+	GM_CHECK(aSave.Save());
+	GM_CHECK(fs::exists(aSave.GetFileName()));
+
+	// ͬõͬļݿ鰴д˳ԭȡ
+	CGMPointCache aLoad(strCacheDir, "StarCube");
+	_AddKeys(aLoad, pImg.get());
+	GM_CHECK(aSave.GetFileName() == aLoad.GetFileName());
+	GM_CHECK(aLoad.Load());
+	osg::Vec4Array loadVertArray;
+	std::vector<unsigned short> loadElementVector;
+	std::vector<float> emptyVector(3, 1.0f);
+	std::string strValue;
+	GM_CHECK(aLoad.PopArray(loadVertArray));
+	GM_CHECK(aLoad.PopArray(loadElementVector));
+	GM_CHECK(aLoad.PopArray(emptyVector));
+	GM_CHECK(aLoad.PopString(strValue));
+	GM_CHECK(loadVertArray.size() == vertArray.size());
+	GM_CHECK(0 == memcmp(&loadVertArray[0], &vertArray[0], vertArray.size() * sizeof(osg::Vec4f)));
+	GM_CHECK(loadElementVector == elementVector);
+	GM_CHECK(emptyVector.empty());
+	GM_CHECK("random state" == strValue);
+	// ûиݿ
+	GM_CHECK(!aLoad.PopString(strValue));
+
+	// ٴLoadӵһݿ¿ʼֽԪشСݿ鲻ȡ
+	GM_CHECK(aLoad.Load());
+	std::vector<osg::Vec3f> wrongVector;
+	GM_CHECK(!aLoad.PopArray(wrongVector));
+	std::vector<float> floatVector;
+	GM_CHECK(aLoad.PopArray(floatVector));
+	GM_CHECK(floatVector.size() == elementVector.size() / 2);
+}
+
+GM_TEST(PointCache_KeyMiss)
+{
+	const std::string strCacheDir = _MakeCacheDir("PointCache_KeyMiss");
+	osg::ref_ptr<osg::Image> pImg = _MakeImage();
+	osg::Vec4Array vertArray;
+	vertArray.push_back(osg::Vec4f(1.0f, 2.0f, 3.0f, 4.0f));
+	std::vector<unsigned short> elementVector(1, 0);
+
+	CGMPointCache aSave(strCacheDir, "StarCube");
+	_AddKeys(aSave, pImg.get());
+	_PushBlocks(aSave, vertArray, elementVector);
+	GM_CHECK(aSave.Save());
+
+	// ÿıһļͬҲ
+	osg::ref_ptr<osg::Image> pPixelImg = _MakeImage();
+	pPixelImg->data()[100] ^= 1;
+	osg::ref_ptr<osg::Image> pSizeImg = new osg::Image;
+	pSizeImg->allocateImage(16, 4, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+	memcpy(pSizeImg->data(), pImg->data(), pImg->getTotalSizeInBytes());
+	const std::vector<std::function<void(CGMPointCache&)>> changeVector = {
+		[&](CGMPointCache& a) { _AddKeys(a, pImg.get(), "5489 1 2 4"); },
+		[&](CGMPointCache& a) { _AddKeys(a, pPixelImg.get()); },
+		[&](CGMPointCache& a) { _AddKeys(a, pSizeImg.get()); },
+		[&](CGMPointCache& a) { _AddKeys(a, nullptr); },
+		[&](CGMPointCache& a) { _AddKeys(a, pImg.get(), "5489 1 2 3", 65535.0); },
+		[&](CGMPointCache& a) { _AddKeys(a, pImg.get(), "5489 1 2 3", 65536.0, 0.2500001); },
+		[&](CGMPointCache& a) { _AddKeys(a, pImg.get()); a.AddKey(0.0); },
+		[&](CGMPointCache& a) { a.AddKey(pImg.get()); a.AddKey(std::string("5489 1 2 3")); a.AddKey(65536.0); a.AddKey(0.25); },
+	};
+	int iSameName = 0;
+	int iHit = 0;
+	for (const auto& change : changeVector)
+	{
+		CGMPointCache aLoad(strCacheDir, "StarCube");
+		change(aLoad);
+		if (aLoad.GetFileName() == aSave.GetFileName()) iSameName++;
+		if (aLoad.Load()) iHit++;
+	}
+	GM_CHECK(0 == iSameName);
+	GM_CHECK(0 == iHit);
+
+	// ҲǼһ
+	CGMPointCache aOtherName(strCacheDir, "StarSphere");
+	_AddKeys(aOtherName, pImg.get());
+	GM_CHECK(!aOtherName.Load());
+
+	// ƴӺַͬõͬļ
+	CGMPointCache aSplitA(strCacheDir, "Split");
+	aSplitA.AddKey(std::string("ab"));
+	aSplitA.AddKey(std::string("c"));
+	CGMPointCache aSplitB(strCacheDir, "Split");
+	aSplitB.AddKey(std::string("a"));
+	aSplitB.AddKey(std::string("bc"));
+	GM_CHECK(aSplitA.GetFileName() != aSplitB.GetFileName());
+
+	// ԭȻ
+	CGMPointCache aLoad(strCacheDir, "StarCube");
+	_AddKeys(aLoad, pImg.get());
+	GM_CHECK(aLoad.Load());
+}
+
+GM_TEST(PointCache_Corrupt)
+{
+	const std::string strCacheDir = _MakeCacheDir("PointCache_Corrupt");
+	osg::ref_ptr<osg::Image> pImg = _MakeImage();
+	osg::Vec4Array vertArray;
+	std::vector<unsigned short> elementVector;
+	for (int i = 0; i < 16; i++)
+	{
+		vertArray.push_back(osg::Vec4f(float(i), 0.5f, -0.5f, 1.0f));
+		elementVector.push_back((unsigned short)i);
+	}
+
+	CGMPointCache aSave(strCacheDir, "StarCube");
+	_AddKeys(aSave, pImg.get());
+	_PushBlocks(aSave, vertArray, elementVector);
+	GM_CHECK(aSave.Save());
+	const std::string strFile = aSave.GetFileName();
+	const std::vector<char> fileVector = _ReadFile(strFile);
+	GM_CHECK(fileVector.size() > 256);
+
+	CGMPointCache aLoad(strCacheDir, "StarCube");
+	_AddKeys(aLoad, pImg.get());
+	GM_CHECK(aLoad.Load());
+
+	// ضϵÿһȣܶȡҲȡݿ
+	int iTruncHit = 0;
+	int iTruncPop = 0;
+	for (size_t iSize = 0; iSize < fileVector.size(); iSize++)
+	{
+		_WriteFile(strFile, std::vector<char>(fileVector.begin(), fileVector.begin() + iSize));
+		if (aLoad.Load()) iTruncHit++;
+		osg::Vec4Array loadArray;
+		if (aLoad.PopArray(loadArray)) iTruncPop++;
+	}
+	GM_CHECK(0 == iTruncHit);
+	GM_CHECK(0 == iTruncPop);
+
+	// Ķÿһֽڣܶȡ
+	int iFlipHit = 0;
+	for (size_t i = 0; i < fileVector.size(); i++)
+	{
+		std::vector<char> flipVector = fileVector;
+		flipVector[i] ^= 0x10;
+		_WriteFile(strFile, flipVector);
+		if (aLoad.Load()) iFlipHit++;
+	}
+	GM_CHECK(0 == iFlipHit);
+
+	// ĩβҲܶȡ
+	std::vector<char> longVector = fileVector;
+	longVector.push_back(0);
+	_WriteFile(strFile, longVector);
+	GM_CHECK(!aLoad.Load());
+
+	// ָԭļܶȡ
+	_WriteFile(strFile, fileVector);
+	GM_CHECK(aLoad.Load());
+	osg::Vec4Array loadArray;
+	GM_CHECK(aLoad.PopArray(loadArray));
+	GM_CHECK(loadArray.size() == vertArray.size());
+}
+
+GM_TEST(PointCache_SingleFile)
+{
+	const std::string strCacheDir = _MakeCacheDir("PointCache_SingleFile");
+	osg::ref_ptr<osg::Image> pImg = _MakeImage();
+	osg::Vec4Array vertArray;
+	vertArray.push_back(osg::Vec4f(1.0f, 2.0f, 3.0f, 4.0f));
+	std::vector<unsigned short> elementVector(1, 0);
+
+	// һƵĻ治Ӱ
+	CGMPointCache aOther(strCacheDir, "StarSphere");
+	_AddKeys(aOther, pImg.get());
+	_PushBlocks(aOther, vertArray, elementVector);
+	GM_CHECK(aOther.Save());
+
+	// ÿ仯һξͱһΣÿαֻͬµǰļҲûʱļ
+	int iWrongNum = 0;
+	int iMissing = 0;
+	std::string strLastFile;
+	for (int i = 0; i < 5; i++)
+	{
+		CGMPointCache aSave(strCacheDir, "StarCube");
+		_AddKeys(aSave, pImg.get(), "5489 1 2 3", 65536.0 + i);
+		_PushBlocks(aSave, vertArray, elementVector);
+		GM_CHECK(aSave.Save());
+		if (2 != _CountFiles(strCacheDir, ".cache")) iWrongNum++;
+		if (!fs::exists(aSave.GetFileName())) iMissing++;
+		if (!strLastFile.empty() && fs::exists(strLastFile)) iWrongNum++;
+		strLastFile = aSave.GetFileName();
+	}
+	GM_CHECK(0 == iWrongNum);
+	GM_CHECK(0 == iMissing);
+	GM_CHECK(0 == _CountFiles(strCacheDir, ".tmp"));
+	GM_CHECK(fs::exists(aOther.GetFileName()));
+
+	// ͬٱһΣȻֻһļ
+	CGMPointCache aSame(strCacheDir, "StarCube");
+	_AddKeys(aSame, pImg.get(), "5489 1 2 3", 65536.0 + 4);
+	_PushBlocks(aSame, vertArray, elementVector);
+	GM_CHECK(aSame.GetFileName() == strLastFile);
+	GM_CHECK(aSame.Save());
+	GM_CHECK(2 == _CountFiles(strCacheDir, ".cache"));
+	GM_CHECK(aSame.Load());
+}
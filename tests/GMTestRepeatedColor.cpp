@@ -0,0 +1,204 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestRepeatedColor.cpp
+/// @brief		Galaxy-Music Engine - GMTestRepeatedColor
+///				ϴСǴʱصСǵĲԣԭɨϷΪգ
+///				Ϊظŷת+0/-0NaN
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMKit.h"
+#include <osg/Image>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* СͼƬλ + ٶȣΪظ
+* @param iWidth, iHeight:	ߴ
+* @param iSeed:				
+* @param iRepeatPercent:	ȫظռİٷֱ
+*/
+static osg::ref_ptr<osg::Image> _MakeAsteroidImage(const unsigned int iWidth, const unsigned int iHeight,
+	const unsigned int iSeed, const int iRepeatPercent)
+{
+	const size_t iNum = size_t(iWidth) * iHeight;
+	float* pData = new float[iNum * 4];
+	std::mt19937 rng(iSeed);
+	std::uniform_int_distribution<> iPseudoNoise(0, 1000000);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		pData[4 * i + 0] = iPseudoNoise(rng) * 7.8e5f;
+		pData[4 * i + 1] = iPseudoNoise(rng) * 7.8e5f;
+		pData[4 * i + 2] = iPseudoNoise(rng) * 0.013f;
+		pData[4 * i + 3] = iPseudoNoise(rng) * 0.013f;
+	}
+
+	auto fCopy = [&](const size_t iFrom, const size_t iTo)
+	{
+		for (int c = 0; c < 4; c++) pData[4 * iTo + c] = pData[4 * iFrom + c];
+	};
+	auto fSet = [&](const size_t i, const float fX, const float fY, const float fZ, const float fW)
+	{
+		pData[4 * i + 0] = fX;
+		pData[4 * i + 1] = fY;
+		pData[4 * i + 2] = fZ;
+		pData[4 * i + 3] = fW;
+	};
+	// ȫظ
+	for (size_t k = 0; k < iNum * iRepeatPercent / 100; k++) fCopy(rng() % iNum, rng() % iNum);
+	// ֻһķŲͬظ
+	for (size_t k = 0; k < iNum / 200; k++)
+	{
+		const size_t iTo = rng() % iNum;
+		fCopy(rng() % iNum, iTo);
+		pData[4 * iTo + rng() % 4] *= -1.0f;
+	}
+	// +0-0
+	for (size_t k = 0; k < iNum / 500; k++)
+	{
+		fSet(rng() % iNum, 0.0f, 1.0f, 2.0f, 3.0f);
+		fSet(rng() % iNum, -0.0f, 1.0f, 2.0f, 3.0f);
+	}
+	// NaNκݶ
+	for (size_t k = 0; k < iNum / 1000; k++)
+	{
+		fSet(rng() % iNum, NAN, 1.0f, 2.0f, 3.0f);
+		fSet(rng() % iNum, NAN, 1.0f, 2.0f, 3.0f);
+	}
+	// ûõĿλ
+	for (size_t k = 0; k < iNum / 1000; k++) fSet(rng() % iNum, 0.0f, 0.0f, 0.0f, 0.0f);
+
+	osg::ref_ptr<osg::Image> pImage = new osg::Image();
+	pImage->setImage(iWidth, iHeight, 1, GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)pData, osg::Image::USE_NEW_DELETE);
+	return pImage;
+}
+
+/** @brief գԭCGMSolar::_WashAsteroidBeltDataÿ㶼ɨһк<=iк<=j */
+static void _ReferenceRepeat(const osg::Image* pImg, std::vector<bool>& repeatVector)
+{
+	const unsigned int iWidth = pImg->s();
+	const unsigned int iHeight = pImg->t();
+	repeatVector.assign(size_t(iWidth) * iHeight, false);
+	for (unsigned int i = 0; i < iWidth; i++)
+	{
+		for (unsigned int j = 0; j < iHeight; j++)
+		{
+			osg::Vec4 vValueNow = pImg->getColor(i, j);
+			bool bSame = false;
+			for (unsigned int _i = 0; _i <= i && !bSame; _i++)
+			{
+				for (unsigned int _j = 0; _j <= j && !bSame; _j++)
+				{
+					if (_i == i && _j == j) continue;
+					osg::Vec4 vValueFront = pImg->getColor(_i, _j);
+					bSame = (vValueNow == vValueFront) ? true : bSame;
+				}
+			}
+			repeatVector[size_t(j) * iWidth + i] = bSame;
+		}
+	}
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(Kit_FindRepeatedColor)
+{
+	// ֳߴظһ
+	int iWrong = 0;
+	int iRepeated = 0;
+	for (unsigned int iSeed = 0; iSeed < 40; iSeed++)
+	{
+		const unsigned int iWidth = 1 + iSeed * 7 % 64;
+		const unsigned int iHeight = 1 + iSeed * 13 % 48;
+		for (const int iPercent : { 0, 5, 50, 200 })
+		{
+			osg::ref_ptr<osg::Image> pImage = _MakeAsteroidImage(iWidth, iHeight, iSeed, iPercent);
+			std::vector<bool> refVector, outVector;
+			_ReferenceRepeat(pImage.get(), refVector);
+			CGMKit::FindRepeatedColor(pImage.get(), outVector);
+			if (refVector != outVector) iWrong++;
+			for (const bool bRepeat : outVector) iRepeated += bRepeat;
+		}
+	}
+	GM_CHECK(0 == iWrong);
+	GM_CHECK(iRepeated > 0);
+
+	// ȫȣ˵һ㣬඼ظ
+	{
+		const unsigned int iWidth = 37;
+		const unsigned int iHeight = 29;
+		float* pData = new float[iWidth * iHeight * 4];
+		for (unsigned int i = 0; i < iWidth * iHeight * 4; i++) pData[i] = float(i % 4 + 1);
+		osg::ref_ptr<osg::Image> pImage = new osg::Image();
+		pImage->setImage(iWidth, iHeight, 1, GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)pData, osg::Image::USE_NEW_DELETE);
+		std::vector<bool> refVector, outVector;
+		_ReferenceRepeat(pImage.get(), refVector);
+		CGMKit::FindRepeatedColor(pImage.get(), outVector);
+		GM_CHECK(refVector == outVector);
+		GM_CHECK(!outVector[0]);
+		GM_CHECK(size_t(std::count(outVector.begin(), outVector.end(), true)) == outVector.size() - 1);
+	}
+
+	// ͬһУֵĲظһкŸĲ
+	{
+		float* pData = new float[2 * 2 * 4];
+		const float vValue[4][4] = { { 1, 0, 0, 0 }, { 2, 0, 0, 0 }, { 2, 0, 0, 0 }, { 1, 0, 0, 0 } };
+		for (int i = 0; i < 4; i++) for (int c = 0; c < 4; c++) pData[4 * i + c] = vValue[i][c];
+		osg::ref_ptr<osg::Image> pImage = new osg::Image();
+		pImage->setImage(2, 2, 1, GL_RGBA32F, GL_RGBA, GL_FLOAT, (unsigned char*)pData, osg::Image::USE_NEW_DELETE);
+		// (0,0)=1 (1,0)=2 (0,1)=2 (1,1)=1
+		std::vector<bool> outVector;
+		CGMKit::FindRepeatedColor(pImage.get(), outVector);
+		GM_CHECK(!outVector[0] && !outVector[1] && !outVector[2] && outVector[3]);
+	}
+
+	// ͼƬ
+	std::vector<bool> emptyVector(3, true);
+	CGMKit::FindRepeatedColor(nullptr, emptyVector);
+	GM_CHECK(emptyVector.empty());
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(Kit_RepeatedColorScaling)
+{
+	// СǴͼƬ81928k64k512kС
+	for (const unsigned int iHeight : { 1u, 8u, 64u })
+	{
+		osg::ref_ptr<osg::Image> pImage = _MakeAsteroidImage(8192, iHeight, 1, 5);
+		std::vector<bool> outVector;
+		const double fTime = CGMTest::Seconds([&]() { CGMKit::FindRepeatedColor(pImage.get(), outVector); });
+		const size_t iRepeated = std::count(outVector.begin(), outVector.end(), true);
+		if (1 == iHeight)
+		{
+			// ԭɨO(N^2)ֻ8kʱУ64kԼ
+			std::vector<bool> refVector;
+			const double fReference = CGMTest::Seconds([&]() { _ReferenceRepeat(pImage.get(), refVector); });
+			GM_CHECK(refVector == outVector);
+			printf("  %7zu asteroids: hash %.2f ms, pairwise scan %.1f ms, %zu repeated\n",
+				outVector.size(), fTime * 1e3, fReference * 1e3, iRepeated);
+		}
+		else
+		{
+			printf("  %7zu asteroids: hash %.2f ms, %zu repeated\n", outVector.size(), fTime * 1e3, iRepeated);
+		}
+	}
+}
@@ -0,0 +1,220 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestSpectrum.cpp
+/// @brief		Galaxy-Music Engine - GMTestSpectrum
+///				Ƶ׷ĲԣϳҲɨƵźŵķֵƵ˥ʹһԼÿ֡ĺʱ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMSpectrum.h"
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/** @brief ҲfPhaseΪʼλ */
+static std::vector<float> _MakeSine(const double fFreq, const float fSampleRate, const size_t iNum,
+	const float fAmp = 1.0f, const double fPhase = 0.0)
+{
+	std::vector<float> pcmVector(iNum);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		pcmVector[i] = fAmp * float(std::sin(6.283185307179586 * fFreq * i / fSampleRate + fPhase));
+	}
+	return pcmVector;
+}
+
+/** @brief ƵƵʱȡƵ */
+static int _PeakBand(const CGMSpectrum& spectrum)
+{
+	const std::vector<float>& bandVector = spectrum.GetBands();
+	int iPeak = 0;
+	for (int b = 1; b < int(bandVector.size()); b++)
+	{
+		if (bandVector[b] > bandVector[iPeak]) iPeak = b;
+	}
+	return iPeak;
+}
+
+/** @brief ͬһźţֱƵȶ */
+static void _Settle(CGMSpectrum& spectrum, const std::vector<float>& pcmVector)
+{
+	for (int i = 0; i < 8; i++) spectrum.Analyze(pcmVector.data(), pcmVector.size(), 1.0f);
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(Spectrum_BandCentres)
+{
+	// ÿƵмƵϵҲֵƵҽӽ1
+	int iWrong = 0;
+	int iWeak = 0;
+	for (const size_t iFFTSize : { size_t(1024), size_t(4096) })
+	{
+		for (const float fSampleRate : { 44100.0f, 48000.0f })
+		{
+			CGMSpectrum spectrum(iFFTSize);
+			spectrum.Init(fSampleRate);
+			const std::vector<unsigned int>& edgeVector = spectrum.GetBandEdges();
+			GM_CHECK(GM_SPECTRUM_BAND_NUM + 1 == int(edgeVector.size()));
+			const double fBinHz = fSampleRate / iFFTSize;
+			for (int b = 0; b < GM_SPECTRUM_BAND_NUM; b++)
+			{
+				GM_CHECK(edgeVector[b] < edgeVector[b + 1]);
+				const double fCentre = 0.5 * (edgeVector[b] + edgeVector[b + 1] - 1) * fBinHz;
+				spectrum.Reset();
+				_Settle(spectrum, _MakeSine(fCentre, fSampleRate, iFFTSize, 1.0f, 0.3 * b));
+				if (b != _PeakBand(spectrum))
+				{
+					iWrong++;
+					printf("  FFT %zu, %.0f Hz: sine at %.1f Hz peaks in band %d instead of %d\n",
+						iFFTSize, fSampleRate, fCentre, _PeakBand(spectrum), b);
+				}
+				if (spectrum.GetBands()[b] < 0.9f) iWeak++;
+			}
+		}
+	}
+	GM_CHECK(0 == iWrong);
+	GM_CHECK(0 == iWeak);
+}
+
+GM_TEST(Spectrum_Sweep)
+{
+	// 40Hz16kHzɨƵֵƵҾƵ
+	for (const size_t iFFTSize : { size_t(1024), size_t(4096) })
+	{
+		const float fSampleRate = 44100.0f;
+		CGMSpectrum spectrum(iFFTSize);
+		spectrum.Init(fSampleRate);
+		const int iStepNum = 2000;
+		int iLast = 0;
+		int iBackward = 0;
+		std::vector<int> hitVector(GM_SPECTRUM_BAND_NUM, 0);
+		for (int i = 0; i <= iStepNum; i++)
+		{
+			const double fFreq = 40.0 * std::pow(16000.0 / 40.0, double(i) / iStepNum);
+			spectrum.Reset();
+			_Settle(spectrum, _MakeSine(fFreq, fSampleRate, iFFTSize, 0.8f, 0.1 * i));
+			const int iPeak = _PeakBand(spectrum);
+			if (iPeak < iLast) iBackward++;
+			iLast = iPeak;
+			hitVector[iPeak]++;
+		}
+		int iMissed = 0;
+		for (const int iHit : hitVector) iMissed += (0 == iHit);
+		GM_CHECK(0 == iBackward);
+		GM_CHECK(0 == iMissed);
+		GM_CHECK(GM_SPECTRUM_BAND_NUM - 1 == iLast);
+	}
+}
+
+GM_TEST(Spectrum_SilenceDecay)
+{
+	const float fSampleRate = 44100.0f;
+	const float fDeltaTime = 1.0f / 60.0f;
+	CGMSpectrum spectrum;
+	spectrum.Init(fSampleRate);
+	_Settle(spectrum, _MakeSine(1000.0, fSampleRate, spectrum.GetFFTSize()));
+	const int iPeak = _PeakBand(spectrum);
+	const float fStart = spectrum.GetBands()[iPeak];
+	GM_CHECK(fStart > 0.9f);
+
+	// ʱʱ䳣0.25sָ˥ÿ֡
+	int iRising = 0;
+	std::vector<float> lastVector = spectrum.GetBands();
+	const std::vector<float> silenceVector(spectrum.GetFFTSize(), 0.0f);
+	for (int i = 1; i <= 120; i++)
+	{
+		// һ֡ûвһ֡ȫ0Ĳͬ
+		if (i % 2) spectrum.Analyze(nullptr, 0, fDeltaTime);
+		else spectrum.Analyze(silenceVector.data(), silenceVector.size(), fDeltaTime);
+		for (int b = 0; b < GM_SPECTRUM_BAND_NUM; b++)
+		{
+			if (spectrum.GetBands()[b] > lastVector[b]) iRising++;
+		}
+		lastVector = spectrum.GetBands();
+		if (15 == i)
+		{
+			GM_CHECK_NEAR(spectrum.GetBands()[iPeak], fStart * std::exp(-15.0 * fDeltaTime / 0.25), 1e-4);
+		}
+	}
+	GM_CHECK(0 == iRising);
+	float fMax = 0.0f;
+	for (const float fBand : spectrum.GetBands()) fMax = (std::max)(fMax, fBand);
+	GM_CHECK(fMax < 1e-3f);
+}
+
+GM_TEST(Spectrum_PowerScale)
+{
+	// ƵеҲʳGetPowerScaleΪ1Ϊ1/4-6dB
+	for (const size_t iFFTSize : { size_t(256), size_t(1024), size_t(4096) })
+	{
+		const float fSampleRate = 48000.0f;
+		CGMSpectrum spectrum(iFFTSize);
+		spectrum.Init(fSampleRate);
+		const double fBinHz = fSampleRate / iFFTSize;
+		for (const size_t k : { size_t(5), iFFTSize / 8, iFFTSize / 2 - 5 })
+		{
+			for (const float fAmp : { 1.0f, 0.5f })
+			{
+				spectrum.Analyze(_MakeSine(k * fBinHz, fSampleRate, iFFTSize, fAmp, 1.0).data(), iFFTSize, 1.0f);
+				const float fPower = spectrum.GetPower()[k] * spectrum.GetPowerScale();
+				GM_CHECK_NEAR(fPower, fAmp * fAmp, 1e-3);
+				// HannƵ6dBʵ1/4
+				GM_CHECK_NEAR(spectrum.GetPower()[k + 1] * spectrum.GetPowerScale(), 0.25 * fAmp * fAmp, 1e-3);
+			}
+		}
+	}
+
+	// Ϊ1-6dBӦ1-6.02/72FFTʱǰ油0Ϊ0
+	CGMSpectrum spectrum;
+	spectrum.Init(48000.0f);
+	const size_t k = 40;
+	const double fFreq = k * 48000.0 / spectrum.GetFFTSize();
+	int iBand = 0;
+	while (spectrum.GetBandEdges()[iBand + 1] <= k) iBand++;
+	_Settle(spectrum, _MakeSine(fFreq, 48000.0f, spectrum.GetFFTSize()));
+	GM_CHECK_NEAR(spectrum.GetBands()[iBand], 1.0, 1e-3);
+	_Settle(spectrum, _MakeSine(fFreq, 48000.0f, spectrum.GetFFTSize(), 0.5f));
+	GM_CHECK_NEAR(spectrum.GetBands()[iBand], 1.0 - 20.0 * std::log10(2.0) / 72.0, 1e-3);
+	_Settle(spectrum, std::vector<float>(16, 0.0f));
+	GM_CHECK(spectrum.GetBands()[iBand] < 1e-3f);
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(Spectrum_AnalyzePerFrame)
+{
+	// ÿ֡һAnalyze60fpsʱһ֡16.7ms
+	const float fSampleRate = 44100.0f;
+	for (const size_t iFFTSize : { size_t(512), size_t(1024), size_t(2048), size_t(4096) })
+	{
+		CGMSpectrum spectrum(iFFTSize);
+		spectrum.Init(fSampleRate);
+		const std::vector<float> pcmVector = _MakeSine(440.0, fSampleRate, iFFTSize * 4, 0.7f);
+		const int iFrameNum = 20000;
+		const double fTime = CGMTest::Seconds([&]() {
+			for (int i = 0; i < iFrameNum; i++)
+				spectrum.Analyze(pcmVector.data() + (i % 3) * iFFTSize, iFFTSize, 1.0f / 60.0f);
+		});
+		GM_CHECK(_PeakBand(spectrum) > 0);
+		printf("  FFT %4zu: %.2f us per frame, %.3f%% of a 60 fps frame\n",
+			iFFTSize, fTime / iFrameNum * 1e6, fTime / iFrameNum * 60.0 * 100.0);
+	}
+}
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestStarCube.cpp
+/// @brief		Galaxy-Music Engine - GMTestStarCube
+///				ǹöĲԣԭCPUosg::Vec4f*fSizeŵĿ
+///				shadergl_Vertex.xyz*cubeSizeĽλͬڴı仯
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include <osg/Vec4f>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+
+// GMGalaxy.cppGMEngine.cppеֵͬ
+#define GM_MIN_STARS_CUBE		(8e18)			// cubeǵСߴ
+#define GM_STAR_CUBE_VERT_NUM	(65536)			// m_pCubeVertArrayĶ
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* ȫ5㼶ı߳
+* 0_CreateStarCubeͬ4_CreateStarCube_4ͬ
+*/
+static std::vector<float> _CubeSizes()
+{
+	const double fUnit3 = 1e15;
+	const double fUnit4 = 1e20;
+	std::vector<float> sizeVector;
+	sizeVector.push_back(float(GM_MIN_STARS_CUBE / fUnit3));
+	const float fCubeMinSize = GM_MIN_STARS_CUBE / fUnit4;
+	for (int i = 0; i < 4; i++)
+	{
+		sizeVector.push_back(fCubeMinSize * std::pow(2, float(i)));
+	}
+	return sizeVector;
+}
+
+/** @brief ȡshaderıʧ򷵻ؿ */
+static std::string _ReadShader(const std::string& strName)
+{
+	std::ifstream file(CGMTest::GetDataPath() + "../../Data/Core/Shaders/GalaxyShader/" + strName);
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(StarCube_SharedVertices)
+{
+	// m_pCubeVertArrayÿiPseudoNoise*1e-4f - 0.5fֻ10000ȡֵ
+	// ˷ģԱȫȡֵȫ㼶͸ж
+	const std::vector<float> sizeVector = _CubeSizes();
+	GM_CHECK(5 == int(sizeVector.size()));
+	int iWrong = 0;
+	int iWrongSize = 0;
+	for (const float fSize : sizeVector)
+	{
+		for (int n = 0; n < 10000; n++)
+		{
+			const float fX = n*1e-4f - 0.5f;
+			const float fY = ((n * 7919) % 10000)*1e-4f - 0.5f;
+			const float fZ = ((n * 104729) % 10000)*1e-4f - 0.5f;
+			const osg::Vec4f vert(fX, fY, fZ, 1.0f);
+
+			// ԭCPUţshaderxyzΪλáwΪcubeSize
+			const osg::Vec4f vOld = vert * fSize;
+			// ڣñ߳Ϊ1Ķ㣬shaderxyz*cubeSizecubeSizeuniform
+			const float vNew[3] = { vert.x() * fSize, vert.y() * fSize, vert.z() * fSize };
+
+			if (0 != memcmp(vOld.ptr(), vNew, sizeof(vNew))) iWrong++;
+			const float fOldSize = vOld.w();
+			if (0 != memcmp(&fOldSize, &fSize, sizeof(float))) iWrongSize++;
+		}
+	}
+	GM_CHECK(0 == iWrong);
+	GM_CHECK(0 == iWrongSize);
+
+	// shaderuniformȡcubeSizeٶgl_Vertex.w
+	for (const char* strShader : { "StarCube_Vert.glsl", "StarCube_4_Vert.glsl" })
+	{
+		const std::string strCode = _ReadShader(strShader);
+		GM_CHECK(!strCode.empty());
+		GM_CHECK(std::string::npos != strCode.find("uniform float cubeSize;"));
+		GM_CHECK(std::string::npos != strCode.find("vec4(gl_Vertex.xyz*cubeSize, 1.0)"));
+		GM_CHECK(std::string::npos == strCode.find("gl_Vertex.w"));
+	}
+
+	// ڴ棺ԭÿ㼶һݿֻm_pCubeVertArrayһ
+	const size_t iArrayBytes = size_t(GM_STAR_CUBE_VERT_NUM) * sizeof(osg::Vec4f);
+	const size_t iBefore = (1 + sizeVector.size()) * iArrayBytes;
+	const size_t iAfter = iArrayBytes;
+	printf("  %zu levels x %d vertices: before %zu bytes, after %zu bytes, saved %zu bytes\n",
+		sizeVector.size(), GM_STAR_CUBE_VERT_NUM, iBefore, iAfter, iBefore - iAfter);
+}
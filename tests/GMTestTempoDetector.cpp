@@ -0,0 +1,236 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestTempoDetector.cpp
+/// @brief		Galaxy-Music Engine - GMTestTempoDetector
+///				BPMĲԣ֪ٶȵĺϳɹĵ㣬ԼƵȷ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMTestLibrary.h"
+#include "GMTempoDetector.h"
+#include "GMAudioAnalyzer.h"
+#include "bass.h"
+#include <random>
+#include <thread>
+#include <chrono>
+#include <map>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* ֪ٶȵĹĵ
+* @param fBPM:			ٶ
+* @param fSec:			ʱλs
+* @param fSampleRate:	ʣλHz
+* @param iStyle:		0ֻе׹ģ1ÿСڵһ2ټϷĵĲ
+* @param iSeed:			
+*/
+static std::vector<float> _MakeClickTrack(const double fBPM, const double fSec, const float fSampleRate,
+	const int iStyle, const unsigned int iSeed)
+{
+	std::mt19937 rng(iSeed);
+	std::normal_distribution<float> noise(0.0f, 1.0f);
+	const size_t iNum = size_t(fSec * fSampleRate);
+	std::vector<float> trackVector(iNum);
+	for (auto& itr : trackVector) itr = 0.02f * noise(rng);
+
+	const double fPeriod = 60.0 / fBPM;
+	int iBeat = 0;
+	for (double t = 0.05; t < fSec; t += fPeriod, iBeat++)
+	{
+		// ׹ģƵʿ½ңָ˥
+		const size_t iStart = size_t(t * fSampleRate);
+		const float fAmp = (iStyle >= 1 && 0 == iBeat % 4) ? 1.0f : 0.6f;
+		for (size_t i = 0; i < size_t(0.08 * fSampleRate) && iStart + i < iNum; i++)
+		{
+			const double fT = i / double(fSampleRate);
+			trackVector[iStart + i] += fAmp * float(std::exp(-fT * 40.0)
+				* std::sin(6.283185307179586 * (60.0 + 120.0 * std::exp(-fT * 30.0)) * fT));
+		}
+		// Ϻ̵ܶ
+		if (iStyle >= 2)
+		{
+			const size_t iHat = size_t((t + fPeriod * 0.5) * fSampleRate);
+			for (size_t i = 0; i < size_t(0.03 * fSampleRate) && iHat + i < iNum; i++)
+			{
+				trackVector[iHat + i] += 0.25f * float(std::exp(-double(i) / fSampleRate * 150.0)) * noise(rng);
+			}
+		}
+	}
+	return trackVector;
+}
+
+/** @brief floatת16λPCMÿֵͬȼ룬ĵʱ */
+static std::vector<int16_t> _ToPcm(const std::vector<float>& monoVector, const int iChans = 1)
+{
+	std::vector<int16_t> pcmVector(monoVector.size() * iChans);
+	for (size_t i = 0; i < monoVector.size(); i++)
+	{
+		const float fValue = (std::max)(-1.0f, (std::min)(1.0f, monoVector[i] * 0.5f));
+		for (int c = 0; c < iChans; c++) pcmVector[i * iChans + c] = int16_t(std::lround(fValue * 32767.0f));
+	}
+	return pcmVector;
+}
+
+/** @brief ȡһȫʱfalse */
+static bool _WaitResults(CGMAudioAnalyzer& analyzer, std::map<std::wstring, SGMAudioAnalysis>& resultMap)
+{
+	const auto tEnd = std::chrono::steady_clock::now() + std::chrono::seconds(120);
+	std::vector<SGMAudioAnalysis> resultVector;
+	while (analyzer.IsRunning())
+	{
+		if (std::chrono::steady_clock::now() > tEnd) return false;
+		analyzer.PopResults(resultVector, 16);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	for (auto& itr : resultVector) resultMap[itr.name] = itr;
+	return true;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(TempoDetector_ClickTracks)
+{
+	CGMTempoDetector detector;
+	const float fSampleRate = 44100.0f;
+	for (int iStyle = 0; iStyle < 3; iStyle++)
+	{
+		int iExact = 0;
+		int iOctave = 0;
+		int iNum = 0;
+		for (double fBPM = 62.0; fBPM < 198.0; fBPM += 7.3, iNum++)
+		{
+			const std::vector<float> trackVector = _MakeClickTrack(fBPM, 60.0, fSampleRate, iStyle, unsigned(fBPM * 10) + iStyle);
+			const double fResult = detector.Detect(trackVector.data(), trackVector.size(), fSampleRate);
+			if (std::abs(fResult - fBPM) <= 1.0)
+				iExact++;
+			else if (std::abs(fResult - 2.0 * fBPM) <= 2.0)
+				iOctave++;
+		}
+		printf("  style %d: %d/%d within 1 BPM, %d/%d at 2x\n", iStyle, iExact, iNum, iOctave, iNum);
+
+		// ֻĵʱ׼ȷĵĲʹܱʶΪ˷ٶȣ
+		if (iStyle < 2)
+			GM_CHECK(iNum == iExact);
+		else
+			GM_CHECK(iNum == iExact + iOctave && iExact * 2 > iNum);
+	}
+}
+
+GM_TEST(TempoDetector_NoRhythm)
+{
+	CGMTempoDetector detector;
+	const float fSampleRate = 44100.0f;
+	const size_t iNum = size_t(60 * fSampleRate);
+
+	std::mt19937 rng(5);
+	std::normal_distribution<float> noise(0.0f, 1.0f);
+	std::vector<float> noiseVector(iNum);
+	for (auto& itr : noiseVector) itr = 0.3f * noise(rng);
+	GM_CHECK(0.0 == detector.Detect(noiseVector.data(), iNum, fSampleRate));
+
+	std::vector<float> toneVector(iNum);
+	for (size_t i = 0; i < iNum; i++) toneVector[i] = 0.5f * float(std::sin(6.283185307179586 * 440.0 * i / fSampleRate));
+	GM_CHECK(0.0 == detector.Detect(toneVector.data(), iNum, fSampleRate));
+
+	// 
+	const std::vector<float> trackVector = _MakeClickTrack(128.0, 60.0, 22050.0f, 2, 1);
+	GM_CHECK_NEAR(128.0, detector.Detect(trackVector.data(), trackVector.size(), 22050.0f), 1.0);
+}
+
+GM_TEST(AudioAnalyzer_ClickTracks)
+{
+	// ͨBASSWAVļǽ롢ȡмһΡΪ
+	BASS_Init(0, 44100, 0, nullptr, nullptr);
+	CGMTestLibrary library("AudioAnalyzer_Click");
+	std::vector<std::wstring> nameVector;
+	std::map<std::wstring, double> bpmMap;
+	for (int i = 0; i < 6; i++)
+	{
+		const double fBPM = 70.0 + 23.0 * i;
+		const std::wstring strName = L"click_" + std::to_wstring(i) + L".wav";
+		GM_CHECK(CGMTestLibrary::WriteWav(library.GetMusicPath() + strName, 44100, 1,
+			_ToPcm(_MakeClickTrack(fBPM, 40.0, 44100.0f, 1, i))));
+		nameVector.push_back(strName);
+		bpmMap[strName] = fBPM;
+	}
+	// ޷ļ
+	GM_CHECK(library.AddFile(L"broken.wav"));
+	nameVector.push_back(L"broken.wav");
+
+	CGMAudioAnalyzer analyzer;
+	const std::string strCache = library.GetPath() + "Core/Users/AudioFeature.cache";
+	GM_CHECK(analyzer.Start(library.GetMusicPath(), nameVector, strCache));
+	// һûн
+	GM_CHECK(!analyzer.Start(library.GetMusicPath(), nameVector, strCache));
+
+	std::map<std::wstring, SGMAudioAnalysis> resultMap;
+	GM_CHECK(_WaitResults(analyzer, resultMap));
+	GM_CHECK(nameVector.size() == resultMap.size());
+	for (auto& itr : bpmMap)
+	{
+		GM_CHECK(resultMap[itr.first].bValid);
+		GM_CHECK_NEAR(itr.second, resultMap[itr.first].sFeature.fBPM, 1.0);
+	}
+	GM_CHECK(!resultMap[L"broken.wav"].bValid);
+	GM_CHECK(0.0f == resultMap[L"broken.wav"].sFeature.fBPM);
+
+	// ;ֹͣ
+	GM_CHECK(analyzer.Start(library.GetMusicPath(), nameVector, strCache));
+	analyzer.Stop();
+	GM_CHECK(!analyzer.IsRunning());
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(TempoDetector_Throughput)
+{
+	CGMTempoDetector detector;
+	const std::vector<float> trackVector = _MakeClickTrack(128.0, 60.0, 44100.0f, 2, 1);
+	const int iRound = 20;
+	double fSum = 0.0;
+	const double fDetect = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iRound; i++) fSum += detector.Detect(trackVector.data(), trackVector.size(), 44100.0f);
+	});
+	GM_CHECK_NEAR(128.0 * iRound, fSum, iRound * 1.0);
+	printf("  detect: %.1f ms per 60 s of 44.1 kHz audio\n", fDetect * 1e3 / iRound);
+
+	//  +  + BPMʹû
+	BASS_Init(0, 44100, 0, nullptr, nullptr);
+	CGMTestLibrary library("TempoDetector_Bench");
+	std::vector<std::wstring> nameVector;
+	for (int i = 0; i < 16; i++)
+	{
+		const std::wstring strName = L"track_" + std::to_wstring(i) + L".wav";
+		CGMTestLibrary::WriteWav(library.GetMusicPath() + strName, 44100, 2,
+			_ToPcm(_MakeClickTrack(80.0 + 7.0 * i, 60.0, 44100.0f, 2, i), 2));
+		nameVector.push_back(strName);
+	}
+	CGMAudioAnalyzer analyzer;
+	std::map<std::wstring, SGMAudioAnalysis> resultMap;
+	const double fBatch = CGMTest::Seconds([&]() {
+		analyzer.Start(library.GetMusicPath(), nameVector, "");
+		_WaitResults(analyzer, resultMap);
+	});
+	GM_CHECK(nameVector.size() == resultMap.size());
+	const unsigned int iCores = std::thread::hardware_concurrency();
+	printf("  analyzer: %zu tracks of 60 s stereo in %.2f s, %.1f tracks/s on %u threads, 1000 tracks in %.1f min\n",
+		nameVector.size(), fBatch, nameVector.size() / fBatch, (iCores > 1) ? iCores - 1 : 1,
+		1000.0 * fBatch / nameVector.size() / 60.0);
+}
@@ -0,0 +1,282 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestThreadPool.cpp
+/// @brief		Galaxy-Music Engine - GMTestThreadPool
+///				̳߳ءڼͽͼƬĲԣ
+///				Լϵķֿܾʽ߳޹
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMThreadPool.h"
+#include "GMKit.h"
+#include <osg/Image>
+#include <random>
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+
+using namespace GM;
+
+/*************************************************************************
+Macro Defines
+*************************************************************************/
+#define GM_TEST_STAR_BLOCK			(4096)			// ÿĺѡϵͬ
+#define GM_TEST_STAR_NUM			(65536)			// ϵ
+
+/*************************************************************************
+Structs
+*************************************************************************/
+
+/**
+* ܵĺѡ
+* @author LiuTao
+* @since 2026.10.18
+*/
+struct SGMTestStar
+{
+	unsigned long long iCandidate;
+	float fU;
+	float fV;
+	osg::Vec4f vColor;
+};
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* ݵͼƬ
+* @param iWidth:		
+* @param iHeight:		߶
+* @param ePixelFormat:	GL_RGBAGL_BGRAGL_RGB
+* @param eDataType:		GL_UNSIGNED_BYTEGL_FLOAT
+* @param iSeed:			
+*/
+static osg::ref_ptr<osg::Image> _MakeImage(const int iWidth, const int iHeight,
+	const GLenum ePixelFormat, const GLenum eDataType, const unsigned int iSeed)
+{
+	const size_t iComps = (GL_RGB == ePixelFormat) ? 3 : 4;
+	const size_t iBytes = (GL_FLOAT == eDataType) ? sizeof(float) : 1;
+	const size_t iSize = size_t(iWidth) * iHeight * iComps;
+	unsigned char* pData = new unsigned char[iSize * iBytes];
+	std::mt19937 rng(iSeed);
+	for (size_t i = 0; i < iSize; i++)
+	{
+		if (GL_FLOAT == eDataType)
+			((float*)pData)[i] = float(rng() % 100001) * 1e-5f;
+		else
+			pData[i] = (unsigned char)(rng() % 256);
+	}
+	osg::ref_ptr<osg::Image> pImage = new osg::Image();
+	pImage->setImage(iWidth, iHeight, 1, int(ePixelFormat), ePixelFormat, eDataType, pData, osg::Image::USE_NEW_DELETE);
+	return pImage;
+}
+
+/**
+* ϵķʽֿܾkѡֻʹük*8+j
+* ÿβмiBlockNumĿ飬ѡ˳ϲȡǰiNumܵĵ
+* @param sImage:		ϵͼƬalphaΪܸ
+* @param iThreadNum:	߳
+* @param iNum:			Ҫĵ
+*/
+static std::vector<SGMTestStar> _SampleStars(const SGMFloatImage& sImage, const unsigned int iThreadNum, const size_t iNum)
+{
+	CGMThreadPool threadPool(iThreadNum);
+	const int iBlockNum = int(threadPool.GetThreadNum()) * 2;
+	std::vector<std::vector<SGMTestStar>> blockVector(iBlockNum);
+	std::vector<SGMTestStar> starVector;
+	unsigned long long iFirstBlock = 0;
+	while (starVector.size() < iNum)
+	{
+		threadPool.ParallelFor(0, iBlockNum, [&](int b)
+		{
+			std::vector<SGMTestStar>& sBlock = blockVector[b];
+			sBlock.clear();
+			const unsigned long long iFirst = (iFirstBlock + b) * GM_TEST_STAR_BLOCK;
+			for (unsigned long long k = iFirst; k < iFirst + GM_TEST_STAR_BLOCK; k++)
+			{
+				const float fU = float(CGMKit::CounterRandom(0, k * 8 + 0) % 10001) * 1e-4f;
+				const float fV = float(CGMKit::CounterRandom(0, k * 8 + 1) % 10001) * 1e-4f;
+				const float fAlpha = float(CGMKit::CounterRandom(0, k * 8 + 2) % 10001) * 1e-4f;
+				const osg::Vec4f vColor = CGMKit::GetImageColor(sImage, fU, fV, true);
+				if (fAlpha < vColor.a()) sBlock.push_back({ k, fU, fV, vColor });
+			}
+		});
+		for (int b = 0; b < iBlockNum && starVector.size() < iNum; b++)
+		{
+			for (size_t i = 0; i < blockVector[b].size() && starVector.size() < iNum; i++)
+			{
+				starVector.push_back(blockVector[b][i]);
+			}
+		}
+		iFirstBlock += iBlockNum;
+	}
+	return starVector;
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(ThreadPool_ParallelFor)
+{
+	for (const unsigned int iThreadNum : { 1u, 2u, 3u, 4u, 8u })
+	{
+		CGMThreadPool threadPool(iThreadNum);
+		GM_CHECK(iThreadNum == threadPool.GetThreadNum());
+
+		// ÿִһΣ̳֮߳ر
+		int iWrong = 0;
+		for (int r = 0; r < 2000; r++)
+		{
+			const int iBegin = r % 5 - 2;
+			const int iEnd = iBegin + r % 37 + 1;
+			std::vector<std::atomic<int>> countVector(iEnd - iBegin);
+			for (auto& itr : countVector) itr.store(0);
+			threadPool.ParallelFor(iBegin, iEnd, [&](int i) { countVector[i - iBegin].fetch_add(1); });
+			for (auto& itr : countVector)
+			{
+				if (1 != itr.load()) iWrong++;
+			}
+		}
+		GM_CHECK(0 == iWrong);
+
+		// շΧ
+		int iCalled = 0;
+		threadPool.ParallelFor(5, 5, [&](int) { iCalled++; });
+		threadPool.ParallelFor(5, 2, [&](int) { iCalled++; });
+		GM_CHECK(0 == iCalled);
+	}
+
+	// 0ʾӲ߳
+	CGMThreadPool threadPool;
+	GM_CHECK(1 <= threadPool.GetThreadNum());
+}
+
+GM_TEST(ThreadPool_CounterRandom)
+{
+	// ͬӺͼõֵͬͬӵõͬ
+	GM_CHECK(CGMKit::CounterRandom(7, 123) == CGMKit::CounterRandom(7, 123));
+	int iSame = 0;
+	for (unsigned long long k = 0; k < 1000; k++)
+	{
+		if (CGMKit::CounterRandom(0, k) == CGMKit::CounterRandom(1, k)) iSame++;
+	}
+	GM_CHECK(0 == iSame);
+
+	// ļÿһλԼһΪ1ȡģͰ
+	const int iNum = 1 << 20;
+	std::vector<int> bitVector(64, 0);
+	std::vector<int> bucketVector(16, 0);
+	for (int k = 0; k < iNum; k++)
+	{
+		const unsigned long long iValue = CGMKit::CounterRandom(0, k);
+		for (int b = 0; b < 64; b++) bitVector[b] += int((iValue >> b) & 1);
+		bucketVector[(iValue % 10001) * 16 / 10001]++;
+	}
+	for (int b = 0; b < 64; b++) GM_CHECK_NEAR(0.5, double(bitVector[b]) / iNum, 0.005);
+	for (int i = 0; i < 16; i++) GM_CHECK_NEAR(1.0, double(bucketVector[i]) * 16 / iNum, 0.02);
+}
+
+GM_TEST(Kit_DecodeImage)
+{
+	// Ĳosg::ImageĲλͬ8λRGBA8λBGRAԼgetColorĸRGB
+	const GLenum vFormat[3][2] = { { GL_RGBA, GL_UNSIGNED_BYTE }, { GL_BGRA, GL_UNSIGNED_BYTE }, { GL_RGB, GL_FLOAT } };
+	for (int f = 0; f < 3; f++)
+	{
+		osg::ref_ptr<osg::Image> pImage = _MakeImage(97, 61, vFormat[f][0], vFormat[f][1], f + 1);
+		SGMFloatImage sImage;
+		GM_CHECK(CGMKit::DecodeImage(pImage.get(), sImage));
+		GM_CHECK(97 == sImage.iWidth && 61 == sImage.iHeight);
+
+		std::mt19937 rng(f);
+		int iDiff = 0;
+		for (int i = 0; i < 200000; i++)
+		{
+			// ߽ͳΧ
+			const float fX = float(int(rng() % 120001) - 10000) * 1e-5f;
+			const float fY = float(int(rng() % 120001) - 10000) * 1e-5f;
+			const bool bLinear = (0 != (i & 1));
+			const osg::Vec4f vA = CGMKit::GetImageColor(pImage.get(), fX, fY, bLinear);
+			const osg::Vec4f vB = CGMKit::GetImageColor(sImage, fX, fY, bLinear);
+			if (0 != std::memcmp(&vA, &vB, sizeof(vA))) iDiff++;
+		}
+		GM_CHECK(0 == iDiff);
+	}
+
+	SGMFloatImage sEmpty;
+	GM_CHECK(!CGMKit::DecodeImage(nullptr, sEmpty));
+	GM_CHECK(sEmpty.texelVector.empty());
+	GM_CHECK(osg::Vec4f(0, 0, 0, 0) == CGMKit::GetImageColor(sEmpty, 0.5f, 0.5f, true));
+}
+
+GM_TEST(ThreadPool_SampleStars)
+{
+	// κ߳õλͬĵ㣬ظҲͬ
+	SGMFloatImage sImage;
+	GM_CHECK(CGMKit::DecodeImage(_MakeImage(256, 256, GL_RGBA, GL_UNSIGNED_BYTE, 9).get(), sImage));
+	const std::vector<SGMTestStar> refVector = _SampleStars(sImage, 1, GM_TEST_STAR_NUM);
+	GM_CHECK(GM_TEST_STAR_NUM == refVector.size());
+	for (const unsigned int iThreadNum : { 1u, 2u, 3u, 4u, 7u, 8u, 16u })
+	{
+		const std::vector<SGMTestStar> starVector = _SampleStars(sImage, iThreadNum, GM_TEST_STAR_NUM);
+		GM_CHECK(refVector.size() == starVector.size());
+		GM_CHECK(0 == std::memcmp(refVector.data(), starVector.data(), refVector.size() * sizeof(SGMTestStar)));
+	}
+
+	// ѡ㰴˳򱻽
+	int iWrong = 0;
+	for (size_t i = 1; i < refVector.size(); i++)
+	{
+		if (refVector[i].iCandidate <= refVector[i - 1].iCandidate) iWrong++;
+	}
+	GM_CHECK(0 == iWrong);
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(ThreadPool_StarScaling)
+{
+	osg::ref_ptr<osg::Image> pImage = _MakeImage(1024, 1024, GL_RGBA, GL_UNSIGNED_BYTE, 3);
+	SGMFloatImage sImage;
+	const double fDecode = CGMTest::Seconds([&]() { CGMKit::DecodeImage(pImage.get(), sImage); });
+
+	// ÿξosg::Image::getColorֱӶȡ
+	const int iSamples = 2000000;
+	float fSumA = 0.0f;
+	float fSumB = 0.0f;
+	const double fOsg = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iSamples; i++)
+		{
+			fSumA += CGMKit::GetImageColor(pImage.get(), (i % 1000) * 1e-3f, (i / 1000 % 1000) * 1e-3f, true).a();
+		}
+	});
+	const double fDecoded = CGMTest::Seconds([&]() {
+		for (int i = 0; i < iSamples; i++)
+		{
+			fSumB += CGMKit::GetImageColor(sImage, (i % 1000) * 1e-3f, (i / 1000 % 1000) * 1e-3f, true).a();
+		}
+	});
+	GM_CHECK(fSumA == fSumB);
+	printf("  decode 1024x1024 %.2f ms, bilinear sample: osg::Image %.1f ns, decoded %.1f ns\n",
+		fDecode * 1e3, fOsg * 1e9 / iSamples, fDecoded * 1e9 / iSamples);
+
+	// 65536ϵ㣬1̵߳ȫӲ߳
+	const unsigned int iCores = (std::max)(1u, std::thread::hardware_concurrency());
+	double fOne = 0.0;
+	for (unsigned int iThreadNum = 1; ; iThreadNum = (std::min)(iThreadNum * 2, iCores))
+	{
+		const double fTime = CGMTest::Seconds([&]() { _SampleStars(sImage, iThreadNum, GM_TEST_STAR_NUM); });
+		if (1 == iThreadNum) fOne = fTime;
+		printf("  %d stars on %2u threads: %.2f ms, %.2fx\n", GM_TEST_STAR_NUM, iThreadNum, fTime * 1e3, fOne / fTime);
+		if (iCores == iThreadNum) break;
+	}
+}
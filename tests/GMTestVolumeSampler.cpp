@@ -0,0 +1,266 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		GMTestVolumeSampler.cpp
+/// @brief		Galaxy-Music Engine - GMTestVolumeSampler
+///				άͼƬĲԣԭosg::Image::getColorԲΪգ
+///				SSEAVX2·Ľλһ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.18
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include "GMVolumeSampler.h"
+#include <osg/Image>
+#include <random>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+
+using namespace GM;
+
+/*************************************************************************
+Static Functions
+*************************************************************************/
+
+/**
+* ݵ8λRGBAͼƬ
+* @param iWidth, iHeight, iDepth:	ߴ
+* @param iSeed:						
+*/
+static osg::ref_ptr<osg::Image> _MakeImage(const int iWidth, const int iHeight, const int iDepth, const unsigned int iSeed)
+{
+	const size_t iSize = size_t(iWidth) * iHeight * iDepth * 4;
+	unsigned char* pData = new unsigned char[iSize];
+	std::mt19937 rng(iSeed);
+	for (size_t i = 0; i < iSize; i++) pData[i] = (unsigned char)(rng() % 256);
+	osg::ref_ptr<osg::Image> pImage = new osg::Image();
+	pImage->setImage(iWidth, iHeight, iDepth, GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, pData, osg::Image::USE_NEW_DELETE);
+	return pImage;
+}
+
+/** @brief գԭCGMGalaxy::_Get3DValueÿδӴĶάͼжһ */
+static float _ReferenceValue(const osg::Image* pImg, const unsigned int iSize,
+	const unsigned int iX, const unsigned int iY, const unsigned int iZ)
+{
+	const unsigned int iLayerNum = iSize / 4;
+	return pImg->getColor(iX, iY + (iZ % iLayerNum) * iSize)[iZ / iLayerNum];
+}
+
+/** @brief գԭCGMGalaxy::_Get3DValueԲֵrepeatģʽ */
+static float _ReferenceSample(const osg::Image* pImg, const unsigned int iSize, const float fX, const float fY, const float fZ)
+{
+	float fS = std::fmod(fX, 1.0f) * iSize;
+	float fT = std::fmod(fY, 1.0f) * iSize;
+	float fR = std::fmod(fZ, 1.0f) * iSize;
+	float fDeltaS = fS - (int)fS;
+	float fDeltaT = fT - (int)fT;
+	float fDeltaR = fR - (int)fR;
+	unsigned int s = (unsigned int)fS;
+	unsigned int t = (unsigned int)fT;
+	unsigned int r = (unsigned int)fR;
+	unsigned int s_next = (s == iSize - 1) ? 0 : s + 1;
+	unsigned int t_next = (t == iSize - 1) ? 0 : t + 1;
+	unsigned int r_next = (r == iSize - 1) ? 0 : r + 1;
+
+	float fValue_000 = _ReferenceValue(pImg, iSize, s, t, r);
+	float fValue_100 = _ReferenceValue(pImg, iSize, s_next, t, r);
+	float fValue_010 = _ReferenceValue(pImg, iSize, s, t_next, r);
+	float fValue_110 = _ReferenceValue(pImg, iSize, s_next, t_next, r);
+	float fValue_001 = _ReferenceValue(pImg, iSize, s, t, r_next);
+	float fValue_101 = _ReferenceValue(pImg, iSize, s_next, t, r_next);
+	float fValue_011 = _ReferenceValue(pImg, iSize, s, t_next, r_next);
+	float fValue_111 = _ReferenceValue(pImg, iSize, s_next, t_next, r_next);
+	return (fValue_000 * (1 - fDeltaS) * (1 - fDeltaT) + fValue_100 * fDeltaS * (1 - fDeltaT)
+		+ fValue_010 * (1 - fDeltaS) * fDeltaT + fValue_110 * fDeltaS * fDeltaT) * (1 - fDeltaR)
+		+ (fValue_001 * (1 - fDeltaS) * (1 - fDeltaT) + fValue_101 * fDeltaS * (1 - fDeltaT)
+		+ fValue_011 * (1 - fDeltaS) * fDeltaT + fValue_111 * fDeltaS * fDeltaT) * fDeltaR;
+}
+
+/**
+* ɷǸĲ꣺N_4ϵķֲꡢ1.0ıֵ߽
+* @param iNum:			
+* @param xVector, yVector, zVector:	
+*/
+static void _MakeCoords(const size_t iNum, std::vector<float>& xVector, std::vector<float>& yVector, std::vector<float>& zVector)
+{
+	xVector.resize(iNum);
+	yVector.resize(iNum);
+	zVector.resize(iNum);
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<> iPseudoNoise(0, 10000);
+	for (size_t i = 0; i < iNum; i++)
+	{
+		const float fScale = (0 == i % 3) ? 2.0f : ((1 == i % 3) ? 1.0f : 7.3f);
+		if (0 == i % 17)
+		{
+			xVector[i] = float(rng() % 9);
+			yVector[i] = 1.0f - 1e-7f * float(rng() % 4);
+			zVector[i] = std::nextafter(1.0f, 0.0f);
+		}
+		else if (0 == i % 5)
+		{
+			xVector[i] = float(rng() % 1000000) * 1e-3f;
+			yVector[i] = float(rng() % 100000) * 1.37e-3f;
+			zVector[i] = float(rng()) * 1e-4f;
+		}
+		else
+		{
+			xVector[i] = iPseudoNoise(rng) * 1e-4f * fScale;
+			yVector[i] = iPseudoNoise(rng) * 1e-4f * fScale;
+			zVector[i] = iPseudoNoise(rng) * 1e-4f;
+		}
+	}
+}
+
+/*************************************************************************
+Tests
+*************************************************************************/
+
+GM_TEST(VolumeSampler_PackedAgainstReference)
+{
+	const unsigned int iSize = 32;
+	osg::ref_ptr<osg::Image> pImage = _MakeImage(iSize, iSize * iSize / 4, 1, 1);
+	CGMVolumeSampler sampler;
+	GM_CHECK(!sampler.IsValid());
+	GM_CHECK(!sampler.DecodePacked(pImage.get(), 16));
+	GM_CHECK(!sampler.DecodePacked(pImage.get(), 30));
+	GM_CHECK(sampler.DecodePacked(pImage.get(), iSize));
+	GM_CHECK(sampler.IsValid());
+
+	std::vector<float> xVector, yVector, zVector;
+	_MakeCoords(200000, xVector, yVector, zVector);
+	int iDiff = 0;
+	for (size_t i = 0; i < xVector.size(); i++)
+	{
+		const float fA = _ReferenceSample(pImage.get(), iSize, xVector[i], yVector[i], zVector[i]);
+		const float fB = sampler.Sample(xVector[i], yVector[i], zVector[i]);
+		if (0 != std::memcmp(&fA, &fB, sizeof(float))) iDiff++;
+	}
+	GM_CHECK(0 == iDiff);
+}
+
+GM_TEST(VolumeSampler_BatchPaths)
+{
+	const unsigned int iSize = 32;
+	osg::ref_ptr<osg::Image> pImage = _MakeImage(iSize, iSize * iSize / 4, 1, 2);
+	CGMVolumeSampler sampler;
+	GM_CHECK(sampler.DecodePacked(pImage.get(), iSize));
+
+	const size_t iNum = 100003;
+	std::vector<float> xVector, yVector, zVector;
+	_MakeCoords(iNum, xVector, yVector, zVector);
+	std::vector<float> refVector(iNum);
+	for (size_t i = 0; i < iNum; i++) refVector[i] = sampler.Sample(xVector[i], yVector[i], zVector[i]);
+
+	// ÿ·ֲͲ48뵥λһ
+	std::vector<float> outVector(iNum);
+	for (int iLevel = 0; iLevel < 3; iLevel++)
+	{
+		sampler.SetSIMD(iLevel);
+		GM_CHECK(sampler.GetSIMD() <= iLevel);
+		for (const size_t iOffset : { 0, 1, 3, 5, 7 })
+		{
+			const size_t iCount = iNum - iOffset - iOffset % 4;
+			std::fill(outVector.begin(), outVector.end(), -1.0f);
+			sampler.Sample(xVector.data() + iOffset, yVector.data() + iOffset, zVector.data() + iOffset, outVector.data(), iCount);
+			GM_CHECK(0 == std::memcmp(outVector.data(), refVector.data() + iOffset, iCount * sizeof(float)));
+			GM_CHECK(iCount == iNum || -1.0f == outVector[iCount]);
+		}
+	}
+
+	// ꣺·һ£[0,1]
+	for (size_t i = 0; i < iNum; i++)
+	{
+		xVector[i] = -xVector[i];
+		if (i % 2) yVector[i] = -yVector[i] - 1e-9f;
+	}
+	sampler.SetSIMD(0);
+	sampler.Sample(xVector.data(), yVector.data(), zVector.data(), refVector.data(), iNum);
+	for (int iLevel = 1; iLevel < 3; iLevel++)
+	{
+		sampler.SetSIMD(iLevel);
+		sampler.Sample(xVector.data(), yVector.data(), zVector.data(), outVector.data(), iNum);
+		GM_CHECK(0 == std::memcmp(outVector.data(), refVector.data(), iNum * sizeof(float)));
+	}
+	int iOutside = 0;
+	for (const float fValue : refVector)
+	{
+		if (!(fValue >= 0.0f && fValue <= 1.0f)) iOutside++;
+	}
+	GM_CHECK(0 == iOutside);
+
+	// δʱ0
+	CGMVolumeSampler empty;
+	GM_CHECK(0.0f == empty.Sample(0.5f, 0.5f, 0.5f));
+	empty.Sample(xVector.data(), yVector.data(), zVector.data(), outVector.data(), 13);
+	for (int i = 0; i < 13; i++) GM_CHECK(0.0f == outVector[i]);
+}
+
+GM_TEST(VolumeSampler_Decode3D)
+{
+	// ͨάͼƬصĸϲõرߴ粻ͬ
+	osg::ref_ptr<osg::Image> pImage = _MakeImage(8, 4, 16, 3);
+	CGMVolumeSampler sampler;
+	GM_CHECK(!sampler.Decode(pImage.get(), 4));
+	GM_CHECK(!sampler.Decode(nullptr, 0));
+	for (int iChannel = 0; iChannel < 4; iChannel++)
+	{
+		GM_CHECK(sampler.Decode(pImage.get(), iChannel));
+		int iDiff = 0;
+		for (int r = 0; r < 16; r++)
+		{
+			for (int t = 0; t < 4; t++)
+			{
+				for (int s = 0; s < 8; s++)
+				{
+					const float fValue = sampler.Sample(s / 8.0f, t / 4.0f + 3.0f, r / 16.0f);
+					if (fValue != pImage->getColor(s, t, r)[iChannel]) iDiff++;
+				}
+			}
+		}
+		GM_CHECK(0 == iDiff);
+	}
+	// мƽֵһһ֮䰴repeatֵ
+	const float fA = pImage->getColor(7, 0, 0)[3];
+	const float fB = pImage->getColor(0, 0, 0)[3];
+	GM_CHECK_NEAR(0.5f * (fA + fB), sampler.Sample(7.5f / 8.0f, 0.0f, 0.0f), 1e-6);
+}
+
+/*************************************************************************
+Benchmarks
+*************************************************************************/
+
+GM_BENCH(VolumeSampler_Paths)
+{
+	// еͼߴͬ128^3
+	const unsigned int iSize = 128;
+	osg::ref_ptr<osg::Image> pImage = _MakeImage(iSize, iSize * iSize / 4, 1, 4);
+	CGMVolumeSampler sampler;
+	const double fDecode = CGMTest::Seconds([&]() { sampler.DecodePacked(pImage.get(), iSize); });
+
+	const size_t iNum = 1 << 20;
+	std::vector<float> xVector, yVector, zVector;
+	_MakeCoords(iNum, xVector, yVector, zVector);
+	std::vector<float> refVector(iNum);
+	const double fReference = CGMTest::Seconds([&]() {
+		for (size_t i = 0; i < iNum; i++) refVector[i] = _ReferenceSample(pImage.get(), iSize, xVector[i], yVector[i], zVector[i]);
+	});
+	printf("  decode 128^3 %.2f ms, osg::Image::getColor path %.1f M samples/s\n", fDecode * 1e3, iNum / fReference * 1e-6);
+
+	std::vector<float> outVector(iNum);
+	const char* vName[3] = { "scalar", "SSE", "AVX2" };
+	for (int iLevel = 0; iLevel < 3; iLevel++)
+	{
+		sampler.SetSIMD(iLevel);
+		if (sampler.GetSIMD() != iLevel) continue;
+		const double fTime = CGMTest::Seconds([&]() {
+			sampler.Sample(xVector.data(), yVector.data(), zVector.data(), outVector.data(), iNum);
+		});
+		GM_CHECK(0 == std::memcmp(outVector.data(), refVector.data(), iNum * sizeof(float)));
+		printf("  batch %-6s %.1f M samples/s, %.1fx\n", vName[iLevel], iNum / fTime * 1e-6, fReference / fTime);
+	}
+}
@@ -0,0 +1,62 @@
+//////////////////////////////////////////////////////////////////////////
+/// COPYRIGHT NOTICE
+/// Copyright (c) 2020~2030, LiuTao
+/// All rights reserved.
+///
+/// @file		main.cpp
+/// @brief		Galaxy-Music Engine - GMTests
+///				ģĵԪԺͻ׼ԣֵΪʧܵļ
+/// @version	1.0
+/// @author		LiuTao
+/// @date		2026.10.17
+//////////////////////////////////////////////////////////////////////////
+
+#include "GMTest.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+using namespace GM;
+
+/** @brief ӡ÷ */
+static void _PrintUsage()
+{
+	printf("Usage: GMTests [-bench] [-filter <name>] [-data <dataPath>]\n");
+	printf("  -bench     run benchmarks instead of tests\n");
+	printf("  -filter    only run tests whose name contains <name>\n");
+	printf("  -data      test data path, default: ../../tests/Data/\n");
+}
+
+int main(int argc, char **argv)
+{
+	std::string strFilter = "";
+	bool bBench = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == strcmp(argv[i], "-bench"))
+		{
+			bBench = true;
+		}
+		else if (0 == strcmp(argv[i], "-filter") && i + 1 < argc)
+		{
+			strFilter = argv[++i];
+		}
+		else if (0 == strcmp(argv[i], "-data") && i + 1 < argc)
+		{
+			CGMTest::SetDataPath(argv[++i]);
+		}
+		else
+		{
+			_PrintUsage();
+			return 1;
+		}
+	}
+
+	// VSеʱĿ¼tests/
+	std::error_code ec;
+	if (!std::filesystem::exists(CGMTest::GetDataPath(), ec) && std::filesystem::exists("Data/", ec))
+		CGMTest::SetDataPath("Data/");
+
+	return CGMTest::Run(strFilter, bBench);
+}